@@ -22,6 +22,7 @@
 
 #include <glib/gi18n-lib.h>
 #include <string.h>
+#include <errno.h>
 #include "gda-report-engine.h"
 #include <libgda/gda-data-model.h>
 #include <libgda/gda-data-model-iter.h>
@@ -57,8 +58,53 @@ typedef struct {
 	xmlNodePtr    result;
 	GHashTable   *objects;
 	gchar        *output_dir;
+
+	GdaConnection *vcnc; /* virtual connection used to evaluate expressions, created when needed */
+	GHashTable   *parsed; /* key = a #GdaSqlParser, value = a #ParserCache */
 } GdaReportEnginePrivate;
 
+/*
+ * Statements and expressions parsed by a parser, which are reused each time the same SQL is
+ * found in the report's specifications, instead of being parsed again
+ */
+typedef struct _ExprNode ExprNode;
+typedef struct {
+	GdaStatement *stmt;     /* "SELECT <expression>" */
+	GSList       *untyped;  /* names of @stmt's parameters which don't have any type specified */
+	GdaStatement *rstmt;    /* @stmt rewritten using @rtypes as the @untyped parameters' types, or %NULL */
+	GArray       *rtypes;   /* array of GType */
+	ExprNode     *native;   /* the expression compiled to be evaluated without any SQL, or %NULL */
+} CompiledExpr;
+
+typedef struct {
+	GHashTable   *statements;  /* key = SQL, value = a #GdaStatement */
+	GHashTable   *expressions; /* key = expression, value = a #CompiledExpr */
+} ParserCache;
+
+static void expr_node_free (ExprNode *node);
+
+static void
+compiled_expr_free (CompiledExpr *cexpr)
+{
+	g_object_unref (cexpr->stmt);
+	g_slist_free_full (cexpr->untyped, g_free);
+	if (cexpr->rstmt)
+		g_object_unref (cexpr->rstmt);
+	if (cexpr->rtypes)
+		g_array_free (cexpr->rtypes, TRUE);
+	if (cexpr->native)
+		expr_node_free (cexpr->native);
+	g_free (cexpr);
+}
+
+static void
+parser_cache_free (ParserCache *pcache)
+{
+	g_hash_table_destroy (pcache->statements);
+	g_hash_table_destroy (pcache->expressions);
+	g_free (pcache);
+}
+
 G_DEFINE_TYPE_WITH_PRIVATE (GdaReportEngine, gda_report_engine, G_TYPE_OBJECT)
 
 /* properties */
@@ -123,6 +169,9 @@ gda_report_engine_init (GdaReportEngine *eng)
 	GdaReportEnginePrivate *priv = gda_report_engine_get_instance_private (eng);
 	priv->objects = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_object_unref);
 	priv->output_dir = NULL;
+	priv->vcnc = NULL;
+	priv->parsed = g_hash_table_new_full (g_direct_hash, g_direct_equal, g_object_unref,
+					      (GDestroyNotify) parser_cache_free);
 }
 
 static void
@@ -153,6 +202,16 @@ gda_report_engine_dispose (GObject *object)
 		priv->output_dir = NULL;
 	}
 
+	if (priv->parsed) {
+		g_hash_table_destroy (priv->parsed);
+		priv->parsed = NULL;
+	}
+
+	if (priv->vcnc) {
+		g_object_unref (priv->vcnc);
+		priv->vcnc = NULL;
+	}
+
 	/* chain to parent class */
 	G_OBJECT_CLASS (gda_report_engine_parent_class)->dispose (object);
 }
@@ -428,6 +487,9 @@ struct _RunContext {
 	GdaStatement       *stmt;
 	GdaDataModel       *model;
 	GdaDataModelIter   *iter;
+
+	gboolean            iterating; /* TRUE while a <gda_report_iter> node moves @iter */
+	GHashTable         *prefetches; /* key = a #GdaStatement, value = a #Prefetch, or %NULL */
 };
 static GdaHolder *run_context_find_param (GdaReportEngine *engine, RunContext *context, const xmlChar *name);
 static GdaStatement *run_context_find_stmt (GdaReportEngine *engine, RunContext *context, const xmlChar *name);
@@ -447,6 +509,10 @@ static gboolean command_gda_report_if (GdaReportEngine *engine, xmlNodePtr node,
 static GdaStatement *rewrite_statement (GdaReportEngine *engine, RunContext *context, GdaStatement *stmt, GError **error);
 static gboolean assign_parameters_values (GdaReportEngine *engine, RunContext *context, GdaSet *plist, GError **error);
 static GValue *evaluate_expression (GdaReportEngine *engine, RunContext *context, const gchar *expr, GError **error);
+static GdaStatement *parse_statement (GdaReportEngine *engine, GdaConnection *cnc, const gchar *sql, GError **error);
+static GdaDataModel *run_context_prefetched_model (GdaReportEngine *engine, RunContext *context, GdaConnection *cnc,
+						   GdaStatement *stmt);
+static void prefetch_free (gpointer data);
 static xmlNodePtr value_to_node (GdaReportEngine *engine, RunContext *context, const GValue *value, GdaSet *options);
 
 /*
@@ -603,7 +669,7 @@ command_gda_report_section_run (GdaReportEngine *engine, xmlNodePtr node, GSList
 				GdaStatement *stmt;
 				xmlChar *prop;
 				GdaConnection *cnc = NULL;
-				GdaSqlParser *parser = NULL;
+				xmlChar *sql;
 
 				/* find which connection to use */
 				prop = xmlGetProp (child, BAD_CAST "cnc_name");
@@ -619,18 +685,12 @@ command_gda_report_section_run (GdaReportEngine *engine, xmlNodePtr node, GSList
 							     _("No connection specified"));
 					return FALSE;
 				}
-				
-				/* parser object */
-				parser = g_object_get_data (G_OBJECT (cnc), "__gda_parser");
-				if (!parser) {
-					parser = gda_connection_create_parser (cnc);
-					g_object_set_data_full (G_OBJECT (cnc), "__gda_parser", 
-								parser, g_object_unref);
-				}
-				
-				/* statement */
-				stmt = gda_sql_parser_parse_string (parser, (gchar *) xmlNodeGetContent (child), 
-								    NULL, error);
+
+				/* statement, parsed only once even if the section is run for each row of
+				 * an enclosing section */
+				sql = xmlNodeGetContent (child);
+				stmt = parse_statement (engine, cnc, (gchar *) sql, error);
+				xmlFree (sql);
 				if (!stmt)
 					return FALSE;
 
@@ -644,11 +704,9 @@ command_gda_report_section_run (GdaReportEngine *engine, xmlNodePtr node, GSList
 					ctx = run_context_push_with_stmt (engine, context, cnc,
 									  stmt, "context", error);
 				if (ctx)
-					ctx->stmt = stmt;
-				else {
-					g_object_unref (stmt);
+					ctx->stmt = g_object_ref (stmt);
+				else
 					return FALSE;
-				}
 				break;
 			}
 		}
@@ -694,9 +752,14 @@ static gboolean
 command_gda_report_iter_run (GdaReportEngine *engine, xmlNodePtr node, GSList **created_nodes,
 			     RunContext *context, GError **error)
 {
+	gboolean iterating;
 	if (!context || !context->iter)
 		return TRUE;
 
+	/* sections run while iterating may fetch the rows for several iterations at once */
+	iterating = context->iterating;
+	context->iterating = TRUE;
+
 	gda_data_model_iter_move_next (context->iter);
 	while (gda_data_model_iter_is_valid (context->iter)) {
 		xmlNodePtr dup, child;
@@ -704,6 +767,7 @@ command_gda_report_iter_run (GdaReportEngine *engine, xmlNodePtr node, GSList **
 				
 		if (!real_run_at_node (engine, dup->children, context, error)) {
 			xmlFreeNode (dup);
+			context->iterating = iterating;
 			return FALSE;
 		}
 		else {
@@ -715,6 +779,7 @@ command_gda_report_iter_run (GdaReportEngine *engine, xmlNodePtr node, GSList **
 		xmlFreeNode (dup);
 		gda_data_model_iter_move_next (context->iter);
 	}
+	context->iterating = iterating;
 
 	*created_nodes = g_slist_reverse (*created_nodes);
 
@@ -730,30 +795,36 @@ static RunContext *
 run_context_push_with_stmt (GdaReportEngine *engine, RunContext *context, GdaConnection *cnc, 
 			    GdaStatement *stmt, const gchar *stmt_name, GError **error)
 {
-	GdaDataModel *model;
-	GdaSet *plist;
-	GdaStatement *lstmt;
-	lstmt = rewrite_statement (engine, context, stmt, error);
-	if (!lstmt)
-		return NULL;
+	GdaDataModel *model = NULL;
 
 	g_assert (cnc);
-	if (!gda_statement_get_parameters (lstmt, &plist, error)) {
-		g_object_unref (lstmt);
-		return NULL;
-	}
+	if (context && context->iterating)
+		model = run_context_prefetched_model (engine, context, cnc, stmt);
+
+	if (!model) {
+		GdaSet *plist;
+		GdaStatement *lstmt;
+		lstmt = rewrite_statement (engine, context, stmt, error);
+		if (!lstmt)
+			return NULL;
 
-	if (plist && !assign_parameters_values (engine, context, plist, error)) {
-		g_object_unref (plist);
+		if (!gda_statement_get_parameters (lstmt, &plist, error)) {
+			g_object_unref (lstmt);
+			return NULL;
+		}
+
+		if (plist && !assign_parameters_values (engine, context, plist, error)) {
+			g_object_unref (plist);
+			g_object_unref (lstmt);
+			return NULL;
+		}
+		model = gda_connection_statement_execute_select (cnc, lstmt, plist, error);
+		if (plist)
+			g_object_unref (plist);
 		g_object_unref (lstmt);
-		return NULL;
+		if (!model) 
+			return NULL;
 	}
-	model = gda_connection_statement_execute_select (cnc, lstmt, plist, error);
-	if (plist)
-		g_object_unref (plist);
-	g_object_unref (lstmt);
-	if (!model) 
-		return NULL;
 	g_object_set_data_full (G_OBJECT (model), "name", g_strdup (stmt_name), g_free);
 		
 	/* add a parameter for the number of rows, attached to model */
@@ -766,6 +837,7 @@ run_context_push_with_stmt (GdaReportEngine *engine, RunContext *context, GdaCon
 	if (! gda_holder_set_value (param, value, error)) {
 		g_object_unref (param);
 		gda_value_free (value);
+		g_object_unref (model);
 		return NULL;
 	}
 	gda_value_free (value);
@@ -795,6 +867,8 @@ run_context_pop (G_GNUC_UNUSED GdaReportEngine *engine, RunContext *context)
 	/*g_print ("<<<< POP CONTEXT %p\n", context);*/
 	if (context->stmt)
 		g_object_unref (context->stmt);
+	if (context->prefetches)
+		g_hash_table_destroy (context->prefetches);
 	g_object_unref (context->iter);
 	g_object_unref (context->model);
 	g_free (context);
@@ -866,12 +940,15 @@ command_gda_report_eval_expr (GdaReportEngine *engine, xmlNodePtr node, GSList *
 {
 	GValue *value;
 	xmlNodePtr child;
+	xmlChar *expr;
 
-	value = evaluate_expression (engine, context, 
-				     (const gchar *) xmlNodeGetContent (node), error);
+	expr = xmlNodeGetContent (node);
+	value = evaluate_expression (engine, context, (const gchar *) expr, error);
+	xmlFree (expr);
 	if (!value)
 		return FALSE;
 	child = value_to_node (engine, context, value, NULL);
+	gda_value_free (value);
 	*created_nodes = g_slist_prepend (NULL, child);
 
 	return TRUE;
@@ -904,10 +981,10 @@ command_gda_report_if (GdaReportEngine *engine, xmlNodePtr node, GSList **create
 	/* evaluate expression as boolean */
 	value = evaluate_expression (engine, context, 
 				     (const gchar *) prop, error);
+	xmlFree (prop);
 	if (!value)
 		return FALSE;
-	xmlFree (prop);
-	if (value && !gda_value_is_null (value)) {
+	if (!gda_value_is_null (value)) {
 		if (G_VALUE_TYPE (value) == G_TYPE_BOOLEAN)
 			expr_is_true = g_value_get_boolean (value);
 		else {
@@ -922,11 +999,12 @@ command_gda_report_if (GdaReportEngine *engine, xmlNodePtr node, GSList **create
 				g_set_error (error, GDA_REPORT_ENGINE_ERROR, GDA_REPORT_ENGINE_GENERAL_ERROR,
 					     _("Cannot cast value from type '%s' to type '%s'"), 
 					     g_type_name (G_VALUE_TYPE (value)), g_type_name (G_TYPE_BOOLEAN));
+				gda_value_free (value);
 				return FALSE;
 			}
 		}
-		gda_value_free (value);
 	}
+	gda_value_free (value);
 	/*g_print ("IF Expression evaluates to %d\n", expr_is_true);*/
 
 	/* find the correct sub node: <gda_report_if_true> or <gda_report_if_false> */
@@ -1011,6 +1089,9 @@ rewrite_statement (GdaReportEngine *engine, RunContext *context,
 	return out_stmt;
 }
 
+/* prefix of the parameters holding the keys for which a nested section's rows are prefetched */
+#define PREFETCH_PARAM_PREFIX "__gda_report_key"
+
 /*
  * assign_parameters_values
  *
@@ -1025,6 +1106,8 @@ assign_parameters_values (GdaReportEngine *engine, RunContext *context, GdaSet *
 		GSList *list;
 		for (list = gda_set_get_holders (plist); list; list = list->next) {
 			GdaHolder *source_param;
+			if (g_str_has_prefix (gda_holder_get_id (GDA_HOLDER (list->data)), PREFETCH_PARAM_PREFIX))
+				continue; /* set by prefetch_run_batch() */
 			source_param = run_context_find_param (engine, context, 
 							       BAD_CAST gda_holder_get_id (GDA_HOLDER (list->data)));
 			if (!source_param) {
@@ -1073,85 +1156,842 @@ assign_parameters_values (GdaReportEngine *engine, RunContext *context, GdaSet *
 }
 
 /*
- * evaluate_expression
+ * get_parser
  *
- * Evaluates the @expr expression, which must be a valid SQLite expression
+ * Returns: (transfer none): the #GdaSqlParser to use with @cnc
+ */
+static GdaSqlParser *
+get_parser (GdaConnection *cnc)
+{
+	GdaSqlParser *parser;
+	parser = g_object_get_data (G_OBJECT (cnc), "__gda_parser");
+	if (!parser) {
+		parser = gda_connection_create_parser (cnc);
+		g_object_set_data_full (G_OBJECT (cnc), "__gda_parser", 
+					parser, g_object_unref);
+	}
+	return parser;
+}
+
+static ParserCache *
+get_parser_cache (GdaReportEngine *engine, GdaSqlParser *parser)
+{
+	GdaReportEnginePrivate *priv = gda_report_engine_get_instance_private (engine);
+	ParserCache *pcache;
+
+	pcache = g_hash_table_lookup (priv->parsed, parser);
+	if (!pcache) {
+		pcache = g_new0 (ParserCache, 1);
+		pcache->statements = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_object_unref);
+		pcache->expressions = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+							     (GDestroyNotify) compiled_expr_free);
+		g_hash_table_insert (priv->parsed, g_object_ref (parser), pcache);
+	}
+	return pcache;
+}
+
+/*
+ * parse_statement
  *
- * Returns: a new GValue if no error occurred
+ * Parses @sql using @cnc's parser, or returns the statement created the last time @sql was parsed
+ *
+ * Returns: (transfer none): a #GdaStatement, or %NULL if an error occurred
  */
-static GValue *
-evaluate_expression (GdaReportEngine *engine, RunContext *context, const gchar *expr, GError **error)
+static GdaStatement *
+parse_statement (GdaReportEngine *engine, GdaConnection *cnc, const gchar *sql, GError **error)
 {
-	GdaStatement *stmt;
-	GdaSet *plist;
-	GdaDataModel *model;
-	GValue *retval;
-	gchar *sql;
-	static GMutex init_mutex;
-	GdaConnection *vcnc = NULL;
 	GdaSqlParser *parser;
+	ParserCache *pcache;
+	GdaStatement *stmt;
 
-	/* create a virtual connection to execute the expression, if it's the first time */
-	g_mutex_lock (&init_mutex);
-	if (!vcnc) {
-		static GdaVirtualProvider *provider = NULL;
+	if (!sql)
+		sql = "";
+	parser = get_parser (cnc);
+	pcache = get_parser_cache (engine, parser);
+	stmt = g_hash_table_lookup (pcache->statements, sql);
+	if (!stmt) {
+		stmt = gda_sql_parser_parse_string (parser, sql, NULL, error);
+		if (stmt)
+			g_hash_table_insert (pcache->statements, g_strdup (sql), stmt);
+	}
+	return stmt;
+}
+
+/*
+ * get_expression_connection
+ *
+ * Returns: (transfer none): the virtual connection used to evaluate expressions, opened the first time
+ */
+static GdaConnection *
+get_expression_connection (GdaReportEngine *engine, GError **error)
+{
+	GdaReportEnginePrivate *priv = gda_report_engine_get_instance_private (engine);
+	static GMutex init_mutex;
+	static GdaVirtualProvider *provider = NULL;
 
+	if (!priv->vcnc) {
+		g_mutex_lock (&init_mutex);
 		if (!provider)
 			provider = gda_vprovider_data_model_new ();
-		vcnc = gda_virtual_connection_open (provider, GDA_CONNECTION_OPTIONS_NONE, error);
-		if (! vcnc) {
-			g_mutex_unlock (&init_mutex);
+		g_mutex_unlock (&init_mutex);
+		priv->vcnc = gda_virtual_connection_open (provider, GDA_CONNECTION_OPTIONS_NONE, error);
+	}
+	return priv->vcnc;
+}
+
+/*
+ * Native evaluation of expressions
+ *
+ * Expressions only made of constants, parameters, arithmetic, comparison, logical and concatenation
+ * operators are evaluated without running any SQL, following SQLite's rules. Whenever an expression
+ * or a value is not handled here, the expression is evaluated by SQLite, using the virtual connection.
+ */
+typedef enum {
+	NATIVE_NULL,
+	NATIVE_INT,
+	NATIVE_DOUBLE,
+	NATIVE_STRING
+} NativeType;
+
+typedef struct {
+	NativeType    type;
+	gint64        i;
+	gdouble       d;
+	const gchar  *s;
+	gchar        *s_to_free; /* if not %NULL, then @s == @s_to_free */
+} NativeValue;
+
+typedef enum {
+	EXPR_NODE_CONST,
+	EXPR_NODE_PARAM,
+	EXPR_NODE_OPERATION
+} ExprNodeType;
+
+struct _ExprNode {
+	ExprNodeType        type;
+	NativeValue         value;         /* EXPR_NODE_CONST */
+	gchar              *name;          /* EXPR_NODE_PARAM */
+	GType               g_type;        /* EXPR_NODE_PARAM, GDA_TYPE_NULL if not specified */
+	GdaSqlOperatorType  operator_type; /* EXPR_NODE_OPERATION */
+	GSList             *operands;      /* EXPR_NODE_OPERATION, list of ExprNode */
+};
+
+/* largest integer which can be converted to a double without loss */
+#define NATIVE_MAX_EXACT_INT (G_GINT64_CONSTANT (1) << 53)
+
+static void
+native_value_clear (NativeValue *nv)
+{
+	g_free (nv->s_to_free);
+	memset (nv, 0, sizeof (NativeValue));
+}
+
+static void
+expr_node_free (ExprNode *node)
+{
+	native_value_clear (&(node->value));
+	g_free (node->name);
+	g_slist_free_full (node->operands, (GDestroyNotify) expr_node_free);
+	g_free (node);
+}
+
+static gboolean
+native_value_is_finite (gdouble d)
+{
+	return (d == d) && (d <= G_MAXDOUBLE) && (d >= -G_MAXDOUBLE);
+}
+
+/*
+ * Converts the SQL representation of a constant ("12", "1.5", "'it''s'", ...)
+ */
+static gboolean
+native_value_from_sql (const gchar *sql, NativeValue *nv)
+{
+	const gchar *ptr;
+	gchar *end;
+
+	memset (nv, 0, sizeof (NativeValue));
+	if (*sql == '\'') {
+		GString *string;
+		string = g_string_new ("");
+		for (ptr = sql + 1; *ptr && (*ptr != '\\'); ptr++) {
+			if (*ptr == '\'') {
+				if (ptr[1] != '\'')
+					break;
+				ptr++;
+			}
+			g_string_append_c (string, *ptr);
+		}
+		if ((*ptr != '\'') || ptr[1]) {
+			g_string_free (string, TRUE);
+			return FALSE;
+		}
+		nv->type = NATIVE_STRING;
+		nv->s_to_free = g_string_free (string, FALSE);
+		nv->s = nv->s_to_free;
+		return TRUE;
+	}
+	if (!g_ascii_strcasecmp (sql, "null"))
+		return TRUE;
+	if (!g_ascii_strcasecmp (sql, "true") || !g_ascii_strcasecmp (sql, "false")) {
+		nv->type = NATIVE_INT;
+		nv->i = g_ascii_tolower (*sql) == 't' ? 1 : 0;
+		return TRUE;
+	}
+
+	ptr = sql;
+	if ((*ptr == '-') || (*ptr == '+'))
+		ptr++;
+	if ((!g_ascii_isdigit (*ptr) && (*ptr != '.')) || strpbrk (ptr, "xX"))
+		return FALSE;
+	if (!strpbrk (ptr, ".eE")) {
+		errno = 0;
+		nv->i = g_ascii_strtoll (sql, &end, 10);
+		if (errno || *end)
+			return FALSE;
+		nv->type = NATIVE_INT;
+	}
+	else {
+		nv->d = g_ascii_strtod (sql, &end);
+		if (*end || !native_value_is_finite (nv->d))
+			return FALSE;
+		nv->type = NATIVE_DOUBLE;
+	}
+	return TRUE;
+}
+
+/*
+ * Converts @value the same way SQLite's provider binds it to a statement's variable; @nv
+ * may point to @value's contents.
+ */
+static gboolean
+native_value_from_gvalue (const GValue *value, NativeValue *nv)
+{
+	GType type;
+
+	memset (nv, 0, sizeof (NativeValue));
+	if (!value || gda_value_is_null (value))
+		return TRUE;
+
+	type = G_VALUE_TYPE (value);
+	nv->type = NATIVE_INT;
+	if (type == G_TYPE_INT)
+		nv->i = g_value_get_int (value);
+	else if (type == G_TYPE_INT64)
+		nv->i = g_value_get_int64 (value);
+	else if (type == G_TYPE_BOOLEAN)
+		nv->i = g_value_get_boolean (value) ? 1 : 0;
+	else if (type == GDA_TYPE_SHORT)
+		nv->i = gda_value_get_short (value);
+	else if (type == GDA_TYPE_USHORT)
+		nv->i = gda_value_get_ushort (value);
+	else if (type == G_TYPE_CHAR)
+		nv->i = g_value_get_schar (value);
+	else if (type == G_TYPE_UCHAR)
+		nv->i = g_value_get_uchar (value);
+	else if ((type == G_TYPE_UINT) && (g_value_get_uint (value) <= G_MAXINT))
+		nv->i = g_value_get_uint (value);
+	else if ((type == G_TYPE_LONG) && (g_value_get_long (value) >= G_MININT) &&
+		 (g_value_get_long (value) <= G_MAXINT))
+		nv->i = g_value_get_long (value);
+	else if ((type == G_TYPE_UINT64) && (g_value_get_uint64 (value) <= G_MAXINT64))
+		nv->i = (gint64) g_value_get_uint64 (value);
+	else if ((type == G_TYPE_DOUBLE) || (type == G_TYPE_FLOAT)) {
+		nv->type = NATIVE_DOUBLE;
+		nv->d = (type == G_TYPE_DOUBLE) ? g_value_get_double (value) : g_value_get_float (value);
+		if (!native_value_is_finite (nv->d))
+			return FALSE;
+	}
+	else if (type == G_TYPE_STRING) {
+		nv->s = g_value_get_string (value);
+		nv->type = nv->s ? NATIVE_STRING : NATIVE_NULL;
+	}
+	else
+		return FALSE;
+	return TRUE;
+}
+
+/*
+ * Converts @nv to the #GValue SQLite's provider would return, or returns %NULL
+ */
+static GValue *
+native_value_to_gvalue (const NativeValue *nv)
+{
+	GValue *value = NULL;
+	switch (nv->type) {
+	case NATIVE_NULL:
+		value = gda_value_new_null ();
+		break;
+	case NATIVE_INT:
+		if ((nv->i >= G_MININT) && (nv->i <= G_MAXINT)) {
+			value = gda_value_new (G_TYPE_INT);
+			g_value_set_int (value, (gint) nv->i);
+		}
+		break;
+	case NATIVE_DOUBLE:
+		value = gda_value_new (G_TYPE_DOUBLE);
+		g_value_set_double (value, nv->d);
+		break;
+	case NATIVE_STRING:
+		value = gda_value_new (G_TYPE_STRING);
+		g_value_set_string (value, nv->s);
+		break;
+	}
+	return value;
+}
+
+/*
+ * expr_node_compile
+ *
+ * Returns: a new #ExprNode, or %NULL if @expr can't be evaluated natively
+ */
+static ExprNode *
+expr_node_compile (GdaSqlExpr *expr)
+{
+	ExprNode *node;
+
+	if (!expr || expr->func || expr->select || expr->case_s || expr->cast_as)
+		return NULL;
+
+	if (expr->param_spec) {
+		if (expr->value || expr->cond || !expr->param_spec->name)
 			return NULL;
+		node = g_new0 (ExprNode, 1);
+		node->type = EXPR_NODE_PARAM;
+		node->name = g_strdup (expr->param_spec->name);
+		node->g_type = expr->param_spec->g_type;
+		return node;
+	}
+
+	if (expr->cond) {
+		guint nb_operands, min, max;
+		GSList *list;
+
+		if (expr->value)
+			return NULL;
+		switch (expr->cond->operator_type) {
+		case GDA_SQL_OPERATOR_TYPE_AND:
+		case GDA_SQL_OPERATOR_TYPE_OR:
+		case GDA_SQL_OPERATOR_TYPE_STAR:
+		case GDA_SQL_OPERATOR_TYPE_CONCAT:
+			min = 2;
+			max = G_MAXUINT;
+			break;
+		case GDA_SQL_OPERATOR_TYPE_PLUS:
+		case GDA_SQL_OPERATOR_TYPE_MINUS:
+			min = 1;
+			max = G_MAXUINT;
+			break;
+		case GDA_SQL_OPERATOR_TYPE_DIV:
+		case GDA_SQL_OPERATOR_TYPE_REM:
+		case GDA_SQL_OPERATOR_TYPE_EQ:
+		case GDA_SQL_OPERATOR_TYPE_DIFF:
+		case GDA_SQL_OPERATOR_TYPE_GT:
+		case GDA_SQL_OPERATOR_TYPE_LT:
+		case GDA_SQL_OPERATOR_TYPE_GEQ:
+		case GDA_SQL_OPERATOR_TYPE_LEQ:
+			min = max = 2;
+			break;
+		case GDA_SQL_OPERATOR_TYPE_NOT:
+		case GDA_SQL_OPERATOR_TYPE_ISNULL:
+		case GDA_SQL_OPERATOR_TYPE_ISNOTNULL:
+			min = max = 1;
+			break;
+		default:
+			return NULL;
+		}
+		nb_operands = g_slist_length (expr->cond->operands);
+		if ((nb_operands < min) || (nb_operands > max))
+			return NULL;
+
+		node = g_new0 (ExprNode, 1);
+		node->type = EXPR_NODE_OPERATION;
+		node->operator_type = expr->cond->operator_type;
+		for (list = expr->cond->operands; list; list = list->next) {
+			ExprNode *operand;
+			operand = expr_node_compile ((GdaSqlExpr*) list->data);
+			if (!operand) {
+				expr_node_free (node);
+				return NULL;
+			}
+			node->operands = g_slist_prepend (node->operands, operand);
 		}
+		node->operands = g_slist_reverse (node->operands);
+		return node;
 	}
-	g_mutex_unlock (&init_mutex);
 
-	/* parser */
-	parser = g_object_get_data (G_OBJECT (context->cnc), "__gda_parser");
-	if (!parser) {
-		parser = gda_connection_create_parser (context->cnc);
-		g_object_set_data_full (G_OBJECT (context->cnc), "__gda_parser", 
-					parser, g_object_unref);
+	node = g_new0 (ExprNode, 1);
+	node->type = EXPR_NODE_CONST;
+	if (expr->value && (G_VALUE_TYPE (expr->value) != GDA_TYPE_NULL)) {
+		if (expr->value_is_ident || (G_VALUE_TYPE (expr->value) != G_TYPE_STRING) ||
+		    !g_value_get_string (expr->value) ||
+		    !native_value_from_sql (g_value_get_string (expr->value), &(node->value))) {
+			expr_node_free (node);
+			return NULL;
+		}
 	}
-	
+	return node;
+}
+
+static gboolean
+native_is_true (const NativeValue *nv, gboolean *is_true)
+{
+	if (nv->type == NATIVE_INT)
+		*is_true = nv->i != 0;
+	else if (nv->type == NATIVE_DOUBLE)
+		*is_true = nv->d != 0.;
+	else
+		return FALSE;
+	return TRUE;
+}
+
+/* arithmetic operation on two numbers, NULL if any of them is NULL */
+static gboolean
+native_arith (GdaSqlOperatorType op, const NativeValue *a, const NativeValue *b, NativeValue *result)
+{
+	memset (result, 0, sizeof (NativeValue));
+	if ((a->type == NATIVE_NULL) || (b->type == NATIVE_NULL))
+		return TRUE;
+
+	if ((a->type == NATIVE_INT) && (b->type == NATIVE_INT)) {
+		gint64 x = a->i;
+		gint64 y = b->i;
+
+		/* SQLite switches to floating point numbers on overflow: let it do it */
+		result->type = NATIVE_INT;
+		switch (op) {
+		case GDA_SQL_OPERATOR_TYPE_PLUS:
+			if (((y > 0) && (x > G_MAXINT64 - y)) || ((y < 0) && (x < G_MININT64 - y)))
+				return FALSE;
+			result->i = x + y;
+			return TRUE;
+		case GDA_SQL_OPERATOR_TYPE_MINUS:
+			if (((y < 0) && (x > G_MAXINT64 + y)) || ((y > 0) && (x < G_MININT64 + y)))
+				return FALSE;
+			result->i = x - y;
+			return TRUE;
+		case GDA_SQL_OPERATOR_TYPE_STAR:
+			if ((x > 0) ? ((y > 0) ? (x > G_MAXINT64 / y) : (y < G_MININT64 / x)) :
+			    ((y > 0) ? (x < G_MININT64 / y) : ((x != 0) && (y < G_MAXINT64 / x))))
+				return FALSE;
+			result->i = x * y;
+			return TRUE;
+		case GDA_SQL_OPERATOR_TYPE_DIV:
+			if (y == 0)
+				result->type = NATIVE_NULL;
+			else if ((x == G_MININT64) && (y == -1))
+				return FALSE;
+			else
+				result->i = x / y;
+			return TRUE;
+		case GDA_SQL_OPERATOR_TYPE_REM:
+			if (y == 0)
+				result->type = NATIVE_NULL;
+			else
+				result->i = (y == -1) ? 0 : x % y;
+			return TRUE;
+		default:
+			return FALSE;
+		}
+	}
+	else if ((a->type != NATIVE_STRING) && (b->type != NATIVE_STRING)) {
+		gdouble x = (a->type == NATIVE_INT) ? (gdouble) a->i : a->d;
+		gdouble y = (b->type == NATIVE_INT) ? (gdouble) b->i : b->d;
+
+		result->type = NATIVE_DOUBLE;
+		switch (op) {
+		case GDA_SQL_OPERATOR_TYPE_PLUS:
+			result->d = x + y;
+			break;
+		case GDA_SQL_OPERATOR_TYPE_MINUS:
+			result->d = x - y;
+			break;
+		case GDA_SQL_OPERATOR_TYPE_STAR:
+			result->d = x * y;
+			break;
+		case GDA_SQL_OPERATOR_TYPE_DIV:
+			if (y == 0.) {
+				result->type = NATIVE_NULL;
+				return TRUE;
+			}
+			result->d = x / y;
+			break;
+		default:
+			return FALSE;
+		}
+		return native_value_is_finite (result->d);
+	}
+
+	/* SQLite converts strings to numbers */
+	return FALSE;
+}
+
+/* compares two non NULL values */
+static gboolean
+native_compare (const NativeValue *a, const NativeValue *b, gint *cmp)
+{
+	if ((a->type == NATIVE_STRING) && (b->type == NATIVE_STRING))
+		*cmp = strcmp (a->s, b->s);
+	else if ((a->type == NATIVE_INT) && (b->type == NATIVE_INT))
+		*cmp = (a->i > b->i) - (a->i < b->i);
+	else if ((a->type != NATIVE_STRING) && (b->type != NATIVE_STRING)) {
+		gdouble x, y;
+		if (((a->type == NATIVE_INT) && ((a->i > NATIVE_MAX_EXACT_INT) || (a->i < -NATIVE_MAX_EXACT_INT))) ||
+		    ((b->type == NATIVE_INT) && ((b->i > NATIVE_MAX_EXACT_INT) || (b->i < -NATIVE_MAX_EXACT_INT))))
+			return FALSE;
+		x = (a->type == NATIVE_INT) ? (gdouble) a->i : a->d;
+		y = (b->type == NATIVE_INT) ? (gdouble) b->i : b->d;
+		*cmp = (x > y) - (x < y);
+	}
+	else
+		/* SQLite orders numbers before strings */
+		return FALSE;
+	return TRUE;
+}
+
+static gboolean native_eval (GdaReportEngine *engine, RunContext *context, ExprNode *node, NativeValue *result);
+
+static gboolean
+native_eval_operation (GdaReportEngine *engine, RunContext *context, ExprNode *node, NativeValue *result)
+{
+	NativeValue *values;
+	GSList *list;
+	guint i, n;
+	gboolean retval = FALSE;
+
+	memset (result, 0, sizeof (NativeValue));
+	n = g_slist_length (node->operands);
+	values = g_new0 (NativeValue, n);
+	for (i = 0, list = node->operands; list; i++, list = list->next) {
+		if (!native_eval (engine, context, (ExprNode*) list->data, &(values [i])))
+			goto out;
+	}
+
+	switch (node->operator_type) {
+	case GDA_SQL_OPERATOR_TYPE_AND:
+	case GDA_SQL_OPERATOR_TYPE_OR: {
+		gboolean is_and = (node->operator_type == GDA_SQL_OPERATOR_TYPE_AND);
+		gboolean has_null = FALSE;
+
+		result->type = NATIVE_INT;
+		result->i = is_and ? 1 : 0;
+		for (i = 0; i < n; i++) {
+			gboolean is_true;
+			if (values [i].type == NATIVE_NULL)
+				has_null = TRUE;
+			else if (!native_is_true (&(values [i]), &is_true))
+				goto out;
+			else if (is_true != is_and) {
+				result->i = is_and ? 0 : 1;
+				break;
+			}
+		}
+		if ((i == n) && has_null)
+			result->type = NATIVE_NULL;
+		retval = TRUE;
+		break;
+	}
+	case GDA_SQL_OPERATOR_TYPE_NOT: {
+		gboolean is_true;
+		if (values [0].type != NATIVE_NULL) {
+			if (!native_is_true (&(values [0]), &is_true))
+				goto out;
+			result->type = NATIVE_INT;
+			result->i = is_true ? 0 : 1;
+		}
+		retval = TRUE;
+		break;
+	}
+	case GDA_SQL_OPERATOR_TYPE_ISNULL:
+	case GDA_SQL_OPERATOR_TYPE_ISNOTNULL:
+		result->type = NATIVE_INT;
+		result->i = ((values [0].type == NATIVE_NULL) ==
+			     (node->operator_type == GDA_SQL_OPERATOR_TYPE_ISNULL)) ? 1 : 0;
+		retval = TRUE;
+		break;
+	case GDA_SQL_OPERATOR_TYPE_PLUS:
+	case GDA_SQL_OPERATOR_TYPE_MINUS:
+	case GDA_SQL_OPERATOR_TYPE_STAR:
+	case GDA_SQL_OPERATOR_TYPE_DIV:
+	case GDA_SQL_OPERATOR_TYPE_REM:
+		for (i = 0; i < n; i++) {
+			if (values [i].type == NATIVE_STRING)
+				goto out;
+		}
+		if (n == 1) {
+			/* unary operator */
+			*result = values [0];
+			if (node->operator_type == GDA_SQL_OPERATOR_TYPE_MINUS) {
+				if (result->type == NATIVE_INT) {
+					if (result->i == G_MININT64)
+						goto out;
+					result->i = - result->i;
+				}
+				else
+					result->d = - result->d;
+			}
+		}
+		else {
+			*result = values [0];
+			for (i = 1; i < n; i++) {
+				NativeValue acc = *result;
+				if (!native_arith (node->operator_type, &acc, &(values [i]), result))
+					goto out;
+			}
+		}
+		retval = TRUE;
+		break;
+	case GDA_SQL_OPERATOR_TYPE_EQ:
+	case GDA_SQL_OPERATOR_TYPE_DIFF:
+	case GDA_SQL_OPERATOR_TYPE_GT:
+	case GDA_SQL_OPERATOR_TYPE_LT:
+	case GDA_SQL_OPERATOR_TYPE_GEQ:
+	case GDA_SQL_OPERATOR_TYPE_LEQ: {
+		gint cmp;
+		gboolean res;
+		if ((values [0].type != NATIVE_NULL) && (values [1].type != NATIVE_NULL)) {
+			if (!native_compare (&(values [0]), &(values [1]), &cmp))
+				goto out;
+			switch (node->operator_type) {
+			case GDA_SQL_OPERATOR_TYPE_EQ:
+				res = (cmp == 0);
+				break;
+			case GDA_SQL_OPERATOR_TYPE_DIFF:
+				res = (cmp != 0);
+				break;
+			case GDA_SQL_OPERATOR_TYPE_GT:
+				res = (cmp > 0);
+				break;
+			case GDA_SQL_OPERATOR_TYPE_LT:
+				res = (cmp < 0);
+				break;
+			case GDA_SQL_OPERATOR_TYPE_GEQ:
+				res = (cmp >= 0);
+				break;
+			default:
+				res = (cmp <= 0);
+				break;
+			}
+			result->type = NATIVE_INT;
+			result->i = res ? 1 : 0;
+		}
+		retval = TRUE;
+		break;
+	}
+	case GDA_SQL_OPERATOR_TYPE_CONCAT: {
+		GString *string;
+		for (i = 0; i < n; i++) {
+			if (values [i].type == NATIVE_NULL)
+				break;
+			if (values [i].type == NATIVE_DOUBLE)
+				goto out; /* SQLite's own formatting of floating point numbers */
+		}
+		if (i == n) {
+			string = g_string_new ("");
+			for (i = 0; i < n; i++) {
+				if (values [i].type == NATIVE_STRING)
+					g_string_append (string, values [i].s);
+				else
+					g_string_append_printf (string, "%" G_GINT64_FORMAT, values [i].i);
+			}
+			result->type = NATIVE_STRING;
+			result->s_to_free = g_string_free (string, FALSE);
+			result->s = result->s_to_free;
+		}
+		retval = TRUE;
+		break;
+	}
+	default:
+		break;
+	}
+
+ out:
+	for (i = 0; i < n; i++)
+		native_value_clear (&(values [i]));
+	g_free (values);
+	if (!retval)
+		memset (result, 0, sizeof (NativeValue));
+	return retval;
+}
+
+/*
+ * native_eval
+ *
+ * Returns: %TRUE if @node could be evaluated, in which case @result must be freed using native_value_clear()
+ */
+static gboolean
+native_eval (GdaReportEngine *engine, RunContext *context, ExprNode *node, NativeValue *result)
+{
+	memset (result, 0, sizeof (NativeValue));
+	switch (node->type) {
+	case EXPR_NODE_CONST:
+		*result = node->value;
+		result->s_to_free = NULL; /* owned by @node */
+		return TRUE;
+	case EXPR_NODE_PARAM: {
+		GdaHolder *holder;
+		const GValue *cvalue;
+		GValue *trans = NULL;
+		gboolean retval;
+
+		holder = run_context_find_param (engine, context, BAD_CAST node->name);
+		if (!holder)
+			return FALSE;
+		cvalue = gda_holder_get_value (holder);
+		if ((node->g_type != GDA_TYPE_NULL) && cvalue && !gda_value_is_null (cvalue) &&
+		    (G_VALUE_TYPE (cvalue) != node->g_type)) {
+			trans = gda_value_new (node->g_type);
+			if (!g_value_transform (cvalue, trans)) {
+				gda_value_free (trans);
+				return FALSE;
+			}
+			cvalue = trans;
+		}
+		retval = native_value_from_gvalue (cvalue, result);
+		if (trans) {
+			if (retval && (result->type == NATIVE_STRING)) {
+				result->s_to_free = g_strdup (result->s);
+				result->s = result->s_to_free;
+			}
+			gda_value_free (trans);
+		}
+		return retval;
+	}
+	case EXPR_NODE_OPERATION:
+		return native_eval_operation (engine, context, node, result);
+	}
+	return FALSE;
+}
+
+static gboolean
+collect_untyped_params_foreach_func (GdaSqlAnyPart *node, GSList **list, G_GNUC_UNUSED GError **error)
+{
+	GdaSqlParamSpec *pspec;
+	if (node && (node->type == GDA_SQL_ANY_EXPR) &&
+	    (pspec = ((GdaSqlExpr*) node)->param_spec) &&
+	    (pspec->g_type == GDA_TYPE_NULL) && pspec->name)
+		*list = g_slist_prepend (*list, g_strdup (pspec->name));
+	return TRUE;
+}
+
+/*
+ * compile_expression
+ *
+ * Parses @expr using @cnc's parser the first time it is used
+ *
+ * Returns: (transfer none): a #CompiledExpr, or %NULL if an error occurred
+ */
+static CompiledExpr *
+compile_expression (GdaReportEngine *engine, GdaConnection *cnc, const gchar *expr, GError **error)
+{
+	GdaSqlParser *parser;
+	ParserCache *pcache;
+	CompiledExpr *cexpr;
+	GdaStatement *stmt;
+	GdaSqlStatement *sql_st;
+	gchar *sql;
+
+	parser = get_parser (cnc);
+	pcache = get_parser_cache (engine, parser);
+	cexpr = g_hash_table_lookup (pcache->expressions, expr);
+	if (cexpr)
+		return cexpr;
+
 	/* create the stmt 
 	 * REM: SQL injection is prevented because only the first statement is kept by GdaStatement 
 	 */
 	sql = g_strdup_printf ("SELECT %s", expr);
 	stmt = gda_sql_parser_parse_string (parser, sql, NULL, error);
+	g_free (sql);
 	if (!stmt)
 		return NULL;
 
-	GdaStatement *lstmt;
-	lstmt = rewrite_statement (engine, context, stmt, error);
-	g_object_unref (stmt);
-	if (!lstmt)
-		return NULL;
-	
-	stmt = lstmt;
-	if (!gda_statement_get_parameters (stmt, &plist, error)) {
-		g_object_unref (stmt);
+	cexpr = g_new0 (CompiledExpr, 1);
+	cexpr->stmt = stmt;
+	g_object_get (G_OBJECT (stmt), "structure", &sql_st, NULL);
+	gda_sql_any_part_foreach (GDA_SQL_ANY_PART (sql_st->contents),
+				  (GdaSqlForeachFunc) collect_untyped_params_foreach_func, &(cexpr->untyped), NULL);
+	if (sql_st->stmt_type == GDA_SQL_STATEMENT_SELECT) {
+		GdaSqlStatementSelect *sel = (GdaSqlStatementSelect*) sql_st->contents;
+		if (!sel->distinct && !sel->from && !sel->where_cond && !sel->group_by && !sel->having_cond &&
+		    !sel->limit_count && !sel->limit_offset && sel->expr_list && !sel->expr_list->next)
+			cexpr->native = expr_node_compile (((GdaSqlSelectField*) sel->expr_list->data)->expr);
+	}
+	gda_sql_statement_free (sql_st);
+
+	g_hash_table_insert (pcache->expressions, g_strdup (expr), cexpr);
+	return cexpr;
+}
+
+/*
+ * sql_evaluate_expression
+ *
+ * Evaluates @cexpr using the virtual connection
+ */
+static GValue *
+sql_evaluate_expression (GdaReportEngine *engine, RunContext *context, CompiledExpr *cexpr,
+			 const gchar *expr, GError **error)
+{
+	GdaConnection *vcnc;
+	GdaSet *plist;
+	GdaDataModel *model;
+	GValue *retval;
+	GArray *types;
+	GSList *list;
+
+	vcnc = get_expression_connection (engine, error);
+	if (!vcnc)
 		return NULL;
+
+	/* the statement is only rewritten if the types of its parameters have changed, otherwise the
+	 * same statement is executed again, and its prepared version is reused */
+	types = g_array_new (FALSE, FALSE, sizeof (GType));
+	for (list = cexpr->untyped; list; list = list->next) {
+		GdaHolder *holder;
+		GType type = GDA_TYPE_NULL;
+		holder = run_context_find_param (engine, context, BAD_CAST list->data);
+		if (holder)
+			type = gda_holder_get_g_type (holder);
+		g_array_append_val (types, type);
+	}
+	if (!cexpr->rstmt ||
+	    memcmp (cexpr->rtypes->data, types->data, sizeof (GType) * types->len)) {
+		GdaStatement *rstmt;
+		rstmt = rewrite_statement (engine, context, cexpr->stmt, error);
+		if (!rstmt) {
+			g_array_free (types, TRUE);
+			return NULL;
+		}
+		if (cexpr->rstmt)
+			g_object_unref (cexpr->rstmt);
+		if (cexpr->rtypes)
+			g_array_free (cexpr->rtypes, TRUE);
+		cexpr->rstmt = rstmt;
+		cexpr->rtypes = types;
 	}
+	else
+		g_array_free (types, TRUE);
+
+	if (!gda_statement_get_parameters (cexpr->rstmt, &plist, error))
+		return NULL;
 
 	if (plist) {
 		if (!assign_parameters_values (engine, context, plist, error)) {
-			g_object_unref (stmt);
 			g_object_unref (plist);
 			return NULL;
 		}
 	}
 
-	model = gda_connection_statement_execute_select (vcnc, stmt, plist, error);
+	model = gda_connection_statement_execute_select (vcnc, cexpr->rstmt, plist, error);
 	if (plist)
 		g_object_unref (plist);
-	g_object_unref (stmt);
 	if (!model) 
 		return NULL;
 
 	if (gda_data_model_get_n_rows (model) != 1) {
 		g_set_error (error, GDA_REPORT_ENGINE_ERROR, GDA_REPORT_ENGINE_GENERAL_ERROR,
 			     _("Expression '%s' should return exactly one value"), expr);
+		g_object_unref (model);
 		return NULL;
 	}
 	retval = (GValue *) gda_data_model_get_value_at (model, 0, 0, error);
@@ -1161,6 +2001,461 @@ evaluate_expression (GdaReportEngine *engine, RunContext *context, const gchar *
 	return retval;
 }
 
+/*
+ * evaluate_expression
+ *
+ * Evaluates the @expr expression, which must be a valid SQLite expression
+ *
+ * Returns: a new GValue if no error occurred
+ */
+static GValue *
+evaluate_expression (GdaReportEngine *engine, RunContext *context, const gchar *expr, GError **error)
+{
+	CompiledExpr *cexpr;
+	GdaConnection *cnc;
+
+	if (!expr)
+		expr = "";
+	if (context)
+		cnc = context->cnc;
+	else {
+		cnc = get_expression_connection (engine, error);
+		if (!cnc)
+			return NULL;
+	}
+
+	cexpr = compile_expression (engine, cnc, expr, error);
+	if (!cexpr)
+		return NULL;
+
+	if (cexpr->native) {
+		NativeValue nv;
+		if (native_eval (engine, context, cexpr->native, &nv)) {
+			GValue *retval;
+			retval = native_value_to_gvalue (&nv);
+			native_value_clear (&nv);
+			if (retval)
+				return retval;
+		}
+	}
+
+	return sql_evaluate_expression (engine, context, cexpr, expr, error);
+}
+
+/*
+ * Prefetching of nested sections
+ *
+ * When a <gda_report_section> is run for each row of its enclosing section and its SELECT statement
+ * depends on that row only through a "column = parameter" condition, the rows for the keys of the
+ * next PREFETCH_BATCH_SIZE rows of the enclosing section are fetched at once, replacing the condition
+ * with "column IN (...)", and grouped by key in memory. This is only done for integer keys, and as soon
+ * as something unexpected happens, the statement is executed for each row as usual.
+ */
+#define PREFETCH_BATCH_SIZE 500
+
+typedef struct {
+	gboolean    disabled;
+	gint        key_column; /* column of the enclosing data model holding the key, or -1 */
+	GHashTable *models; /* key = a gint64 key, value = the #GdaDataModel of the rows for that key */
+} Prefetch;
+
+static void
+prefetch_free (gpointer data)
+{
+	Prefetch *pf = (Prefetch*) data;
+	if (pf->models)
+		g_hash_table_destroy (pf->models);
+	g_free (pf);
+}
+
+static gboolean
+value_to_int64 (const GValue *value, gint64 *key)
+{
+	GType type;
+	if (!value)
+		return FALSE;
+	type = G_VALUE_TYPE (value);
+	if (type == G_TYPE_INT)
+		*key = g_value_get_int (value);
+	else if (type == G_TYPE_INT64)
+		*key = g_value_get_int64 (value);
+	else if (type == G_TYPE_UINT)
+		*key = g_value_get_uint (value);
+	else if (type == G_TYPE_LONG)
+		*key = g_value_get_long (value);
+	else if (type == GDA_TYPE_SHORT)
+		*key = gda_value_get_short (value);
+	else if (type == GDA_TYPE_USHORT)
+		*key = gda_value_get_ushort (value);
+	else if ((type == G_TYPE_UINT64) && (g_value_get_uint64 (value) <= G_MAXINT64))
+		*key = (gint64) g_value_get_uint64 (value);
+	else
+		return FALSE;
+	return TRUE;
+}
+
+typedef struct {
+	GdaReportEngine *engine;
+	RunContext      *context;
+	GSList          *exprs; /* list of GdaSqlExpr using a parameter from @context's current row */
+} CorrelationData;
+
+static gboolean
+correlation_foreach_func (GdaSqlAnyPart *node, CorrelationData *cdata, G_GNUC_UNUSED GError **error)
+{
+	GdaSqlParamSpec *pspec;
+	if (node && (node->type == GDA_SQL_ANY_EXPR) &&
+	    (pspec = ((GdaSqlExpr*) node)->param_spec) && pspec->name) {
+		GdaHolder *holder;
+		holder = run_context_find_param (cdata->engine, cdata->context, BAD_CAST pspec->name);
+		if (holder && g_slist_find (gda_set_get_holders (GDA_SET (cdata->context->iter)), holder))
+			cdata->exprs = g_slist_prepend (cdata->exprs, node);
+	}
+	return TRUE;
+}
+
+static gboolean
+no_aggregate_foreach_func (GdaSqlAnyPart *node, G_GNUC_UNUSED gpointer data, G_GNUC_UNUSED GError **error)
+{
+	/* functions may be aggregates, and sub selects may use the selected rows */
+	return !node || ((node->type != GDA_SQL_ANY_SQL_FUNCTION) && (node->type != GDA_SQL_ANY_STMT_SELECT) &&
+			 (node->type != GDA_SQL_ANY_STMT_COMPOUND));
+}
+
+static gboolean
+expr_is_column (GdaSqlExpr *expr)
+{
+	const gchar *str;
+	if (!expr->value || expr->param_spec || expr->func || expr->cond || expr->select ||
+	    expr->case_s || expr->cast_as || (G_VALUE_TYPE (expr->value) != G_TYPE_STRING))
+		return FALSE;
+	str = g_value_get_string (expr->value);
+	if (!str || (!g_ascii_isalpha (*str) && (*str != '_') && (*str != '"')))
+		return FALSE;
+	return g_ascii_strcasecmp (str, "null") && g_ascii_strcasecmp (str, "true") &&
+		g_ascii_strcasecmp (str, "false");
+}
+
+/*
+ * prefetch_find_correlation
+ *
+ * Finds, in @sql_st, the "column = parameter" condition correlating it to @context's current row.
+ *
+ * Returns: the condition, or %NULL if @sql_st can't be prefetched
+ */
+static GdaSqlOperation *
+prefetch_find_correlation (GdaReportEngine *engine, RunContext *context, GdaSqlStatement *sql_st,
+			   GdaSqlExpr **col_expr, GdaSqlExpr **key_expr, gint *key_column)
+{
+	GdaSqlStatementSelect *sel;
+	GdaSqlOperation *cond;
+	CorrelationData cdata;
+	GdaHolder *holder;
+	GType type;
+	GSList *list;
+
+	if (sql_st->stmt_type != GDA_SQL_STATEMENT_SELECT)
+		return NULL;
+	sel = (GdaSqlStatementSelect*) sql_st->contents;
+	if (sel->distinct || !sel->from || !sel->where_cond || sel->group_by || sel->having_cond ||
+	    sel->limit_count || sel->limit_offset)
+		return NULL;
+	for (list = sel->expr_list; list; list = list->next) {
+		if (!gda_sql_any_part_foreach (GDA_SQL_ANY_PART (list->data),
+					       (GdaSqlForeachFunc) no_aggregate_foreach_func, NULL, NULL))
+			return NULL;
+	}
+
+	/* a single parameter must come from @context's current row */
+	cdata.engine = engine;
+	cdata.context = context;
+	cdata.exprs = NULL;
+	gda_sql_any_part_foreach (GDA_SQL_ANY_PART (sel), (GdaSqlForeachFunc) correlation_foreach_func,
+				  &cdata, NULL);
+	if (!cdata.exprs || cdata.exprs->next) {
+		g_slist_free (cdata.exprs);
+		return NULL;
+	}
+	*key_expr = (GdaSqlExpr*) cdata.exprs->data;
+	g_slist_free (cdata.exprs);
+
+	/* and be compared to a column by the WHERE clause, or by one of its ANDed conditions */
+	cond = sel->where_cond->cond;
+	if (cond && (cond->operator_type == GDA_SQL_OPERATOR_TYPE_AND)) {
+		GdaSqlOperation *and_cond = cond;
+		cond = NULL;
+		for (list = and_cond->operands; list; list = list->next) {
+			GdaSqlExpr *operand = (GdaSqlExpr*) list->data;
+			if (operand->cond && g_slist_find (operand->cond->operands, *key_expr)) {
+				cond = operand->cond;
+				break;
+			}
+		}
+	}
+	if (!cond || (cond->operator_type != GDA_SQL_OPERATOR_TYPE_EQ) ||
+	    (g_slist_length (cond->operands) != 2) || !g_slist_find (cond->operands, *key_expr))
+		return NULL;
+	*col_expr = (GdaSqlExpr*) ((cond->operands->data == *key_expr) ?
+				   cond->operands->next->data : cond->operands->data);
+	if (!expr_is_column (*col_expr))
+		return NULL;
+
+	holder = run_context_find_param (engine, context, BAD_CAST (*key_expr)->param_spec->name);
+	type = gda_holder_get_g_type (holder);
+	if ((type != (*key_expr)->param_spec->g_type) || ((type != G_TYPE_INT) && (type != G_TYPE_INT64)))
+		return NULL;
+	*key_column = g_slist_index (gda_set_get_holders (GDA_SET (context->iter)), holder);
+
+	return cond;
+}
+
+/* creates an empty data model with the same columns as the @ncols first ones of @src */
+static GdaDataModel *
+prefetch_new_model (GdaDataModel *src, gint ncols)
+{
+	GdaDataModel *model;
+	gint i;
+
+	model = gda_data_model_array_new (ncols);
+	for (i = 0; i < ncols; i++) {
+		GdaColumn *copycol, *srccol;
+		gchar *colid;
+
+		srccol = gda_data_model_describe_column (src, i);
+		copycol = gda_data_model_describe_column (model, i);
+
+		g_object_get (G_OBJECT (srccol), "id", &colid, NULL);
+		g_object_set (G_OBJECT (copycol), "id", colid, NULL);
+		g_free (colid);
+		gda_column_set_description (copycol, gda_column_get_description (srccol));
+		gda_column_set_name (copycol, gda_column_get_name (srccol));
+		gda_column_set_dbms_type (copycol, gda_column_get_dbms_type (srccol));
+		gda_column_set_g_type (copycol, gda_column_get_g_type (srccol));
+		gda_column_set_position (copycol, gda_column_get_position (srccol));
+		gda_column_set_allow_null (copycol, gda_column_get_allow_null (srccol));
+	}
+	return model;
+}
+
+/*
+ * prefetch_run_batch
+ *
+ * Fetches the rows of @stmt for the keys of @context's rows, starting at its current row
+ *
+ * Returns: %FALSE if @stmt can't be prefetched
+ */
+static gboolean
+prefetch_run_batch (GdaReportEngine *engine, RunContext *context, GdaConnection *cnc, GdaStatement *stmt,
+		    Prefetch *pf)
+{
+	GdaStatement *lstmt, *bstmt = NULL;
+	GdaSqlStatement *sql_st;
+	GdaSqlStatementSelect *sel;
+	GdaSqlOperation *cond;
+	GdaSqlExpr *col_expr, *key_expr;
+	GdaSqlSelectField *field;
+	GdaSet *plist = NULL;
+	GdaDataModel *bmodel = NULL;
+	GHashTable *models, *seen;
+	GArray *keys;
+	GSList *params = NULL;
+	GType key_type;
+	gint key_column, row, nrows, ncols;
+	guint i;
+	gboolean retval = FALSE;
+
+	g_hash_table_remove_all (pf->models);
+
+	lstmt = rewrite_statement (engine, context, stmt, NULL);
+	if (!lstmt)
+		return FALSE;
+	g_object_get (G_OBJECT (lstmt), "structure", &sql_st, NULL);
+	g_object_unref (lstmt);
+
+	cond = prefetch_find_correlation (engine, context, sql_st, &col_expr, &key_expr, &key_column);
+	if (!cond) {
+		gda_sql_statement_free (sql_st);
+		return FALSE;
+	}
+	pf->key_column = key_column;
+	key_type = key_expr->param_spec->g_type;
+
+	/* keys of the current row and of the next ones */
+	keys = g_array_new (FALSE, FALSE, sizeof (gint64));
+	models = g_hash_table_new_full (g_int64_hash, g_int64_equal, g_free, g_object_unref);
+	seen = g_hash_table_new_full (g_int64_hash, g_int64_equal, g_free, NULL);
+	nrows = gda_data_model_get_n_rows (context->model);
+	for (row = gda_data_model_iter_get_row (context->iter);
+	     (row >= 0) && (row < nrows) && (keys->len < PREFETCH_BATCH_SIZE);
+	     row++) {
+		gint64 key;
+		if (value_to_int64 (gda_data_model_get_value_at (context->model, key_column, row, NULL), &key) &&
+		    !g_hash_table_contains (seen, &key)) {
+			gint64 *pkey;
+			pkey = g_new (gint64, 1);
+			*pkey = key;
+			g_hash_table_add (seen, pkey);
+			g_array_append_val (keys, key);
+		}
+	}
+	g_hash_table_destroy (seen);
+	if (keys->len == 0) {
+		retval = TRUE;
+		goto out;
+	}
+
+	/* "column = ##key" becomes "column IN (##__gda_report_key0, ...)" */
+	cond->operands = g_slist_remove (cond->operands, key_expr);
+	gda_sql_expr_free (key_expr);
+	cond->operator_type = GDA_SQL_OPERATOR_TYPE_IN;
+	for (i = 0; i < keys->len; i++) {
+		GdaSqlExpr *expr;
+		expr = gda_sql_expr_new (GDA_SQL_ANY_PART (cond));
+		expr->param_spec = gda_sql_param_spec_new (NULL);
+		expr->param_spec->name = g_strdup_printf (PREFETCH_PARAM_PREFIX "%u", i);
+		expr->param_spec->g_type = key_type;
+		params = g_slist_prepend (params, expr);
+	}
+	cond->operands = g_slist_concat (cond->operands, g_slist_reverse (params));
+
+	/* and the column is added to the selected ones, to group the rows */
+	sel = (GdaSqlStatementSelect*) sql_st->contents;
+	field = gda_sql_select_field_new (GDA_SQL_ANY_PART (sel));
+	gda_sql_select_field_take_expr (field, gda_sql_expr_copy (col_expr));
+	sel->expr_list = g_slist_append (sel->expr_list, field);
+
+	bstmt = (GdaStatement*) g_object_new (GDA_TYPE_STATEMENT, "structure", sql_st, NULL);
+	if (!gda_statement_get_parameters (bstmt, &plist, NULL) || !plist ||
+	    !assign_parameters_values (engine, context, plist, NULL))
+		goto out;
+	for (i = 0; i < keys->len; i++) {
+		GdaHolder *holder;
+		GValue *value;
+		gchar *name;
+		gboolean set;
+
+		name = g_strdup_printf (PREFETCH_PARAM_PREFIX "%u", i);
+		holder = gda_set_get_holder (plist, name);
+		g_free (name);
+		value = gda_value_new (key_type);
+		if (key_type == G_TYPE_INT)
+			g_value_set_int (value, (gint) g_array_index (keys, gint64, i));
+		else
+			g_value_set_int64 (value, g_array_index (keys, gint64, i));
+		set = holder && gda_holder_set_value (holder, value, NULL);
+		gda_value_free (value);
+		if (!set)
+			goto out;
+	}
+
+	bmodel = gda_connection_statement_execute_select (cnc, bstmt, plist, NULL);
+	if (!bmodel)
+		goto out;
+
+	/* group the rows by key */
+	ncols = gda_data_model_get_n_columns (bmodel) - 1;
+	nrows = gda_data_model_get_n_rows (bmodel);
+	for (i = 0; i < keys->len; i++) {
+		gint64 *pkey;
+		pkey = g_new (gint64, 1);
+		*pkey = g_array_index (keys, gint64, i);
+		g_hash_table_insert (models, pkey, prefetch_new_model (bmodel, ncols));
+	}
+	for (row = 0; row < nrows; row++) {
+		GdaDataModel *model;
+		GList *values = NULL;
+		gint64 key;
+		gint col, added;
+
+		/* any key which is not one of the requested ones means that the database does not compare
+		 * the keys the same way */
+		if (!value_to_int64 (gda_data_model_get_value_at (bmodel, ncols, row, NULL), &key) ||
+		    !(model = g_hash_table_lookup (models, &key)))
+			goto out;
+		for (col = ncols - 1; col >= 0; col--) {
+			const GValue *cvalue;
+			cvalue = gda_data_model_get_value_at (bmodel, col, row, NULL);
+			if (!cvalue) {
+				g_list_free (values);
+				goto out;
+			}
+			values = g_list_prepend (values, gda_value_is_null (cvalue) ? NULL : (gpointer) cvalue);
+		}
+		added = gda_data_model_append_values (model, values, NULL);
+		g_list_free (values);
+		if (added < 0)
+			goto out;
+	}
+
+	g_hash_table_destroy (pf->models);
+	pf->models = models;
+	models = NULL;
+	retval = TRUE;
+
+ out:
+	if (models)
+		g_hash_table_destroy (models);
+	g_array_free (keys, TRUE);
+	if (bmodel)
+		g_object_unref (bmodel);
+	if (plist)
+		g_object_unref (plist);
+	if (bstmt)
+		g_object_unref (bstmt);
+	gda_sql_statement_free (sql_st);
+	return retval;
+}
+
+/*
+ * run_context_prefetched_model
+ *
+ * Returns: (transfer full): the data model resulting of the execution of @stmt for @context's current
+ * row, or %NULL if @stmt must be executed
+ */
+static GdaDataModel *
+run_context_prefetched_model (GdaReportEngine *engine, RunContext *context, GdaConnection *cnc,
+			      GdaStatement *stmt)
+{
+	Prefetch *pf;
+	GdaDataModel *model;
+	gint64 key;
+
+	if (!context->iter || !context->model)
+		return NULL;
+	if (!context->prefetches)
+		context->prefetches = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+							     g_object_unref, prefetch_free);
+	pf = g_hash_table_lookup (context->prefetches, stmt);
+	if (!pf) {
+		pf = g_new0 (Prefetch, 1);
+		pf->key_column = -1;
+		pf->models = g_hash_table_new_full (g_int64_hash, g_int64_equal, g_free, g_object_unref);
+		pf->disabled = ! (gda_data_model_get_access_flags (context->model) & GDA_DATA_MODEL_ACCESS_RANDOM);
+		g_hash_table_insert (context->prefetches, g_object_ref (stmt), pf);
+	}
+	if (pf->disabled)
+		return NULL;
+
+	if (pf->key_column >= 0) {
+		if (!value_to_int64 (gda_data_model_iter_get_value_at (context->iter, pf->key_column), &key))
+			return NULL;
+		model = g_hash_table_lookup (pf->models, &key);
+		if (model)
+			return g_object_ref (model);
+	}
+
+	if (!prefetch_run_batch (engine, context, cnc, stmt, pf)) {
+		pf->disabled = TRUE;
+		g_hash_table_remove_all (pf->models);
+		return NULL;
+	}
+
+	if (!value_to_int64 (gda_data_model_iter_get_value_at (context->iter, pf->key_column), &key))
+		return NULL;
+	model = g_hash_table_lookup (pf->models, &key);
+	return model ? g_object_ref (model) : NULL;
+}
+
 static guint
 gtype_hash (gconstpointer key)
 {
@@ -0,0 +1,249 @@
+/* test-report-engine.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#include <glib/gi18n.h>
+#include <glib/gstdio.h>
+#include <locale.h>
+#include <string.h>
+#include <libgda/libgda.h>
+#include <libgda-report/libgda-report.h>
+
+#define DB_TEST_BASE "sqlite_report_engine"
+/* more than one batch of prefetched keys */
+#define NB_INVOICES 600
+/* number of keys prefetched at once by the engine */
+#define PREFETCH_BATCH_SIZE 500
+
+typedef struct
+{
+  GdaConnection *cnc;
+  gchar *dbfile;
+} TestObjectFixture;
+
+static void
+test_report_start (TestObjectFixture *fixture,
+                   G_GNUC_UNUSED gconstpointer user_data)
+{
+  gint id = g_random_int_range (0, G_MAXINT);
+  gchar *cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s_%d", DB_TEST_BASE, id);
+  gchar *sql;
+
+  fixture->dbfile = g_strdup_printf ("%s_%d.db", DB_TEST_BASE, id);
+  fixture->cnc = gda_connection_open_from_string ("SQLite", cncstring, NULL,
+                                                  GDA_CONNECTION_OPTIONS_NONE, NULL);
+  g_free (cncstring);
+  g_assert_nonnull (fixture->cnc);
+
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc,
+                                                              "CREATE TABLE nums (a INTEGER, b INTEGER, s TEXT)",
+                                                              NULL), !=, -1);
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc,
+                                                              "INSERT INTO nums VALUES (1, 2, 'x'), (7, 0, NULL), (-3, 4, 'y')",
+                                                              NULL), ==, 3);
+
+  /* invoice i has (i % 4) lines, with ids i * 10 + k and a quantity of (i + k) % 5 */
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc,
+                                                              "CREATE TABLE invoices (id INTEGER PRIMARY KEY, customer TEXT)",
+                                                              NULL), !=, -1);
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc,
+                                                              "CREATE TABLE lines (id INTEGER PRIMARY KEY, invoice_id INTEGER, qty INTEGER)",
+                                                              NULL), !=, -1);
+  sql = g_strdup_printf ("WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c WHERE x < %d) "
+                         "INSERT INTO invoices SELECT x, 'customer' || x FROM c", NB_INVOICES);
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc, sql, NULL), ==, NB_INVOICES);
+  g_free (sql);
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc,
+                                                              "WITH RECURSIVE k(y) AS (SELECT 1 UNION ALL SELECT y + 1 FROM k WHERE y < 3) "
+                                                              "INSERT INTO lines SELECT i.id * 10 + k.y, i.id, (i.id + k.y) % 5 "
+                                                              "FROM invoices i, k WHERE k.y <= i.id % 4",
+                                                              NULL), >, 0);
+}
+
+static void
+test_report_finish (TestObjectFixture *fixture,
+                    G_GNUC_UNUSED gconstpointer user_data)
+{
+  gda_connection_close (fixture->cnc, NULL);
+  g_object_unref (fixture->cnc);
+  g_unlink (fixture->dbfile);
+  g_free (fixture->dbfile);
+}
+
+/* runs the @spec report and returns its result as a string */
+static gchar *
+run_report (TestObjectFixture *fixture, const gchar *spec)
+{
+  GdaReportEngine *engine;
+  xmlNodePtr node;
+  xmlBufferPtr buffer;
+  GError *error = NULL;
+  gchar *result;
+
+  engine = gda_report_engine_new_from_string (spec);
+  g_assert_nonnull (engine);
+  gda_report_engine_declare_object (engine, G_OBJECT (fixture->cnc), "main_cnc");
+
+  node = gda_report_engine_run_as_node (engine, &error);
+  g_assert_no_error (error);
+  g_assert_nonnull (node);
+
+  buffer = xmlBufferCreate ();
+  xmlNodeDump (buffer, NULL, node, 0, 0);
+  result = g_strdup ((gchar *) xmlBufferContent (buffer));
+  xmlBufferFree (buffer);
+  xmlFreeNode (node);
+  g_object_unref (engine);
+
+  return result;
+}
+
+/* returns the number of statements executed by @cnc since its metrics have been reset */
+static guint64
+count_executed_statements (GdaConnection *cnc)
+{
+  GdaDataModel *metrics;
+  guint64 total = 0;
+  gint i, nrows;
+
+  metrics = gda_connection_get_metrics (cnc);
+  g_assert_nonnull (metrics);
+  nrows = gda_data_model_get_n_rows (metrics);
+  for (i = 0; i < nrows; i++) {
+    const GValue *cvalue;
+    cvalue = gda_data_model_get_value_at (metrics, 1, i, NULL);
+    g_assert_true (cvalue && (G_VALUE_TYPE (cvalue) == G_TYPE_UINT64));
+    total += g_value_get_uint64 (cvalue);
+  }
+  g_object_unref (metrics);
+  return total;
+}
+
+static void
+test_report_expressions (TestObjectFixture *fixture,
+                         G_GNUC_UNUSED gconstpointer user_data)
+{
+  gchar *result;
+
+  /* the abs() function is not evaluated by the engine itself but using SQL */
+  result = run_report (fixture,
+                       "<report><gda_report_section>"
+                       "<gda_report_query query_name=\"nums\" cnc_name=\"main_cnc\">"
+                       "SELECT a, b, s FROM nums ORDER BY rowid</gda_report_query>"
+                       "<gda_report_iter><r>"
+                       "<gda_report_expr>##nums|@a + ##nums|@b</gda_report_expr>|"
+                       "<gda_report_expr>##nums|@a / ##nums|@b</gda_report_expr>|"
+                       "<gda_report_expr>##nums|@s || '-' || ##nums|@a</gda_report_expr>|"
+                       "<gda_report_expr>abs (##nums|@a ) &gt; 2</gda_report_expr>|"
+                       "<gda_report_if expr=\"##nums|@s IS NULL\">"
+                       "<gda_report_if_true>null</gda_report_if_true>"
+                       "<gda_report_if_false>set</gda_report_if_false></gda_report_if>"
+                       "</r></gda_report_iter>"
+                       "</gda_report_section></report>");
+  g_assert_cmpstr (result, ==,
+                   "<report><r>3|0|x-1|0|set</r><r>7|||1|null</r><r>1|0|y--3|1|set</r></report>");
+  g_free (result);
+}
+
+static gchar *
+expected_invoices (void)
+{
+  GString *string;
+  gint i, k;
+
+  string = g_string_new ("<report>");
+  for (i = 1; i <= NB_INVOICES; i++) {
+    g_string_append_printf (string, "<i>%d:", i);
+    for (k = 1; k <= i % 4; k++) {
+      gint qty = (i + k) % 5;
+      if (qty > 0)
+        g_string_append_printf (string, "<l>%d=%d</l>", i * 10 + k, qty * 2);
+    }
+    g_string_append (string, "</i>");
+  }
+  g_string_append (string, "</report>");
+  return g_string_free (string, FALSE);
+}
+
+static void
+test_report_nested (TestObjectFixture *fixture,
+                    G_GNUC_UNUSED gconstpointer user_data)
+{
+  const gchar *variants[] = {
+    /* fetched in batches of invoices */
+    "",
+    /* executed once per invoice */
+    " LIMIT 10"
+  };
+  /* statements executed for each variant, including the invoices' one */
+  const guint64 nb_statements[] = {
+    1 + (NB_INVOICES + PREFETCH_BATCH_SIZE - 1) / PREFETCH_BATCH_SIZE,
+    1 + NB_INVOICES
+  };
+  gchar *expected;
+  guint i;
+
+  g_object_set (fixture->cnc, "statement-metrics", TRUE, NULL);
+  expected = expected_invoices ();
+  for (i = 0; i < G_N_ELEMENTS (variants); i++) {
+    gchar *spec, *result;
+
+    spec = g_strdup_printf ("<report><gda_report_section>"
+                            "<gda_report_query query_name=\"invoices\" cnc_name=\"main_cnc\">"
+                            "SELECT id, customer FROM invoices ORDER BY id</gda_report_query>"
+                            "<gda_report_iter><i><gda_report_param_value param_name=\"invoices|@id\"/>:"
+                            "<gda_report_section><gda_report_query query_name=\"lines\">"
+                            "SELECT l.id, l.qty FROM lines l WHERE l.invoice_id = ##invoices|@id::gint "
+                            "AND l.qty &gt; 0 ORDER BY l.id%s</gda_report_query>"
+                            "<gda_report_iter><l><gda_report_param_value param_name=\"lines|@id\"/>="
+                            "<gda_report_expr>##lines|@qty * 2</gda_report_expr></l></gda_report_iter>"
+                            "</gda_report_section></i></gda_report_iter>"
+                            "</gda_report_section></report>", variants[i]);
+    gda_connection_reset_metrics (fixture->cnc);
+    result = run_report (fixture, spec);
+    g_free (spec);
+    g_assert_cmpstr (result, ==, expected);
+    g_free (result);
+    g_assert_cmpuint (count_executed_statements (fixture->cnc), ==, nb_statements[i]);
+  }
+  g_free (expected);
+  g_object_set (fixture->cnc, "statement-metrics", FALSE, NULL);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  setlocale (LC_ALL,"");
+  g_test_init (&argc, &argv, NULL);
+  gda_init ();
+
+  g_test_add ("/test-report-engine/expressions",
+              TestObjectFixture,
+              NULL,
+              test_report_start,
+              test_report_expressions,
+              test_report_finish);
+
+  g_test_add ("/test-report-engine/nested",
+              TestObjectFixture,
+              NULL,
+              test_report_start,
+              test_report_nested,
+              test_report_finish);
+
+  return g_test_run ();
+}
@@ -64,6 +64,8 @@ typedef struct
 {
 	GtkWidget *raw_grid;
 	GtkWidget *info;
+	GtkWidget *sw;
+	GtkWidget *virtual_scrollbar; /* shown in virtual mode */
 } GdauiGridPrivate;
 
 G_DEFINE_TYPE_WITH_CODE(GdauiGrid, gdaui_grid, GTK_TYPE_BOX,
@@ -143,7 +145,7 @@ raw_grid_selection_changed_cb (G_GNUC_UNUSED GdauiRawGrid *rawgrid, GdauiGrid *g
 static void
 gdaui_grid_init (GdauiGrid *grid)
 {
-	GtkWidget *sw;
+	GtkWidget *sw, *hbox;
 
 	GdauiGridPrivate *priv = gdaui_grid_get_instance_private (grid);
 	priv->raw_grid = NULL;
@@ -151,11 +153,19 @@ gdaui_grid_init (GdauiGrid *grid)
 
 	gtk_orientable_set_orientation (GTK_ORIENTABLE (grid), GTK_ORIENTATION_VERTICAL);
 
+	hbox = gtk_box_new (GTK_ORIENTATION_HORIZONTAL, 0);
+	gtk_box_pack_start (GTK_BOX (grid), hbox, TRUE, TRUE, 0);
+	gtk_widget_show (hbox);
+
 	sw = gtk_scrolled_window_new (NULL, NULL);
         gtk_scrolled_window_set_policy (GTK_SCROLLED_WINDOW (sw), GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
         gtk_scrolled_window_set_shadow_type (GTK_SCROLLED_WINDOW (sw), GTK_SHADOW_IN);
-	gtk_box_pack_start (GTK_BOX (grid), sw, TRUE, TRUE, 0);
+	gtk_box_pack_start (GTK_BOX (hbox), sw, TRUE, TRUE, 0);
 	gtk_widget_show (sw);
+	priv->sw = sw;
+
+	priv->virtual_scrollbar = gtk_scrollbar_new (GTK_ORIENTATION_VERTICAL, NULL);
+	gtk_box_pack_start (GTK_BOX (hbox), priv->virtual_scrollbar, FALSE, FALSE, 0);
 
 	priv->raw_grid = gdaui_raw_grid_new (NULL);
 	gtk_container_add (GTK_CONTAINER (sw), priv->raw_grid);
@@ -293,6 +303,40 @@ gdaui_grid_set_sample_size (GdauiGrid *grid, gint sample_size)
 	gdaui_raw_grid_set_sample_size (GDAUI_RAW_GRID (priv->raw_grid), sample_size);
 }
 
+/**
+ * gdaui_grid_set_virtual_mode:
+ * @grid: a #GdauiGrid widget
+ * @virtual_mode: %TRUE to enable the virtual mode
+ *
+ * Enables or disables the virtual mode suited to browse very large data models,
+ * see gdaui_raw_grid_set_virtual_mode(). In virtual mode, the vertical scrollbar
+ * represents the position of the visible rows among all the rows of the data model.
+ *
+ * Since: 6.0
+ */
+void
+gdaui_grid_set_virtual_mode (GdauiGrid *grid, gboolean virtual_mode)
+{
+	g_return_if_fail (grid && GDAUI_IS_GRID (grid));
+	GdauiGridPrivate *priv = gdaui_grid_get_instance_private (grid);
+
+	gdaui_raw_grid_set_virtual_mode (GDAUI_RAW_GRID (priv->raw_grid), virtual_mode);
+
+	/* the raw grid's own scrollbar only represents the position within the displayed sample */
+	if (virtual_mode) {
+		gtk_range_set_adjustment (GTK_RANGE (priv->virtual_scrollbar),
+					  _gdaui_raw_grid_get_virtual_adjustment (GDAUI_RAW_GRID (priv->raw_grid)));
+		gtk_scrolled_window_set_policy (GTK_SCROLLED_WINDOW (priv->sw),
+						GTK_POLICY_AUTOMATIC, GTK_POLICY_EXTERNAL);
+		gtk_widget_show (priv->virtual_scrollbar);
+	}
+	else {
+		gtk_widget_hide (priv->virtual_scrollbar);
+		gtk_scrolled_window_set_policy (GTK_SCROLLED_WINDOW (priv->sw),
+						GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+	}
+}
+
 /* GdauiDataProxy interface */
 static GdaDataProxy *
 gdaui_grid_get_proxy (GdauiDataProxy *iface)
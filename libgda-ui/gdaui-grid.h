@@ -45,6 +45,7 @@ struct _GdauiGridClass
 
 GtkWidget        *gdaui_grid_new                 (GdaDataModel *model);
 void              gdaui_grid_set_sample_size     (GdauiGrid *grid, gint sample_size);
+void              gdaui_grid_set_virtual_mode    (GdauiGrid *grid, gboolean virtual_mode);
 
 G_END_DECLS
 
@@ -28,6 +28,7 @@
 #include <libgda-ui.h>
 #include <libgda/gda-blob-op.h>
 #include "internal/utility.h"
+#include "internal/gdaui-prefetch-model.h"
 #include "marshallers/gdaui-marshal.h"
 #include "data-entries/gdaui-data-cell-renderer-combo.h"
 #include "data-entries/gdaui-data-cell-renderer-info.h"
@@ -49,6 +50,12 @@ static void gdaui_raw_grid_get_property (GObject *object,
 static void create_columns_data (GdauiRawGrid *grid);
 
 static void proxy_sample_changed_cb (GdaDataProxy *proxy, gint sample_start, gint sample_end, GdauiRawGrid *grid);
+static GdaDataModel *virtual_wrap_model (GdauiRawGrid *grid, GdaDataModel *model);
+static void virtual_vadjustment_notify_cb (GdauiRawGrid *grid, GParamSpec *pspec, gpointer data);
+static void virtual_set_vadjustment (GdauiRawGrid *grid, GtkAdjustment *adj);
+static void virtual_mode_setup (GdauiRawGrid *grid);
+static void virtual_update_position (GdauiRawGrid *grid);
+static void virtual_pos_value_changed_cb (GtkAdjustment *adj, GdauiRawGrid *grid);
 static void proxy_row_updated_cb (GdaDataProxy *proxy, gint proxy_row, GdauiRawGrid *grid);
 static void proxy_reset_pre_cb (GdaDataProxy *proxy, GdauiRawGrid *grid);
 static void proxy_reset_cb (GdaDataProxy *proxy, GdauiRawGrid *grid);
@@ -140,8 +147,21 @@ typedef struct
 	gint                        bin_y;
 
 	GSList                     *formatting_funcs; /* list of #FormattingFuncData structures */
+
+	/* virtual mode, see gdaui_raw_grid_set_virtual_mode() */
+	gboolean                    virtual_mode;
+	GtkAdjustment              *virtual_vadj; /* ref held */
+	GtkAdjustment              *virtual_pos_adj; /* position among all the rows, ref held */
+	gint                        virtual_first; /* first visible row at the last scroll */
+	gint                        virtual_nb_visible; /* number of visible rows at the last scroll */
+	gboolean                    virtual_sliding; /* TRUE while the sample is being moved */
+	gint                        virtual_saved_sample_size; /* sample size to restore, or -1 */
 } GdauiRawGridPrivate;
 
+/* number of rows in the proxy's sample, and of cached rows in virtual mode */
+#define VIRTUAL_SAMPLE_SIZE 500
+#define VIRTUAL_CACHE_SIZE (4 * VIRTUAL_SAMPLE_SIZE)
+
 G_DEFINE_TYPE_WITH_CODE (GdauiRawGrid, gdaui_raw_grid, GTK_TYPE_TREE_VIEW,
                          G_ADD_PRIVATE (GdauiRawGrid)
                          G_IMPLEMENT_INTERFACE (GDAUI_TYPE_DATA_PROXY, gdaui_raw_grid_widget_init)
@@ -313,6 +333,7 @@ gdaui_raw_grid_init (GdauiRawGrid *grid)
 	priv->columns_hash = g_hash_table_new (NULL, NULL);
 	priv->export_type = 1;
 	priv->write_mode = GDAUI_DATA_PROXY_WRITE_ON_DEMAND;
+	priv->virtual_saved_sample_size = -1;
 
 	tree_view = GTK_TREE_VIEW (grid);
 	gtk_tree_view_set_enable_search (GTK_TREE_VIEW (tree_view), TRUE);
@@ -373,6 +394,16 @@ gdaui_raw_grid_dispose (GObject *object)
 
 	gdaui_raw_grid_clean (grid);
 
+	if (priv->virtual_mode) {
+		g_signal_handlers_disconnect_by_func (grid, G_CALLBACK (virtual_vadjustment_notify_cb), NULL);
+		virtual_set_vadjustment (grid, NULL);
+	}
+	if (priv->virtual_pos_adj) {
+		g_signal_handlers_disconnect_by_func (priv->virtual_pos_adj,
+						      G_CALLBACK (virtual_pos_value_changed_cb), grid);
+		g_clear_object (&(priv->virtual_pos_adj));
+	}
+
 	if (priv->formatting_funcs) {
 		g_slist_free_full (priv->formatting_funcs, (GDestroyNotify) formatting_func_destroy);
 		priv->formatting_funcs = NULL;
@@ -408,16 +439,26 @@ gdaui_raw_grid_set_property (GObject *object,
 					gdaui_raw_grid_clean (grid);
 					g_assert (!priv->proxy);
 				}
-				else
-					g_object_set (G_OBJECT (priv->proxy), "model", model, NULL);
+				else {
+					GdaDataModel *wmodel;
+					wmodel = virtual_wrap_model (grid, model);
+					g_object_set (G_OBJECT (priv->proxy), "model", wmodel, NULL);
+					g_object_unref (wmodel);
+					if (priv->virtual_mode)
+						virtual_mode_setup (grid);
+				}
 			}
 
 			if (!priv->proxy) {
 				/* first time setting */
 				if (GDA_IS_DATA_PROXY (model))
 					priv->proxy = GDA_DATA_PROXY (g_object_ref (G_OBJECT (model)));
-				else
-					priv->proxy = GDA_DATA_PROXY (gda_data_proxy_new (model));
+				else {
+					GdaDataModel *wmodel;
+					wmodel = virtual_wrap_model (grid, model);
+					priv->proxy = GDA_DATA_PROXY (gda_data_proxy_new (wmodel));
+					g_object_unref (wmodel);
+				}
 
 				g_signal_connect (priv->proxy, "reset",
 						  G_CALLBACK (proxy_reset_pre_cb), grid);
@@ -452,6 +493,8 @@ gdaui_raw_grid_set_property (GObject *object,
 
 				create_columns_data (grid);
 				reset_columns_default (grid);
+				if (priv->virtual_mode)
+					virtual_mode_setup (grid);
 
 				g_signal_emit_by_name (object, "proxy-changed", priv->proxy);
 			}
@@ -2256,6 +2299,11 @@ gdaui_raw_grid_set_sample_size (GdauiRawGrid *grid, gint sample_size)
 	g_return_if_fail (grid && GDAUI_IS_RAW_GRID (grid));
 	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
 
+	if (priv->virtual_mode) {
+		/* applied when the virtual mode is disabled */
+		priv->virtual_saved_sample_size = sample_size;
+		return;
+	}
 	gda_data_proxy_set_sample_size (priv->proxy, sample_size);
 }
 
@@ -2276,6 +2324,281 @@ gdaui_raw_grid_set_sample_start (GdauiRawGrid *grid, gint sample_start)
 	gda_data_proxy_set_sample_start (priv->proxy, sample_start);
 }
 
+/*
+ * Returns: (transfer full): the data model to proxy in order to display @model
+ */
+static GdaDataModel *
+virtual_wrap_model (GdauiRawGrid *grid, GdaDataModel *model)
+{
+	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
+	if (priv->virtual_mode && !GDAUI_IS_PREFETCH_MODEL (model)) {
+		GdaDataModel *pmodel;
+		pmodel = _gdaui_prefetch_model_new (model, VIRTUAL_CACHE_SIZE);
+		/* don't block the UI moving a cursor to the rows to display */
+		_gdaui_prefetch_model_set_deferred (GDAUI_PREFETCH_MODEL (pmodel), TRUE);
+		return pmodel;
+	}
+	else
+		return g_object_ref (model);
+}
+
+/*
+ * Updates @priv->virtual_pos_adj to reflect the position of the visible rows among all the
+ * rows of the data model
+ */
+static void
+virtual_update_position (GdauiRawGrid *grid)
+{
+	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
+	gint sample_start, nb_rows, model_nb_rows, upper;
+	gboolean sliding;
+
+	if (!priv->virtual_pos_adj || !priv->proxy)
+		return;
+
+	sample_start = gda_data_proxy_get_sample_start (priv->proxy);
+	nb_rows = gda_data_model_get_n_rows ((GdaDataModel*) priv->proxy);
+	model_nb_rows = gda_data_model_get_n_rows (gda_data_proxy_get_proxied_model (priv->proxy));
+	upper = (model_nb_rows >= 0) ? model_nb_rows : sample_start + nb_rows;
+	if (priv->virtual_nb_visible <= 0)
+		priv->virtual_nb_visible = 1;
+
+	sliding = priv->virtual_sliding;
+	priv->virtual_sliding = TRUE;
+	gtk_adjustment_configure (priv->virtual_pos_adj, sample_start + priv->virtual_first,
+				  0., upper, 1., priv->virtual_nb_visible, priv->virtual_nb_visible);
+	priv->virtual_sliding = sliding;
+}
+
+/*
+ * Moves the sample if the @abs_first row of the data model is close to one of its edges, or outside
+ * of it, keeping @abs_first as the first visible row. If @scroll is %TRUE, @abs_first is made the
+ * first visible row even if the sample does not need to be moved.
+ */
+static void
+virtual_show_row (GdauiRawGrid *grid, gint abs_first, gboolean scroll)
+{
+	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
+	GtkTreePath *path;
+	gint sample_start, new_start, nb_rows, model_nb_rows, margin, nb_visible;
+
+	sample_start = gda_data_proxy_get_sample_start (priv->proxy);
+	nb_rows = gda_data_model_get_n_rows ((GdaDataModel*) priv->proxy);
+	model_nb_rows = gda_data_model_get_n_rows (gda_data_proxy_get_proxied_model (priv->proxy));
+	nb_visible = priv->virtual_nb_visible > 0 ? priv->virtual_nb_visible : 1;
+
+	new_start = sample_start;
+	margin = VIRTUAL_SAMPLE_SIZE / 4;
+	if (((abs_first - sample_start < margin) && (sample_start > 0)) ||
+	    ((abs_first + nb_visible - 1 >= sample_start + nb_rows - margin) &&
+	     ((model_nb_rows < 0) || (sample_start + nb_rows < model_nb_rows)))) {
+		new_start = abs_first - (VIRTUAL_SAMPLE_SIZE - nb_visible) / 2;
+		if (new_start < 0)
+			new_start = 0;
+	}
+
+	priv->virtual_sliding = TRUE;
+	if (new_start != sample_start) {
+		gda_data_proxy_set_sample_start (priv->proxy, new_start);
+		scroll = TRUE;
+	}
+	if (scroll && (abs_first - new_start >= 0) &&
+	    (abs_first - new_start < gda_data_model_get_n_rows ((GdaDataModel*) priv->proxy))) {
+		path = gtk_tree_path_new_from_indices (abs_first - new_start, -1);
+		gtk_tree_view_scroll_to_cell ((GtkTreeView*) grid, path, NULL, TRUE, 0., 0.);
+		gtk_tree_path_free (path);
+		priv->virtual_first = abs_first - new_start;
+	}
+	priv->virtual_sliding = FALSE;
+	virtual_update_position (grid);
+}
+
+static void
+virtual_vadjustment_value_changed_cb (G_GNUC_UNUSED GtkAdjustment *adj, GdauiRawGrid *grid)
+{
+	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
+	GtkTreePath *start_path, *end_path;
+	GdaDataModel *model;
+	gint first, last, sample_start;
+
+	if (priv->virtual_sliding || !priv->proxy)
+		return;
+	if (! gtk_tree_view_get_visible_range ((GtkTreeView*) grid, &start_path, &end_path))
+		return;
+	first = gtk_tree_path_get_indices (start_path) [0];
+	last = gtk_tree_path_get_indices (end_path) [0];
+	gtk_tree_path_free (start_path);
+	gtk_tree_path_free (end_path);
+
+	sample_start = gda_data_proxy_get_sample_start (priv->proxy);
+	model = gda_data_proxy_get_proxied_model (priv->proxy);
+
+	/* read the rows which are about to be displayed while the user is scrolling */
+	if (GDAUI_IS_PREFETCH_MODEL (model)) {
+		if (first < priv->virtual_first)
+			_gdaui_prefetch_model_prefetch (GDAUI_PREFETCH_MODEL (model),
+							sample_start + first - VIRTUAL_SAMPLE_SIZE / 2,
+							sample_start + first - 1);
+		else if (first > priv->virtual_first)
+			_gdaui_prefetch_model_prefetch (GDAUI_PREFETCH_MODEL (model),
+							sample_start + last + 1,
+							sample_start + last + VIRTUAL_SAMPLE_SIZE / 2);
+	}
+	priv->virtual_first = first;
+	priv->virtual_nb_visible = last - first + 1;
+
+	/* move the sample when getting close to its edges, keeping the same rows on screen */
+	virtual_show_row (grid, sample_start + first, FALSE);
+}
+
+/* the user moved the scrollbar showing the position among all the rows */
+static void
+virtual_pos_value_changed_cb (GtkAdjustment *adj, GdauiRawGrid *grid)
+{
+	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
+	GdaDataModel *model;
+	gint abs_first;
+
+	if (priv->virtual_sliding || !priv->proxy)
+		return;
+
+	abs_first = (gint) gtk_adjustment_get_value (adj);
+	model = gda_data_proxy_get_proxied_model (priv->proxy);
+	if (GDAUI_IS_PREFETCH_MODEL (model))
+		_gdaui_prefetch_model_prefetch (GDAUI_PREFETCH_MODEL (model), abs_first,
+						abs_first + priv->virtual_nb_visible - 1);
+	virtual_show_row (grid, abs_first, TRUE);
+}
+
+static void
+virtual_set_vadjustment (GdauiRawGrid *grid, GtkAdjustment *adj)
+{
+	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
+
+	if (priv->virtual_vadj) {
+		g_signal_handlers_disconnect_by_func (priv->virtual_vadj,
+						      G_CALLBACK (virtual_vadjustment_value_changed_cb), grid);
+		g_object_unref (priv->virtual_vadj);
+		priv->virtual_vadj = NULL;
+	}
+	if (adj) {
+		priv->virtual_vadj = g_object_ref (adj);
+		g_signal_connect (adj, "value-changed",
+				  G_CALLBACK (virtual_vadjustment_value_changed_cb), grid);
+	}
+}
+
+static void
+virtual_vadjustment_notify_cb (GdauiRawGrid *grid, G_GNUC_UNUSED GParamSpec *pspec,
+			       G_GNUC_UNUSED gpointer data)
+{
+	virtual_set_vadjustment (grid, gtk_scrollable_get_vadjustment (GTK_SCROLLABLE (grid)));
+}
+
+static void
+virtual_mode_setup (GdauiRawGrid *grid)
+{
+	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
+	if (priv->virtual_saved_sample_size < 0)
+		priv->virtual_saved_sample_size = gda_data_proxy_get_sample_size (priv->proxy);
+	gda_data_proxy_set_sample_size (priv->proxy, VIRTUAL_SAMPLE_SIZE);
+	priv->virtual_first = 0;
+	virtual_update_position (grid);
+}
+
+/*
+ * _gdaui_raw_grid_get_virtual_adjustment:
+ * @grid: a #GdauiRawGrid
+ *
+ * Get the adjustment representing the position of the visible rows among all the rows of the
+ * data model when @grid is in virtual mode, to be used by a vertical scrollbar: @grid's own
+ * vertical adjustment only represents the position within the displayed sample.
+ *
+ * Returns: (transfer none): the #GtkAdjustment, or %NULL if @grid is not in virtual mode
+ */
+GtkAdjustment *
+_gdaui_raw_grid_get_virtual_adjustment (GdauiRawGrid *grid)
+{
+	g_return_val_if_fail (GDAUI_IS_RAW_GRID (grid), NULL);
+	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
+
+	return priv->virtual_mode ? priv->virtual_pos_adj : NULL;
+}
+
+/**
+ * gdaui_raw_grid_set_virtual_mode:
+ * @grid: a #GdauiRawGrid
+ * @virtual_mode: %TRUE to enable the virtual mode
+ *
+ * In virtual mode, @grid is suited to browse very large data models: only a sample of 500 rows
+ * is displayed at a time, which automatically follows the visible rows when scrolling, and the
+ * rows of the data model are read when first displayed and kept in a cache of bounded size. The
+ * rows about to be displayed are read in advance in a worker thread. The sample size set using
+ * gdaui_raw_grid_set_sample_size() is applied again when the virtual mode is disabled.
+ *
+ * As @grid's vertical adjustment only represents the position within the sample, a #GdauiGrid
+ * displays another vertical scrollbar representing the position among all the rows.
+ *
+ * In virtual mode, the data is displayed read-only, and the data model is accessed from a worker
+ * thread, so it must not be modified from another thread while displayed; the #GdauiRawGrid:model
+ * property then refers to a read-only data model with the same contents which can safely be used
+ * from the thread using @grid. Data models which only support cursor based access can be displayed,
+ * their rows being read by the worker thread only, but the rows which can be displayed again after
+ * scrolling backwards depend on the data model's capabilities.
+ *
+ * Changing the mode discards any modification not yet written to the data model.
+ *
+ * Since: 6.0
+ */
+void
+gdaui_raw_grid_set_virtual_mode (GdauiRawGrid *grid, gboolean virtual_mode)
+{
+	g_return_if_fail (GDAUI_IS_RAW_GRID (grid));
+	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
+
+	if (priv->virtual_mode == virtual_mode)
+		return;
+	priv->virtual_mode = virtual_mode;
+
+	if (virtual_mode) {
+		g_signal_connect (grid, "notify::vadjustment",
+				  G_CALLBACK (virtual_vadjustment_notify_cb), NULL);
+		virtual_set_vadjustment (grid, gtk_scrollable_get_vadjustment (GTK_SCROLLABLE (grid)));
+		if (!priv->virtual_pos_adj) {
+			priv->virtual_pos_adj = g_object_ref_sink (gtk_adjustment_new (0., 0., 0., 1., 1., 1.));
+			g_signal_connect (priv->virtual_pos_adj, "value-changed",
+					  G_CALLBACK (virtual_pos_value_changed_cb), grid);
+		}
+	}
+	else {
+		g_signal_handlers_disconnect_by_func (grid, G_CALLBACK (virtual_vadjustment_notify_cb), NULL);
+		virtual_set_vadjustment (grid, NULL);
+	}
+
+	if (priv->proxy) {
+		GdaDataModel *model, *wmodel;
+
+		model = gda_data_proxy_get_proxied_model (priv->proxy);
+		if (virtual_mode)
+			wmodel = virtual_wrap_model (grid, model);
+		else if (GDAUI_IS_PREFETCH_MODEL (model))
+			wmodel = g_object_ref (_gdaui_prefetch_model_get_model (GDAUI_PREFETCH_MODEL (model)));
+		else
+			wmodel = g_object_ref (model);
+		if (wmodel != model)
+			g_object_set (G_OBJECT (priv->proxy), "model", wmodel, NULL);
+		g_object_unref (wmodel);
+		priv->data_model = gda_data_proxy_get_proxied_model (priv->proxy);
+
+		if (virtual_mode)
+			virtual_mode_setup (grid);
+		else if (priv->virtual_saved_sample_size >= 0)
+			gda_data_proxy_set_sample_size (priv->proxy, priv->virtual_saved_sample_size);
+	}
+	if (!virtual_mode)
+		priv->virtual_saved_sample_size = -1;
+}
+
 /**
  * gdaui_raw_grid_set_layout_from_file:
  * @grid: a #GdauiRawGrid
@@ -2713,6 +3036,10 @@ static void
 proxy_sample_changed_cb (G_GNUC_UNUSED GdaDataProxy *proxy, G_GNUC_UNUSED gint sample_start,
 			 G_GNUC_UNUSED gint sample_end, GdauiRawGrid *grid)
 {
+	GdauiRawGridPrivate *priv = gdaui_raw_grid_get_instance_private (grid);
+	if (priv->virtual_sliding)
+		return; /* the displayed rows are kept in place */
+
 	/* bring back the vertical scrollbar to the top */
 	gtk_adjustment_set_value (gtk_scrollable_get_vadjustment (GTK_SCROLLABLE (grid)), 0.);
 }
@@ -2793,6 +3120,8 @@ proxy_reset_cb (GdaDataProxy *proxy, GdauiRawGrid *grid)
 		gda_data_model_iter_invalidate_contents (priv->iter);
 	priv->iter_row = -1;
 	priv->data_model = gda_data_proxy_get_proxied_model (priv->proxy);
+	if (priv->virtual_mode)
+		virtual_update_position (grid);
 
 	if (! priv->reset_soft)
 		g_signal_emit_by_name (grid, "proxy-changed", priv->proxy);
@@ -53,6 +53,7 @@ GtkWidget *gdaui_raw_grid_new                   (GdaDataModel *model);
 
 void       gdaui_raw_grid_set_sample_size       (GdauiRawGrid *grid, gint sample_size);
 void       gdaui_raw_grid_set_sample_start      (GdauiRawGrid *grid, gint sample_start);
+void       gdaui_raw_grid_set_virtual_mode      (GdauiRawGrid *grid, gboolean virtual_mode);
 
 void       gdaui_raw_grid_set_layout_from_file  (GdauiRawGrid *grid, const gchar *file_name, const gchar *grid_name);
 
@@ -63,6 +64,7 @@ void       gdaui_raw_grid_remove_formatting_function (GdauiRawGrid *grid, GdauiR
 
 /* private API */
 GList     *_gdaui_raw_grid_get_selection        (GdauiRawGrid *grid);
+GtkAdjustment *_gdaui_raw_grid_get_virtual_adjustment (GdauiRawGrid *grid);
 
 G_END_DECLS
 
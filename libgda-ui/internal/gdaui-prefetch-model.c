@@ -0,0 +1,745 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <glib/gi18n-lib.h>
+#include <libgda/gda-row.h>
+#include "gdaui-prefetch-model.h"
+
+/*
+ * Threading:
+ *
+ * The wrapped data model is only accessed with @model_mutex locked, either by the thread
+ * using the GdauiPrefetchModel object (on a cache miss), or by the worker thread (to read ahead).
+ *
+ * The rows read ahead by the worker thread are stored in @ready, and only moved to @rows by
+ * the thread using the object, in _gdaui_prefetch_model_get_value_at(): this way the values
+ * returned by that function are never freed by the worker thread.
+ *
+ * When reads are deferred (see _gdaui_prefetch_model_set_deferred()), the rows missing from the
+ * cache are stored in @missing and read by the worker thread, which then attaches @notify to
+ * @context: the "row-updated" signal is emitted for them from the thread using the object.
+ */
+
+typedef struct {
+	gint    rownum;
+	GdaRow *row;
+	GList   link; /* in @lru */
+} CachedRow;
+
+struct _GdauiPrefetchModel {
+	GObject           object;
+
+	GdaDataModel     *model;
+	GdaDataModelIter *iter; /* used to access @model if it does not support random access */
+	gint              nb_cols;
+	gint              nb_rows; /* number of rows of @model, or -1 if unknown */
+	gint              cache_size; /* max. number of rows in @rows */
+	gint              read_ahead; /* number of rows read ahead */
+
+	GRecMutex         model_mutex; /* locked when @model or @iter are used */
+
+	GMutex            mutex; /* protects all the following attributes */
+	GCond             cond;
+	GHashTable       *rows; /* key = row number, value = a #CachedRow */
+	GQueue            lru;  /* of CachedRow, most recently used first */
+	GHashTable       *ready; /* key = row number, value = a #GdaRow read by the worker thread */
+	gint              last_row; /* last row accessed by _gdaui_prefetch_model_get_value_at() */
+	gint              req_next; /* next row to read ahead */
+	gint              req_last; /* last row to read ahead */
+	guint             generation; /* incremented each time the cache is flushed */
+	gboolean          busy; /* TRUE while the worker thread is reading a row */
+	gboolean          quit;
+	GThread          *worker;
+
+	gboolean          deferred;
+	GHashTable       *missing; /* set of row numbers requested while not in the cache */
+	GMainContext     *context; /* of the thread using the object */
+	GSource          *notify; /* attached to @context when some missing rows have been read */
+};
+
+static void _gdaui_prefetch_model_data_model_init (GdaDataModelInterface *iface);
+
+G_DEFINE_TYPE_WITH_CODE (GdauiPrefetchModel, _gdaui_prefetch_model, G_TYPE_OBJECT,
+			 G_IMPLEMENT_INTERFACE (GDA_TYPE_DATA_MODEL, _gdaui_prefetch_model_data_model_init))
+
+static void
+cached_row_free (CachedRow *crow)
+{
+	g_object_unref (crow->row);
+	g_free (crow);
+}
+
+/* @pmodel->mutex must be locked */
+static void
+cache_flush (GdauiPrefetchModel *pmodel)
+{
+	g_queue_init (&(pmodel->lru));
+	g_hash_table_remove_all (pmodel->rows);
+	g_hash_table_remove_all (pmodel->ready);
+	g_hash_table_remove_all (pmodel->missing);
+	pmodel->req_next = 0;
+	pmodel->req_last = -1;
+	pmodel->last_row = -1;
+	pmodel->generation ++;
+}
+
+static void
+model_changed (GdauiPrefetchModel *pmodel)
+{
+	gint nb_rows;
+
+	g_rec_mutex_lock (&(pmodel->model_mutex));
+	nb_rows = gda_data_model_get_n_rows (pmodel->model);
+	g_rec_mutex_unlock (&(pmodel->model_mutex));
+
+	g_mutex_lock (&(pmodel->mutex));
+	cache_flush (pmodel);
+	pmodel->nb_rows = nb_rows;
+	g_mutex_unlock (&(pmodel->mutex));
+}
+
+static void
+model_row_inserted_cb (G_GNUC_UNUSED GdaDataModel *mod, gint row, GdauiPrefetchModel *pmodel)
+{
+	model_changed (pmodel);
+	gda_data_model_row_inserted ((GdaDataModel*) pmodel, row);
+}
+
+static void
+model_row_updated_cb (G_GNUC_UNUSED GdaDataModel *mod, gint row, GdauiPrefetchModel *pmodel)
+{
+	model_changed (pmodel);
+	gda_data_model_row_updated ((GdaDataModel*) pmodel, row);
+}
+
+static void
+model_row_removed_cb (G_GNUC_UNUSED GdaDataModel *mod, gint row, GdauiPrefetchModel *pmodel)
+{
+	model_changed (pmodel);
+	gda_data_model_row_removed ((GdaDataModel*) pmodel, row);
+}
+
+static void
+model_reset_cb (G_GNUC_UNUSED GdaDataModel *mod, GdauiPrefetchModel *pmodel)
+{
+	model_changed (pmodel);
+	gda_data_model_reset ((GdaDataModel*) pmodel);
+}
+
+static void
+_gdaui_prefetch_model_init (GdauiPrefetchModel *pmodel)
+{
+	g_rec_mutex_init (&(pmodel->model_mutex));
+	g_mutex_init (&(pmodel->mutex));
+	g_cond_init (&(pmodel->cond));
+	pmodel->rows = g_hash_table_new_full (NULL, NULL, NULL, (GDestroyNotify) cached_row_free);
+	pmodel->ready = g_hash_table_new_full (NULL, NULL, NULL, g_object_unref);
+	pmodel->missing = g_hash_table_new (NULL, NULL);
+	pmodel->context = g_main_context_ref_thread_default ();
+	g_queue_init (&(pmodel->lru));
+	pmodel->nb_rows = -1;
+	pmodel->last_row = -1;
+	pmodel->req_next = 0;
+	pmodel->req_last = -1;
+}
+
+static void
+_gdaui_prefetch_model_dispose (GObject *object)
+{
+	GdauiPrefetchModel *pmodel = GDAUI_PREFETCH_MODEL (object);
+
+	if (pmodel->worker) {
+		g_mutex_lock (&(pmodel->mutex));
+		pmodel->quit = TRUE;
+		g_cond_broadcast (&(pmodel->cond));
+		g_mutex_unlock (&(pmodel->mutex));
+		g_thread_join (pmodel->worker);
+		pmodel->worker = NULL;
+	}
+	if (pmodel->notify) {
+		g_source_destroy (pmodel->notify);
+		g_source_unref (pmodel->notify);
+		pmodel->notify = NULL;
+	}
+	g_clear_pointer (&(pmodel->context), g_main_context_unref);
+
+	if (pmodel->model) {
+		g_signal_handlers_disconnect_by_func (pmodel->model,
+						      G_CALLBACK (model_row_inserted_cb), pmodel);
+		g_signal_handlers_disconnect_by_func (pmodel->model,
+						      G_CALLBACK (model_row_updated_cb), pmodel);
+		g_signal_handlers_disconnect_by_func (pmodel->model,
+						      G_CALLBACK (model_row_removed_cb), pmodel);
+		g_signal_handlers_disconnect_by_func (pmodel->model,
+						      G_CALLBACK (model_reset_cb), pmodel);
+		g_clear_object (&(pmodel->iter));
+		g_clear_object (&(pmodel->model));
+	}
+
+	if (pmodel->rows) {
+		g_queue_init (&(pmodel->lru));
+		g_hash_table_destroy (pmodel->rows);
+		pmodel->rows = NULL;
+		g_hash_table_destroy (pmodel->ready);
+		pmodel->ready = NULL;
+		g_hash_table_destroy (pmodel->missing);
+		pmodel->missing = NULL;
+	}
+
+	G_OBJECT_CLASS (_gdaui_prefetch_model_parent_class)->dispose (object);
+}
+
+static void
+_gdaui_prefetch_model_finalize (GObject *object)
+{
+	GdauiPrefetchModel *pmodel = GDAUI_PREFETCH_MODEL (object);
+
+	g_rec_mutex_clear (&(pmodel->model_mutex));
+	g_mutex_clear (&(pmodel->mutex));
+	g_cond_clear (&(pmodel->cond));
+
+	G_OBJECT_CLASS (_gdaui_prefetch_model_parent_class)->finalize (object);
+}
+
+static void
+_gdaui_prefetch_model_class_init (GdauiPrefetchModelClass *klass)
+{
+	GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+	object_class->dispose = _gdaui_prefetch_model_dispose;
+	object_class->finalize = _gdaui_prefetch_model_finalize;
+}
+
+/*
+ * Copies the values of the @rownum row of @pmodel->model, any error being stored
+ * in the returned #GdaRow
+ */
+static GdaRow *
+fetch_row (GdauiPrefetchModel *pmodel, gint rownum)
+{
+	GdaRow *row;
+	gint i;
+
+	row = gda_row_new (pmodel->nb_cols);
+	g_rec_mutex_lock (&(pmodel->model_mutex));
+	if (pmodel->iter && (gda_data_model_iter_get_row (pmodel->iter) != rownum) &&
+	    ! gda_data_model_iter_move_to_row (pmodel->iter, rownum)) {
+		for (i = 0; i < pmodel->nb_cols; i++) {
+			GError *lerror = NULL;
+			g_set_error (&lerror, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ACCESS_ERROR,
+				     _("Can't access row %d"), rownum);
+			gda_row_invalidate_value_e (row, gda_row_get_value (row, i), lerror);
+		}
+	}
+	else {
+		for (i = 0; i < pmodel->nb_cols; i++) {
+			const GValue *cvalue;
+			GValue *dest;
+			GError *lerror = NULL;
+
+			dest = gda_row_get_value (row, i);
+			if (pmodel->iter)
+				cvalue = gda_data_model_iter_get_value_at_e (pmodel->iter, i, &lerror);
+			else
+				cvalue = gda_data_model_get_value_at (pmodel->model, i, rownum, &lerror);
+			if (cvalue) {
+				gda_value_reset_with_type (dest, G_VALUE_TYPE ((GValue *) cvalue));
+				g_value_copy (cvalue, dest);
+			}
+			else
+				gda_row_invalidate_value_e (row, dest, lerror);
+		}
+	}
+	g_rec_mutex_unlock (&(pmodel->model_mutex));
+
+	return row;
+}
+
+/* @pmodel->mutex must be locked */
+static gboolean
+row_is_known (GdauiPrefetchModel *pmodel, gint rownum)
+{
+	return g_hash_table_contains (pmodel->rows, GINT_TO_POINTER (rownum)) ||
+		g_hash_table_contains (pmodel->ready, GINT_TO_POINTER (rownum));
+}
+
+/*
+ * Returns: the first missing row which has not yet been read, or -1.
+ * @pmodel->mutex must be locked.
+ */
+static gint
+next_missing_row (GdauiPrefetchModel *pmodel)
+{
+	GHashTableIter iter;
+	gpointer key;
+	gint rownum = -1;
+
+	g_hash_table_iter_init (&iter, pmodel->missing);
+	while (g_hash_table_iter_next (&iter, &key, NULL)) {
+		if (((rownum < 0) || (GPOINTER_TO_INT (key) < rownum)) && ! row_is_known (pmodel, GPOINTER_TO_INT (key)))
+			rownum = GPOINTER_TO_INT (key);
+	}
+	return rownum;
+}
+
+/* @pmodel->mutex must be locked */
+static gboolean
+worker_has_work (GdauiPrefetchModel *pmodel)
+{
+	return ((pmodel->req_next <= pmodel->req_last) &&
+		((gint) g_hash_table_size (pmodel->ready) < pmodel->read_ahead)) ||
+		(next_missing_row (pmodel) >= 0);
+}
+
+static gboolean notify_missing_rows (GdauiPrefetchModel *pmodel);
+
+static gpointer
+worker_main (GdauiPrefetchModel *pmodel)
+{
+	g_mutex_lock (&(pmodel->mutex));
+	while (!pmodel->quit) {
+		gint rownum;
+		guint generation;
+		GdaRow *row;
+
+		if (! worker_has_work (pmodel)) {
+			g_cond_broadcast (&(pmodel->cond));
+			g_cond_wait (&(pmodel->cond), &(pmodel->mutex));
+			continue;
+		}
+
+		/* the missing rows first, as they are being displayed */
+		rownum = next_missing_row (pmodel);
+		if (rownum < 0) {
+			rownum = pmodel->req_next ++;
+			if (row_is_known (pmodel, rownum))
+				continue;
+		}
+
+		pmodel->busy = TRUE;
+		generation = pmodel->generation;
+		g_mutex_unlock (&(pmodel->mutex));
+
+		row = fetch_row (pmodel, rownum);
+
+		g_mutex_lock (&(pmodel->mutex));
+		pmodel->busy = FALSE;
+		if ((generation == pmodel->generation) && ! row_is_known (pmodel, rownum)) {
+			g_hash_table_insert (pmodel->ready, GINT_TO_POINTER (rownum), row);
+			if (!pmodel->notify &&
+			    g_hash_table_contains (pmodel->missing, GINT_TO_POINTER (rownum))) {
+				pmodel->notify = g_idle_source_new ();
+				g_source_set_callback (pmodel->notify, (GSourceFunc) notify_missing_rows,
+						       pmodel, NULL);
+				g_source_attach (pmodel->notify, pmodel->context);
+			}
+		}
+		else
+			g_object_unref (row);
+	}
+	g_cond_broadcast (&(pmodel->cond));
+	g_mutex_unlock (&(pmodel->mutex));
+
+	return NULL;
+}
+
+/*
+ * Requests the worker thread to read the rows from @first to @last.
+ * @pmodel->mutex must be locked.
+ */
+static void
+request_rows (GdauiPrefetchModel *pmodel, gint first, gint last)
+{
+	if (first < 0)
+		first = 0;
+	if ((pmodel->nb_rows >= 0) && (last >= pmodel->nb_rows))
+		last = pmodel->nb_rows - 1;
+	if (last - first >= pmodel->read_ahead)
+		last = first + pmodel->read_ahead - 1;
+	if (last < first)
+		return;
+
+	pmodel->req_next = first;
+	pmodel->req_last = last;
+	if (! pmodel->worker)
+		pmodel->worker = g_thread_new ("gdaui-prefetch", (GThreadFunc) worker_main, pmodel);
+	g_cond_broadcast (&(pmodel->cond));
+}
+
+/*
+ * Moves the rows read by the worker thread to the cache.
+ * @pmodel->mutex must be locked.
+ */
+static void
+cache_take_ready_rows (GdauiPrefetchModel *pmodel)
+{
+	GHashTableIter iter;
+	gpointer key, value;
+
+	if (g_hash_table_size (pmodel->ready) == 0)
+		return;
+
+	g_hash_table_iter_init (&iter, pmodel->ready);
+	while (g_hash_table_iter_next (&iter, &key, &value)) {
+		CachedRow *crow;
+
+		g_hash_table_iter_steal (&iter);
+		crow = g_new0 (CachedRow, 1);
+		crow->rownum = GPOINTER_TO_INT (key);
+		crow->row = GDA_ROW (value);
+		crow->link.data = crow;
+		g_hash_table_insert (pmodel->rows, key, crow);
+		g_queue_push_head_link (&(pmodel->lru), &(crow->link));
+	}
+
+	/* the worker thread may have stopped because too many rows were waiting */
+	g_cond_broadcast (&(pmodel->cond));
+}
+
+/*
+ * Called from @pmodel->context once some rows which were missing have been read by the worker thread
+ */
+static gboolean
+notify_missing_rows (GdauiPrefetchModel *pmodel)
+{
+	GHashTableIter iter;
+	gpointer key;
+	GSList *rows = NULL, *list;
+
+	g_mutex_lock (&(pmodel->mutex));
+	g_source_unref (pmodel->notify);
+	pmodel->notify = NULL;
+	cache_take_ready_rows (pmodel);
+	g_hash_table_iter_init (&iter, pmodel->missing);
+	while (g_hash_table_iter_next (&iter, &key, NULL)) {
+		if (g_hash_table_contains (pmodel->rows, key)) {
+			rows = g_slist_prepend (rows, key);
+			g_hash_table_iter_remove (&iter);
+		}
+	}
+	g_mutex_unlock (&(pmodel->mutex));
+
+	for (list = rows; list; list = list->next)
+		gda_data_model_row_updated ((GdaDataModel*) pmodel, GPOINTER_TO_INT (list->data));
+	g_slist_free (rows);
+
+	return G_SOURCE_REMOVE;
+}
+
+/**
+ * _gdaui_prefetch_model_new:
+ * @model: a #GdaDataModel
+ * @cache_size: the maximum number of rows of @model kept in memory
+ *
+ * Creates a new read-only data model with the same contents as @model. Rows are copied from
+ * @model when first accessed, and the rows after (or before, when moving backwards) the accessed
+ * ones are read in advance in a worker thread.
+ *
+ * @model is accessed from several threads, though never concurrently by the returned object:
+ * it must not be modified by another thread while it is wrapped.
+ *
+ * Returns: (transfer full): a new #GdaDataModel
+ */
+GdaDataModel *
+_gdaui_prefetch_model_new (GdaDataModel *model, gint cache_size)
+{
+	GdauiPrefetchModel *pmodel;
+
+	g_return_val_if_fail (GDA_IS_DATA_MODEL (model), NULL);
+	g_return_val_if_fail (cache_size > 1, NULL);
+
+	pmodel = g_object_new (GDAUI_TYPE_PREFETCH_MODEL, NULL);
+	pmodel->model = g_object_ref (model);
+	pmodel->cache_size = cache_size;
+	pmodel->read_ahead = cache_size / 4 > 0 ? cache_size / 4 : 1;
+	pmodel->nb_cols = gda_data_model_get_n_columns (model);
+	pmodel->nb_rows = gda_data_model_get_n_rows (model);
+	if (! (gda_data_model_get_access_flags (model) & GDA_DATA_MODEL_ACCESS_RANDOM)) {
+		pmodel->iter = gda_data_model_create_iter (model);
+		g_object_set (pmodel->iter, "validate-changes", FALSE, NULL);
+	}
+
+	g_signal_connect (model, "row-inserted",
+			  G_CALLBACK (model_row_inserted_cb), pmodel);
+	g_signal_connect (model, "row-updated",
+			  G_CALLBACK (model_row_updated_cb), pmodel);
+	g_signal_connect (model, "row-removed",
+			  G_CALLBACK (model_row_removed_cb), pmodel);
+	g_signal_connect (model, "reset",
+			  G_CALLBACK (model_reset_cb), pmodel);
+
+	return GDA_DATA_MODEL (pmodel);
+}
+
+/**
+ * _gdaui_prefetch_model_get_model:
+ * @pmodel: a #GdauiPrefetchModel
+ *
+ * Returns: (transfer none): the data model wrapped by @pmodel
+ */
+GdaDataModel *
+_gdaui_prefetch_model_get_model (GdauiPrefetchModel *pmodel)
+{
+	g_return_val_if_fail (GDAUI_IS_PREFETCH_MODEL (pmodel), NULL);
+	return pmodel->model;
+}
+
+/**
+ * _gdaui_prefetch_model_prefetch:
+ * @pmodel: a #GdauiPrefetchModel
+ * @first: the first row to read
+ * @last: the last row to read
+ *
+ * Requests the rows from @first to @last to be read in the background, replacing any
+ * previous request. At most a quarter of the cache size is read for each request.
+ */
+void
+_gdaui_prefetch_model_prefetch (GdauiPrefetchModel *pmodel, gint first, gint last)
+{
+	g_return_if_fail (GDAUI_IS_PREFETCH_MODEL (pmodel));
+
+	g_mutex_lock (&(pmodel->mutex));
+	request_rows (pmodel, first, last);
+	g_mutex_unlock (&(pmodel->mutex));
+}
+
+/**
+ * _gdaui_prefetch_model_wait:
+ * @pmodel: a #GdauiPrefetchModel
+ *
+ * Waits until the worker thread has read all the requested rows (or until it can't read any
+ * more because the rows it has read have not been accessed yet).
+ */
+void
+_gdaui_prefetch_model_wait (GdauiPrefetchModel *pmodel)
+{
+	g_return_if_fail (GDAUI_IS_PREFETCH_MODEL (pmodel));
+
+	g_mutex_lock (&(pmodel->mutex));
+	while (pmodel->worker && (pmodel->busy || worker_has_work (pmodel)))
+		g_cond_wait (&(pmodel->cond), &(pmodel->mutex));
+	g_mutex_unlock (&(pmodel->mutex));
+}
+
+/**
+ * _gdaui_prefetch_model_set_deferred:
+ * @pmodel: a #GdauiPrefetchModel
+ * @deferred: %TRUE to defer the reading of the rows which are not in the cache
+ *
+ * If the data model wrapped by @pmodel does not support random access, reading a row which has
+ * not been cached may require moving a cursor over a large number of rows. If @deferred is %TRUE,
+ * such a row is not read by gda_data_model_get_value_at(), which returns %NULL and sets a
+ * %GDA_DATA_MODEL_ACCESS_ERROR error, but by the worker thread; the "row-updated" signal is then
+ * emitted for that row, from the main context of the thread which created @pmodel.
+ */
+void
+_gdaui_prefetch_model_set_deferred (GdauiPrefetchModel *pmodel, gboolean deferred)
+{
+	g_return_if_fail (GDAUI_IS_PREFETCH_MODEL (pmodel));
+
+	g_mutex_lock (&(pmodel->mutex));
+	pmodel->deferred = deferred;
+	if (! deferred)
+		g_hash_table_remove_all (pmodel->missing);
+	g_mutex_unlock (&(pmodel->mutex));
+}
+
+/*
+ * GdaDataModel interface implementation
+ */
+static gint
+_gdaui_prefetch_model_get_n_rows (GdaDataModel *model)
+{
+	GdauiPrefetchModel *pmodel = GDAUI_PREFETCH_MODEL (model);
+	gint nb_rows;
+
+	g_mutex_lock (&(pmodel->mutex));
+	nb_rows = pmodel->nb_rows;
+	g_mutex_unlock (&(pmodel->mutex));
+	return nb_rows;
+}
+
+static gint
+_gdaui_prefetch_model_get_n_columns (GdaDataModel *model)
+{
+	return GDAUI_PREFETCH_MODEL (model)->nb_cols;
+}
+
+static GdaColumn *
+_gdaui_prefetch_model_describe_column (GdaDataModel *model, gint col)
+{
+	GdauiPrefetchModel *pmodel = GDAUI_PREFETCH_MODEL (model);
+	GdaColumn *column;
+
+	g_rec_mutex_lock (&(pmodel->model_mutex));
+	column = gda_data_model_describe_column (pmodel->model, col);
+	g_rec_mutex_unlock (&(pmodel->model_mutex));
+	return column;
+}
+
+static GdaDataModelAccessFlags
+_gdaui_prefetch_model_get_access_flags (G_GNUC_UNUSED GdaDataModel *model)
+{
+	return GDA_DATA_MODEL_ACCESS_RANDOM;
+}
+
+static const GValue *
+_gdaui_prefetch_model_get_value_at (GdaDataModel *model, gint col, gint row, GError **error)
+{
+	GdauiPrefetchModel *pmodel = GDAUI_PREFETCH_MODEL (model);
+	CachedRow *crow;
+	GValue *value;
+
+	g_return_val_if_fail (row >= 0, NULL);
+	if ((col < 0) || (col >= pmodel->nb_cols)) {
+		g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_COLUMN_OUT_OF_RANGE_ERROR,
+			     _("Column %d out of range (0-%d)"), col, pmodel->nb_cols - 1);
+		return NULL;
+	}
+
+	g_mutex_lock (&(pmodel->mutex));
+	if ((pmodel->nb_rows >= 0) && (row >= pmodel->nb_rows)) {
+		g_mutex_unlock (&(pmodel->mutex));
+		g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ROW_OUT_OF_RANGE_ERROR,
+			     _("Row %d out of range (0-%d)"), row, pmodel->nb_rows - 1);
+		return NULL;
+	}
+
+	cache_take_ready_rows (pmodel);
+	crow = g_hash_table_lookup (pmodel->rows, GINT_TO_POINTER (row));
+	if (crow)
+		g_queue_unlink (&(pmodel->lru), &(crow->link));
+	else if (pmodel->deferred && pmodel->iter) {
+		/* let the worker thread move the cursor */
+		if (! g_hash_table_contains (pmodel->missing, GINT_TO_POINTER (row))) {
+			g_hash_table_add (pmodel->missing, GINT_TO_POINTER (row));
+			if ((row < pmodel->req_next) || (row > pmodel->req_last))
+				request_rows (pmodel, row, row + pmodel->read_ahead - 1);
+			else
+				g_cond_broadcast (&(pmodel->cond));
+		}
+		pmodel->last_row = row;
+		g_mutex_unlock (&(pmodel->mutex));
+		g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ACCESS_ERROR,
+			     _("Row %d is being read"), row);
+		return NULL;
+	}
+	else {
+		GdaRow *grow;
+		guint generation;
+
+		/* on demand fetch, without preventing the worker thread from running meanwhile */
+		generation = pmodel->generation;
+		g_mutex_unlock (&(pmodel->mutex));
+		grow = fetch_row (pmodel, row);
+		g_mutex_lock (&(pmodel->mutex));
+		if (generation != pmodel->generation) {
+			/* the data model has changed meanwhile */
+			g_mutex_unlock (&(pmodel->mutex));
+			g_object_unref (grow);
+			return _gdaui_prefetch_model_get_value_at (model, col, row, error);
+		}
+
+		crow = g_new0 (CachedRow, 1);
+		crow->rownum = row;
+		crow->row = grow;
+		crow->link.data = crow;
+		g_hash_table_remove (pmodel->ready, GINT_TO_POINTER (row));
+		g_hash_table_insert (pmodel->rows, GINT_TO_POINTER (row), crow);
+	}
+	g_queue_push_head_link (&(pmodel->lru), &(crow->link));
+
+	/* keep the cache bounded, the current row being first in @lru is never removed */
+	while ((gint) g_queue_get_length (&(pmodel->lru)) > pmodel->cache_size) {
+		CachedRow *oldest;
+		oldest = (CachedRow*) g_queue_peek_tail (&(pmodel->lru));
+		g_queue_unlink (&(pmodel->lru), &(oldest->link));
+		g_hash_table_remove (pmodel->rows, GINT_TO_POINTER (oldest->rownum));
+	}
+
+	/* read ahead in the direction the rows are being accessed */
+	if (row != pmodel->last_row) {
+		gint next;
+		next = (row > pmodel->last_row) ? row + 1 : row - 1;
+		if ((next >= 0) && ! row_is_known (pmodel, next) &&
+		    ((next < pmodel->req_next) || (next > pmodel->req_last))) {
+			if (next > row)
+				request_rows (pmodel, next, next + pmodel->read_ahead - 1);
+			else
+				request_rows (pmodel, next - pmodel->read_ahead + 1, next);
+		}
+		pmodel->last_row = row;
+	}
+
+	value = gda_row_get_value (crow->row, col);
+	if (! gda_row_value_is_valid_e (crow->row, value, error))
+		value = NULL;
+	g_mutex_unlock (&(pmodel->mutex));
+
+	return value;
+}
+
+static GdaValueAttribute
+_gdaui_prefetch_model_get_attributes_at (GdaDataModel *model, gint col, gint row)
+{
+	GdauiPrefetchModel *pmodel = GDAUI_PREFETCH_MODEL (model);
+	GdaValueAttribute flags = 0;
+
+	if (! pmodel->iter) {
+		g_rec_mutex_lock (&(pmodel->model_mutex));
+		flags = gda_data_model_get_attributes_at (pmodel->model, col, row);
+		g_rec_mutex_unlock (&(pmodel->model_mutex));
+	}
+	flags |= GDA_VALUE_ATTR_NO_MODIF;
+
+	return flags;
+}
+
+static GError **
+_gdaui_prefetch_model_get_exceptions (GdaDataModel *model)
+{
+	return gda_data_model_get_exceptions (GDAUI_PREFETCH_MODEL (model)->model);
+}
+
+static void
+_gdaui_prefetch_model_data_model_init (GdaDataModelInterface *iface)
+{
+	iface->get_n_rows = _gdaui_prefetch_model_get_n_rows;
+	iface->get_n_columns = _gdaui_prefetch_model_get_n_columns;
+	iface->describe_column = _gdaui_prefetch_model_describe_column;
+	iface->get_access_flags = _gdaui_prefetch_model_get_access_flags;
+	iface->get_value_at = _gdaui_prefetch_model_get_value_at;
+	iface->get_attributes_at = _gdaui_prefetch_model_get_attributes_at;
+
+	iface->create_iter = NULL;
+
+	iface->set_value_at = NULL;
+	iface->set_values = NULL;
+	iface->append_values = NULL;
+	iface->append_row = NULL;
+	iface->remove_row = NULL;
+	iface->find_row = NULL;
+
+	iface->freeze = NULL;
+	iface->thaw = NULL;
+	iface->get_notify = NULL;
+	iface->send_hint = NULL;
+
+	iface->get_exceptions = _gdaui_prefetch_model_get_exceptions;
+}
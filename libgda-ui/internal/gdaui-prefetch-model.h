@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __GDAUI_PREFETCH_MODEL_H__
+#define __GDAUI_PREFETCH_MODEL_H__
+
+#include <libgda/libgda.h>
+
+G_BEGIN_DECLS
+
+#define GDAUI_TYPE_PREFETCH_MODEL (_gdaui_prefetch_model_get_type())
+G_DECLARE_FINAL_TYPE (GdauiPrefetchModel, _gdaui_prefetch_model, GDAUI, PREFETCH_MODEL, GObject)
+
+/*
+ * Read-only data model which fetches the rows of another data model on demand, keeps at most
+ * a fixed number of them in a cache, and reads ahead the rows likely to be requested next in
+ * a worker thread.
+ */
+GdaDataModel *_gdaui_prefetch_model_new       (GdaDataModel *model, gint cache_size);
+GdaDataModel *_gdaui_prefetch_model_get_model (GdauiPrefetchModel *pmodel);
+void          _gdaui_prefetch_model_prefetch  (GdauiPrefetchModel *pmodel, gint first, gint last);
+void          _gdaui_prefetch_model_wait      (GdauiPrefetchModel *pmodel);
+void          _gdaui_prefetch_model_set_deferred (GdauiPrefetchModel *pmodel, gboolean deferred);
+
+G_END_DECLS
+
+#endif
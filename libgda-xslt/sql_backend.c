@@ -63,16 +63,22 @@ static int get_resultset_col_value (GdaXsltIntCont * pdata,
 				    const char *colname, char **outvalue,
 				    GError ** error);
 static int get_resultset_nodeset (GdaXsltIntCont * pdata,
+				  xsltTransformContextPtr ctxt,
 				  const char *resultset_name,
 				  xmlXPathObjectPtr * nodeset,
 				  GError ** error);
-static int _utility_data_model_to_nodeset (GdaDataModel * model,
+static int _utility_data_model_to_nodeset (GObject * result,
+					   xsltTransformContextPtr ctxt,
 					   xmlXPathObjectPtr * nodeset,
 					   GError ** error);
-static int gda_xslt_bk_internal_query (GdaXsltExCont * exec,
-				       GdaXsltIntCont * pdata,
-				       xsltTransformContextPtr ctxt,
-				       xmlNodePtr query_node);
+static GdaDataModel *gda_xslt_bk_internal_query (GdaXsltExCont * exec,
+						 GdaXsltIntCont * pdata,
+						 xsltTransformContextPtr ctxt,
+						 xmlNodePtr query_node,
+						 gboolean stream,
+						 xmlChar ** out_query_name);
+static int run_section_template (xsltTransformContextPtr ctxt, xmlNodePtr node,
+				 xmlNodePtr template_node);
 
 int
 _gda_xslt_holder_set_value (GdaHolder *param, xsltTransformContextPtr ctxt)
@@ -108,6 +114,14 @@ _gda_xslt_holder_set_value (GdaHolder *param, xsltTransformContextPtr ctxt)
 	}
 }
 
+/*
+ * The <sql:section> element runs its <sql:query> and then calls the template of its
+ * <sql:template> element.
+ *
+ * If the "stream" attribute is "yes", then the query's result is read row by row using a forward-only
+ * cursor, and the template is called once for each row, the query's result set then being the current row.
+ * Otherwise the template is called once, the query's result set containing all the rows.
+ */
 int
 _gda_xslt_bk_section (GdaXsltExCont * exec, GdaXsltIntCont * pdata,
 		     xsltTransformContextPtr ctxt, xmlNodePtr node,
@@ -116,7 +130,11 @@ _gda_xslt_bk_section (GdaXsltExCont * exec, GdaXsltIntCont * pdata,
 	xmlNode *cur_node = NULL;
 	xmlNode *query_node = NULL;
 	xmlNode *template_node = NULL;
-	int res;
+	GdaDataModel *model;
+	xmlChar *query_name = NULL;
+	xmlChar *prop;
+	gboolean stream = FALSE;
+	int res = 0;
 
 	for (cur_node = inst->children; cur_node; cur_node = cur_node->next) {
 		if (cur_node->type == XML_ELEMENT_NODE &&
@@ -141,64 +159,101 @@ _gda_xslt_bk_section (GdaXsltExCont * exec, GdaXsltIntCont * pdata,
 			     "%s", "no query node in section node");
 		return -1;
 	}
+
+	prop = xmlGetProp (inst, BAD_CAST GDA_XSLT_ATTR_STREAM);
+	if (prop) {
+		stream = xmlStrEqual (prop, BAD_CAST "yes") || xmlStrEqual (prop, BAD_CAST "true");
+		xmlFree (prop);
+	}
+
 	/* set the query context */
-	res = gda_xslt_bk_internal_query (exec, pdata, ctxt, query_node);
-	if (res < 0) {
-		printf ("sql_bk_internal_query res [%d]\n", res);
+	model = gda_xslt_bk_internal_query (exec, pdata, ctxt, query_node, stream, &query_name);
+	if (!model) {
+#ifdef GDA_DEBUG_NO
+		printf ("sql_bk_internal_query failed\n");
+#endif
 		return -1;
 	}
-	/* run the template */
-	if (template_node) {
-		/* template node must have only
-		   xml comments and ONE xsl:call-template nodes */
-		for (cur_node = template_node->children; cur_node;
-		     cur_node = cur_node->next) {
-			if (IS_XSLT_ELEM (cur_node)) {
-				if (IS_XSLT_NAME (cur_node, "call-template")) {
-					xsltElemPreCompPtr info =
-						(xsltElemPreCompPtr)
-						cur_node->psvi;
-					if (info != NULL) {
-						xsltCallTemplate
-							(ctxt, node,
-							 cur_node, info);
-					}
-					else {
-						printf ("the xsltStylePreCompPtr is empthy\n");
-						return -1;
-					}
+
+	if (!stream) {
+		set_resultset_value (pdata, (const char *) query_name, G_OBJECT (model), &(exec->error));
+		/* run the template */
+		if (template_node)
+			res = run_section_template (ctxt, node, template_node);
+	}
+	else {
+		GdaDataModelIter *iter;
+
+		/* the iterator is the result set while the template is run for each row,
+		 * it only holds a weak reference on @model */
+		iter = gda_data_model_create_iter (model);
+		set_resultset_value (pdata, (const char *) query_name, G_OBJECT (iter), &(exec->error));
+		while (gda_data_model_iter_move_next (iter)) {
+			if (template_node) {
+				res = run_section_template (ctxt, node, template_node);
+				if (res < 0)
+					break;
+			}
+		}
+		g_hash_table_remove (pdata->result_sets, query_name);
+		g_object_unref (model);
+	}
+
+	xmlFree (query_name);
+	return res;
+}
+
+static int
+run_section_template (xsltTransformContextPtr ctxt, xmlNodePtr node, xmlNodePtr template_node)
+{
+	xmlNode *cur_node;
+
+	/* template node must have only
+	   xml comments and ONE xsl:call-template nodes */
+	for (cur_node = template_node->children; cur_node;
+	     cur_node = cur_node->next) {
+		if (IS_XSLT_ELEM (cur_node)) {
+			if (IS_XSLT_NAME (cur_node, "call-template")) {
+				xsltElemPreCompPtr info =
+					(xsltElemPreCompPtr)
+					cur_node->psvi;
+				if (info != NULL) {
+					xsltCallTemplate
+						(ctxt, node,
+						 cur_node, info);
 				}
 				else {
-#ifdef GDA_DEBUG_NO
-					printf ("only one call-template node is allowed on sql:template node\n");
-#endif
+					printf ("the xsltStylePreCompPtr is empthy\n");
 					return -1;
 				}
 			}
-			else if (cur_node->type != XML_COMMENT_NODE) {
+			else {
 #ifdef GDA_DEBUG_NO
-				printf ("only one xsl:call-template or comment node is allowed on sql:template node\n");
+				printf ("only one call-template node is allowed on sql:template node\n");
 #endif
 				return -1;
 			}
 		}
+		else if (cur_node->type != XML_COMMENT_NODE) {
+#ifdef GDA_DEBUG_NO
+			printf ("only one xsl:call-template or comment node is allowed on sql:template node\n");
+#endif
+			return -1;
+		}
 	}
-	/* unset the query context */
-// TODO, delete the query result information and the query if it was created inline
 	return 0;
-
 }
 
 xmlXPathObjectPtr
-_gda_xslt_bk_fun_getnodeset (xmlChar * set, GdaXsltExCont * exec,
-			    GdaXsltIntCont * pdata)
+_gda_xslt_bk_fun_getnodeset (xmlChar * set, xsltTransformContextPtr ctxt,
+			    GdaXsltExCont * exec, GdaXsltIntCont * pdata)
 {
 	xmlXPathObjectPtr nodeset;
 	int res;
 #ifdef GDA_DEBUG_NO
 	printf ("running function:_gda_xslt_bk_fun_getnodeset\n");
 #endif
-	res = get_resultset_nodeset (pdata, (gchar*) set, &nodeset, &(exec->error));
+	res = get_resultset_nodeset (pdata, ctxt, (gchar*) set, &nodeset, &(exec->error));
 	if (res < 0 || nodeset == NULL) {
 		xsltGenericError (xsltGenericErrorContext,
 				  "_gda_xslt_bk_fun_getnodeset error\n");
@@ -306,24 +361,36 @@ get_resultset_col_value (GdaXsltIntCont * pdata, const char *resultset_name,
 		return -1;
 	}
 
-	if (!GDA_IS_DATA_MODEL (result)) {
+	GdaDataModel *model;
+	const GValue *db_value;
+	gint col_index;
+	if (GDA_IS_DATA_MODEL_ITER (result)) {
+		/* streamed result set: use the current row */
+		g_object_get (result, "data-model", &model, NULL);
+	}
+	else if (GDA_IS_DATA_MODEL (result))
+		model = GDA_DATA_MODEL (g_object_ref (result));
+	else {
 #ifdef GDA_DEBUG_NO
 		g_print ("this is not a data model, returning NULL");
 #endif
 		*outvalue = NULL;
 		return -1;
 	}
-	gint col_index;
-	col_index = gda_data_model_get_column_index (GDA_DATA_MODEL (result), colname);
+	col_index = gda_data_model_get_column_index (model, colname);
 	if (col_index < 0) {
 #ifdef GDA_DEBUG_NO
 		g_print ("no column found by name [%s]", colname);
 #endif
+		g_object_unref (model);
 		*outvalue = NULL;
 		return -1;
 	}
-	const GValue *db_value;
-	db_value = gda_data_model_get_value_at (GDA_DATA_MODEL (result), col_index, 0, error);
+	if (GDA_IS_DATA_MODEL_ITER (result))
+		db_value = gda_data_model_iter_get_value_at_e (GDA_DATA_MODEL_ITER (result), col_index, error);
+	else
+		db_value = gda_data_model_get_value_at (model, col_index, 0, error);
+	g_object_unref (model);
 	if (db_value == NULL) {
 #ifdef GDA_DEBUG_NO
 		g_print ("no value found on col_index [%d]", col_index);
@@ -346,7 +413,8 @@ get_resultset_col_value (GdaXsltIntCont * pdata, const char *resultset_name,
 }
 
 static int
-get_resultset_nodeset (GdaXsltIntCont * pdata, const char *resultset_name,
+get_resultset_nodeset (GdaXsltIntCont * pdata, xsltTransformContextPtr ctxt,
+		       const char *resultset_name,
 		       xmlXPathObjectPtr * nodeset, GError ** error)
 {
 	gpointer orig_key = NULL;
@@ -375,8 +443,7 @@ get_resultset_nodeset (GdaXsltIntCont * pdata, const char *resultset_name,
 		return -1;
 	}
 // Dont check if this is a Data Model, because saving the result we alreally check
-	res = _utility_data_model_to_nodeset (GDA_DATA_MODEL (result),
-					      nodeset, error);
+	res = _utility_data_model_to_nodeset (result, ctxt, nodeset, error);
 	if (res < 0) {
 #ifdef GDA_DEBUG_NO
 		g_print ("_utility_data_model_to_nodeset fault");
@@ -389,16 +456,59 @@ get_resultset_nodeset (GdaXsltIntCont * pdata, const char *resultset_name,
 
 /* -------------------------------------------------- */
 static int
-_utility_data_model_to_nodeset (GdaDataModel * model,
+append_row_node (xmlNodePtr mainnode, GdaDataModelIter *iter, gchar **col_ids, gint rnb_cols,
+		 GError **error)
+{
+	xmlNodePtr row, field;
+	gint c;
+
+	row = xmlNewChild (mainnode, NULL, (xmlChar *) "row", NULL);
+	for (c = 0; c < rnb_cols; c++) {
+		const GValue *value;
+		xmlChar *str = NULL;
+		gboolean isnull = FALSE;
+
+		value = gda_data_model_iter_get_value_at_e (iter, c, error);
+		if (!value)
+			return -1;
+		if (gda_value_is_null (value))
+			isnull = TRUE;
+		else 
+			str = value_to_xmlchar (value);
+		field = xmlNewTextChild (row, NULL, (xmlChar *) "column", (xmlChar *) str);
+		xmlSetProp (field, (xmlChar *) "name", (xmlChar *) col_ids[c]);
+		if (isnull)
+			xmlSetProp (field, (xmlChar *) "isnull", (xmlChar *) "true");
+		g_free (str);
+	}
+	return 0;
+}
+
+/*
+ * Converts @result (a #GdaDataModel, or a #GdaDataModelIter for a streamed result set, in which case only
+ * the current row is converted) to a <resultset> node. The node is part of a result value tree of @ctxt
+ * and is freed by libxslt once not used anymore.
+ */
+static int
+_utility_data_model_to_nodeset (GObject * result, xsltTransformContextPtr ctxt,
 				xmlXPathObjectPtr * nodeset, GError ** error)
 {
-	gint nrows, i;
-	gint *rcols, rnb_cols;
+	GdaDataModel *model;
+	GdaDataModelIter *iter;
+	gint rnb_cols;
 	gchar **col_ids = NULL;
 	gint c;
+	int res = 0;
 
+	xmlDocPtr rvt;
 	xmlNodePtr mainnode;
-	mainnode = xmlNewNode (NULL, (xmlChar *) "resultset");
+	rvt = xsltCreateRVT (ctxt);
+	if (rvt == NULL) {
+		g_set_error (error, GDA_XSLT_ERROR, GDA_XSLT_GENERAL_ERROR, "%s", "xsltCreateRVT return NULL\n");
+		return -1;
+	}
+	xsltRegisterLocalRVT (ctxt, rvt);
+	mainnode = xmlNewDocNode (rvt, NULL, (xmlChar *) "resultset", NULL);
 	if (mainnode == NULL) {
 #ifdef GDA_DEBUG_NO
 		g_print ("xmlNewNode return NULL\n");
@@ -406,17 +516,24 @@ _utility_data_model_to_nodeset (GdaDataModel * model,
 		g_set_error (error, GDA_XSLT_ERROR, GDA_XSLT_GENERAL_ERROR, "%s", "xmlNewNode return NULL\n");
 		return -1;
 	}
+	xmlAddChild ((xmlNodePtr) rvt, mainnode);
+
+	if (GDA_IS_DATA_MODEL_ITER (result)) {
+		iter = GDA_DATA_MODEL_ITER (g_object_ref (result));
+		g_object_get (result, "data-model", &model, NULL);
+	}
+	else {
+		model = GDA_DATA_MODEL (g_object_ref (result));
+		iter = NULL;
+	}
+
 	/* compute columns */
 	rnb_cols = gda_data_model_get_n_columns (model);
-	rcols = g_new (gint, rnb_cols);
-	for (i = 0; i < rnb_cols; i++)
-		rcols[i] = i;
-
 	col_ids = g_new0 (gchar *, rnb_cols);
 	for (c = 0; c < rnb_cols; c++) {
 		GdaColumn *column;
 		const gchar *name;
-		column = gda_data_model_describe_column (model, rcols[c]);
+		column = gda_data_model_describe_column (model, c);
 		name = gda_column_get_name (column);
 		if (name)
 			col_ids[c] = g_strdup (name);
@@ -425,41 +542,23 @@ _utility_data_model_to_nodeset (GdaDataModel * model,
 	}
 
 	/* add the model data to the XML output */
-	nrows = gda_data_model_get_n_rows (model);
-	if (nrows > 0) {
-		xmlNodePtr row, field;
-		gint r, c;
-		for (r = 0; r < nrows; r++) {
-			row = xmlNewChild (mainnode, NULL, (xmlChar *) "row", NULL);
-			for (c = 0; c < rnb_cols; c++) {
-				GValue *value;
-				xmlChar *str = NULL;
-				gboolean isnull = FALSE;
-
-				value = (GValue *) gda_data_model_get_value_at (model, rcols[c], r, error);
-				if (!value) {
-					for (c = 0; c < rnb_cols; c++)
-						g_free (col_ids[c]);
-					g_free (col_ids);
-					g_free (rcols);
-					return -1;
-				}
-				if (gda_value_is_null ((GValue *) value))
-					isnull = TRUE;
-				else 
-					str = value_to_xmlchar (value);
-				field = xmlNewTextChild (row, NULL, (xmlChar *) "column", (xmlChar *) str);
-				xmlSetProp (field, (xmlChar *) "name", (xmlChar *) col_ids[c]);
-				if (isnull)
-					xmlSetProp (field, (xmlChar *) "isnull", (xmlChar *) "true");
-				g_free (str);
-			}
-		}
+	if (iter) {
+		if (gda_data_model_iter_is_valid (iter))
+			res = append_row_node (mainnode, iter, col_ids, rnb_cols, error);
+	}
+	else {
+		iter = gda_data_model_create_iter (model);
+		while ((res == 0) && gda_data_model_iter_move_next (iter))
+			res = append_row_node (mainnode, iter, col_ids, rnb_cols, error);
 	}
 	for (c = 0; c < rnb_cols; c++)
 		g_free (col_ids[c]);
 	g_free (col_ids);
-	g_free (rcols);
+	g_object_unref (iter);
+	g_object_unref (model);
+
+	if (res < 0)
+		return -1;
 
 	*nodeset = (xmlXPathObjectPtr) xmlXPathNewNodeSet (mainnode);
 
@@ -491,10 +590,49 @@ look_predefined_query_by_name (GdaXsltExCont * exec, const char *query_name,
 	}
 }
 
-static int
+/*
+ * Computes the key identifying the execution of @query with @params in the query cache
+ */
+static gchar *
+make_query_cache_key (const gchar *sql, GdaSet *params)
+{
+	GString *string;
+	GSList *list;
+
+	string = g_string_new (sql);
+	for (list = params ? gda_set_get_holders (params) : NULL; list; list = list->next) {
+		GdaHolder *holder = GDA_HOLDER (list->data);
+		const GValue *value;
+		gchar *str;
+
+		value = gda_holder_get_value (holder);
+		g_string_append_c (string, '\n');
+		g_string_append (string, gda_holder_get_id (holder));
+		if (!value || gda_value_is_null (value)) {
+			g_string_append_c (string, '!');
+			continue;
+		}
+		str = gda_value_stringify (value);
+		g_string_append_printf (string, "=%s:%s", g_type_name (G_VALUE_TYPE (value)), str);
+		g_free (str);
+	}
+	return g_string_free (string, FALSE);
+}
+
+/*
+ * Runs the query of @query_node, using the XSLT variables as parameters.
+ *
+ * If @stream is %TRUE, then the query is run using a forward-only cursor. Otherwise the returned
+ * data model is cached for the duration of the transformation, and returned again if the same
+ * query is run with the same parameters.
+ *
+ * Returns: (transfer full): the query's result, or %NULL if an error occurred
+ */
+static GdaDataModel *
 gda_xslt_bk_internal_query (GdaXsltExCont * exec, GdaXsltIntCont * pdata,
 			    xsltTransformContextPtr ctxt,
-			    xmlNodePtr query_node)
+			    xmlNodePtr query_node, gboolean stream,
+			    xmlChar ** out_query_name)
 {
 	GdaStatement *query = NULL;
 	GdaSet *params;
@@ -502,6 +640,7 @@ gda_xslt_bk_internal_query (GdaXsltExCont * exec, GdaXsltIntCont * pdata,
 	GdaDataModel *resQuery;
 	GSList *plist;
 	int predefined = 0;
+	gchar *cache_key = NULL;
 
 	xmlNodePtr sqltxt_node = NULL;
 	xmlChar *query_name;
@@ -514,7 +653,7 @@ gda_xslt_bk_internal_query (GdaXsltExCont * exec, GdaXsltIntCont * pdata,
 	if (query_name == NULL) {
 		g_set_error (&(exec->error), 0, 0,
 			     "%s", "the query element is not correct, no 'name' attribute\n");
-		return -1;
+		return NULL;
 	}
 
 	look_predefined_query_by_name (exec, (gchar*) query_name, &(query));
@@ -525,23 +664,32 @@ gda_xslt_bk_internal_query (GdaXsltExCont * exec, GdaXsltIntCont * pdata,
 		if (sqltxt_node == NULL || sqltxt_node->type != XML_TEXT_NODE) {
 			g_set_error (&(exec->error), 0, 0,
 				     "%s", "the query element is not correct, it have not a first text children\n");
-			return -1;
+			xmlFree (query_name);
+			return NULL;
 		}
 #ifdef GDA_DEBUG_NO
 		printf ("query_content[%s]\n", XML_GET_CONTENT (sqltxt_node));
 #endif
-		/* create the query */
-		GdaSqlParser *parser;
-		parser = gda_connection_create_parser (exec->cnc);
-		query = gda_sql_parser_parse_string (parser, (gchar*) XML_GET_CONTENT (sqltxt_node), NULL, &(exec->error));
-		g_object_unref (parser);
-		if (!query) {
+		/* create the query, or reuse the one already parsed */
+		query = g_hash_table_lookup (pdata->parsed_queries, XML_GET_CONTENT (sqltxt_node));
+		if (query)
+			g_object_ref (query);
+		else {
+			GdaSqlParser *parser;
+			parser = gda_connection_create_parser (exec->cnc);
+			query = gda_sql_parser_parse_string (parser, (gchar*) XML_GET_CONTENT (sqltxt_node), NULL, &(exec->error));
+			g_object_unref (parser);
+			if (!query) {
 #ifdef GDA_DEBUG_NO
-			g_print ("gda_query_new_from_sql:error [%s]\n",
-				 exec->error && exec->error->message ? exec->error->
-				 message : "No detail");
+				g_print ("gda_query_new_from_sql:error [%s]\n",
+					 exec->error && exec->error->message ? exec->error->
+					 message : "No detail");
 #endif
-			return -1;
+				xmlFree (query_name);
+				return NULL;
+			}
+			g_hash_table_insert (pdata->parsed_queries, g_strdup ((gchar*) XML_GET_CONTENT (sqltxt_node)),
+					     g_object_ref (query));
 		}
 	}
 	else {
@@ -550,8 +698,12 @@ gda_xslt_bk_internal_query (GdaXsltExCont * exec, GdaXsltIntCont * pdata,
 	}
 
 	/* find the parameters on xsltcontext */
-	if (! gda_statement_get_parameters (query, &params, &(exec->error)))
-		return -1;
+	if (! gda_statement_get_parameters (query, &params, &(exec->error))) {
+		if (!predefined)
+			g_object_unref (query);
+		xmlFree (query_name);
+		return NULL;
+	}
 
 	if (params != NULL) {
 		plist = gda_set_get_holders (params);
@@ -561,20 +713,29 @@ gda_xslt_bk_internal_query (GdaXsltExCont * exec, GdaXsltIntCont * pdata,
 		}
 	}
 
-	/* run the query */
-	resQuery = gda_connection_statement_execute_select (exec->cnc, query, params, &(exec->error));
+	/* run the query, or use the result of the same query, run with the same parameters */
+	resQuery = NULL;
+	if (!stream) {
+		gchar *sql;
+		sql = predefined ? g_strdup_printf ("@%s", (gchar*) query_name) :
+			g_strdup ((gchar*) XML_GET_CONTENT (sqltxt_node));
+		cache_key = make_query_cache_key (sql, params);
+		g_free (sql);
+		resQuery = g_hash_table_lookup (pdata->query_cache, cache_key);
+		if (resQuery)
+			g_object_ref (resQuery);
+	}
 	if (!resQuery) {
-#ifdef GDA_DEBUG_NO
-		g_print ("gda_query_execute:error [%s]\n",
-			 exec->error
-			 && exec->error->message ? exec->error->
-			 message : "No detail");
-#endif
-		return -1;
+		resQuery = gda_connection_statement_execute_select_full (exec->cnc, query, params,
+									 stream ? GDA_STATEMENT_MODEL_CURSOR_FORWARD :
+									 GDA_STATEMENT_MODEL_RANDOM_ACCESS,
+									 NULL, &(exec->error));
+		if (resQuery && cache_key) {
+			g_hash_table_insert (pdata->query_cache, cache_key, g_object_ref (resQuery));
+			cache_key = NULL;
+		}
 	}
-
-	/* save the result to the internal context */
-	set_resultset_value (pdata, (const char *) query_name, (GObject*) resQuery, &(exec->error));
+	g_free (cache_key);
 
 	/* free the parameters */
 	if (params)
@@ -582,8 +743,20 @@ gda_xslt_bk_internal_query (GdaXsltExCont * exec, GdaXsltIntCont * pdata,
 	/* free the query if not predefined */
 	if (!predefined && query)
 		g_object_unref (query);
-	xmlFree (query_name);
-	return 0;
+
+	if (!resQuery) {
+#ifdef GDA_DEBUG_NO
+		g_print ("gda_query_execute:error [%s]\n",
+			 exec->error
+			 && exec->error->message ? exec->error->
+			 message : "No detail");
+#endif
+		xmlFree (query_name);
+		return NULL;
+	}
+
+	*out_query_name = query_name;
+	return resQuery;
 }
 
 
@@ -601,11 +774,11 @@ value_to_xmlchar (const GValue * value)
 	gchar *str;
 
 	if (!value || gda_value_is_null (value))
-		return (BAD_CAST "");
+		return (BAD_CAST g_strdup (""));
 	else if ((G_VALUE_TYPE (value) == GDA_TYPE_BINARY) ||
 		 (G_VALUE_TYPE (value) == GDA_TYPE_BLOB)) {
 		TO_IMPLEMENT;
-		return (BAD_CAST "Binary data");
+		return (BAD_CAST g_strdup ("Binary data"));
 	}
 	if (!data_handlers) {
 		/* initialize the internal data handlers */
@@ -669,5 +842,5 @@ value_to_xmlchar (const GValue * value)
 		str = gda_data_handler_get_str_from_value (dh, value);
 	else
 		str = gda_value_stringify (value);
-	return (BAD_CAST (str ? str : ""));
+	return (BAD_CAST (str ? str : g_strdup ("")));
 }
@@ -35,6 +35,7 @@ G_BEGIN_DECLS
 #define GDA_XSLT_ELEM_SECTION        "section"
 #define GDA_XSLT_ELEM_INTERNAL_QUERY      "query"
 #define GDA_XSLT_ELEM_INTERNAL_TEMPLATE   "template"
+#define GDA_XSLT_ATTR_STREAM         "stream"
 
 /* error reporting */
 extern GQuark gda_xslt_error_quark (void);
@@ -47,7 +48,9 @@ typedef enum {
 struct _GdaXsltIntCont
 {
 	int         init;
-	GHashTable *result_sets;
+	GHashTable *result_sets; /* key = result set name, value = GdaDataModel or GdaDataModelIter */
+	GHashTable *parsed_queries; /* key = SQL, value = GdaStatement */
+	GHashTable *query_cache; /* key = SQL and parameters, value = GdaDataModel */
 
 	/* Padding for future expansion */
 	gpointer _gda_reserved1;
@@ -74,6 +77,7 @@ xmlXPathObjectPtr _gda_xslt_bk_fun_getvalue (xmlChar * set, xmlChar * name,
 					    GdaXsltIntCont * pdata,
 					    int getXml);
 xmlXPathObjectPtr _gda_xslt_bk_fun_getnodeset (xmlChar * set,
+					      xsltTransformContextPtr ctxt,
 					      GdaXsltExCont * exec,
 					      GdaXsltIntCont * pdata);
 xmlXPathObjectPtr _gda_xslt_bk_fun_checkif (xmlChar * setname,
@@ -71,7 +71,15 @@ _gda_xslt_extension_init (xsltTransformContextPtr ctxt, const xmlChar * URI)
 	data->result_sets =
 		g_hash_table_new_full (g_str_hash, g_str_equal,
 				       g_free,
-				       NULL);
+				       g_object_unref);
+	data->parsed_queries =
+		g_hash_table_new_full (g_str_hash, g_str_equal,
+				       g_free,
+				       g_object_unref);
+	data->query_cache =
+		g_hash_table_new_full (g_str_hash, g_str_equal,
+				       g_free,
+				       g_object_unref);
 
 	res = xsltRegisterExtFunction (ctxt,
 				       (const xmlChar *)
@@ -110,6 +118,9 @@ _gda_xslt_extension_shutdown (G_GNUC_UNUSED xsltTransformContextPtr ctxt,
 {
 	GdaXsltIntCont *p_data = (GdaXsltIntCont *) data;
 	if (p_data) {
+		g_hash_table_destroy (p_data->result_sets);
+		g_hash_table_destroy (p_data->parsed_queries);
+		g_hash_table_destroy (p_data->query_cache);
 		free (p_data);
 	}
 }
@@ -158,7 +169,7 @@ gda_xslt_getnodeset_function (xmlXPathParserContextPtr ctxt, int nargs)
 		}
 	}
 	nodeset =
-		_gda_xslt_bk_fun_getnodeset (setname->stringval, execc, data);
+		_gda_xslt_bk_fun_getnodeset (setname->stringval, tctxt, execc, data);
 	if (nodeset == NULL) {
 		xsltGenericError (xsltGenericErrorContext,
 				  "exsltDynMapFunctoin: ret == NULL\n");
@@ -0,0 +1,252 @@
+/* test-xslt.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+#include <glib/gi18n.h>
+#include <glib/gstdio.h>
+#include <locale.h>
+#include <string.h>
+#include <libgda/libgda.h>
+#include <libxslt/xsltutils.h>
+#include "libgda-xslt.h"
+
+#define DB_TEST_BASE "sqlite_xslt"
+
+#define STYLESHEET_START \
+  "<xsl:stylesheet version='1.0' xmlns:xsl='http://www.w3.org/1999/XSL/Transform' " \
+  "xmlns:sql='" GDA_XSLT_EXTENSION_URI "' extension-element-prefixes='sql'>" \
+  "<xsl:output method='xml' omit-xml-declaration='yes'/>"
+#define STYLESHEET_END "</xsl:stylesheet>"
+
+typedef struct
+{
+  GdaConnection *cnc;
+  gchar *dbfile;
+} TestObjectFixture;
+
+static void
+test_xslt_start (TestObjectFixture *fixture,
+                 G_GNUC_UNUSED gconstpointer user_data)
+{
+  gint id = g_random_int_range (0, G_MAXINT);
+  gchar *cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s_%d", DB_TEST_BASE, id);
+
+  fixture->dbfile = g_strdup_printf ("%s_%d.db", DB_TEST_BASE, id);
+  fixture->cnc = gda_connection_open_from_string ("SQLite", cncstring, NULL,
+                                                  GDA_CONNECTION_OPTIONS_NONE, NULL);
+  g_free (cncstring);
+  g_assert_nonnull (fixture->cnc);
+
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc,
+                                                              "CREATE TABLE items (id INTEGER, name TEXT, data BLOB)",
+                                                              NULL), !=, -1);
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc,
+                                                              "INSERT INTO items VALUES (1, 'a', x'0102'), "
+                                                              "(2, NULL, NULL), (3, 'c', NULL)",
+                                                              NULL), ==, 3);
+  g_object_set (fixture->cnc, "statement-metrics", TRUE, NULL);
+}
+
+static void
+test_xslt_finish (TestObjectFixture *fixture,
+                  G_GNUC_UNUSED gconstpointer user_data)
+{
+  gda_connection_close (fixture->cnc, NULL);
+  g_object_unref (fixture->cnc);
+  g_unlink (fixture->dbfile);
+  g_free (fixture->dbfile);
+}
+
+/* returns the number of statements executed by @cnc since its metrics have been reset */
+static guint64
+count_executed_statements (GdaConnection *cnc)
+{
+  GdaDataModel *metrics;
+  guint64 total = 0;
+  gint i, nrows;
+
+  metrics = gda_connection_get_metrics (cnc);
+  g_assert_nonnull (metrics);
+  nrows = gda_data_model_get_n_rows (metrics);
+  for (i = 0; i < nrows; i++) {
+    const GValue *cvalue;
+    cvalue = gda_data_model_get_value_at (metrics, 1, i, NULL);
+    g_assert_true (cvalue && (G_VALUE_TYPE (cvalue) == G_TYPE_UINT64));
+    total += g_value_get_uint64 (cvalue);
+  }
+  g_object_unref (metrics);
+  return total;
+}
+
+/* applies the @xsl stylesheet to the @xml document and returns the result as a string */
+static gchar *
+run_transform (TestObjectFixture *fixture, const gchar *xml, const gchar *xsl)
+{
+  GdaXsltExCont *sql_ctx;
+  GError *error = NULL;
+  xmlDocPtr doc, xsldoc, res;
+  xsltStylesheetPtr style;
+  xsltTransformContextPtr ctxt;
+  xmlChar *buffer = NULL;
+  int len;
+  gchar *result;
+
+  gda_xslt_register ();
+  sql_ctx = gda_xslt_create_context_simple (fixture->cnc, &error);
+  g_assert_no_error (error);
+  g_assert_nonnull (sql_ctx);
+
+  doc = xmlParseDoc (BAD_CAST xml);
+  g_assert_nonnull (doc);
+  xsldoc = xmlParseDoc (BAD_CAST xsl);
+  g_assert_nonnull (xsldoc);
+  style = xsltParseStylesheetDoc (xsldoc);
+  g_assert_nonnull (style);
+
+  ctxt = xsltNewTransformContext (style, doc);
+  gda_xslt_set_execution_context (ctxt, sql_ctx);
+  res = xsltApplyStylesheetUser (style, doc, NULL, NULL, NULL, ctxt);
+  g_assert_nonnull (res);
+  g_assert_cmpint (ctxt->state, ==, XSLT_STATE_OK);
+  xsltFreeTransformContext (ctxt);
+  g_assert_null (sql_ctx->error);
+
+  g_assert_cmpint (xsltSaveResultToString (&buffer, &len, res, style), ==, 0);
+  result = g_strstrip (g_strndup ((gchar *) buffer, len));
+  xmlFree (buffer);
+
+  xmlFreeDoc (res);
+  xsltFreeStylesheet (style);
+  xmlFreeDoc (doc);
+  gda_xslt_finalize_context (sql_ctx);
+
+  return result;
+}
+
+static void
+test_xslt_stream (TestObjectFixture *fixture,
+                  G_GNUC_UNUSED gconstpointer user_data)
+{
+  gchar *result;
+
+  gda_connection_reset_metrics (fixture->cnc);
+  result = run_transform (fixture, "<root/>",
+                          STYLESHEET_START
+                          "<xsl:template match='/'><out>"
+                          "<sql:section stream='yes'>"
+                          "<sql:query name='all'>SELECT id, name FROM items ORDER BY id</sql:query>"
+                          "<sql:template><xsl:call-template name='row'/></sql:template>"
+                          "</sql:section></out></xsl:template>"
+                          "<xsl:template name='row'><r>"
+                          "<xsl:value-of select=\"sql:getvalue('all','id')\"/>="
+                          "<xsl:value-of select=\"sql:getvalue('all','name')\"/>:"
+                          "<xsl:value-of select=\"count(sql:getnodeset('all')/row)\"/>"
+                          "</r></xsl:template>"
+                          STYLESHEET_END);
+  /* the template is called once per row, and the result set is the current row only */
+  g_assert_cmpstr (result, ==, "<out><r>1=a:1</r><r>2=:1</r><r>3=c:1</r></out>");
+  g_free (result);
+  g_assert_cmpuint (count_executed_statements (fixture->cnc), ==, 1);
+}
+
+static void
+test_xslt_cache (TestObjectFixture *fixture,
+                 G_GNUC_UNUSED gconstpointer user_data)
+{
+  gchar *result;
+
+  gda_connection_reset_metrics (fixture->cnc);
+  result = run_transform (fixture, "<root><k>1</k><k>2</k><k>1</k><k>3</k></root>",
+                          STYLESHEET_START
+                          "<xsl:template match='/'><out>"
+                          "<xsl:for-each select='//k'><xsl:call-template name='one'/></xsl:for-each>"
+                          "</out></xsl:template>"
+                          "<xsl:template name='one'><xsl:variable name='key' select='text()'/>"
+                          "<sql:section>"
+                          "<sql:query name='item'>SELECT id, name FROM items WHERE id = ##key::gint</sql:query>"
+                          "<sql:template><xsl:call-template name='item'/></sql:template>"
+                          "</sql:section></xsl:template>"
+                          "<xsl:template name='item'><i>"
+                          "<xsl:value-of select=\"sql:getvalue('item','id')\"/>="
+                          "<xsl:value-of select=\"sql:getvalue('item','name')\"/>"
+                          "</i></xsl:template>"
+                          STYLESHEET_END);
+  g_assert_cmpstr (result, ==, "<out><i>1=a</i><i>2=</i><i>1=a</i><i>3=c</i></out>");
+  g_free (result);
+  /* the query run a second time with the same parameter uses the previous result */
+  g_assert_cmpuint (count_executed_statements (fixture->cnc), ==, 3);
+}
+
+static void
+test_xslt_values (TestObjectFixture *fixture,
+                  G_GNUC_UNUSED gconstpointer user_data)
+{
+  gchar *result;
+
+  result = run_transform (fixture, "<root/>",
+                          STYLESHEET_START
+                          "<xsl:template match='/'><out>"
+                          "<sql:section>"
+                          "<sql:query name='items'>SELECT id, name, data FROM items WHERE id &lt; 3 ORDER BY id</sql:query>"
+                          "<sql:template><xsl:call-template name='items'/></sql:template>"
+                          "</sql:section></out></xsl:template>"
+                          "<xsl:template name='items'>"
+                          "<v><xsl:value-of select=\"sql:getvalue('items','data')\"/></v>"
+                          "<xsl:copy-of select=\"sql:getnodeset('items')\"/>"
+                          "</xsl:template>"
+                          STYLESHEET_END);
+  g_assert_cmpstr (result, ==,
+                   "<out><v>Binary data</v><resultset>"
+                   "<row><column name=\"id\">1</column><column name=\"name\">a</column>"
+                   "<column name=\"data\">Binary data</column></row>"
+                   "<row><column name=\"id\">2</column><column name=\"name\" isnull=\"true\"/>"
+                   "<column name=\"data\" isnull=\"true\"/></row>"
+                   "</resultset></out>");
+  g_free (result);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  setlocale (LC_ALL,"");
+  g_test_init (&argc, &argv, NULL);
+  gda_init ();
+
+  g_test_add ("/test-xslt/stream",
+              TestObjectFixture,
+              NULL,
+              test_xslt_start,
+              test_xslt_stream,
+              test_xslt_finish);
+
+  g_test_add ("/test-xslt/cache",
+              TestObjectFixture,
+              NULL,
+              test_xslt_start,
+              test_xslt_cache,
+              test_xslt_finish);
+
+  g_test_add ("/test-xslt/values",
+              TestObjectFixture,
+              NULL,
+              test_xslt_start,
+              test_xslt_values,
+              test_xslt_finish);
+
+  return g_test_run ();
+}
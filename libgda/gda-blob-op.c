@@ -33,6 +33,8 @@
 #include "gda-server-provider-private.h"
 #include "thread-wrapper/gda-worker.h"
 #include "gda-value.h"
+#include "gda-trace-private.h"
+#include "gda-blob-stream.h"
 
 #define PARENT_TYPE G_TYPE_OBJECT
 #define CLASS(blob) (GDA_BLOB_OP_CLASS (G_OBJECT_GET_CLASS (blob)))
@@ -48,6 +50,9 @@ static void gda_blob_op_get_property (GObject *object,
 				      guint param_id,
 				      GValue *value,
 				      GParamSpec *pspec);
+static glong blob_op_read_real (GdaBlobOp *op, GdaBlob *blob, glong offset, glong size);
+static glong blob_op_write_real (GdaBlobOp *op, GdaBlob *blob, glong offset);
+static gboolean blob_op_write_all_real (GdaBlobOp *op, GdaBlob *blob);
 
 typedef struct {
 	GdaConnection *cnc;
@@ -243,7 +248,18 @@ worker_read (WorkerData *data, GError **error)
 glong
 gda_blob_op_read (GdaBlobOp *op, GdaBlob *blob, glong offset, glong size)
 {
+	glong retval;
 	g_return_val_if_fail (GDA_IS_BLOB_OP (op), -1);
+
+	GDA_TRACE (blob_read, begin, op, offset);
+	retval = blob_op_read_real (op, blob, offset, size);
+	GDA_TRACE (blob_read, end, op, retval);
+	return retval;
+}
+
+static glong
+blob_op_read_real (GdaBlobOp *op, GdaBlob *blob, glong offset, glong size)
+{
 	GdaBlobOpPrivate *priv = gda_blob_op_get_instance_private (op);
 
 	if (priv) {
@@ -336,7 +352,18 @@ worker_write (WorkerData *data, GError **error)
 glong
 gda_blob_op_write (GdaBlobOp *op, GdaBlob *blob, glong offset)
 {
+	glong retval;
 	g_return_val_if_fail (GDA_IS_BLOB_OP (op), -1);
+
+	GDA_TRACE (blob_write, begin, op, offset);
+	retval = blob_op_write_real (op, blob, offset);
+	GDA_TRACE (blob_write, end, op, retval);
+	return retval;
+}
+
+static glong
+blob_op_write_real (GdaBlobOp *op, GdaBlob *blob, glong offset)
+{
 	GdaBlobOpPrivate *priv = gda_blob_op_get_instance_private (op);
 
 	if (priv) {
@@ -380,13 +407,22 @@ gda_blob_op_write (GdaBlobOp *op, GdaBlob *blob, glong offset)
 static gpointer
 worker_write_all (WorkerData *data, GError **error)
 {
-	if (VFUNCTIONS (data->op)->write_all != NULL)
-		data->retval = VFUNCTIONS (data->op)->write_all (data->op, data->blob) ? 1 : 0;
-	else
-		data->retval = 0;
+	data->retval = blob_op_write_all_real (data->op, data->blob) ? 1 : 0;
 	return (gpointer) 0x01;
 }
 
+static gboolean
+blob_op_write_all_real (GdaBlobOp *op, GdaBlob *blob)
+{
+	gboolean retval = FALSE;
+
+	GDA_TRACE (blob_write, begin, op, 0);
+	if (VFUNCTIONS (op)->write_all != NULL)
+		retval = VFUNCTIONS (op)->write_all (op, blob);
+	GDA_TRACE (blob_write, end, op, retval ? gda_binary_get_size (gda_blob_get_binary (blob)) : -1);
+	return retval;
+}
+
 /**
  * gda_blob_op_write_all:
  * @op: a #GdaBlobOp
@@ -434,7 +470,7 @@ gda_blob_op_write_all (GdaBlobOp *op, GdaBlob *blob)
 				return FALSE;
 		}
 		else
-			return VFUNCTIONS (op)->write_all (op, blob);
+			return blob_op_write_all_real (op, blob);
 	}
 	else {
 		glong res;
@@ -442,3 +478,75 @@ gda_blob_op_write_all (GdaBlobOp *op, GdaBlob *blob)
 		return res >= 0 ? TRUE : FALSE;
 	}
 }
+
+static gsize
+blob_op_get_buffer_size (GdaBlobOp *op, gsize buffer_size)
+{
+	GdaBlobOpPrivate *priv;
+
+	if (buffer_size > 0)
+		return buffer_size;
+	priv = gda_blob_op_get_instance_private (op);
+	if (priv && priv->cnc)
+		return _gda_connection_get_blob_chunk_size (priv->cnc);
+	return _GDA_BLOB_CHUNK_SIZE;
+}
+
+/**
+ * gda_blob_op_get_input_stream:
+ * @op: a #GdaBlobOp
+ * @buffer_size: the size of the read-ahead buffer, or 0 to use the connection's "blob-chunk-size" property
+ *
+ * Creates a #GInputStream to read the contents of the BLOB manipulated by @op, starting at its beginning.
+ * Data is fetched from the BLOB by blocks of @buffer_size bytes, so reading the stream in small pieces
+ * does not require one round trip to the database for each read.
+ *
+ * The returned stream is seekable, and its asynchronous functions (such as g_input_stream_read_async())
+ * run in a separate thread, so it can be used with g_output_stream_splice() to copy a BLOB
+ * to a file or to a socket without loading it in memory.
+ *
+ * Returns: (transfer full): a new #GInputStream
+ *
+ * Since: 6.0
+ */
+GInputStream *
+gda_blob_op_get_input_stream (GdaBlobOp *op, gsize buffer_size)
+{
+	GInputStream *base, *stream;
+
+	g_return_val_if_fail (GDA_IS_BLOB_OP (op), NULL);
+
+	base = _gda_blob_input_stream_new (op);
+	stream = g_buffered_input_stream_new_sized (base, blob_op_get_buffer_size (op, buffer_size));
+	g_object_unref (base);
+	return stream;
+}
+
+/**
+ * gda_blob_op_get_output_stream:
+ * @op: a #GdaBlobOp
+ * @buffer_size: the size of the write-behind buffer, or 0 to use the connection's "blob-chunk-size" property
+ *
+ * Creates a #GOutputStream to write to the BLOB manipulated by @op, starting at its beginning.
+ * Written data is accumulated and sent to the BLOB by blocks of @buffer_size bytes; use
+ * g_output_stream_flush() or g_output_stream_close() to make sure all the data has been written.
+ *
+ * The asynchronous functions of the returned stream (such as g_output_stream_splice_async())
+ * run in a separate thread.
+ *
+ * Returns: (transfer full): a new #GOutputStream
+ *
+ * Since: 6.0
+ */
+GOutputStream *
+gda_blob_op_get_output_stream (GdaBlobOp *op, gsize buffer_size)
+{
+	GOutputStream *base, *stream;
+
+	g_return_val_if_fail (GDA_IS_BLOB_OP (op), NULL);
+
+	base = _gda_blob_output_stream_new (op);
+	stream = g_buffered_output_stream_new_sized (base, blob_op_get_buffer_size (op, buffer_size));
+	g_object_unref (base);
+	return stream;
+}
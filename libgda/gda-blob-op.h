@@ -23,6 +23,7 @@
 
 #include <glib.h>
 #include <glib-object.h>
+#include <gio/gio.h>
 #include <libgda/gda-decl.h>
 #include <libgda/gda-value.h>
 
@@ -112,6 +113,9 @@ gboolean gda_blob_op_read_all   (GdaBlobOp *op, GdaBlob *blob);
 glong    gda_blob_op_write      (GdaBlobOp *op, GdaBlob *blob, glong offset);
 gboolean gda_blob_op_write_all  (GdaBlobOp *op, GdaBlob *blob);
 
+GInputStream  *gda_blob_op_get_input_stream  (GdaBlobOp *op, gsize buffer_size);
+GOutputStream *gda_blob_op_get_output_stream (GdaBlobOp *op, gsize buffer_size);
+
 G_END_DECLS
 
 #endif
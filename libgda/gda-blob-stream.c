@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+#define G_LOG_DOMAIN "GDA-blob-stream"
+
+#include <string.h>
+#include <glib/gi18n-lib.h>
+#include <libgda/gda-blob-stream.h>
+
+/*
+ * GdaBlobInputStream
+ */
+struct _GdaBlobInputStream {
+	GInputStream  parent_instance;
+	GdaBlobOp    *op;
+	GdaBlob      *blob; /* used to receive the data read by @op */
+	glong         offset;
+	glong         length; /* -1 until known */
+};
+
+static void gda_blob_input_stream_seekable_init (GSeekableIface *iface);
+
+G_DEFINE_TYPE_WITH_CODE (GdaBlobInputStream, _gda_blob_input_stream, G_TYPE_INPUT_STREAM,
+			 G_IMPLEMENT_INTERFACE (G_TYPE_SEEKABLE, gda_blob_input_stream_seekable_init))
+
+static void
+gda_blob_input_stream_finalize (GObject *object)
+{
+	GdaBlobInputStream *stream = GDA_BLOB_INPUT_STREAM (object);
+
+	g_object_unref (stream->op);
+	gda_blob_free (stream->blob);
+
+	G_OBJECT_CLASS (_gda_blob_input_stream_parent_class)->finalize (object);
+}
+
+static glong
+gda_blob_input_stream_get_length (GdaBlobInputStream *stream)
+{
+	if (stream->length < 0)
+		stream->length = gda_blob_op_get_length (stream->op);
+	return stream->length;
+}
+
+static gssize
+gda_blob_input_stream_read (GInputStream *input, void *buffer, gsize count,
+			    GCancellable *cancellable, GError **error)
+{
+	GdaBlobInputStream *stream = GDA_BLOB_INPUT_STREAM (input);
+	GdaBinary *bin;
+	glong nread, length;
+
+	if (g_cancellable_set_error_if_cancelled (cancellable, error))
+		return -1;
+	if (count == 0)
+		return 0;
+	if (count > G_MAXLONG)
+		count = G_MAXLONG;
+
+	/* some providers report an error when reading at the end of the BLOB */
+	length = gda_blob_input_stream_get_length (stream);
+	if ((length >= 0) && (stream->offset >= length))
+		return 0;
+
+	nread = gda_blob_op_read (stream->op, stream->blob, stream->offset, (glong) count);
+	if (nread < 0) {
+		g_set_error (error, G_IO_ERROR, G_IO_ERROR_FAILED,
+			     "%s", _("Can't read BLOB's contents"));
+		return -1;
+	}
+
+	bin = gda_blob_get_binary (stream->blob);
+	nread = MIN ((glong) count, gda_binary_get_size (bin));
+	if (nread > 0)
+		memcpy (buffer, gda_binary_get_data (bin), nread);
+	stream->offset += nread;
+	return nread;
+}
+
+static gssize
+gda_blob_input_stream_skip (GInputStream *input, gsize count,
+			    GCancellable *cancellable, GError **error)
+{
+	GdaBlobInputStream *stream = GDA_BLOB_INPUT_STREAM (input);
+	glong length;
+
+	if (g_cancellable_set_error_if_cancelled (cancellable, error))
+		return -1;
+
+	/* no need to read anything, only the position changes */
+	length = gda_blob_input_stream_get_length (stream);
+	if (length < 0) {
+		g_set_error (error, G_IO_ERROR, G_IO_ERROR_FAILED,
+			     "%s", _("Can't get BLOB's length"));
+		return -1;
+	}
+	if (stream->offset >= length)
+		return 0;
+	if ((glong) count > length - stream->offset)
+		count = length - stream->offset;
+	stream->offset += count;
+	return count;
+}
+
+static gboolean
+gda_blob_input_stream_close (G_GNUC_UNUSED GInputStream *input, G_GNUC_UNUSED GCancellable *cancellable,
+			     G_GNUC_UNUSED GError **error)
+{
+	return TRUE;
+}
+
+static void
+_gda_blob_input_stream_class_init (GdaBlobInputStreamClass *klass)
+{
+	GObjectClass *object_class = G_OBJECT_CLASS (klass);
+	GInputStreamClass *stream_class = G_INPUT_STREAM_CLASS (klass);
+
+	object_class->finalize = gda_blob_input_stream_finalize;
+	stream_class->read_fn = gda_blob_input_stream_read;
+	stream_class->skip = gda_blob_input_stream_skip;
+	stream_class->close_fn = gda_blob_input_stream_close;
+	/* the default asynchronous implementations run the functions above in a thread,
+	 * which is what we want as they block on the connection's worker thread */
+}
+
+static void
+_gda_blob_input_stream_init (GdaBlobInputStream *stream)
+{
+	stream->length = -1;
+}
+
+static goffset
+gda_blob_input_stream_tell (GSeekable *seekable)
+{
+	return GDA_BLOB_INPUT_STREAM (seekable)->offset;
+}
+
+static gboolean
+gda_blob_input_stream_can_seek (G_GNUC_UNUSED GSeekable *seekable)
+{
+	return TRUE;
+}
+
+static gboolean
+gda_blob_input_stream_seek (GSeekable *seekable, goffset offset, GSeekType type,
+			    GCancellable *cancellable, GError **error)
+{
+	GdaBlobInputStream *stream = GDA_BLOB_INPUT_STREAM (seekable);
+	goffset pos;
+
+	if (g_cancellable_set_error_if_cancelled (cancellable, error))
+		return FALSE;
+
+	switch (type) {
+	case G_SEEK_CUR:
+		pos = stream->offset + offset;
+		break;
+	case G_SEEK_SET:
+		pos = offset;
+		break;
+	case G_SEEK_END: {
+		glong length;
+		length = gda_blob_input_stream_get_length (stream);
+		if (length < 0) {
+			g_set_error (error, G_IO_ERROR, G_IO_ERROR_FAILED,
+				     "%s", _("Can't get BLOB's length"));
+			return FALSE;
+		}
+		pos = length + offset;
+		break;
+	}
+	default:
+		g_assert_not_reached ();
+	}
+
+	if ((pos < 0) || (pos > G_MAXLONG)) {
+		g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_ARGUMENT,
+			     "%s", _("Invalid seek request"));
+		return FALSE;
+	}
+	stream->offset = (glong) pos;
+	return TRUE;
+}
+
+static gboolean
+gda_blob_input_stream_can_truncate (G_GNUC_UNUSED GSeekable *seekable)
+{
+	return FALSE;
+}
+
+static gboolean
+gda_blob_input_stream_truncate (G_GNUC_UNUSED GSeekable *seekable, G_GNUC_UNUSED goffset offset,
+				G_GNUC_UNUSED GCancellable *cancellable, GError **error)
+{
+	g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+		     "%s", _("Cannot truncate a BLOB input stream"));
+	return FALSE;
+}
+
+static void
+gda_blob_input_stream_seekable_init (GSeekableIface *iface)
+{
+	iface->tell = gda_blob_input_stream_tell;
+	iface->can_seek = gda_blob_input_stream_can_seek;
+	iface->seek = gda_blob_input_stream_seek;
+	iface->can_truncate = gda_blob_input_stream_can_truncate;
+	iface->truncate_fn = gda_blob_input_stream_truncate;
+}
+
+GInputStream *
+_gda_blob_input_stream_new (GdaBlobOp *op)
+{
+	GdaBlobInputStream *stream;
+
+	g_return_val_if_fail (GDA_IS_BLOB_OP (op), NULL);
+
+	stream = g_object_new (GDA_TYPE_BLOB_INPUT_STREAM, NULL);
+	stream->op = g_object_ref (op);
+	stream->blob = gda_blob_new ();
+	return (GInputStream*) stream;
+}
+
+/*
+ * GdaBlobOutputStream
+ */
+struct _GdaBlobOutputStream {
+	GOutputStream  parent_instance;
+	GdaBlobOp     *op;
+	GdaBlob       *blob; /* holds the data passed to @op */
+	glong          offset;
+};
+
+G_DEFINE_TYPE (GdaBlobOutputStream, _gda_blob_output_stream, G_TYPE_OUTPUT_STREAM)
+
+static void
+gda_blob_output_stream_finalize (GObject *object)
+{
+	GdaBlobOutputStream *stream = GDA_BLOB_OUTPUT_STREAM (object);
+
+	g_object_unref (stream->op);
+	gda_blob_free (stream->blob);
+
+	G_OBJECT_CLASS (_gda_blob_output_stream_parent_class)->finalize (object);
+}
+
+static gssize
+gda_blob_output_stream_write (GOutputStream *output, const void *buffer, gsize count,
+			      GCancellable *cancellable, GError **error)
+{
+	GdaBlobOutputStream *stream = GDA_BLOB_OUTPUT_STREAM (output);
+	glong nwritten;
+
+	if (g_cancellable_set_error_if_cancelled (cancellable, error))
+		return -1;
+	if (count == 0)
+		return 0;
+	if (count > G_MAXLONG)
+		count = G_MAXLONG;
+
+	gda_binary_set_data (gda_blob_get_binary (stream->blob), buffer, (glong) count);
+	nwritten = gda_blob_op_write (stream->op, stream->blob, stream->offset);
+	gda_binary_reset_data (gda_blob_get_binary (stream->blob));
+	if (nwritten < 0) {
+		g_set_error (error, G_IO_ERROR, G_IO_ERROR_FAILED,
+			     "%s", _("Can't write BLOB's contents"));
+		return -1;
+	}
+	stream->offset += nwritten;
+	return nwritten;
+}
+
+static gboolean
+gda_blob_output_stream_close (G_GNUC_UNUSED GOutputStream *output, G_GNUC_UNUSED GCancellable *cancellable,
+			      G_GNUC_UNUSED GError **error)
+{
+	return TRUE;
+}
+
+static void
+_gda_blob_output_stream_class_init (GdaBlobOutputStreamClass *klass)
+{
+	GObjectClass *object_class = G_OBJECT_CLASS (klass);
+	GOutputStreamClass *stream_class = G_OUTPUT_STREAM_CLASS (klass);
+
+	object_class->finalize = gda_blob_output_stream_finalize;
+	stream_class->write_fn = gda_blob_output_stream_write;
+	stream_class->close_fn = gda_blob_output_stream_close;
+}
+
+static void
+_gda_blob_output_stream_init (G_GNUC_UNUSED GdaBlobOutputStream *stream)
+{
+}
+
+GOutputStream *
+_gda_blob_output_stream_new (GdaBlobOp *op)
+{
+	GdaBlobOutputStream *stream;
+
+	g_return_val_if_fail (GDA_IS_BLOB_OP (op), NULL);
+
+	stream = g_object_new (GDA_TYPE_BLOB_OUTPUT_STREAM, NULL);
+	stream->op = g_object_ref (op);
+	stream->blob = gda_blob_new ();
+	return (GOutputStream*) stream;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __GDA_BLOB_STREAM_H__
+#define __GDA_BLOB_STREAM_H__
+
+#include <gio/gio.h>
+#include <libgda/gda-blob-op.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Unbuffered GIO streams reading from and writing to a GdaBlobOp, each read or write being
+ * a single call to gda_blob_op_read() or gda_blob_op_write(); see gda_blob_op_get_input_stream()
+ * and gda_blob_op_get_output_stream() which add the buffering.
+ */
+#define GDA_TYPE_BLOB_INPUT_STREAM (_gda_blob_input_stream_get_type ())
+G_DECLARE_FINAL_TYPE (GdaBlobInputStream, _gda_blob_input_stream, GDA, BLOB_INPUT_STREAM, GInputStream)
+
+#define GDA_TYPE_BLOB_OUTPUT_STREAM (_gda_blob_output_stream_get_type ())
+G_DECLARE_FINAL_TYPE (GdaBlobOutputStream, _gda_blob_output_stream, GDA, BLOB_OUTPUT_STREAM, GOutputStream)
+
+GInputStream  *_gda_blob_input_stream_new  (GdaBlobOp *op);
+GOutputStream *_gda_blob_output_stream_new (GdaBlobOp *op);
+
+G_END_DECLS
+
+#endif
@@ -1697,12 +1697,17 @@ gda_config_get_provider (const gchar *provider_name, GError **error)
 		if (!ip->handle) {
 			g_set_error (error, GDA_CONFIG_ERROR, GDA_CONFIG_PROVIDER_CREATION_ERROR,
 				     _("Can't load provider: %s"), g_module_error ());
+			GDA_CONFIG_UNLOCK ();
 			return NULL;
 		}
 
-		void (*plugin_init) (void);
+		/* the module may not have been loaded yet if its information was in the providers' cache */
+		void (*plugin_init) (const gchar *);
 		if (g_module_symbol (ip->handle, "plugin_init", (gpointer *) &plugin_init)) {
-			plugin_init ();
+			gchar *dirname;
+			dirname = g_path_get_dirname (info->location);
+			plugin_init (dirname);
+			g_free (dirname);
 		}
 	}
 
@@ -1839,7 +1844,10 @@ internal_provider_sort_func (InternalProvider *a, InternalProvider *b)
 	return strcmp (a->pinfo.id, b->pinfo.id);
 }
 
-static void load_providers_from_dir (const gchar *dirname, gboolean recurs);
+typedef struct _ProvidersCache ProvidersCache;
+static ProvidersCache *providers_cache_load (void);
+static void providers_cache_save_and_free (ProvidersCache *cache);
+static void load_providers_from_dir (const gchar *dirname, gboolean recurs, ProvidersCache *cache);
 static void
 load_all_providers (void)
 {
@@ -1847,20 +1855,24 @@ load_all_providers (void)
 	g_assert (unique_instance);
 	GdaConfigPrivate *priv = gda_config_get_instance_private (unique_instance);
 	GError *error = NULL;
+	ProvidersCache *cache;
 
+	cache = providers_cache_load ();
 	dirname = g_getenv ("GDA_TOP_BUILD_DIR");
 	if (dirname) {
 		gchar *pdir;
 		pdir = g_build_path (G_DIR_SEPARATOR_S, dirname, "providers", NULL);
-		load_providers_from_dir (pdir, TRUE);
+		load_providers_from_dir (pdir, TRUE, cache);
 		g_free (pdir);
 	}
 	else {
 		gchar *str;
 		str = gda_gbr_get_file_path (GDA_LIB_DIR, LIBGDA_ABI_NAME, "providers", NULL);
-		load_providers_from_dir (str, FALSE);
+		load_providers_from_dir (str, FALSE, cache);
 		g_free (str);
 	}
+	if (cache)
+		providers_cache_save_and_free (cache);
 	priv->providers_loaded = TRUE;
 
 	/* find SQLite provider, and instantiate it if not installed */
@@ -1966,8 +1978,210 @@ create_internal_provider (const gchar *path,
 	return ip;
 }
 
+/*
+ * Providers' cache: the information about the providers installed is kept in a key file, with one group
+ * per provider's module (named after the module's path), so modules don't need to be loaded
+ * (with all their dependencies) just to know which providers they implement. A module's group is
+ * ignored and the module is loaded again when its modification time or size has changed.
+ */
+#define CACHE_KEY_MTIME "MTime"
+#define CACHE_KEY_SIZE "Size"
+#define CACHE_KEY_NB "NbProviders"
+#define CACHE_KEY_LOCALE "Locale" /* descriptions are translated */
+
+struct _ProvidersCache {
+	GKeyFile   *keyfile;
+	GHashTable *seen; /* key = module's path, value = not used */
+	gboolean    modified;
+};
+
+static gchar *
+providers_cache_get_filename (void)
+{
+	gchar *fname, *path;
+	fname = g_strdup_printf ("providers-%s.cache", LIBGDA_ABI_NAME);
+	path = g_build_filename (g_get_user_cache_dir (), "libgda", fname, NULL);
+	g_free (fname);
+	return path;
+}
+
+static ProvidersCache *
+providers_cache_load (void)
+{
+	ProvidersCache *cache;
+	gchar *path;
+
+	if (g_getenv ("GDA_NO_PROVIDERS_CACHE"))
+		return NULL;
+
+	cache = g_new0 (ProvidersCache, 1);
+	cache->keyfile = g_key_file_new ();
+	cache->seen = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+	path = providers_cache_get_filename ();
+	if (! g_key_file_load_from_file (cache->keyfile, path, G_KEY_FILE_NONE, NULL))
+		cache->modified = TRUE;
+	g_free (path);
+	return cache;
+}
+
+static void
+providers_cache_save_and_free (ProvidersCache *cache)
+{
+	gchar **groups, **ptr;
+
+	/* forget about the modules which have been removed */
+	groups = g_key_file_get_groups (cache->keyfile, NULL);
+	for (ptr = groups; ptr && *ptr; ptr++) {
+		if (! g_hash_table_contains (cache->seen, *ptr)) {
+			g_key_file_remove_group (cache->keyfile, *ptr, NULL);
+			cache->modified = TRUE;
+		}
+	}
+	g_strfreev (groups);
+
+	if (cache->modified) {
+		gchar *path, *dir;
+		path = providers_cache_get_filename ();
+		dir = g_path_get_dirname (path);
+		if (! g_mkdir_with_parents (dir, 0700)) {
+			GError *lerror = NULL;
+			gchar *data;
+			gsize length;
+			data = g_key_file_to_data (cache->keyfile, &length, NULL);
+			if (! g_file_set_contents (path, data, length, &lerror)) {
+				gda_log_message (_("Could not save providers' cache '%s': %s"), path,
+						 lerror && lerror->message ? lerror->message : _("No detail"));
+				g_clear_error (&lerror);
+			}
+			g_free (data);
+		}
+		g_free (dir);
+		g_free (path);
+	}
+
+	g_key_file_free (cache->keyfile);
+	g_hash_table_destroy (cache->seen);
+	g_free (cache);
+}
+
+static gchar *
+providers_cache_key (const gchar *key, gint index)
+{
+	return g_strdup_printf ("%s%d", key, index);
+}
+
+static gchar *
+providers_cache_get_string (ProvidersCache *cache, const gchar *path, const gchar *key, gint index)
+{
+	gchar *ckey, *value;
+	ckey = providers_cache_key (key, index);
+	value = g_key_file_get_string (cache->keyfile, path, ckey, NULL);
+	g_free (ckey);
+	return value;
+}
+
+static void
+providers_cache_set_string (ProvidersCache *cache, const gchar *path, const gchar *key, gint index,
+			    const gchar *value)
+{
+	gchar *ckey;
+	if (!value)
+		return;
+	ckey = providers_cache_key (key, index);
+	g_key_file_set_string (cache->keyfile, path, ckey, value);
+	g_free (ckey);
+}
+
+/*
+ * Creates the InternalProvider structures for the module at @path using @cache, if it
+ * contains up to date information for that module.
+ *
+ * Returns: %TRUE if @cache has been used
+ */
+static gboolean
+providers_cache_load_module (ProvidersCache *cache, const gchar *path, GStatBuf *sbuf)
+{
+	gint nb, i;
+	g_assert (unique_instance);
+	GdaConfigPrivate *priv = gda_config_get_instance_private (unique_instance);
+
+	if (! g_key_file_has_group (cache->keyfile, path) ||
+	    (g_key_file_get_int64 (cache->keyfile, path, CACHE_KEY_MTIME, NULL) != (gint64) sbuf->st_mtime) ||
+	    (g_key_file_get_int64 (cache->keyfile, path, CACHE_KEY_SIZE, NULL) != (gint64) sbuf->st_size))
+		return FALSE;
+
+	gchar *locale;
+	gboolean same_locale;
+	locale = g_key_file_get_string (cache->keyfile, path, CACHE_KEY_LOCALE, NULL);
+	same_locale = locale && !strcmp (locale, g_get_language_names ()[0]);
+	g_free (locale);
+	if (!same_locale)
+		return FALSE;
+
+	nb = g_key_file_get_integer (cache->keyfile, path, CACHE_KEY_NB, NULL);
+	for (i = 0; i < nb; i++) {
+		InternalProvider *ip;
+		gchar *name, *descr, *icon_id;
+
+		name = providers_cache_get_string (cache, path, "Name", i);
+		if (!name)
+			continue;
+		descr = providers_cache_get_string (cache, path, "Description", i);
+		icon_id = providers_cache_get_string (cache, path, "IconId", i);
+		ip = create_internal_provider (path, name, descr,
+					       providers_cache_get_string (cache, path, "DsnSpec", i),
+					       providers_cache_get_string (cache, path, "AuthSpec", i),
+					       icon_id);
+		if (ip) {
+			priv->prov_list = g_slist_prepend (priv->prov_list, ip);
+#ifdef GDA_DEBUG
+			g_print ("Loaded '%s' provider from cache\n", ((GdaProviderInfo*) ip)->id);
+#endif
+		}
+		g_free (name);
+		g_free (descr);
+		g_free (icon_id);
+	}
+	return TRUE;
+}
+
+/*
+ * Adds a provider found in the module at @path, and stores its information in @cache if not %NULL.
+ * @dsn_spec and @auth_spec are freed by this function.
+ */
+static void
+add_module_provider (ProvidersCache *cache, const gchar *path, gint index,
+		     const gchar *prov_name, const gchar *prov_descr,
+		     gchar *dsn_spec, gchar *auth_spec, const gchar *icon_id)
+{
+	InternalProvider *ip;
+	g_assert (unique_instance);
+	GdaConfigPrivate *priv = gda_config_get_instance_private (unique_instance);
+
+	if (cache && prov_name) {
+		providers_cache_set_string (cache, path, "Name", index, prov_name);
+		providers_cache_set_string (cache, path, "Description", index, prov_descr);
+		providers_cache_set_string (cache, path, "DsnSpec", index, dsn_spec);
+		providers_cache_set_string (cache, path, "AuthSpec", index, auth_spec);
+		providers_cache_set_string (cache, path, "IconId", index, icon_id);
+	}
+
+	ip = create_internal_provider (path, prov_name, prov_descr, dsn_spec, auth_spec, icon_id);
+	if (ip) {
+		priv->prov_list = g_slist_prepend (priv->prov_list, ip);
+#ifdef GDA_DEBUG
+		g_print ("Loaded '%s' provider\n", ((GdaProviderInfo*) ip)->id);
+#endif
+	}
+#ifdef GDA_DEBUG
+	else {
+		g_print ("Error Loading provider\n");
+	}
+#endif
+}
+
 static void 
-load_providers_from_dir (const gchar *dirname, gboolean recurs)
+load_providers_from_dir (const gchar *dirname, gboolean recurs, ProvidersCache *cache)
 {
 	GDir *dir;
 	GError *err = NULL;
@@ -1976,7 +2190,6 @@ load_providers_from_dir (const gchar *dirname, gboolean recurs)
 	GDA_CONFIG_LOCK ();
 	if (!unique_instance)
 		gda_config_get ();
-	GdaConfigPrivate *priv = gda_config_get_instance_private (unique_instance);
 	/* read the plugin directory */
 #ifdef GDA_DEBUG
 	g_print ("Loading providers in %s\n", dirname);
@@ -1985,12 +2198,15 @@ load_providers_from_dir (const gchar *dirname, gboolean recurs)
 	if (err) {
 		gda_log_error (err->message);
 		g_error_free (err);
+		GDA_CONFIG_UNLOCK ();
 		return;
 	}
 	
 	while ((name = g_dir_read_name (dir))) {
 		GModule *handle;
 		gchar *path;
+		GStatBuf sbuf;
+		ProvidersCache *mcache = NULL; /* @cache if it can be used for the module */
 
 		/* initialization method */
 		void (*plugin_init) (const gchar *);
@@ -2013,7 +2229,7 @@ load_providers_from_dir (const gchar *dirname, gboolean recurs)
 			gchar *cname;
 			cname = g_build_filename (dirname, name, NULL);
 			if (g_file_test (cname, G_FILE_TEST_IS_DIR)) 
-				load_providers_from_dir (cname, TRUE);
+				load_providers_from_dir (cname, TRUE, cache);
 			g_free (cname);
 		}
 		if (!g_str_has_suffix (name, "." G_MODULE_SUFFIX))
@@ -2029,6 +2245,17 @@ load_providers_from_dir (const gchar *dirname, gboolean recurs)
 		g_print ("File's name checking for provider: %s\n", name);
 #endif
 		path = g_build_path (G_DIR_SEPARATOR_S, dirname, name, NULL);
+
+		/* key file's group names can't contain any '[' or ']' */
+		if (cache && !strchr (path, '[') && !strchr (path, ']') && !g_stat (path, &sbuf)) {
+			g_hash_table_add (cache->seen, g_strdup (path));
+			if (providers_cache_load_module (cache, path, &sbuf)) {
+				g_free (path);
+				continue;
+			}
+			mcache = cache;
+		}
+
 		handle = g_module_open (path, G_MODULE_BIND_LAZY);
 		if (!handle) {
 			if (g_getenv ("GDA_SHOW_PROVIDER_LOADING_ERROR"))
@@ -2036,14 +2263,27 @@ load_providers_from_dir (const gchar *dirname, gboolean recurs)
 #ifdef GDA_DEBUG
 		g_print ("Error loading provider's module: %s : %s\n", path, g_module_error ());
 #endif
+			/* not cached: the module may be loadable later, once its dependencies are installed */
+			if (mcache)
+				g_key_file_remove_group (mcache->keyfile, path, NULL);
 			g_free (path);
 			continue;
 		}
 
+		if (mcache) {
+			g_key_file_remove_group (mcache->keyfile, path, NULL);
+			g_key_file_set_int64 (mcache->keyfile, path, CACHE_KEY_MTIME, (gint64) sbuf.st_mtime);
+			g_key_file_set_int64 (mcache->keyfile, path, CACHE_KEY_SIZE, (gint64) sbuf.st_size);
+			g_key_file_set_string (mcache->keyfile, path, CACHE_KEY_LOCALE, g_get_language_names ()[0]);
+			g_key_file_set_integer (mcache->keyfile, path, CACHE_KEY_NB, 0);
+			mcache->modified = TRUE;
+		}
+
 		if (g_module_symbol (handle, "plugin_init", (gpointer *) &plugin_init)) {
 			plugin_init (dirname);
 		}
 		else {
+			/* the module is cached as not implementing any provider */
 			g_module_close (handle);
 			g_free (path);
 			continue;
@@ -2072,52 +2312,29 @@ load_providers_from_dir (const gchar *dirname, gboolean recurs)
 		if (plugin_get_sub_names) {
 			const gchar **subnames = plugin_get_sub_names ();
 			const gchar **ptr;
-			for (ptr = subnames; ptr && *ptr; ptr++) {
-				InternalProvider *ip;
-								
-				ip = create_internal_provider (path, *ptr,
-							       plugin_get_sub_description ? 
-							       plugin_get_sub_description (*ptr) : NULL,
-							       plugin_get_sub_dsn_spec ? 
-							       plugin_get_sub_dsn_spec (*ptr) : NULL,
-							       plugin_get_sub_auth_spec ?
-							       plugin_get_sub_auth_spec (*ptr) : NULL,
-							       plugin_get_sub_icon_id ?
-							       plugin_get_sub_icon_id (*ptr) : NULL);
-				if (ip) {
-					priv->prov_list =
-						g_slist_prepend (priv->prov_list, ip);
-#ifdef GDA_DEBUG
-					g_print ("Loaded '%s' sub-provider\n", ((GdaProviderInfo*) ip)->id);
-#endif
-				}
-#ifdef GDA_DEBUG
-				else {
-					g_print ("Error Loading sub-provider\n");
-				}
-#endif
-			}
+			gint index = 0;
+			for (ptr = subnames; ptr && *ptr; ptr++, index++)
+				add_module_provider (mcache, path, index, *ptr,
+						     plugin_get_sub_description ? 
+						     plugin_get_sub_description (*ptr) : NULL,
+						     plugin_get_sub_dsn_spec ? 
+						     plugin_get_sub_dsn_spec (*ptr) : NULL,
+						     plugin_get_sub_auth_spec ?
+						     plugin_get_sub_auth_spec (*ptr) : NULL,
+						     plugin_get_sub_icon_id ?
+						     plugin_get_sub_icon_id (*ptr) : NULL);
+			if (mcache)
+				g_key_file_set_integer (mcache->keyfile, path, CACHE_KEY_NB, index);
 		}
 		else {
-			InternalProvider *ip;
-			ip = create_internal_provider (path,
-						       plugin_get_name ? plugin_get_name () : name,
-						       plugin_get_description ? plugin_get_description () : NULL,
-						       plugin_get_dsn_spec ? plugin_get_dsn_spec () : NULL,
-						       plugin_get_auth_spec ? plugin_get_auth_spec () : NULL,
-						       plugin_get_icon_id ? plugin_get_icon_id () : NULL);
-			if (ip) {
-				priv->prov_list =
-					g_slist_prepend (priv->prov_list, ip);
-#ifdef GDA_DEBUG
-				g_print ("Loaded '%s' provider\n", ((GdaProviderInfo*) ip)->id);
-#endif
-			}
-#ifdef GDA_DEBUG
-				else {
-					g_print ("Error Loading provider\n");
-				}
-#endif
+			add_module_provider (mcache, path, 0,
+					     plugin_get_name ? plugin_get_name () : name,
+					     plugin_get_description ? plugin_get_description () : NULL,
+					     plugin_get_dsn_spec ? plugin_get_dsn_spec () : NULL,
+					     plugin_get_auth_spec ? plugin_get_auth_spec () : NULL,
+					     plugin_get_icon_id ? plugin_get_icon_id () : NULL);
+			if (mcache)
+				g_key_file_set_integer (mcache->keyfile, path, CACHE_KEY_NB, 1);
 		}
 		g_free (path);
 		g_module_close (handle);
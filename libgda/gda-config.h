@@ -142,6 +142,11 @@ GType            gda_provider_info_get_type  (void) G_GNUC_CONST;
  * instance. Note that setting either of these properties to <literal>NULL</literal> will disable using the corresponding
  * configuration file (DSN will exist only in memory and their definition will be lost when the application finishes).
  *
+ * The information about the installed database providers is kept in a cache file in the user's cache
+ * directory, so the providers' modules (and the client libraries they depend on) are only loaded when a
+ * provider is actually used; a module is inspected again whenever its modification time or size changes.
+ * Setting the <envar>GDA_NO_PROVIDERS_CACHE</envar> environment variable disables that cache.
+ *
  * The #GdaConfig object implements its own locking mechanism so it is thread-safe.
  *
  * Note about localization: when the #GdaConfig loads configuration files, it filters the
@@ -26,6 +26,7 @@
 
 #include <libgda/gda-decl.h>
 #include <libgda/gda-server-provider.h>
+#include <libgda/gda-connection-metrics.h>
 
 G_BEGIN_DECLS
 
@@ -43,8 +44,17 @@ G_BEGIN_DECLS
 /*
  * Misc.
  */
+#define _GDA_BLOB_CHUNK_SIZE 65536 /* default value of the GdaConnection:blob-chunk-size property */
+
 GdaWorker         *_gda_connection_get_worker (GdaConnection *cnc);
 guint              _gda_connection_get_exec_slowdown (GdaConnection *cnc);
+guint              _gda_connection_get_blob_chunk_size (GdaConnection *cnc);
+guint              _gda_connection_get_statement_timeout (GdaConnection *cnc, GdaStatement *stmt);
+void               _gda_connection_get_row_limits (GdaConnection *cnc, GdaStatement *stmt,
+						   guint *out_max_rows, guint64 *out_max_bytes);
+gchar             *_gda_connection_lookup_quoted_identifier (GdaConnection *cnc, const gchar *key);
+void               _gda_connection_add_quoted_identifier (GdaConnection *cnc, const gchar *key,
+							  const gchar *quoted);
 
 void               _gda_connection_set_status (GdaConnection *cnc, GdaConnectionStatus status);
 void               gda_connection_increase_usage (GdaConnection *cnc);
@@ -65,6 +75,11 @@ GdaConnection     *_gda_open_internal_sqlite_connection (const gchar *cnc_string
 void               _gda_connection_signal_meta_table_update (GdaConnection *cnc, const gchar *table_name);
 gchar             *_gda_connection_compute_table_virtual_name (GdaConnection *cnc, const gchar *table_name);
 
+/*
+ * Statement metrics, see the GdaConnection:statement-metrics property
+ */
+GdaConnectionMetricsEntry *_gda_connection_get_metrics_entry (GdaConnection *cnc, GdaStatement *stmt);
+
 G_END_DECLS
 
 #endif
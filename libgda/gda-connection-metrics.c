@@ -0,0 +1,643 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <string.h>
+#include <libgda/gda-connection-metrics.h>
+#include <libgda/gda-statement.h>
+#include <libgda/gda-data-model-array.h>
+#include <libgda/gda-column.h>
+#include <libgda/gda-value.h>
+
+/*
+ * Latency histograms
+ *
+ * Values (in microseconds) are stored in log-linear buckets: each power of 2 range is split
+ * into HIST_SUB_BUCKETS buckets, so any value is known with a relative error below
+ * 1 / HIST_SUB_BUCKETS, whatever its magnitude (values below HIST_SUB_BUCKETS are exact).
+ * Values above 2^HIST_MAX_BITS microseconds (about 12 days) are stored in the last bucket.
+ */
+#define HIST_SUB_BITS 3
+#define HIST_SUB_BUCKETS (1 << HIST_SUB_BITS)
+#define HIST_MAX_BITS 40
+#define HIST_NB_BUCKETS ((HIST_MAX_BITS - HIST_SUB_BITS + 1) * HIST_SUB_BUCKETS)
+
+typedef struct {
+	guint64  count;
+	gint64   sum;
+	gint64   max;
+	guint64 *buckets; /* HIST_NB_BUCKETS counters, allocated with the 1st value */
+} Histogram;
+
+static guint
+histogram_bucket_index (gint64 usec)
+{
+	guint64 val;
+	guint shift;
+	if (usec < HIST_SUB_BUCKETS)
+		return usec < 0 ? 0 : (guint) usec;
+
+	val = (guint64) usec;
+	if (val >= ((guint64) 1) << HIST_MAX_BITS)
+		return HIST_NB_BUCKETS - 1;
+	shift = g_bit_storage (val) - 1 - HIST_SUB_BITS;
+	return (shift + 1) * HIST_SUB_BUCKETS + (guint) (val >> shift) - HIST_SUB_BUCKETS;
+}
+
+/* highest value stored in the @index bucket */
+static gint64
+histogram_bucket_upper_value (guint index)
+{
+	guint shift;
+	guint64 mantissa;
+	if (index < HIST_SUB_BUCKETS)
+		return index;
+	shift = index / HIST_SUB_BUCKETS - 1;
+	mantissa = index % HIST_SUB_BUCKETS + HIST_SUB_BUCKETS;
+	return (gint64) (((mantissa + 1) << shift) - 1);
+}
+
+static void
+histogram_add (Histogram *hist, gint64 usec)
+{
+	if (usec < 0)
+		usec = 0;
+	if (!hist->buckets)
+		hist->buckets = g_new0 (guint64, HIST_NB_BUCKETS);
+	hist->buckets [histogram_bucket_index (usec)] ++;
+	hist->count ++;
+	hist->sum += usec;
+	if (usec > hist->max)
+		hist->max = usec;
+}
+
+/*
+ * Returns: the value (in microseconds) below which @quantile of the values are, or -1 if
+ * there is no value
+ */
+static gint64
+histogram_get_quantile (Histogram *hist, gdouble quantile)
+{
+	guint64 rank, cumul = 0;
+	guint i;
+	if (hist->count == 0)
+		return -1;
+	rank = (guint64) (quantile * hist->count + 0.5);
+	if (rank < 1)
+		rank = 1;
+	for (i = 0; i < HIST_NB_BUCKETS; i++) {
+		cumul += hist->buckets [i];
+		if (cumul >= rank)
+			return MIN (histogram_bucket_upper_value (i), hist->max);
+	}
+	return hist->max;
+}
+
+static void
+histogram_clear (Histogram *hist)
+{
+	g_free (hist->buckets);
+	memset (hist, 0, sizeof (Histogram));
+}
+
+/*
+ * Metrics
+ */
+/*
+ * Each #GdaConnectionMetrics has its own lock, which protects its entries' contents. Entries
+ * may outlive the #GdaConnectionMetrics which created them (they are referenced by #GdaDataSelect
+ * objects), so they hold a reference on it for its lock.
+ */
+struct _GdaConnectionMetricsEntry {
+	gint       ref_count;
+	GdaConnectionMetrics *metrics; /* ref held */
+	gchar     *sql; /* normalized SQL */
+	guint64    executions;
+	guint64    errors;
+	guint64    rows;
+	Histogram  hists [GDA_CONNECTION_METRICS_NB_PHASES];
+};
+
+struct _GdaConnectionMetrics {
+	gint        ref_count;
+	GMutex      mutex;
+	GHashTable *entries; /* key = normalized SQL, value = a #GdaConnectionMetricsEntry (ref held) */
+};
+
+static const gchar *phase_names [GDA_CONNECTION_METRICS_NB_PHASES] = {
+	"prepare",
+	"queue_wait",
+	"execute",
+	"first_row",
+	"fetch_all"
+};
+
+GdaConnectionMetrics *
+_gda_connection_metrics_new (void)
+{
+	GdaConnectionMetrics *metrics;
+	metrics = g_new0 (GdaConnectionMetrics, 1);
+	metrics->ref_count = 1;
+	g_mutex_init (&(metrics->mutex));
+	metrics->entries = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+						  (GDestroyNotify) _gda_connection_metrics_entry_unref);
+	return metrics;
+}
+
+static void
+metrics_unref (GdaConnectionMetrics *metrics)
+{
+	if (g_atomic_int_dec_and_test (&(metrics->ref_count))) {
+		g_mutex_clear (&(metrics->mutex));
+		g_free (metrics);
+	}
+}
+
+void
+_gda_connection_metrics_free (GdaConnectionMetrics *metrics)
+{
+	GHashTable *entries;
+	g_return_if_fail (metrics);
+
+	/* the entries still referenced elsewhere keep @metrics alive for its lock */
+	g_mutex_lock (&(metrics->mutex));
+	entries = metrics->entries;
+	metrics->entries = NULL;
+	g_mutex_unlock (&(metrics->mutex));
+	g_hash_table_destroy (entries);
+	metrics_unref (metrics);
+}
+
+void
+_gda_connection_metrics_reset (GdaConnectionMetrics *metrics)
+{
+	g_return_if_fail (metrics);
+	g_mutex_lock (&(metrics->mutex));
+	g_hash_table_remove_all (metrics->entries);
+	g_mutex_unlock (&(metrics->mutex));
+}
+
+GdaConnectionMetricsEntry *
+_gda_connection_metrics_entry_ref (GdaConnectionMetricsEntry *entry)
+{
+	g_return_val_if_fail (entry, NULL);
+	g_atomic_int_inc (&(entry->ref_count));
+	return entry;
+}
+
+void
+_gda_connection_metrics_entry_unref (GdaConnectionMetricsEntry *entry)
+{
+	g_return_if_fail (entry);
+	if (g_atomic_int_dec_and_test (&(entry->ref_count))) {
+		guint i;
+		for (i = 0; i < GDA_CONNECTION_METRICS_NB_PHASES; i++)
+			histogram_clear (&(entry->hists [i]));
+		metrics_unref (entry->metrics);
+		g_free (entry->sql);
+		g_free (entry);
+	}
+}
+
+/*
+ * Replaces literal values by '?' and collapses white spaces
+ */
+static gchar *
+normalize_sql (const gchar *sql)
+{
+	GString *string;
+	const gchar *ptr;
+	gboolean in_space = FALSE;
+
+	string = g_string_sized_new (strlen (sql));
+	for (ptr = sql; *ptr; ) {
+		if (g_ascii_isspace (*ptr)) {
+			in_space = TRUE;
+			ptr++;
+			continue;
+		}
+		if (in_space && (string->len > 0))
+			g_string_append_c (string, ' ');
+		in_space = FALSE;
+
+		if (*ptr == '\'') {
+			/* string literal, with '' for quotes */
+			for (ptr++; *ptr; ptr++) {
+				if (*ptr == '\'') {
+					if (ptr[1] == '\'')
+						ptr++;
+					else
+						break;
+				}
+			}
+			if (*ptr)
+				ptr++;
+			g_string_append_c (string, '?');
+		}
+		else if (*ptr == '"') {
+			/* quoted identifier */
+			const gchar *start = ptr;
+			for (ptr++; *ptr && (*ptr != '"'); ptr++);
+			if (*ptr)
+				ptr++;
+			g_string_append_len (string, start, ptr - start);
+		}
+		else if (g_ascii_isdigit (*ptr) &&
+			 ((string->len == 0) ||
+			  (! g_ascii_isalnum (string->str [string->len - 1]) &&
+			   (string->str [string->len - 1] != '_')))) {
+			/* numeric literal */
+			for (; g_ascii_isalnum (*ptr) || (*ptr == '.'); ptr++);
+			g_string_append_c (string, '?');
+		}
+		else {
+			g_string_append_c (string, *ptr);
+			ptr++;
+		}
+	}
+	return g_string_free (string, FALSE);
+}
+
+/*
+ * The normalized SQL of each statement is cached as the statement's data, and is
+ * invalidated when the statement changes.
+ */
+#define STMT_SQL_KEY "_gda_metrics_sql"
+
+typedef struct {
+	GMutex mutex;
+	gchar *sql;
+	guint  serial; /* incremented each time the statement changes */
+} StmtSql;
+
+static void
+stmt_sql_free (StmtSql *ssql)
+{
+	g_mutex_clear (&(ssql->mutex));
+	g_free (ssql->sql);
+	g_free (ssql);
+}
+
+static void
+stmt_reset_cb (G_GNUC_UNUSED GdaStatement *stmt, StmtSql *ssql)
+{
+	g_mutex_lock (&(ssql->mutex));
+	g_free (ssql->sql);
+	ssql->sql = NULL;
+	ssql->serial++;
+	g_mutex_unlock (&(ssql->mutex));
+}
+
+/* the same statement may be executed by several connections at once */
+static StmtSql *
+stmt_get_stmt_sql (GdaStatement *stmt)
+{
+	StmtSql *ssql, *nssql;
+	ssql = g_object_get_data ((GObject*) stmt, STMT_SQL_KEY);
+	if (ssql)
+		return ssql;
+
+	nssql = g_new0 (StmtSql, 1);
+	g_mutex_init (&(nssql->mutex));
+	if (g_object_replace_data ((GObject*) stmt, STMT_SQL_KEY, NULL, nssql,
+				   (GDestroyNotify) stmt_sql_free, NULL)) {
+		g_signal_connect (stmt, "reset", G_CALLBACK (stmt_reset_cb), nssql);
+		return nssql;
+	}
+
+	/* another thread has been faster */
+	stmt_sql_free (nssql);
+	return g_object_get_data ((GObject*) stmt, STMT_SQL_KEY);
+}
+
+/*
+ * The statement is rendered without any lock being held, so rendering a statement
+ * for several connections is not serialized.
+ *
+ * Returns: (transfer full): the normalized SQL of @stmt
+ */
+static gchar *
+stmt_get_normalized_sql (GdaStatement *stmt)
+{
+	StmtSql *ssql;
+	gchar *sql, *nsql;
+	guint serial;
+
+	ssql = stmt_get_stmt_sql (stmt);
+	g_mutex_lock (&(ssql->mutex));
+	if (ssql->sql) {
+		nsql = g_strdup (ssql->sql);
+		g_mutex_unlock (&(ssql->mutex));
+		return nsql;
+	}
+	serial = ssql->serial;
+	g_mutex_unlock (&(ssql->mutex));
+
+	sql = gda_statement_to_sql_extended (stmt, NULL, NULL, GDA_STATEMENT_SQL_PARAMS_AS_UQMARK,
+					     NULL, NULL);
+	if (sql) {
+		nsql = normalize_sql (sql);
+		g_free (sql);
+	}
+	else
+		nsql = g_strdup ("?");
+
+	/* don't cache the result if @stmt has changed while it was being rendered */
+	g_mutex_lock (&(ssql->mutex));
+	if (!ssql->sql && (ssql->serial == serial))
+		ssql->sql = g_strdup (nsql);
+	g_mutex_unlock (&(ssql->mutex));
+	return nsql;
+}
+
+/*
+ * Returns: (transfer full): the #GdaConnectionMetricsEntry for @stmt, use
+ * _gda_connection_metrics_entry_unref() when not needed anymore
+ */
+GdaConnectionMetricsEntry *
+_gda_connection_metrics_get_entry (GdaConnectionMetrics *metrics, GdaStatement *stmt)
+{
+	GdaConnectionMetricsEntry *entry;
+	gchar *sql;
+	g_return_val_if_fail (metrics, NULL);
+	g_return_val_if_fail (GDA_IS_STATEMENT (stmt), NULL);
+
+	sql = stmt_get_normalized_sql (stmt);
+
+	g_mutex_lock (&(metrics->mutex));
+	entry = g_hash_table_lookup (metrics->entries, sql);
+	if (!entry) {
+		entry = g_new0 (GdaConnectionMetricsEntry, 1);
+		entry->ref_count = 1;
+		g_atomic_int_inc (&(metrics->ref_count));
+		entry->metrics = metrics;
+		entry->sql = sql;
+		sql = NULL;
+		g_hash_table_insert (metrics->entries, entry->sql, entry);
+	}
+	_gda_connection_metrics_entry_ref (entry);
+	g_mutex_unlock (&(metrics->mutex));
+	g_free (sql);
+	return entry;
+}
+
+void
+_gda_connection_metrics_entry_add_time (GdaConnectionMetricsEntry *entry, GdaConnectionMetricsPhase phase,
+					gint64 usec)
+{
+	g_return_if_fail (entry);
+	g_return_if_fail (phase < GDA_CONNECTION_METRICS_NB_PHASES);
+	g_mutex_lock (&(entry->metrics->mutex));
+	histogram_add (&(entry->hists [phase]), usec);
+	g_mutex_unlock (&(entry->metrics->mutex));
+}
+
+/*
+ * @nrows: the number of rows impacted by the execution, or -1 if unknown
+ */
+void
+_gda_connection_metrics_entry_add_execution (GdaConnectionMetricsEntry *entry, gboolean failed, gint64 nrows)
+{
+	g_return_if_fail (entry);
+	g_mutex_lock (&(entry->metrics->mutex));
+	entry->executions ++;
+	if (failed)
+		entry->errors ++;
+	if (nrows > 0)
+		entry->rows += nrows;
+	g_mutex_unlock (&(entry->metrics->mutex));
+}
+
+void
+_gda_connection_metrics_entry_add_rows (GdaConnectionMetricsEntry *entry, gint64 nrows)
+{
+	g_return_if_fail (entry);
+	if (nrows <= 0)
+		return;
+	g_mutex_lock (&(entry->metrics->mutex));
+	entry->rows += nrows;
+	g_mutex_unlock (&(entry->metrics->mutex));
+}
+
+/* sorts entries by decreasing total execution time */
+static gint
+entries_compare_func (gconstpointer a, gconstpointer b)
+{
+	GdaConnectionMetricsEntry *ea = *((GdaConnectionMetricsEntry**) a);
+	GdaConnectionMetricsEntry *eb = *((GdaConnectionMetricsEntry**) b);
+	gint64 sa, sb;
+	sa = ea->hists [GDA_CONNECTION_METRICS_EXECUTE].sum;
+	sb = eb->hists [GDA_CONNECTION_METRICS_EXECUTE].sum;
+	if (sa != sb)
+		return sa > sb ? -1 : 1;
+	return strcmp (ea->sql, eb->sql);
+}
+
+/* call with @metrics' lock held */
+static GPtrArray *
+metrics_get_sorted_entries (GdaConnectionMetrics *metrics)
+{
+	GPtrArray *array;
+	GHashTableIter iter;
+	gpointer entry;
+	array = g_ptr_array_sized_new (g_hash_table_size (metrics->entries));
+	g_hash_table_iter_init (&iter, metrics->entries);
+	while (g_hash_table_iter_next (&iter, NULL, &entry))
+		g_ptr_array_add (array, entry);
+	g_ptr_array_sort (array, entries_compare_func);
+	return array;
+}
+
+static GValue *
+usec_to_seconds_value (gint64 usec)
+{
+	GValue *value;
+	if (usec < 0)
+		return gda_value_new_null ();
+	value = gda_value_new (G_TYPE_DOUBLE);
+	g_value_set_double (value, usec / (gdouble) G_USEC_PER_SEC);
+	return value;
+}
+
+#define NB_STATS 3 /* median, 99th percentile and maximum */
+
+/*
+ * Returns: (transfer full): a new #GdaDataModel, see gda_connection_get_metrics()
+ */
+GdaDataModel *
+_gda_connection_metrics_to_data_model (GdaConnectionMetrics *metrics)
+{
+	GdaDataModel *model;
+	GType *types;
+	gint ncols, col;
+	guint i, phase;
+
+	g_return_val_if_fail (metrics, NULL);
+
+	ncols = 4 + GDA_CONNECTION_METRICS_NB_PHASES * NB_STATS;
+	types = g_new (GType, ncols);
+	types [0] = G_TYPE_STRING;
+	types [1] = G_TYPE_UINT64;
+	types [2] = G_TYPE_UINT64;
+	types [3] = G_TYPE_UINT64;
+	for (col = 4; col < ncols; col++)
+		types [col] = G_TYPE_DOUBLE;
+	model = gda_data_model_array_new_with_g_types_v (ncols, types);
+	g_free (types);
+
+	gda_column_set_name (gda_data_model_describe_column (model, 0), "statement");
+	gda_column_set_name (gda_data_model_describe_column (model, 1), "executions");
+	gda_column_set_name (gda_data_model_describe_column (model, 2), "errors");
+	gda_column_set_name (gda_data_model_describe_column (model, 3), "rows");
+	for (phase = 0, col = 4; phase < GDA_CONNECTION_METRICS_NB_PHASES; phase++) {
+		gchar *tmp;
+		tmp = g_strdup_printf ("%s_p50", phase_names [phase]);
+		gda_column_set_name (gda_data_model_describe_column (model, col++), tmp);
+		g_free (tmp);
+		tmp = g_strdup_printf ("%s_p99", phase_names [phase]);
+		gda_column_set_name (gda_data_model_describe_column (model, col++), tmp);
+		g_free (tmp);
+		tmp = g_strdup_printf ("%s_max", phase_names [phase]);
+		gda_column_set_name (gda_data_model_describe_column (model, col++), tmp);
+		g_free (tmp);
+	}
+
+	GPtrArray *entries;
+	g_mutex_lock (&(metrics->mutex));
+	entries = metrics_get_sorted_entries (metrics);
+	for (i = 0; i < entries->len; i++) {
+		GdaConnectionMetricsEntry *entry;
+		GList *values = NULL;
+		GValue *value;
+
+		entry = g_ptr_array_index (entries, i);
+		g_value_set_string ((value = gda_value_new (G_TYPE_STRING)), entry->sql);
+		values = g_list_prepend (values, value);
+		g_value_set_uint64 ((value = gda_value_new (G_TYPE_UINT64)), entry->executions);
+		values = g_list_prepend (values, value);
+		g_value_set_uint64 ((value = gda_value_new (G_TYPE_UINT64)), entry->errors);
+		values = g_list_prepend (values, value);
+		g_value_set_uint64 ((value = gda_value_new (G_TYPE_UINT64)), entry->rows);
+		values = g_list_prepend (values, value);
+		for (phase = 0; phase < GDA_CONNECTION_METRICS_NB_PHASES; phase++) {
+			Histogram *hist = &(entry->hists [phase]);
+			values = g_list_prepend (values, usec_to_seconds_value (histogram_get_quantile (hist, .5)));
+			values = g_list_prepend (values, usec_to_seconds_value (histogram_get_quantile (hist, .99)));
+			values = g_list_prepend (values, usec_to_seconds_value (hist->count > 0 ? hist->max : -1));
+		}
+		values = g_list_reverse (values);
+		gda_data_model_append_values (model, values, NULL);
+		g_list_free_full (values, (GDestroyNotify) gda_value_free);
+	}
+	g_mutex_unlock (&(metrics->mutex));
+	g_ptr_array_free (entries, TRUE);
+
+	g_object_set (model, "read-only", TRUE, NULL);
+	return model;
+}
+
+static void
+append_label_value (GString *string, const gchar *value)
+{
+	const gchar *ptr;
+	for (ptr = value; *ptr; ptr++) {
+		if ((*ptr == '\\') || (*ptr == '"'))
+			g_string_append_c (string, '\\');
+		else if (*ptr == '\n') {
+			g_string_append (string, "\\n");
+			continue;
+		}
+		g_string_append_c (string, *ptr);
+	}
+}
+
+/*
+ * Returns: (transfer full): a new string, see gda_connection_dump_metrics()
+ */
+gchar *
+_gda_connection_metrics_to_prometheus (GdaConnectionMetrics *metrics)
+{
+	static const gdouble quantiles [] = {.5, .9, .99};
+	static const gchar *counters [][2] = {
+		{"gda_statement_executions_total", "Number of executions of the statement"},
+		{"gda_statement_errors_total", "Number of failed executions of the statement"},
+		{"gda_statement_rows_total", "Number of rows returned or impacted by the statement"}
+	};
+	GString *string;
+	GPtrArray *entries;
+	guint c, i;
+
+	g_return_val_if_fail (metrics, NULL);
+
+	string = g_string_new ("");
+	g_mutex_lock (&(metrics->mutex));
+	entries = metrics_get_sorted_entries (metrics);
+	for (c = 0; c < G_N_ELEMENTS (counters); c++) {
+		g_string_append_printf (string, "# HELP %s %s\n# TYPE %s counter\n",
+					counters [c][0], counters [c][1], counters [c][0]);
+		for (i = 0; i < entries->len; i++) {
+			GdaConnectionMetricsEntry *entry;
+			guint64 val;
+			entry = g_ptr_array_index (entries, i);
+			val = (c == 0) ? entry->executions : ((c == 1) ? entry->errors : entry->rows);
+			g_string_append_printf (string, "%s{statement=\"", counters [c][0]);
+			append_label_value (string, entry->sql);
+			g_string_append_printf (string, "\"} %" G_GUINT64_FORMAT "\n", val);
+		}
+	}
+
+	g_string_append (string, "# HELP gda_statement_phase_seconds Duration of the statement's execution phases\n"
+			 "# TYPE gda_statement_phase_seconds summary\n");
+	for (i = 0; i < entries->len; i++) {
+		GdaConnectionMetricsEntry *entry;
+		guint phase;
+		entry = g_ptr_array_index (entries, i);
+		for (phase = 0; phase < GDA_CONNECTION_METRICS_NB_PHASES; phase++) {
+			Histogram *hist = &(entry->hists [phase]);
+			gchar buf [G_ASCII_DTOSTR_BUF_SIZE];
+			guint q;
+			if (hist->count == 0)
+				continue;
+			for (q = 0; q < G_N_ELEMENTS (quantiles); q++) {
+				gint64 usec;
+				usec = histogram_get_quantile (hist, quantiles [q]);
+				g_string_append (string, "gda_statement_phase_seconds{statement=\"");
+				append_label_value (string, entry->sql);
+				g_string_append_printf (string, "\",phase=\"%s\",quantile=\"%s\"} ",
+							phase_names [phase],
+							g_ascii_dtostr (buf, sizeof (buf), quantiles [q]));
+				g_string_append_printf (string, "%s\n",
+							g_ascii_dtostr (buf, sizeof (buf),
+									usec / (gdouble) G_USEC_PER_SEC));
+			}
+			g_string_append (string, "gda_statement_phase_seconds_sum{statement=\"");
+			append_label_value (string, entry->sql);
+			g_string_append_printf (string, "\",phase=\"%s\"} %s\n", phase_names [phase],
+						g_ascii_dtostr (buf, sizeof (buf),
+								hist->sum / (gdouble) G_USEC_PER_SEC));
+			g_string_append (string, "gda_statement_phase_seconds_count{statement=\"");
+			append_label_value (string, entry->sql);
+			g_string_append_printf (string, "\",phase=\"%s\"} %" G_GUINT64_FORMAT "\n",
+						phase_names [phase], hist->count);
+		}
+	}
+	g_mutex_unlock (&(metrics->mutex));
+	g_ptr_array_free (entries, TRUE);
+
+	return g_string_free (string, FALSE);
+}
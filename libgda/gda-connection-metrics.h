@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __GDA_CONNECTION_METRICS_H__
+#define __GDA_CONNECTION_METRICS_H__
+
+#include <libgda/gda-decl.h>
+#include <libgda/gda-data-model.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Statistics collected by a #GdaConnection about the statements it executes, see the
+ * GdaConnection:statement-metrics property.
+ *
+ * Statements are grouped by their normalized SQL (where literal values and variables are
+ * replaced by '?'), and for each group a #GdaConnectionMetricsEntry holds the number of executions,
+ * of errors, of rows, and a latency histogram for each execution phase.
+ *
+ * All the functions are thread safe.
+ */
+typedef struct _GdaConnectionMetrics GdaConnectionMetrics;
+typedef struct _GdaConnectionMetricsEntry GdaConnectionMetricsEntry;
+
+typedef enum {
+	GDA_CONNECTION_METRICS_PREPARE,    /* statement preparation */
+	GDA_CONNECTION_METRICS_QUEUE_WAIT, /* waiting for the connection's worker thread */
+	GDA_CONNECTION_METRICS_EXECUTE,    /* statement execution */
+	GDA_CONNECTION_METRICS_FIRST_ROW,  /* from the start of the execution to the first row */
+	GDA_CONNECTION_METRICS_FETCH_ALL,  /* from the start of the execution to the last row */
+	GDA_CONNECTION_METRICS_NB_PHASES
+} GdaConnectionMetricsPhase;
+
+GdaConnectionMetrics      *_gda_connection_metrics_new (void);
+void                       _gda_connection_metrics_free (GdaConnectionMetrics *metrics);
+void                       _gda_connection_metrics_reset (GdaConnectionMetrics *metrics);
+
+GdaConnectionMetricsEntry *_gda_connection_metrics_get_entry (GdaConnectionMetrics *metrics, GdaStatement *stmt);
+GdaConnectionMetricsEntry *_gda_connection_metrics_entry_ref (GdaConnectionMetricsEntry *entry);
+void                       _gda_connection_metrics_entry_unref (GdaConnectionMetricsEntry *entry);
+
+void                       _gda_connection_metrics_entry_add_time (GdaConnectionMetricsEntry *entry,
+								   GdaConnectionMetricsPhase phase, gint64 usec);
+void                       _gda_connection_metrics_entry_add_execution (GdaConnectionMetricsEntry *entry,
+									gboolean failed, gint64 nrows);
+void                       _gda_connection_metrics_entry_add_rows (GdaConnectionMetricsEntry *entry, gint64 nrows);
+
+GdaDataModel              *_gda_connection_metrics_to_data_model (GdaConnectionMetrics *metrics);
+gchar                     *_gda_connection_metrics_to_prometheus (GdaConnectionMetrics *metrics);
+
+G_END_DECLS
+
+#endif
@@ -50,6 +50,8 @@
 #include <libgda/gda-connection.h>
 #include <libgda/gda-connection-private.h>
 #include <libgda/gda-connection-internal.h>
+#include <libgda/gda-connection-metrics.h>
+#include <libgda/gda-data-select-extra.h>
 #include <libgda/gda-connection-event.h>
 #include <glib/gi18n-lib.h>
 #include <libgda/gda-log.h>
@@ -81,6 +83,7 @@
 #include <ctype.h>
 
 static GMutex global_mutex;
+static GMutex quoted_ids_mutex;
 static GdaSqlParser *internal_parser = NULL;
 static GHashTable *all_context_hash = NULL; /* key = a #GThread, value = a #GMainContext (ref held) */
 
@@ -130,6 +133,20 @@ typedef struct {
 
 	gboolean              exec_times;
 	guint                 exec_slowdown;
+
+	GdaConnectionMetrics *metrics; /* created when first needed, never freed before the connection */
+	gboolean              collect_metrics;
+
+	guint                 blob_chunk_size;
+
+	/* execution limits, see _gda_connection_get_statement_timeout() and _gda_connection_get_row_limits() */
+	guint                 statement_timeout;
+	guint                 max_rows;
+	guint64               max_bytes;
+
+	/* identifiers quoted by gda_sql_identifier_quote() while the connection is opened,
+	 * protected by quoted_ids_mutex */
+	GHashTable           *quoted_ids;
 } GdaConnectionPrivate;
 
 G_DEFINE_TYPE_WITH_CODE (GdaConnection, gda_connection, G_TYPE_OBJECT, 
@@ -179,7 +196,12 @@ enum
 	PROP_META_STORE,
 	PROP_EVENTS_HISTORY_SIZE,
 	PROP_EXEC_TIMES,
-	PROP_EXEC_SLOWDOWN
+	PROP_EXEC_SLOWDOWN,
+	PROP_STATEMENT_METRICS,
+	PROP_BLOB_CHUNK_SIZE,
+	PROP_STATEMENT_TIMEOUT,
+	PROP_MAX_ROWS,
+	PROP_MAX_BYTES
 };
 
 extern GdaServerProvider *_gda_config_sqlite_provider; /* defined in gda-config.c */
@@ -389,6 +411,85 @@ gda_connection_class_init (GdaConnectionClass *klass)
 							    0, G_MAXUINT, 0,
 							    (G_PARAM_READABLE | G_PARAM_WRITABLE)));
 
+	/**
+	 * GdaConnection:statement-metrics:
+	 *
+	 * Collects statistics about the executed statements: for each normalized statement, the
+	 * number of executions, of errors and of rows, and the latency of each execution phase.
+	 * Use gda_connection_get_metrics() or gda_connection_dump_metrics() to get them.
+	 *
+	 * Since: 6.0
+	 **/
+	g_object_class_install_property (object_class, PROP_STATEMENT_METRICS,
+					 g_param_spec_boolean ("statement-metrics", NULL,
+							       _("Collects statistics about executed statements"),
+							       FALSE,
+							       (G_PARAM_READABLE | G_PARAM_WRITABLE)));
+
+	/**
+	 * GdaConnection:blob-chunk-size:
+	 *
+	 * Size, in bytes, of the chunks in which the providers transfer the contents of BLOB parameters
+	 * when they are read through a #GdaBlobOp: the whole BLOB is never loaded in memory, so this value
+	 * bounds the memory used to send it.
+	 *
+	 * Since: 6.0
+	 **/
+	g_object_class_install_property (object_class, PROP_BLOB_CHUNK_SIZE,
+					 g_param_spec_uint ("blob-chunk-size", NULL,
+							    _("Size of the chunks used to transfer BLOB parameters"),
+							    1024, G_MAXINT, _GDA_BLOB_CHUNK_SIZE,
+							    (G_PARAM_READABLE | G_PARAM_WRITABLE)));
+
+	/**
+	 * GdaConnection:statement-timeout:
+	 *
+	 * Maximum execution time of the statements, in milliseconds, or 0 for no limit. The limit is
+	 * enforced by the database server when it supports it, and statements running longer are
+	 * aborted with the %GDA_SERVER_PROVIDER_TIMEOUT_ERROR error. The #GdaStatement:timeout property
+	 * overrides this setting for a specific statement.
+	 *
+	 * Since: 6.0
+	 **/
+	g_object_class_install_property (object_class, PROP_STATEMENT_TIMEOUT,
+					 g_param_spec_uint ("statement-timeout", NULL,
+							    _("Maximum execution time of the statements, in milliseconds"),
+							    0, G_MAXUINT, 0,
+							    (G_PARAM_READABLE | G_PARAM_WRITABLE)));
+
+	/**
+	 * GdaConnection:max-rows:
+	 *
+	 * Maximum number of rows each data model returned by a SELECT statement may hold in memory,
+	 * or 0 for no limit. When the limit is reached, fetching more rows fails with the
+	 * %GDA_DATA_SELECT_LIMIT_ERROR error, and the rows already fetched remain accessible.
+	 * The #GdaStatement:max-rows property overrides this setting for a specific statement.
+	 *
+	 * Since: 6.0
+	 **/
+	g_object_class_install_property (object_class, PROP_MAX_ROWS,
+					 g_param_spec_uint ("max-rows", NULL,
+							    _("Maximum number of rows held in memory by each data model"),
+							    0, G_MAXINT, 0,
+							    (G_PARAM_READABLE | G_PARAM_WRITABLE)));
+
+	/**
+	 * GdaConnection:max-bytes:
+	 *
+	 * Maximum size, in bytes, of the rows each data model returned by a SELECT statement may hold
+	 * in memory, or 0 for no limit. The size of the rows is estimated from the size of their values.
+	 * When the limit is reached, fetching more rows fails with the %GDA_DATA_SELECT_LIMIT_ERROR error,
+	 * and the rows already fetched remain accessible.
+	 * The #GdaStatement:max-bytes property overrides this setting for a specific statement.
+	 *
+	 * Since: 6.0
+	 **/
+	g_object_class_install_property (object_class, PROP_MAX_BYTES,
+					 g_param_spec_uint64 ("max-bytes", NULL,
+							      _("Maximum size of the rows held in memory by each data model"),
+							      0, G_MAXUINT64, 0,
+							      (G_PARAM_READABLE | G_PARAM_WRITABLE)));
+
 	object_class->dispose = gda_connection_dispose;
 
 	/* computing debug level */
@@ -467,6 +568,10 @@ gda_connection_init (GdaConnection *cnc)
 
 	priv->exec_times = FALSE;
 	priv->exec_slowdown = 0;
+
+	priv->metrics = NULL;
+	priv->collect_metrics = FALSE;
+	priv->blob_chunk_size = _GDA_BLOB_CHUNK_SIZE;
 }
 
 static void auto_update_meta_context_free (GdaMetaContext *context);
@@ -492,6 +597,11 @@ gda_connection_dispose (GObject *object)
 		priv->prepared_stmts = NULL;
 	}
 
+	if (priv->quoted_ids) {
+		g_hash_table_destroy (priv->quoted_ids);
+		priv->quoted_ids = NULL;
+	}
+
 	if (priv->provider_obj) {
 		_gda_server_provider_handlers_clear_for_cnc (priv->provider_obj, cnc);
 		g_object_unref (G_OBJECT (priv->provider_obj));
@@ -547,6 +657,10 @@ gda_connection_dispose (GObject *object)
 		g_free (priv->auth_string);
 		priv->auth_string = NULL;
 	}
+	if (priv->metrics) {
+		_gda_connection_metrics_free (priv->metrics);
+		priv->metrics = NULL;
+	}
   if (priv->mutex_initalized) {
     g_rec_mutex_clear (&priv->rmutex);
     priv->mutex_initalized = FALSE;
@@ -668,6 +782,12 @@ gda_connection_set_property (GObject *object,
 			}
 			priv->options = flags;
 			gda_connection_unlock ((GdaLockable*) cnc);
+
+			/* identifiers may now be quoted differently */
+			g_mutex_lock (&quoted_ids_mutex);
+			if (priv->quoted_ids)
+				g_hash_table_remove_all (priv->quoted_ids);
+			g_mutex_unlock (&quoted_ids_mutex);
 			break;
 		}
 		case PROP_META_STORE:
@@ -692,6 +812,25 @@ gda_connection_set_property (GObject *object,
 		case PROP_EXEC_SLOWDOWN:
 			priv->exec_slowdown = g_value_get_uint (value);
 			break;
+		case PROP_STATEMENT_METRICS:
+			gda_connection_lock ((GdaLockable*) cnc);
+			if (g_value_get_boolean (value) && !priv->metrics)
+				priv->metrics = _gda_connection_metrics_new ();
+			priv->collect_metrics = g_value_get_boolean (value);
+			gda_connection_unlock ((GdaLockable*) cnc);
+			break;
+		case PROP_BLOB_CHUNK_SIZE:
+			priv->blob_chunk_size = g_value_get_uint (value);
+			break;
+		case PROP_STATEMENT_TIMEOUT:
+			priv->statement_timeout = g_value_get_uint (value);
+			break;
+		case PROP_MAX_ROWS:
+			priv->max_rows = g_value_get_uint (value);
+			break;
+		case PROP_MAX_BYTES:
+			priv->max_bytes = g_value_get_uint64 (value);
+			break;
                 }
         }	
 }
@@ -735,6 +874,21 @@ gda_connection_get_property (GObject *object,
 		case PROP_EXEC_SLOWDOWN:
 			g_value_set_uint (value, priv->exec_slowdown);
 			break;
+		case PROP_STATEMENT_METRICS:
+			g_value_set_boolean (value, priv->collect_metrics);
+			break;
+		case PROP_BLOB_CHUNK_SIZE:
+			g_value_set_uint (value, priv->blob_chunk_size);
+			break;
+		case PROP_STATEMENT_TIMEOUT:
+			g_value_set_uint (value, priv->statement_timeout);
+			break;
+		case PROP_MAX_ROWS:
+			g_value_set_uint (value, priv->max_rows);
+			break;
+		case PROP_MAX_BYTES:
+			g_value_set_uint64 (value, priv->max_bytes);
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
 			break;
@@ -1640,6 +1794,115 @@ _gda_connection_get_exec_slowdown (GdaConnection *cnc)
 	return priv->exec_slowdown;
 }
 
+/*
+ * _gda_connection_get_blob_chunk_size:
+ *
+ * Returns: the value of the GdaConnection:blob-chunk-size property
+ */
+guint
+_gda_connection_get_blob_chunk_size (GdaConnection *cnc)
+{
+	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), _GDA_BLOB_CHUNK_SIZE);
+	GdaConnectionPrivate *priv = gda_connection_get_instance_private (cnc);
+	return priv->blob_chunk_size;
+}
+
+/*
+ * _gda_connection_get_statement_timeout:
+ * @cnc: a #GdaConnection
+ * @stmt: (nullable): the #GdaStatement about to be executed, or %NULL
+ *
+ * Used by the providers to know how long @stmt may run.
+ *
+ * Returns: the maximum execution time of @stmt, in milliseconds, or 0 for no limit
+ */
+guint
+_gda_connection_get_statement_timeout (GdaConnection *cnc, GdaStatement *stmt)
+{
+	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), 0);
+	GdaConnectionPrivate *priv = gda_connection_get_instance_private (cnc);
+	guint timeout = 0;
+
+	if (stmt)
+		g_object_get (stmt, "timeout", &timeout, NULL);
+	return timeout ? timeout : priv->statement_timeout;
+}
+
+/*
+ * _gda_connection_get_row_limits:
+ * @cnc: a #GdaConnection
+ * @stmt: (nullable): the executed #GdaStatement, or %NULL
+ * @out_max_rows: a place to store the maximum number of rows
+ * @out_max_bytes: a place to store the maximum size of the rows
+ *
+ * Get how many rows, and how many bytes, the data model returned when executing @stmt may hold
+ * in memory; 0 means no limit.
+ */
+void
+_gda_connection_get_row_limits (GdaConnection *cnc, GdaStatement *stmt,
+				guint *out_max_rows, guint64 *out_max_bytes)
+{
+	g_return_if_fail (GDA_IS_CONNECTION (cnc));
+	g_return_if_fail (out_max_rows && out_max_bytes);
+	GdaConnectionPrivate *priv = gda_connection_get_instance_private (cnc);
+	guint max_rows = 0;
+	guint64 max_bytes = 0;
+
+	if (stmt)
+		g_object_get (stmt, "max-rows", &max_rows, "max-bytes", &max_bytes, NULL);
+	*out_max_rows = max_rows ? max_rows : priv->max_rows;
+	*out_max_bytes = max_bytes ? max_bytes : priv->max_bytes;
+}
+
+/* maximum number of identifiers kept for each connection by _gda_connection_add_quoted_identifier() */
+#define QUOTED_IDS_MAX_SIZE 1024
+
+/*
+ * _gda_connection_lookup_quoted_identifier:
+ * @cnc: a #GdaConnection
+ * @key: the key used to store the quoted identifier, see gda_sql_identifier_quote()
+ *
+ * Returns: (transfer full) (nullable): a copy of the quoted identifier stored for @key, or %NULL
+ */
+gchar *
+_gda_connection_lookup_quoted_identifier (GdaConnection *cnc, const gchar *key)
+{
+	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), NULL);
+	GdaConnectionPrivate *priv = gda_connection_get_instance_private (cnc);
+	gchar *quoted = NULL;
+
+	g_mutex_lock (&quoted_ids_mutex);
+	if (priv->quoted_ids)
+		quoted = g_strdup (g_hash_table_lookup (priv->quoted_ids, key));
+	g_mutex_unlock (&quoted_ids_mutex);
+	return quoted;
+}
+
+/*
+ * _gda_connection_add_quoted_identifier:
+ * @cnc: a #GdaConnection
+ * @key: the key used to store the quoted identifier
+ * @quoted: the quoted identifier
+ *
+ * Keeps @quoted for the next calls to _gda_connection_lookup_quoted_identifier() with the same @key,
+ * until @cnc is closed.
+ */
+void
+_gda_connection_add_quoted_identifier (GdaConnection *cnc, const gchar *key, const gchar *quoted)
+{
+	g_return_if_fail (GDA_IS_CONNECTION (cnc));
+	g_return_if_fail (key && quoted);
+	GdaConnectionPrivate *priv = gda_connection_get_instance_private (cnc);
+
+	g_mutex_lock (&quoted_ids_mutex);
+	if (!priv->quoted_ids)
+		priv->quoted_ids = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+	else if (g_hash_table_size (priv->quoted_ids) >= QUOTED_IDS_MAX_SIZE)
+		g_hash_table_remove_all (priv->quoted_ids);
+	g_hash_table_insert (priv->quoted_ids, g_strdup (key), g_strdup (quoted));
+	g_mutex_unlock (&quoted_ids_mutex);
+}
+
 static void
 assert_status_transaction (GdaConnectionStatus old, GdaConnectionStatus new)
 {
@@ -2260,6 +2523,235 @@ gda_connection_insert_row_into_table_v (GdaConnection *cnc, const gchar *table,
 	return retval;
 }
 
+/* used by gda_connection_insert_rows_into_table() when the provider does not tell its limit */
+#define DEFAULT_MAX_PARAMS 999
+
+static GSList *
+make_sql_fields_list (GdaConnection *cnc, GdaSqlStatementInsert *ssi, const gchar * const *names)
+{
+	GSList *list = NULL;
+	gint i;
+	for (i = 0; names && names [i]; i++) {
+		GdaSqlField *field;
+		field = gda_sql_field_new (GDA_SQL_ANY_PART (ssi));
+		field->field_name = gda_sql_identifier_quote (names [i], cnc, NULL, FALSE, FALSE);
+		list = g_slist_prepend (list, field);
+	}
+	return g_slist_reverse (list);
+}
+
+/*
+ * Executes the INSERT statement whose structure is @sql_stm, with the @holders parameters,
+ * and frees both
+ */
+static gboolean
+execute_insert_rows_chunk (GdaConnection *cnc, GdaSqlStatement *sql_stm, GSList *holders, GError **error)
+{
+	GdaStatement *insert;
+	GdaSet *set = NULL;
+	gboolean retval;
+
+	insert = gda_statement_new ();
+	g_object_set (G_OBJECT (insert), "structure", sql_stm, NULL);
+	gda_sql_statement_free (sql_stm);
+
+	if (holders) {
+		set = gda_set_new (holders);
+		g_slist_free_full (holders, (GDestroyNotify) g_object_unref);
+	}
+
+	retval = (gda_connection_statement_execute_non_select (cnc, insert, set, NULL, error) == -1) ? FALSE : TRUE;
+
+	if (set)
+		g_object_unref (set);
+	g_object_unref (insert);
+
+	return retval;
+}
+
+/**
+ * gda_connection_insert_rows_into_table:
+ * @cnc: an opened connection
+ * @table: table's name to insert into
+ * @col_names: (element-type utf8) (nullable): a list of column names (as const gchar *), or %NULL
+ * @rows: a #GdaDataModel containing the rows to insert
+ * @conflict_columns: (array zero-terminated=1) (nullable): a %NULL terminated array of the names of the columns
+ * making up the unique constraint which may be violated by the insertion, or %NULL
+ * @update_columns: (array zero-terminated=1) (nullable): a %NULL terminated array of the names of the columns
+ * to update when the insertion of a row conflicts with an existing row, or %NULL
+ * @error: a place to store errors, or %NULL
+ *
+ * Inserts all the rows of @rows into @table, using multi-row INSERT statements. The values of the
+ * i-th column of @rows are inserted in the column named after the i-th element of @col_names or, if
+ * @col_names is %NULL, after the name of the i-th column of @rows.
+ *
+ * As many rows as possible are inserted by each statement: the rows are split in chunks to respect
+ * the maximum number of parameters a statement can have, as returned by
+ * gda_server_provider_get_max_params(). If no transaction has been started on @cnc, then one
+ * is started and committed (or rolled back if an error occurred) so that either all the rows or none
+ * are inserted.
+ *
+ * If @conflict_columns or @update_columns is not %NULL, then each row which can't be inserted because of a
+ * unique constraint violation updates instead the @update_columns columns of the existing row (or is ignored
+ * if @update_columns is %NULL), see gda_sql_builder_insert_set_upsert(). @conflict_columns is required
+ * when @update_columns is not %NULL.
+ *
+ * Like gda_connection_insert_row_into_table_v(), this function relies on variables which makes it immune
+ * to SQL injection problems.
+ *
+ * Returns: TRUE if no error occurred, FALSE otherwise
+ *
+ * Since: 6.0
+ */
+gboolean
+gda_connection_insert_rows_into_table (GdaConnection *cnc, const gchar *table,
+				       GSList *col_names, GdaDataModel *rows,
+				       const gchar * const *conflict_columns,
+				       const gchar * const *update_columns,
+				       GError **error)
+{
+	GdaSqlStatement *sql_stm = NULL;
+	GdaSqlStatementInsert *ssi = NULL;
+	GdaDataModelIter *iter;
+	GSList *fields = NULL, *holders = NULL, *values_list = NULL, *list;
+	gboolean retval = TRUE, started = FALSE;
+	gint nb_cols, max_params, max_rows, nb_rows = 0, nb_params = 0;
+	gint i;
+
+	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), FALSE);
+	g_return_val_if_fail (table && *table, FALSE);
+	g_return_val_if_fail (GDA_IS_DATA_MODEL (rows), FALSE);
+
+	if (! gda_connection_is_opened (cnc)) {
+		g_set_error (error, GDA_CONNECTION_ERROR, GDA_CONNECTION_CLOSED_ERROR,
+			     "%s", _("Connection is closed"));
+		return FALSE;
+	}
+
+	nb_cols = gda_data_model_get_n_columns (rows);
+	g_return_val_if_fail (nb_cols > 0, FALSE);
+	g_return_val_if_fail (!col_names || (g_slist_length (col_names) == (guint) nb_cols), FALSE);
+
+	/* the fields, from @col_names or from @rows' columns */
+	for (i = 0, list = col_names; i < nb_cols; i++) {
+		const gchar *col_name;
+		if (list) {
+			col_name = (const gchar*) list->data;
+			list = list->next;
+		}
+		else
+			col_name = gda_column_get_name (gda_data_model_describe_column (rows, i));
+		if (!col_name || !*col_name) {
+			g_set_error (error, GDA_CONNECTION_ERROR, GDA_CONNECTION_STATEMENT_TYPE_ERROR,
+				     _("Missing name for column %d"), i);
+			g_slist_free (fields);
+			return FALSE;
+		}
+		fields = g_slist_prepend (fields, gda_sql_identifier_quote (col_name, cnc, NULL, FALSE, FALSE));
+	}
+	fields = g_slist_reverse (fields);
+
+	max_params = gda_server_provider_get_max_params (gda_connection_get_provider (cnc), cnc);
+	if (max_params <= 0)
+		max_params = DEFAULT_MAX_PARAMS;
+	max_rows = MAX (1, max_params / nb_cols);
+
+	iter = gda_data_model_create_iter (rows);
+	if (!iter) {
+		g_set_error (error, GDA_CONNECTION_ERROR, GDA_CONNECTION_STATEMENT_TYPE_ERROR,
+			     "%s", _("Can't iterate over the rows to insert"));
+		g_slist_free_full (fields, g_free);
+		return FALSE;
+	}
+
+	if (! gda_connection_get_transaction_status (cnc))
+		started = gda_connection_begin_transaction (cnc, NULL, GDA_TRANSACTION_ISOLATION_UNKNOWN, NULL);
+
+	while (retval && gda_data_model_iter_move_next (iter)) {
+		GSList *expr_values = NULL;
+
+		if (!sql_stm) {
+			/* start a new statement */
+			sql_stm = gda_sql_statement_new (GDA_SQL_STATEMENT_INSERT);
+			ssi = (GdaSqlStatementInsert*) sql_stm->contents;
+			ssi->table = gda_sql_table_new (GDA_SQL_ANY_PART (ssi));
+			ssi->table->table_name = gda_sql_identifier_quote (table, cnc, NULL, FALSE, FALSE);
+			ssi->fields_list = NULL;
+			for (list = fields; list; list = list->next) {
+				GdaSqlField *field;
+				field = gda_sql_field_new (GDA_SQL_ANY_PART (ssi));
+				field->field_name = g_strdup ((gchar*) list->data);
+				ssi->fields_list = g_slist_prepend (ssi->fields_list, field);
+			}
+			ssi->fields_list = g_slist_reverse (ssi->fields_list);
+			if (conflict_columns || update_columns)
+				gda_sql_statement_insert_take_upsert (sql_stm,
+								      make_sql_fields_list (cnc, ssi, conflict_columns),
+								      make_sql_fields_list (cnc, ssi, update_columns));
+		}
+
+		for (i = 0; i < nb_cols; i++) {
+			const GValue *value;
+			GdaSqlExpr *expr;
+
+			value = gda_data_model_iter_get_value_at (iter, i);
+			expr = gda_sql_expr_new (GDA_SQL_ANY_PART (ssi));
+			if (value && (G_VALUE_TYPE (value) != GDA_TYPE_NULL)) {
+				/* create a GdaSqlExpr with a parameter */
+				GdaSqlParamSpec *param;
+				GdaHolder *holder;
+
+				param = g_new0 (GdaSqlParamSpec, 1);
+				param->name = g_strdup_printf ("+%d", nb_params++);
+				param->g_type = G_VALUE_TYPE (value);
+				param->is_param = TRUE;
+				expr->param_spec = param;
+
+				holder = (GdaHolder*)  g_object_new (GDA_TYPE_HOLDER, "g-type", G_VALUE_TYPE (value),
+								     "id", param->name, NULL);
+				g_assert (gda_holder_set_value (holder, value, NULL));
+				holders = g_slist_prepend (holders, holder);
+			}
+			else {
+				/* create a NULL GdaSqlExpr => nothing to do */
+			}
+			expr_values = g_slist_prepend (expr_values, expr);
+		}
+		values_list = g_slist_prepend (values_list, g_slist_reverse (expr_values));
+
+		if (++nb_rows == max_rows) {
+			ssi->values_list = g_slist_reverse (values_list);
+			retval = execute_insert_rows_chunk (cnc, sql_stm, holders, error);
+			sql_stm = NULL;
+			values_list = NULL;
+			holders = NULL;
+			nb_rows = 0;
+			nb_params = 0;
+		}
+	}
+	g_object_unref (iter);
+	g_slist_free_full (fields, g_free);
+
+	if (sql_stm) {
+		ssi->values_list = g_slist_reverse (values_list);
+		if (retval)
+			retval = execute_insert_rows_chunk (cnc, sql_stm, holders, error);
+		else {
+			gda_sql_statement_free (sql_stm);
+			g_slist_free_full (holders, (GDestroyNotify) g_object_unref);
+		}
+	}
+
+	if (started) {
+		if (retval)
+			retval = gda_connection_commit_transaction (cnc, NULL, error);
+		else
+			gda_connection_rollback_transaction (cnc, NULL, NULL);
+	}
+
+	return retval;
+}
+
 /**
  * gda_connection_update_row_in_table:
  * @cnc: an opened connection
@@ -3166,7 +3658,21 @@ gda_connection_statement_prepare (GdaConnection *cnc, GdaStatement *stmt, GError
 	g_return_val_if_fail (priv->provider_obj, FALSE);
 	g_return_val_if_fail (GDA_IS_STATEMENT (stmt), FALSE);
 
-	return _gda_server_provider_statement_prepare (priv->provider_obj, cnc, stmt, error);
+	GdaConnectionMetricsEntry *mentry;
+	gint64 start_time = 0;
+	gboolean retval;
+	mentry = _gda_connection_get_metrics_entry (cnc, stmt);
+	if (mentry)
+		start_time = g_get_monotonic_time ();
+
+	retval = _gda_server_provider_statement_prepare (priv->provider_obj, cnc, stmt, error);
+
+	if (mentry) {
+		_gda_connection_metrics_entry_add_time (mentry, GDA_CONNECTION_METRICS_PREPARE,
+							g_get_monotonic_time () - start_time);
+		_gda_connection_metrics_entry_unref (mentry);
+	}
+	return retval;
 }
 
 /*
@@ -3210,6 +3716,47 @@ make_col_types_array (va_list args)
 	return types;
 }
 
+/*
+ * Returns: (transfer full) (nullable): the #GdaConnectionMetricsEntry for @stmt if @cnc collects statement
+ * metrics, or %NULL
+ */
+GdaConnectionMetricsEntry *
+_gda_connection_get_metrics_entry (GdaConnection *cnc, GdaStatement *stmt)
+{
+	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), NULL);
+	GdaConnectionPrivate *priv = gda_connection_get_instance_private (cnc);
+	if (!priv->collect_metrics)
+		return NULL;
+	return _gda_connection_metrics_get_entry (priv->metrics, stmt);
+}
+
+/*
+ * Takes into account the execution of a statement which started at @start_time, and
+ * unrefs @mentry
+ */
+static void
+add_exec_metrics (GdaConnectionMetricsEntry *mentry, gint64 start_time, GObject *obj)
+{
+	gint64 nrows = -1;
+
+	_gda_connection_metrics_entry_add_time (mentry, GDA_CONNECTION_METRICS_EXECUTE,
+						g_get_monotonic_time () - start_time);
+	if (GDA_IS_DATA_SELECT (obj))
+		_gda_data_select_set_metrics_entry (GDA_DATA_SELECT (obj), mentry, start_time);
+	else if (GDA_IS_SET (obj)) {
+		GdaHolder *holder;
+		holder = gda_set_get_holder (GDA_SET (obj), "IMPACTED_ROWS");
+		if (holder) {
+			const GValue *value;
+			value = gda_holder_get_value (holder);
+			if (value && (G_VALUE_TYPE (value) == G_TYPE_INT))
+				nrows = g_value_get_int (value);
+		}
+	}
+	_gda_connection_metrics_entry_add_execution (mentry, obj ? FALSE : TRUE, nrows);
+	_gda_connection_metrics_entry_unref (mentry);
+}
+
 static void
 add_exec_time_to_object (GObject *obj, GTimer *timer)
 {
@@ -3240,6 +3787,8 @@ gda_connection_statement_execute_v (GdaConnection *cnc, GdaStatement *stmt, GdaS
 	GObject *obj = NULL;
 	GType *types, *req_types;
 	GTimer *timer = NULL;
+	GdaConnectionMetricsEntry *mentry;
+	gint64 start_time = 0;
 	va_start (ap, error);
 	types = make_col_types_array (ap);
 	va_end (ap);
@@ -3277,11 +3826,16 @@ gda_connection_statement_execute_v (GdaConnection *cnc, GdaStatement *stmt, GdaS
 	dump_exec_params (cnc, stmt, params);
 	if (priv->exec_times)
 		timer = g_timer_new ();
+	mentry = _gda_connection_get_metrics_entry (cnc, stmt);
+	if (mentry)
+		start_time = g_get_monotonic_time ();
 
 	obj = _gda_server_provider_statement_execute (priv->provider_obj, cnc, stmt, params, model_usage,
 						      req_types ? req_types : types, last_inserted_row, error);
 	if (timer)
 		g_timer_stop (timer);
+	if (mentry)
+		add_exec_metrics (mentry, start_time, obj);
 	g_free (types);
 
 	if (obj) {
@@ -3615,6 +4169,8 @@ gda_connection_statement_execute_select_fullv (GdaConnection *cnc, GdaStatement
 	GdaDataModel *model = NULL;
 	GType *types, *req_types;
 	GTimer *timer = NULL;
+	GdaConnectionMetricsEntry *mentry;
+	gint64 start_time = 0;
 
 	va_start (ap, error);
 	types = make_col_types_array (ap);
@@ -3650,11 +4206,16 @@ gda_connection_statement_execute_select_fullv (GdaConnection *cnc, GdaStatement
 	dump_exec_params (cnc, stmt, params);
 	if (priv->exec_times)
 		timer = g_timer_new ();
+	mentry = _gda_connection_get_metrics_entry (cnc, stmt);
+	if (mentry)
+		start_time = g_get_monotonic_time ();
 
 	model = (GdaDataModel*) _gda_server_provider_statement_execute (priv->provider_obj, cnc, stmt, params, model_usage,
 									req_types ? req_types : types, NULL, error);
 	if (timer)
 		g_timer_stop (timer);
+	if (mentry)
+		add_exec_metrics (mentry, start_time, (GObject*) model);
 
 	g_object_unref ((GObject*) cnc);
 	g_free (types);
@@ -3704,6 +4265,8 @@ gda_connection_statement_execute_select_full (GdaConnection *cnc, GdaStatement *
 {
 	GdaDataModel *model = NULL;
 	GTimer *timer = NULL;
+	GdaConnectionMetricsEntry *mentry;
+	gint64 start_time = 0;
 
 	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), NULL);
 	GdaConnectionPrivate *priv = gda_connection_get_instance_private (cnc);
@@ -3741,11 +4304,16 @@ gda_connection_statement_execute_select_full (GdaConnection *cnc, GdaStatement *
 	dump_exec_params (cnc, stmt, params);
 	if (priv->exec_times)
 		timer = g_timer_new ();
+	mentry = _gda_connection_get_metrics_entry (cnc, stmt);
+	if (mentry)
+		start_time = g_get_monotonic_time ();
 
 	model = (GdaDataModel*) _gda_server_provider_statement_execute (priv->provider_obj, cnc, stmt, params, model_usage,
 									req_types ? req_types : col_types, NULL, error);
 	if (timer)
 		g_timer_stop (timer);
+	if (mentry)
+		add_exec_metrics (mentry, start_time, (GObject*) model);
 	g_free (req_types);
 	g_object_unref ((GObject*) cnc);
 
@@ -3833,16 +4401,23 @@ gda_connection_repetitive_statement_execute (GdaConnection *cnc, GdaRepetitiveSt
 		GObject *obj = NULL;
 		GError *lerror = NULL;
 		GTimer *timer = NULL;
+		GdaConnectionMetricsEntry *mentry;
+		gint64 start_time = 0;
 
 		dump_exec_params (cnc, stmt, (GdaSet*) list->data);
 		if (priv->exec_times)
 			timer = g_timer_new ();
+		mentry = _gda_connection_get_metrics_entry (cnc, stmt);
+		if (mentry)
+			start_time = g_get_monotonic_time ();
 
 		obj = _gda_server_provider_statement_execute (priv->provider_obj, cnc, stmt, GDA_SET (list->data),
 							      model_usage, req_types ? req_types : col_types,
 							      NULL, &lerror);
 		if (timer)
 			g_timer_stop (timer);
+		if (mentry)
+			add_exec_metrics (mentry, start_time, obj);
 		if (!obj) {
 			if (stop_on_error) {
 				if (timer)
@@ -6224,6 +6799,13 @@ gda_connection_internal_set_provider_data (GdaConnection *cnc, GdaServerProvider
 	priv->provider_data = data;
 	if (data)
 		data->provider_data_destroy_func = destroy_func;
+	else {
+		/* the quoting rules may differ when the connection is opened again */
+		g_mutex_lock (&quoted_ids_mutex);
+		if (priv->quoted_ids)
+			g_hash_table_remove_all (priv->quoted_ids);
+		g_mutex_unlock (&quoted_ids_mutex);
+	}
 
 	if (!data)
 		gda_connection_unlock ((GdaLockable*) cnc);
@@ -7342,3 +7924,87 @@ gda_connection_create_db_catalog (GdaConnection *cnc)
 
   return g_object_new (GDA_TYPE_DB_CATALOG,"connection",cnc,NULL);
 }
+
+/*
+ * Returns: the #GdaConnectionMetrics of @cnc, created if necessary
+ */
+static GdaConnectionMetrics *
+get_metrics (GdaConnection *cnc)
+{
+	GdaConnectionPrivate *priv = gda_connection_get_instance_private (cnc);
+	gda_connection_lock ((GdaLockable*) cnc);
+	if (!priv->metrics)
+		priv->metrics = _gda_connection_metrics_new ();
+	gda_connection_unlock ((GdaLockable*) cnc);
+	return priv->metrics;
+}
+
+/**
+ * gda_connection_get_metrics:
+ * @cnc: a #GdaConnection
+ *
+ * Get the statistics collected about the statements executed by @cnc while the
+ * #GdaConnection:statement-metrics property was %TRUE.
+ *
+ * Statements which only differ by their literal values or variables are grouped together.
+ * The returned data model has one row per group of statements, sorted by decreasing total
+ * execution time, and the following columns:
+ * <itemizedlist>
+ *   <listitem><para>"statement" (string): the normalized SQL of the statements</para></listitem>
+ *   <listitem><para>"executions", "errors" and "rows" (unsigned 64 bits integers): the number of executions,
+ *     of failed executions, and of rows returned or impacted by the statements</para></listitem>
+ *   <listitem><para>for each of the "prepare", "queue_wait" (waiting for the connection to be available),
+ *     "execute", "first_row" and "fetch_all" phases (the last two being measured from the start of the
+ *     execution), the median, the 99th percentile and the maximum duration (doubles, in seconds, or NULL
+ *     if there is no measure), in the "&lt;phase&gt;_p50", "&lt;phase&gt;_p99" and "&lt;phase&gt;_max"
+ *     columns</para></listitem>
+ * </itemizedlist>
+ *
+ * Durations are computed from histograms, with a precision of about 12%, except for the maximum
+ * durations which are exact.
+ *
+ * Returns: (transfer full): a new read-only #GdaDataModel
+ *
+ * Since: 6.0
+ */
+GdaDataModel *
+gda_connection_get_metrics (GdaConnection *cnc)
+{
+	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), NULL);
+	return _gda_connection_metrics_to_data_model (get_metrics (cnc));
+}
+
+/**
+ * gda_connection_dump_metrics:
+ * @cnc: a #GdaConnection
+ *
+ * Get the same statistics as gda_connection_get_metrics(), using the Prometheus text exposition
+ * format: counters for the number of executions, errors and rows, and summaries (with the 0.5, 0.9
+ * and 0.99 quantiles) for the durations of each phase, the normalized SQL and the phase being
+ * used as labels.
+ *
+ * Returns: (transfer full): a new string
+ *
+ * Since: 6.0
+ */
+gchar *
+gda_connection_dump_metrics (GdaConnection *cnc)
+{
+	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), NULL);
+	return _gda_connection_metrics_to_prometheus (get_metrics (cnc));
+}
+
+/**
+ * gda_connection_reset_metrics:
+ * @cnc: a #GdaConnection
+ *
+ * Discards all the statistics collected about the executed statements.
+ *
+ * Since: 6.0
+ */
+void
+gda_connection_reset_metrics (GdaConnection *cnc)
+{
+	g_return_if_fail (GDA_IS_CONNECTION (cnc));
+	_gda_connection_metrics_reset (get_metrics (cnc));
+}
@@ -337,6 +337,11 @@ gboolean            gda_connection_insert_row_into_table        (GdaConnection *
 gboolean            gda_connection_insert_row_into_table_v      (GdaConnection *cnc, const gchar *table,
 								 GSList *col_names, GSList *values,
 								 GError **error);
+gboolean            gda_connection_insert_rows_into_table       (GdaConnection *cnc, const gchar *table,
+								 GSList *col_names, GdaDataModel *rows,
+								 const gchar * const *conflict_columns,
+								 const gchar * const *update_columns,
+								 GError **error);
 
 gboolean            gda_connection_update_row_in_table          (GdaConnection *cnc, const gchar *table,
 								 const gchar *condition_column_name,
@@ -405,6 +410,10 @@ GdaDataModel        *gda_connection_get_meta_store_data  (GdaConnection *cnc, Gd
 GdaDataModel        *gda_connection_get_meta_store_data_v(GdaConnection *cnc, GdaConnectionMetaType meta_type,
 							  GList* filters, GError **error);
 GdaDbCatalog        *gda_connection_create_db_catalog    (GdaConnection *cnc);
+
+GdaDataModel        *gda_connection_get_metrics          (GdaConnection *cnc);
+gchar               *gda_connection_dump_metrics         (GdaConnection *cnc);
+void                 gda_connection_reset_metrics        (GdaConnection *cnc);
 G_END_DECLS
 
 #endif
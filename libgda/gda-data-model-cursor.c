@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <glib/gi18n-lib.h>
+#include <libgda/gda-data-model-cursor.h>
+#include <libgda/gda-data-model-array.h>
+#include <libgda/gda-data-model-iter.h>
+#include <libgda/gda-data-select.h>
+#include <libgda/gda-data-select-extra.h>
+#include <libgda/gda-row.h>
+
+typedef enum {
+	CURSOR_MODE_ARRAY,  /* GdaDataModelArray: rows are read directly */
+	CURSOR_MODE_SELECT, /* cursor based GdaDataSelect: rows are fetched without any GdaDataModelIter */
+	CURSOR_MODE_RANDOM, /* any other random access data model */
+	CURSOR_MODE_ITER    /* any other data model, through a GdaDataModelIter */
+} CursorMode;
+
+struct _GdaDataModelCursor {
+	gint              ref_count;
+	GdaDataModel     *model;
+	CursorMode        mode;
+	gint              n_columns;
+	gint              n_rows; /* for CURSOR_MODE_ARRAY and CURSOR_MODE_RANDOM */
+
+	gint              row; /* -1 before the 1st row and after the last one */
+	gboolean          started;
+	gboolean          end_reached;
+	gboolean          moved; /* TRUE if the model's position has been moved, for CURSOR_MODE_SELECT */
+	GdaRow           *grow; /* ref held, for CURSOR_MODE_ARRAY and CURSOR_MODE_SELECT */
+	GdaDataModelIter *iter; /* for CURSOR_MODE_ITER */
+};
+
+G_DEFINE_BOXED_TYPE (GdaDataModelCursor, gda_data_model_cursor, gda_data_model_cursor_ref, gda_data_model_cursor_unref)
+
+static void cursor_sync_model (GdaDataModelCursor *cursor);
+
+/**
+ * gda_data_model_cursor_new:
+ * @model: a #GdaDataModel
+ *
+ * Creates a new #GdaDataModelCursor to read @model's rows. The cursor is initially positioned
+ * before the first row, so gda_data_model_cursor_move_next() must be called before accessing any value.
+ *
+ * If @model does not offer a random access, then the cursor shares its position with the iterator
+ * normally used to access data in @model: if that iterator is already positioned on a row, then the first
+ * call to gda_data_model_cursor_move_next() positions the cursor on that same row, and once the cursor
+ * has been moved, that iterator is updated to the cursor's position when the end of @model is reached or
+ * when the cursor is freed.
+ *
+ * Returns: (transfer full): a new #GdaDataModelCursor, free using gda_data_model_cursor_unref()
+ *
+ * Since: 6.0
+ */
+GdaDataModelCursor *
+gda_data_model_cursor_new (GdaDataModel *model)
+{
+	GdaDataModelCursor *cursor;
+	GdaDataModelAccessFlags flags;
+
+	g_return_val_if_fail (GDA_IS_DATA_MODEL (model), NULL);
+
+	cursor = g_new0 (GdaDataModelCursor, 1);
+	cursor->ref_count = 1;
+	cursor->model = g_object_ref (model);
+	cursor->n_columns = gda_data_model_get_n_columns (model);
+	cursor->row = -1;
+
+	flags = gda_data_model_get_access_flags (model);
+	if (GDA_IS_DATA_MODEL_ARRAY (model))
+		cursor->mode = CURSOR_MODE_ARRAY;
+	else if (flags & GDA_DATA_MODEL_ACCESS_RANDOM)
+		cursor->mode = CURSOR_MODE_RANDOM;
+	else if (GDA_IS_DATA_SELECT (model))
+		cursor->mode = CURSOR_MODE_SELECT;
+	else
+		cursor->mode = CURSOR_MODE_ITER;
+
+	if ((cursor->mode == CURSOR_MODE_ARRAY) || (cursor->mode == CURSOR_MODE_RANDOM))
+		cursor->n_rows = gda_data_model_get_n_rows (model);
+	else
+		cursor->n_rows = -1;
+
+	return cursor;
+}
+
+/**
+ * gda_data_model_cursor_ref:
+ * @cursor: a #GdaDataModelCursor
+ *
+ * Increases @cursor's reference count.
+ *
+ * Returns: (transfer full): @cursor
+ *
+ * Since: 6.0
+ */
+GdaDataModelCursor *
+gda_data_model_cursor_ref (GdaDataModelCursor *cursor)
+{
+	g_return_val_if_fail (cursor, NULL);
+	g_atomic_int_inc (&cursor->ref_count);
+	return cursor;
+}
+
+/**
+ * gda_data_model_cursor_unref:
+ * @cursor: (transfer full): a #GdaDataModelCursor
+ *
+ * Decreases @cursor's reference count, and frees it when the count reaches 0.
+ *
+ * Since: 6.0
+ */
+void
+gda_data_model_cursor_unref (GdaDataModelCursor *cursor)
+{
+	g_return_if_fail (cursor);
+	if (! g_atomic_int_dec_and_test (&cursor->ref_count))
+		return;
+
+	cursor_sync_model (cursor);
+	if (cursor->grow)
+		g_object_unref (cursor->grow);
+	if (cursor->iter)
+		g_object_unref (cursor->iter);
+	g_object_unref (cursor->model);
+	g_free (cursor);
+}
+
+static void
+cursor_sync_model (GdaDataModelCursor *cursor)
+{
+	if (!cursor->moved)
+		return;
+	cursor->moved = FALSE;
+	_gda_data_select_cursor_sync_iter ((GdaDataSelect*) cursor->model, cursor->grow);
+}
+
+static void
+cursor_set_row (GdaDataModelCursor *cursor, GdaRow *grow)
+{
+	if (grow)
+		g_object_ref (grow);
+	if (cursor->grow)
+		g_object_unref (cursor->grow);
+	cursor->grow = grow;
+}
+
+/**
+ * gda_data_model_cursor_move_next:
+ * @cursor: a #GdaDataModelCursor
+ * @error: (nullable): a place to store errors, or %NULL
+ *
+ * Moves @cursor to the next row of its data model. When the last row has already been reached,
+ * this function returns %FALSE without setting @error.
+ *
+ * Any value previously returned by gda_data_model_cursor_get_value() may become invalid
+ * once this function has been called.
+ *
+ * Returns: %TRUE if @cursor is now positioned on a row
+ *
+ * Since: 6.0
+ */
+gboolean
+gda_data_model_cursor_move_next (GdaDataModelCursor *cursor, GError **error)
+{
+	g_return_val_if_fail (cursor, FALSE);
+
+	if (cursor->end_reached)
+		return FALSE;
+
+	switch (cursor->mode) {
+	case CURSOR_MODE_ARRAY: {
+		GdaRow *grow = NULL;
+		if (cursor->row + 1 < cursor->n_rows) {
+			grow = gda_data_model_array_get_row ((GdaDataModelArray*) cursor->model,
+							     cursor->row + 1, error);
+			if (!grow)
+				return FALSE;
+		}
+		cursor_set_row (cursor, grow);
+		cursor->row = grow ? cursor->row + 1 : -1;
+		break;
+	}
+	case CURSOR_MODE_RANDOM:
+		if (cursor->row + 1 < cursor->n_rows)
+			cursor->row ++;
+		else
+			cursor->row = -1;
+		break;
+	case CURSOR_MODE_SELECT: {
+		GdaRow *grow;
+		gint row;
+		if (cursor->started ||
+		    ! _gda_data_select_cursor_get_current ((GdaDataSelect*) cursor->model, &row, &grow)) {
+			if (! _gda_data_select_cursor_move_next ((GdaDataSelect*) cursor->model, &row, &grow, error))
+				return FALSE;
+			cursor->moved = TRUE;
+		}
+		cursor_set_row (cursor, grow);
+		cursor->row = row;
+		break;
+	}
+	case CURSOR_MODE_ITER:
+		if (!cursor->iter) {
+			cursor->iter = gda_data_model_create_iter (cursor->model);
+			if (!cursor->iter) {
+				g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ACCESS_ERROR,
+					     "%s", _("Data model does not support cursor access"));
+				return FALSE;
+			}
+		}
+		if (!cursor->started && gda_data_model_iter_is_valid (cursor->iter) &&
+		    (gda_data_model_iter_get_row (cursor->iter) >= 0))
+			/* shared iterator already positioned on a row */
+			cursor->row = gda_data_model_iter_get_row (cursor->iter);
+		else if (gda_data_model_iter_move_next (cursor->iter))
+			cursor->row = gda_data_model_iter_get_row (cursor->iter);
+		else
+			cursor->row = -1;
+		break;
+	default:
+		g_assert_not_reached ();
+	}
+
+	cursor->started = TRUE;
+	if (cursor->row < 0) {
+		cursor->end_reached = TRUE;
+		if (cursor->mode == CURSOR_MODE_SELECT)
+			cursor_sync_model (cursor);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/**
+ * gda_data_model_cursor_get_row:
+ * @cursor: a #GdaDataModelCursor
+ *
+ * Get the number of the row on which @cursor is positioned.
+ *
+ * Returns: the row number, or -1 if @cursor is not positioned on any row
+ *
+ * Since: 6.0
+ */
+gint
+gda_data_model_cursor_get_row (GdaDataModelCursor *cursor)
+{
+	g_return_val_if_fail (cursor, -1);
+	return cursor->row;
+}
+
+/**
+ * gda_data_model_cursor_get_n_columns:
+ * @cursor: a #GdaDataModelCursor
+ *
+ * Get the number of columns of @cursor's data model.
+ *
+ * Returns: the number of columns
+ *
+ * Since: 6.0
+ */
+gint
+gda_data_model_cursor_get_n_columns (GdaDataModelCursor *cursor)
+{
+	g_return_val_if_fail (cursor, 0);
+	return cursor->n_columns;
+}
+
+/**
+ * gda_data_model_cursor_get_value:
+ * @cursor: a #GdaDataModelCursor
+ * @col: a column number, starting at 0
+ *
+ * Get the value at column @col of the row on which @cursor is positioned. The returned value
+ * is not copied and remains valid until the next call to gda_data_model_cursor_move_next().
+ *
+ * Returns: (transfer none) (nullable): the value, or %NULL if @cursor is not positioned on any
+ * row, if @col is out of range or if the value is invalid
+ *
+ * Since: 6.0
+ */
+const GValue *
+gda_data_model_cursor_get_value (GdaDataModelCursor *cursor, gint col)
+{
+	g_return_val_if_fail (cursor, NULL);
+
+	if ((cursor->row < 0) || (col < 0) || (col >= cursor->n_columns))
+		return NULL;
+
+	switch (cursor->mode) {
+	case CURSOR_MODE_ARRAY:
+	case CURSOR_MODE_SELECT: {
+		GValue *value;
+		value = gda_row_get_value (cursor->grow, col);
+		return gda_row_value_is_valid (cursor->grow, value) ? value : NULL;
+	}
+	case CURSOR_MODE_RANDOM:
+		return gda_data_model_get_value_at (cursor->model, col, cursor->row, NULL);
+	case CURSOR_MODE_ITER:
+		return gda_data_model_iter_get_value_at (cursor->iter, col);
+	default:
+		g_assert_not_reached ();
+	}
+	return NULL;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __GDA_DATA_MODEL_CURSOR_H__
+#define __GDA_DATA_MODEL_CURSOR_H__
+
+#include <libgda/gda-decl.h>
+#include <libgda/gda-data-model.h>
+
+G_BEGIN_DECLS
+
+#define GDA_TYPE_DATA_MODEL_CURSOR (gda_data_model_cursor_get_type ())
+
+typedef struct _GdaDataModelCursor GdaDataModelCursor;
+
+/**
+ * SECTION:gda-data-model-cursor
+ * @short_description: Read-only forward cursor over a data model
+ * @title: GdaDataModelCursor
+ * @stability: Unstable
+ * @see_also: #GdaDataModel, #GdaDataModelIter
+ *
+ * A #GdaDataModelCursor reads the rows of a #GdaDataModel from the first one to the last one,
+ * and gives access to the values of the current row as borrowed #GValue pointers.
+ *
+ * Contrary to a #GdaDataModelIter, a cursor does not hold any #GdaHolder: moving to the next
+ * row does not copy any value and does not emit any signal, which makes it the preferred way to
+ * scan large data models when the values only need to be read (for example when exporting them).
+ *
+ * The values returned by gda_data_model_cursor_get_value() remain valid until the next call to
+ * gda_data_model_cursor_move_next() or until the cursor is freed, and must not be modified.
+ *
+ * Note that for data models which only support cursor based access (such as a #GdaDataSelect
+ * created with the %GDA_STATEMENT_MODEL_CURSOR_FORWARD flag), the position in the model is shared
+ * with the #GdaDataModelIter returned by gda_data_model_create_iter(), as for any other iterator
+ * on those models.
+ */
+
+GType               gda_data_model_cursor_get_type      (void) G_GNUC_CONST;
+GdaDataModelCursor *gda_data_model_cursor_new           (GdaDataModel *model);
+GdaDataModelCursor *gda_data_model_cursor_ref           (GdaDataModelCursor *cursor);
+void                gda_data_model_cursor_unref         (GdaDataModelCursor *cursor);
+
+gboolean            gda_data_model_cursor_move_next     (GdaDataModelCursor *cursor, GError **error);
+gint                gda_data_model_cursor_get_row       (GdaDataModelCursor *cursor);
+gint                gda_data_model_cursor_get_n_columns (GdaDataModelCursor *cursor);
+const GValue       *gda_data_model_cursor_get_value     (GdaDataModelCursor *cursor, gint col);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,1134 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+#define G_LOG_DOMAIN "GDA-data-model-snapshot"
+
+#include <string.h>
+#include <gio/gio.h>
+#include <glib/gi18n-lib.h>
+#include <libgda/gda-data-model-snapshot.h>
+#include <libgda/gda-data-model-cursor.h>
+#include <libgda/gda-blob-op.h>
+#include <libgda/gda-column.h>
+#include <libgda/gda-util.h>
+#include <libgda/gda-value.h>
+#include <libgda/gda-value-private.h>
+
+/*
+ * File format
+ *
+ * All the numbers are stored using the byte order of the machine which has written the file, and all
+ * the sections start at offsets which are multiples of 8 so the arrays can be used directly from
+ * the mapped file:
+ *   - a SnapHeader
+ *   - one SnapColumn per column
+ *   - for each column: the NULL values bitmap (1 bit per row, if the column has any NULL value), the
+ *     values and the dictionary or binary data area
+ *   - the strings area: all the NUL terminated strings (column names, type names and values),
+ *     each distinct string being stored only once; it always starts with an empty string
+ */
+#define SNAP_MAGIC "GDASNAP"
+#define SNAP_VERSION 1
+#define SNAP_BYTE_ORDER 0x01020304
+#define SNAP_ALIGN(x) (((x) + 7) & ~((guint64) 7))
+
+typedef enum {
+	SNAP_KIND_NULL,   /* all the values are NULL, nothing stored */
+	SNAP_KIND_FIXED,  /* array of fixed size values */
+	SNAP_KIND_STRING, /* array of guint32 indexes in the column's dictionary */
+	SNAP_KIND_TEXT,   /* as SNAP_KIND_STRING, values converted using gda_value_new_from_string() */
+	SNAP_KIND_BINARY  /* array of (offset, size) guint64 pairs in the column's binary data area */
+} SnapKind;
+
+typedef struct {
+	gchar   magic [8];
+	guint32 version;
+	guint32 byte_order;
+	guint32 n_columns;
+	guint32 reserved;
+	guint64 n_rows;
+	guint64 strings_offset;
+	guint64 strings_size;
+} SnapHeader;
+
+typedef struct {
+	guint32 kind;
+	guint32 reserved;
+	guint64 name;         /* offset in the strings area */
+	guint64 type_name;    /* offset in the strings area, as returned by gda_g_type_to_string() */
+	guint64 nulls_offset; /* 0 if the column has no NULL value */
+	guint64 data_offset;
+	guint64 dict_offset;  /* dictionary or binary data area */
+	guint64 dict_size;    /* number of entries in the dictionary, or size of the binary data area */
+	guint64 reserved2;
+} SnapColumn;
+
+G_STATIC_ASSERT (sizeof (SnapHeader) == 48);
+G_STATIC_ASSERT (sizeof (SnapColumn) == 64);
+
+typedef struct {
+	const SnapColumn *desc;
+	GdaColumn        *column;
+	GType             type;
+	gsize             elsize; /* for SNAP_KIND_FIXED */
+	const guint8     *nulls;
+	const guint8     *data;
+	const guint64    *dict;   /* offsets in the strings area, for SNAP_KIND_STRING and SNAP_KIND_TEXT */
+	const guint8     *bin;    /* for SNAP_KIND_BINARY */
+
+	/* for SNAP_KIND_STRING and SNAP_KIND_TEXT: values created when first requested, one per
+	 * dictionary entry (shared by all the rows using it) */
+	GValue          **values;
+	guint             n_values;
+
+	/* for SNAP_KIND_FIXED and SNAP_KIND_BINARY: a single value, updated for each requested row;
+	 * binary values point into the mapped file */
+	GValue           *value;
+	gint              value_row;
+} ColumnData;
+
+typedef struct {
+	GMappedFile *map;
+	const gchar *strings;
+	guint64      strings_size;
+	gint         n_rows;
+	gint         n_columns;
+	ColumnData  *cdata;
+	GValue      *null_value;
+} GdaDataModelSnapshotPrivate;
+
+static void                 gda_data_model_snapshot_data_model_init (GdaDataModelInterface *iface);
+static gint                 gda_data_model_snapshot_get_n_rows      (GdaDataModel *model);
+static gint                 gda_data_model_snapshot_get_n_columns   (GdaDataModel *model);
+static GdaColumn           *gda_data_model_snapshot_describe_column (GdaDataModel *model, gint col);
+static GdaDataModelAccessFlags gda_data_model_snapshot_get_access_flags (GdaDataModel *model);
+static const GValue        *gda_data_model_snapshot_get_value_at    (GdaDataModel *model, gint col, gint row, GError **error);
+static GdaValueAttribute    gda_data_model_snapshot_get_attributes_at (GdaDataModel *model, gint col, gint row);
+
+G_DEFINE_TYPE_WITH_CODE (GdaDataModelSnapshot, gda_data_model_snapshot, G_TYPE_OBJECT,
+                         G_ADD_PRIVATE (GdaDataModelSnapshot)
+                         G_IMPLEMENT_INTERFACE (GDA_TYPE_DATA_MODEL, gda_data_model_snapshot_data_model_init))
+
+/* module error */
+GQuark gda_data_model_snapshot_error_quark (void)
+{
+        static GQuark quark;
+        if (!quark)
+                quark = g_quark_from_static_string ("gda_data_model_snapshot_error");
+        return quark;
+}
+
+static void
+gda_data_model_snapshot_data_model_init (GdaDataModelInterface *iface)
+{
+	iface->get_n_rows = gda_data_model_snapshot_get_n_rows;
+	iface->get_n_columns = gda_data_model_snapshot_get_n_columns;
+	iface->describe_column = gda_data_model_snapshot_describe_column;
+	iface->get_access_flags = gda_data_model_snapshot_get_access_flags;
+	iface->get_value_at = gda_data_model_snapshot_get_value_at;
+	iface->get_attributes_at = gda_data_model_snapshot_get_attributes_at;
+
+	iface->create_iter = NULL;
+
+	iface->set_value_at = NULL;
+	iface->set_values = NULL;
+	iface->append_values = NULL;
+	iface->append_row = NULL;
+	iface->remove_row = NULL;
+	iface->find_row = NULL;
+
+	iface->freeze = NULL;
+	iface->thaw = NULL;
+	iface->get_notify = NULL;
+	iface->send_hint = NULL;
+}
+
+static void
+gda_data_model_snapshot_init (GdaDataModelSnapshot *model)
+{
+	GdaDataModelSnapshotPrivate *priv = gda_data_model_snapshot_get_instance_private (model);
+	priv->null_value = gda_value_new_null ();
+}
+
+/* returns the #GdaBinary held by @cdata's value, for SNAP_KIND_BINARY columns */
+static GdaBinary *
+column_value_get_binary (ColumnData *cdata)
+{
+	if (cdata->type == GDA_TYPE_BLOB)
+		return gda_blob_get_binary ((GdaBlob*) gda_value_get_blob (cdata->value));
+	else
+		return gda_value_get_binary (cdata->value);
+}
+
+static void
+column_value_clear_static_data (ColumnData *cdata)
+{
+	if (cdata->desc->kind == SNAP_KIND_BINARY)
+		_gda_binary_set_static_data (column_value_get_binary (cdata), NULL, 0);
+}
+
+static void
+gda_data_model_snapshot_dispose (GObject *object)
+{
+	GdaDataModelSnapshot *model = (GdaDataModelSnapshot *) object;
+	GdaDataModelSnapshotPrivate *priv = gda_data_model_snapshot_get_instance_private (model);
+
+	if (priv->cdata) {
+		gint i;
+		for (i = 0; i < priv->n_columns; i++) {
+			ColumnData *cdata = &(priv->cdata [i]);
+			if (cdata->values) {
+				guint j;
+				for (j = 0; j < cdata->n_values; j++) {
+					if (cdata->values [j])
+						gda_value_free (cdata->values [j]);
+				}
+				g_free (cdata->values);
+			}
+			if (cdata->value) {
+				column_value_clear_static_data (cdata);
+				gda_value_free (cdata->value);
+			}
+			if (cdata->column)
+				g_object_unref (cdata->column);
+		}
+		g_free (priv->cdata);
+		priv->cdata = NULL;
+	}
+
+	/* the values above may point into the mapped file, so it must be released last */
+	if (priv->map) {
+		g_mapped_file_unref (priv->map);
+		priv->map = NULL;
+	}
+
+	if (priv->null_value) {
+		gda_value_free (priv->null_value);
+		priv->null_value = NULL;
+	}
+
+	G_OBJECT_CLASS (gda_data_model_snapshot_parent_class)->dispose (object);
+}
+
+static void
+gda_data_model_snapshot_class_init (GdaDataModelSnapshotClass *klass)
+{
+	GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+	/* virtual functions */
+	object_class->dispose = gda_data_model_snapshot_dispose;
+}
+
+/*
+ * Fixed size values
+ */
+static gsize
+fixed_type_size (GType type)
+{
+	if ((type == G_TYPE_BOOLEAN) || (type == G_TYPE_CHAR) || (type == G_TYPE_UCHAR))
+		return 1;
+	if ((type == GDA_TYPE_SHORT) || (type == GDA_TYPE_USHORT))
+		return 2;
+	if ((type == G_TYPE_INT) || (type == G_TYPE_UINT) || (type == G_TYPE_FLOAT))
+		return 4;
+	if ((type == G_TYPE_LONG) || (type == G_TYPE_ULONG) ||
+	    (type == G_TYPE_INT64) || (type == G_TYPE_UINT64) || (type == G_TYPE_DOUBLE))
+		return 8;
+	return 0;
+}
+
+/* @buf must be at least 8 bytes long; longs are always stored using 64 bits */
+static void
+fixed_value_write (const GValue *value, guint8 *buf)
+{
+	GType type = G_VALUE_TYPE (value);
+
+	if (type == G_TYPE_BOOLEAN)
+		buf [0] = g_value_get_boolean (value) ? 1 : 0;
+	else if (type == G_TYPE_CHAR) {
+		gint8 v = g_value_get_schar (value);
+		memcpy (buf, &v, 1);
+	}
+	else if (type == G_TYPE_UCHAR)
+		buf [0] = g_value_get_uchar (value);
+	else if (type == GDA_TYPE_SHORT) {
+		gint16 v = gda_value_get_short (value);
+		memcpy (buf, &v, 2);
+	}
+	else if (type == GDA_TYPE_USHORT) {
+		guint16 v = gda_value_get_ushort (value);
+		memcpy (buf, &v, 2);
+	}
+	else if (type == G_TYPE_INT) {
+		gint32 v = g_value_get_int (value);
+		memcpy (buf, &v, 4);
+	}
+	else if (type == G_TYPE_UINT) {
+		guint32 v = g_value_get_uint (value);
+		memcpy (buf, &v, 4);
+	}
+	else if (type == G_TYPE_FLOAT) {
+		gfloat v = g_value_get_float (value);
+		memcpy (buf, &v, 4);
+	}
+	else if (type == G_TYPE_LONG) {
+		gint64 v = g_value_get_long (value);
+		memcpy (buf, &v, 8);
+	}
+	else if (type == G_TYPE_ULONG) {
+		guint64 v = g_value_get_ulong (value);
+		memcpy (buf, &v, 8);
+	}
+	else if (type == G_TYPE_INT64) {
+		gint64 v = g_value_get_int64 (value);
+		memcpy (buf, &v, 8);
+	}
+	else if (type == G_TYPE_UINT64) {
+		guint64 v = g_value_get_uint64 (value);
+		memcpy (buf, &v, 8);
+	}
+	else if (type == G_TYPE_DOUBLE) {
+		gdouble v = g_value_get_double (value);
+		memcpy (buf, &v, 8);
+	}
+	else
+		g_assert_not_reached ();
+}
+
+/* @value must already hold the type of the value to read */
+static void
+fixed_value_read (GValue *value, const guint8 *ptr)
+{
+	GType type = G_VALUE_TYPE (value);
+
+	if (type == G_TYPE_BOOLEAN)
+		g_value_set_boolean (value, ptr [0] ? TRUE : FALSE);
+	else if (type == G_TYPE_CHAR)
+		g_value_set_schar (value, (gint8) ptr [0]);
+	else if (type == G_TYPE_UCHAR)
+		g_value_set_uchar (value, ptr [0]);
+	else if (type == GDA_TYPE_SHORT) {
+		gint16 v;
+		memcpy (&v, ptr, 2);
+		gda_value_set_short (value, v);
+	}
+	else if (type == GDA_TYPE_USHORT) {
+		guint16 v;
+		memcpy (&v, ptr, 2);
+		gda_value_set_ushort (value, v);
+	}
+	else if (type == G_TYPE_INT) {
+		gint32 v;
+		memcpy (&v, ptr, 4);
+		g_value_set_int (value, v);
+	}
+	else if (type == G_TYPE_UINT) {
+		guint32 v;
+		memcpy (&v, ptr, 4);
+		g_value_set_uint (value, v);
+	}
+	else if (type == G_TYPE_FLOAT) {
+		gfloat v;
+		memcpy (&v, ptr, 4);
+		g_value_set_float (value, v);
+	}
+	else if (type == G_TYPE_LONG) {
+		gint64 v;
+		memcpy (&v, ptr, 8);
+		g_value_set_long (value, (glong) v);
+	}
+	else if (type == G_TYPE_ULONG) {
+		guint64 v;
+		memcpy (&v, ptr, 8);
+		g_value_set_ulong (value, (gulong) v);
+	}
+	else if (type == G_TYPE_INT64) {
+		gint64 v;
+		memcpy (&v, ptr, 8);
+		g_value_set_int64 (value, v);
+	}
+	else if (type == G_TYPE_UINT64) {
+		guint64 v;
+		memcpy (&v, ptr, 8);
+		g_value_set_uint64 (value, v);
+	}
+	else if (type == G_TYPE_DOUBLE) {
+		gdouble v;
+		memcpy (&v, ptr, 8);
+		g_value_set_double (value, v);
+	}
+	else
+		g_assert_not_reached ();
+}
+
+/*
+ * Reading
+ */
+
+/* checks that [@offset, @offset + @length[ is inside a file of @size bytes and that @offset is aligned */
+static gboolean
+range_is_valid (gsize size, guint64 offset, guint64 length)
+{
+	return (offset <= size) && (length <= size - offset) && ((offset & 7) == 0);
+}
+
+static void
+set_corrupted_error (GError **error)
+{
+	g_set_error (error, GDA_DATA_MODEL_SNAPSHOT_ERROR, GDA_DATA_MODEL_SNAPSHOT_FORMAT_ERROR,
+		     "%s", _("Corrupted data model snapshot"));
+}
+
+static gboolean
+snapshot_load (GdaDataModelSnapshot *model, GError **error)
+{
+	GdaDataModelSnapshotPrivate *priv = gda_data_model_snapshot_get_instance_private (model);
+	const gchar *contents;
+	const SnapHeader *header;
+	const SnapColumn *descs;
+	gsize size;
+	gint i;
+
+	contents = g_mapped_file_get_contents (priv->map);
+	size = g_mapped_file_get_length (priv->map);
+	if ((size < sizeof (SnapHeader)) || memcmp (contents, SNAP_MAGIC, sizeof (SNAP_MAGIC))) {
+		g_set_error (error, GDA_DATA_MODEL_SNAPSHOT_ERROR, GDA_DATA_MODEL_SNAPSHOT_FORMAT_ERROR,
+			     "%s", _("Not a data model snapshot"));
+		return FALSE;
+	}
+
+	header = (const SnapHeader*) contents;
+	if (header->byte_order != SNAP_BYTE_ORDER) {
+		g_set_error (error, GDA_DATA_MODEL_SNAPSHOT_ERROR, GDA_DATA_MODEL_SNAPSHOT_FORMAT_ERROR,
+			     "%s", _("Data model snapshot was written on a machine with a different byte order"));
+		return FALSE;
+	}
+	if (header->version != SNAP_VERSION) {
+		g_set_error (error, GDA_DATA_MODEL_SNAPSHOT_ERROR, GDA_DATA_MODEL_SNAPSHOT_VERSION_ERROR,
+			     _("Unsupported data model snapshot version %u"), header->version);
+		return FALSE;
+	}
+	if ((header->n_rows > G_MAXINT) || (header->n_columns > G_MAXINT) ||
+	    ! range_is_valid (size, sizeof (SnapHeader), (guint64) header->n_columns * sizeof (SnapColumn)) ||
+	    ! range_is_valid (size, header->strings_offset, header->strings_size) ||
+	    (header->strings_size == 0) ||
+	    contents [header->strings_offset + header->strings_size - 1]) {
+		set_corrupted_error (error);
+		return FALSE;
+	}
+
+	priv->strings = contents + header->strings_offset;
+	priv->strings_size = header->strings_size;
+	priv->n_rows = (gint) header->n_rows;
+	priv->n_columns = (gint) header->n_columns;
+	priv->cdata = g_new0 (ColumnData, priv->n_columns);
+
+	descs = (const SnapColumn*) (contents + sizeof (SnapHeader));
+	for (i = 0; i < priv->n_columns; i++) {
+		ColumnData *cdata = &(priv->cdata [i]);
+		const SnapColumn *desc = &(descs [i]);
+		guint64 n_rows = header->n_rows;
+		guint64 j;
+
+		cdata->desc = desc;
+		if ((desc->name >= priv->strings_size) || (desc->type_name >= priv->strings_size)) {
+			set_corrupted_error (error);
+			return FALSE;
+		}
+		cdata->type = gda_g_type_from_string (priv->strings + desc->type_name);
+		if (cdata->type == G_TYPE_INVALID) {
+			g_set_error (error, GDA_DATA_MODEL_SNAPSHOT_ERROR, GDA_DATA_MODEL_SNAPSHOT_TYPE_ERROR,
+				     _("Unknown data type '%s'"), priv->strings + desc->type_name);
+			return FALSE;
+		}
+
+		if (desc->nulls_offset) {
+			if (! range_is_valid (size, desc->nulls_offset, (n_rows + 7) / 8)) {
+				set_corrupted_error (error);
+				return FALSE;
+			}
+			cdata->nulls = (const guint8*) contents + desc->nulls_offset;
+		}
+
+		switch (desc->kind) {
+		case SNAP_KIND_NULL:
+			break;
+		case SNAP_KIND_FIXED:
+			cdata->elsize = fixed_type_size (cdata->type);
+			if ((cdata->elsize == 0) ||
+			    ! range_is_valid (size, desc->data_offset, n_rows * cdata->elsize)) {
+				set_corrupted_error (error);
+				return FALSE;
+			}
+			break;
+		case SNAP_KIND_STRING:
+		case SNAP_KIND_TEXT:
+			if ((desc->dict_size > n_rows) ||
+			    ! range_is_valid (size, desc->data_offset, n_rows * sizeof (guint32)) ||
+			    ! range_is_valid (size, desc->dict_offset, desc->dict_size * sizeof (guint64))) {
+				set_corrupted_error (error);
+				return FALSE;
+			}
+			cdata->dict = (const guint64*) (contents + desc->dict_offset);
+			for (j = 0; j < desc->dict_size; j++) {
+				if (cdata->dict [j] >= priv->strings_size) {
+					set_corrupted_error (error);
+					return FALSE;
+				}
+			}
+			/* the indexes themselves are checked when the values are requested */
+			cdata->n_values = (guint) desc->dict_size;
+			break;
+		case SNAP_KIND_BINARY:
+			if (! range_is_valid (size, desc->data_offset, n_rows * 2 * sizeof (guint64)) ||
+			    ! range_is_valid (size, desc->dict_offset, desc->dict_size)) {
+				set_corrupted_error (error);
+				return FALSE;
+			}
+			cdata->bin = (const guint8*) contents + desc->dict_offset;
+			break;
+		default:
+			set_corrupted_error (error);
+			return FALSE;
+		}
+		cdata->data = (const guint8*) contents + desc->data_offset;
+
+		cdata->column = gda_column_new ();
+		gda_column_set_name (cdata->column, priv->strings + desc->name);
+		gda_column_set_description (cdata->column, priv->strings + desc->name);
+		gda_column_set_g_type (cdata->column, cdata->type);
+		gda_column_set_allow_null (cdata->column,
+					   (cdata->nulls || (desc->kind == SNAP_KIND_NULL)) ? TRUE : FALSE);
+		gda_column_set_position (cdata->column, i);
+	}
+
+	return TRUE;
+}
+
+/**
+ * gda_data_model_snapshot_new:
+ * @filename: the name of a file written by gda_data_model_snapshot_save()
+ * @error: (nullable): a place to store errors, or %NULL
+ *
+ * Opens the @filename snapshot, which is mapped in memory for the whole life of the returned
+ * data model: the file must not be modified in place while it is being used (note that
+ * gda_data_model_snapshot_save() replaces files atomically so it can be used to update a snapshot
+ * which is opened).
+ *
+ * The returned data model is read-only and supports random access.
+ *
+ * Returns: (transfer full) (nullable): a new #GdaDataModel, or %NULL if an error occurred
+ *
+ * Since: 6.0
+ */
+GdaDataModel *
+gda_data_model_snapshot_new (const gchar *filename, GError **error)
+{
+	GdaDataModelSnapshot *model;
+	GdaDataModelSnapshotPrivate *priv;
+	GMappedFile *map;
+
+	g_return_val_if_fail (filename && *filename, NULL);
+
+	map = g_mapped_file_new (filename, FALSE, error);
+	if (!map)
+		return NULL;
+
+	model = g_object_new (GDA_TYPE_DATA_MODEL_SNAPSHOT, NULL);
+	priv = gda_data_model_snapshot_get_instance_private (model);
+	priv->map = map;
+	if (! snapshot_load (model, error)) {
+		g_object_unref (model);
+		return NULL;
+	}
+	return (GdaDataModel*) model;
+}
+
+static gint
+gda_data_model_snapshot_get_n_rows (GdaDataModel *model)
+{
+	g_return_val_if_fail (GDA_IS_DATA_MODEL_SNAPSHOT (model), 0);
+	GdaDataModelSnapshotPrivate *priv = gda_data_model_snapshot_get_instance_private ((GdaDataModelSnapshot*) model);
+
+	return priv->n_rows;
+}
+
+static gint
+gda_data_model_snapshot_get_n_columns (GdaDataModel *model)
+{
+	g_return_val_if_fail (GDA_IS_DATA_MODEL_SNAPSHOT (model), 0);
+	GdaDataModelSnapshotPrivate *priv = gda_data_model_snapshot_get_instance_private ((GdaDataModelSnapshot*) model);
+
+	return priv->n_columns;
+}
+
+static GdaColumn *
+gda_data_model_snapshot_describe_column (GdaDataModel *model, gint col)
+{
+	g_return_val_if_fail (GDA_IS_DATA_MODEL_SNAPSHOT (model), NULL);
+	GdaDataModelSnapshotPrivate *priv = gda_data_model_snapshot_get_instance_private ((GdaDataModelSnapshot*) model);
+
+	if ((col < 0) || (col >= priv->n_columns))
+		return NULL;
+	return priv->cdata [col].column;
+}
+
+static GdaDataModelAccessFlags
+gda_data_model_snapshot_get_access_flags (G_GNUC_UNUSED GdaDataModel *model)
+{
+	return GDA_DATA_MODEL_ACCESS_RANDOM |
+		GDA_DATA_MODEL_ACCESS_CURSOR_FORWARD |
+		GDA_DATA_MODEL_ACCESS_CURSOR_BACKWARD;
+}
+
+static gboolean
+value_is_null (ColumnData *cdata, gint row)
+{
+	if (cdata->desc->kind == SNAP_KIND_NULL)
+		return TRUE;
+	return (cdata->nulls && (cdata->nulls [row >> 3] & (1 << (row & 7)))) ? TRUE : FALSE;
+}
+
+static GValue *
+make_value (GdaDataModelSnapshotPrivate *priv, ColumnData *cdata, guint32 index, GError **error)
+{
+	GValue *value = NULL;
+
+	switch (cdata->desc->kind) {
+	case SNAP_KIND_STRING:
+		/* no copy: the string remains in the mapped file */
+		value = gda_value_new (G_TYPE_STRING);
+		g_value_set_static_string (value, priv->strings + cdata->dict [index]);
+		break;
+	case SNAP_KIND_TEXT:
+		value = gda_value_new_from_string (priv->strings + cdata->dict [index], cdata->type);
+		if (!value)
+			g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_VALUE_TYPE_ERROR,
+				     _("Can't convert '%s' to a value of type %s"),
+				     priv->strings + cdata->dict [index], g_type_name (cdata->type));
+		break;
+	default:
+		g_assert_not_reached ();
+	}
+	return value;
+}
+
+/* sets @cdata's value to the one at @row */
+static gboolean
+column_value_set_row (ColumnData *cdata, gint row, GError **error)
+{
+	if (!cdata->value) {
+		cdata->value = gda_value_new (cdata->type);
+		if (cdata->type == GDA_TYPE_BLOB)
+			gda_value_take_blob (cdata->value, gda_blob_new ());
+		else if (cdata->type == GDA_TYPE_BINARY)
+			gda_value_take_binary (cdata->value, gda_binary_new ());
+		cdata->value_row = -1;
+	}
+
+	switch (cdata->desc->kind) {
+	case SNAP_KIND_FIXED:
+		fixed_value_read (cdata->value, cdata->data + (gsize) row * cdata->elsize);
+		break;
+	case SNAP_KIND_BINARY: {
+		guint64 pair [2];
+		memcpy (pair, cdata->data + (gsize) row * sizeof (pair), sizeof (pair));
+		if ((pair [0] > cdata->desc->dict_size) || (pair [1] > cdata->desc->dict_size - pair [0]) ||
+		    (pair [1] > G_MAXLONG)) {
+			cdata->value_row = -1;
+			set_corrupted_error (error);
+			return FALSE;
+		}
+		/* no copy: the data remains in the mapped file */
+		_gda_binary_set_static_data (column_value_get_binary (cdata), cdata->bin + pair [0],
+					     (glong) pair [1]);
+		break;
+	}
+	default:
+		g_assert_not_reached ();
+	}
+	cdata->value_row = row;
+	return TRUE;
+}
+
+static const GValue *
+gda_data_model_snapshot_get_value_at (GdaDataModel *model, gint col, gint row, GError **error)
+{
+	ColumnData *cdata;
+	guint32 index;
+
+	g_return_val_if_fail (GDA_IS_DATA_MODEL_SNAPSHOT (model), NULL);
+	GdaDataModelSnapshotPrivate *priv = gda_data_model_snapshot_get_instance_private ((GdaDataModelSnapshot*) model);
+
+	if ((col < 0) || (col >= priv->n_columns)) {
+		g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_COLUMN_OUT_OF_RANGE_ERROR,
+			     _("Column %d out of range (0-%d)"), col, priv->n_columns - 1);
+		return NULL;
+	}
+	if ((row < 0) || (row >= priv->n_rows)) {
+		g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ROW_OUT_OF_RANGE_ERROR,
+			     _("Row %d out of range (0-%d)"), row, priv->n_rows - 1);
+		return NULL;
+	}
+
+	cdata = &(priv->cdata [col]);
+	if (value_is_null (cdata, row))
+		return priv->null_value;
+
+	if ((cdata->desc->kind == SNAP_KIND_FIXED) || (cdata->desc->kind == SNAP_KIND_BINARY)) {
+		if ((!cdata->value || (cdata->value_row != row)) &&
+		    ! column_value_set_row (cdata, row, error))
+			return NULL;
+		return cdata->value;
+	}
+
+	memcpy (&index, cdata->data + (gsize) row * sizeof (guint32), sizeof (guint32));
+	if (index >= cdata->n_values) {
+		set_corrupted_error (error);
+		return NULL;
+	}
+	if (!cdata->values)
+		cdata->values = g_new0 (GValue*, cdata->n_values);
+	if (!cdata->values [index])
+		cdata->values [index] = make_value (priv, cdata, index, error);
+	return cdata->values [index];
+}
+
+static GdaValueAttribute
+gda_data_model_snapshot_get_attributes_at (GdaDataModel *model, gint col, gint row)
+{
+	GdaValueAttribute flags = GDA_VALUE_ATTR_NO_MODIF;
+	ColumnData *cdata;
+
+	g_return_val_if_fail (GDA_IS_DATA_MODEL_SNAPSHOT (model), 0);
+	GdaDataModelSnapshotPrivate *priv = gda_data_model_snapshot_get_instance_private ((GdaDataModelSnapshot*) model);
+
+	if ((col < 0) || (col >= priv->n_columns))
+		return 0;
+
+	cdata = &(priv->cdata [col]);
+	if (cdata->nulls || (cdata->desc->kind == SNAP_KIND_NULL))
+		flags |= GDA_VALUE_ATTR_CAN_BE_NULL;
+	if ((row >= 0) && (row < priv->n_rows) && value_is_null (cdata, row))
+		flags |= GDA_VALUE_ATTR_IS_NULL;
+	return flags;
+}
+
+/*
+ * Writing
+ */
+typedef struct {
+	GType       type;
+	SnapKind    kind;
+	gsize       elsize;
+	GArray     *nulls;     /* bitmap, NULL until the 1st NULL value */
+	GByteArray *data;
+	GArray     *dict;      /* guint64 offsets in the strings area */
+	GHashTable *dict_hash; /* key: offset in the strings area + 1, value: index in @dict + 1 */
+	GByteArray *bin;
+	SnapColumn  desc;
+} ColumnWriter;
+
+typedef struct {
+	GByteArray   *strings;
+	GHashTable   *strings_hash; /* key: string, value: offset in @strings */
+	gint          n_columns;
+	ColumnWriter *columns;
+	guint64       n_rows;
+} SnapWriter;
+
+static guint64
+strings_add (SnapWriter *writer, const gchar *str)
+{
+	gpointer offset;
+	guint pos;
+
+	if (g_hash_table_lookup_extended (writer->strings_hash, str, NULL, &offset))
+		return (guint64) GPOINTER_TO_SIZE (offset);
+
+	pos = writer->strings->len;
+	g_byte_array_append (writer->strings, (const guint8*) str, strlen (str) + 1);
+	g_hash_table_insert (writer->strings_hash, g_strdup (str), GSIZE_TO_POINTER ((gsize) pos));
+	return pos;
+}
+
+static guint32
+dict_add (SnapWriter *writer, ColumnWriter *cw, const gchar *str)
+{
+	guint64 offset;
+	gpointer index;
+
+	offset = strings_add (writer, str);
+	index = g_hash_table_lookup (cw->dict_hash, GSIZE_TO_POINTER ((gsize) offset + 1));
+	if (index)
+		return GPOINTER_TO_UINT (index) - 1;
+
+	g_array_append_val (cw->dict, offset);
+	g_hash_table_insert (cw->dict_hash, GSIZE_TO_POINTER ((gsize) offset + 1), GUINT_TO_POINTER (cw->dict->len));
+	return cw->dict->len - 1;
+}
+
+/* appends the value stored for a NULL value to @cw->data */
+static void
+column_writer_add_null_data (ColumnWriter *cw)
+{
+	static const guint8 zeros [16] = {0};
+
+	switch (cw->kind) {
+	case SNAP_KIND_NULL:
+		break;
+	case SNAP_KIND_FIXED:
+		g_byte_array_append (cw->data, zeros, cw->elsize);
+		break;
+	case SNAP_KIND_STRING:
+	case SNAP_KIND_TEXT:
+		g_byte_array_append (cw->data, zeros, sizeof (guint32));
+		break;
+	case SNAP_KIND_BINARY:
+		g_byte_array_append (cw->data, zeros, 2 * sizeof (guint64));
+		break;
+	default:
+		g_assert_not_reached ();
+	}
+}
+
+/* @n_rows rows have already been added, all NULL */
+static void
+column_writer_set_type (ColumnWriter *cw, GType type, guint64 n_rows)
+{
+	guint64 i;
+
+	cw->type = type;
+	cw->elsize = fixed_type_size (type);
+	if (type == GDA_TYPE_NULL)
+		cw->kind = SNAP_KIND_NULL;
+	else if (cw->elsize > 0)
+		cw->kind = SNAP_KIND_FIXED;
+	else if (type == G_TYPE_STRING)
+		cw->kind = SNAP_KIND_STRING;
+	else if ((type == GDA_TYPE_BINARY) || (type == GDA_TYPE_BLOB))
+		cw->kind = SNAP_KIND_BINARY;
+	else
+		cw->kind = SNAP_KIND_TEXT;
+
+	if ((cw->kind == SNAP_KIND_STRING) || (cw->kind == SNAP_KIND_TEXT)) {
+		cw->dict = g_array_new (FALSE, FALSE, sizeof (guint64));
+		cw->dict_hash = g_hash_table_new (NULL, NULL);
+	}
+	else if (cw->kind == SNAP_KIND_BINARY)
+		cw->bin = g_byte_array_new ();
+
+	for (i = 0; i < n_rows; i++)
+		column_writer_add_null_data (cw);
+}
+
+static gboolean
+column_writer_add (SnapWriter *writer, ColumnWriter *cw, gint col, const GValue *value, GError **error)
+{
+	GValue converted = G_VALUE_INIT;
+
+	if (!value || gda_value_is_null (value) ||
+	    ((G_VALUE_TYPE (value) == G_TYPE_STRING) && !g_value_get_string (value))) {
+		guint64 byte = writer->n_rows / 8;
+		if (!cw->nulls)
+			cw->nulls = g_array_new (FALSE, TRUE, 1);
+		if (cw->nulls->len <= byte)
+			g_array_set_size (cw->nulls, byte + 1);
+		g_array_index (cw->nulls, guint8, byte) |= 1 << (writer->n_rows & 7);
+		column_writer_add_null_data (cw);
+		return TRUE;
+	}
+
+	/* columns of unknown type take the type of their 1st non NULL value */
+	if (cw->kind == SNAP_KIND_NULL)
+		column_writer_set_type (cw, G_VALUE_TYPE (value), writer->n_rows);
+
+	if (G_VALUE_TYPE (value) != cw->type) {
+		g_value_init (&converted, cw->type);
+		if (! g_value_type_transformable (G_VALUE_TYPE (value), cw->type) ||
+		    ! g_value_transform (value, &converted)) {
+			g_value_unset (&converted);
+			g_set_error (error, GDA_DATA_MODEL_SNAPSHOT_ERROR, GDA_DATA_MODEL_SNAPSHOT_TYPE_ERROR,
+				     _("Can't store a value of type %s in column %d of type %s"),
+				     g_type_name (G_VALUE_TYPE (value)), col, g_type_name (cw->type));
+			return FALSE;
+		}
+		value = &converted;
+	}
+
+	switch (cw->kind) {
+	case SNAP_KIND_FIXED: {
+		guint8 buf [8];
+		fixed_value_write (value, buf);
+		g_byte_array_append (cw->data, buf, cw->elsize);
+		break;
+	}
+	case SNAP_KIND_STRING: {
+		guint32 index;
+		index = dict_add (writer, cw, g_value_get_string (value));
+		g_byte_array_append (cw->data, (const guint8*) &index, sizeof (index));
+		break;
+	}
+	case SNAP_KIND_TEXT: {
+		gchar *str;
+		guint32 index;
+		str = gda_value_stringify (value);
+		index = dict_add (writer, cw, str ? str : "");
+		g_free (str);
+		g_byte_array_append (cw->data, (const guint8*) &index, sizeof (index));
+		break;
+	}
+	case SNAP_KIND_BINARY: {
+		GdaBlob *copy = NULL;
+		GdaBinary *bin;
+		guint64 pair [2];
+
+		if (cw->type == GDA_TYPE_BLOB) {
+			GdaBlob *blob = (GdaBlob*) gda_value_get_blob (value);
+			if (gda_blob_get_op (blob)) {
+				copy = gda_blob_copy (blob);
+				if (! gda_blob_op_read_all (gda_blob_get_op (copy), copy)) {
+					gda_blob_free (copy);
+					if (G_IS_VALUE (&converted))
+						g_value_unset (&converted);
+					g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ACCESS_ERROR,
+						     _("Can't read BLOB's contents in column %d"), col);
+					return FALSE;
+				}
+				bin = gda_blob_get_binary (copy);
+			}
+			else
+				bin = gda_blob_get_binary (blob);
+		}
+		else
+			bin = gda_value_get_binary (value);
+
+		pair [0] = cw->bin->len;
+		pair [1] = (guint64) gda_binary_get_size (bin);
+		if (pair [1] > 0)
+			g_byte_array_append (cw->bin, gda_binary_get_data (bin), (guint) pair [1]);
+		g_byte_array_append (cw->data, (const guint8*) pair, sizeof (pair));
+		if (copy)
+			gda_blob_free (copy);
+		break;
+	}
+	default:
+		g_assert_not_reached ();
+	}
+
+	if (G_IS_VALUE (&converted))
+		g_value_unset (&converted);
+	return TRUE;
+}
+
+/* writes zeros up to @offset, then @size bytes of @data */
+static gboolean
+write_section (GOutputStream *ostream, guint64 *pos, guint64 offset, gconstpointer data, gsize size,
+	       GError **error)
+{
+	static const guint8 zeros [8] = {0};
+
+	g_assert ((offset >= *pos) && (offset - *pos < sizeof (zeros)));
+	if ((offset > *pos) &&
+	    ! g_output_stream_write_all (ostream, zeros, offset - *pos, NULL, NULL, error))
+		return FALSE;
+	if ((size > 0) && ! g_output_stream_write_all (ostream, data, size, NULL, NULL, error))
+		return FALSE;
+	*pos = offset + size;
+	return TRUE;
+}
+
+static gboolean
+snapshot_write (SnapWriter *writer, GOutputStream *ostream, GError **error)
+{
+	SnapHeader header;
+	guint64 offset, pos;
+	gint i;
+
+	/* compute the layout */
+	offset = SNAP_ALIGN (sizeof (SnapHeader) + writer->n_columns * sizeof (SnapColumn));
+	for (i = 0; i < writer->n_columns; i++) {
+		ColumnWriter *cw = &(writer->columns [i]);
+
+		cw->desc.kind = cw->kind;
+		cw->desc.type_name = strings_add (writer, gda_g_type_to_string (cw->type));
+		if (cw->nulls) {
+			g_array_set_size (cw->nulls, (writer->n_rows + 7) / 8);
+			cw->desc.nulls_offset = offset;
+			offset = SNAP_ALIGN (offset + cw->nulls->len);
+		}
+		cw->desc.data_offset = offset;
+		offset = SNAP_ALIGN (offset + cw->data->len);
+		if (cw->dict) {
+			cw->desc.dict_offset = offset;
+			cw->desc.dict_size = cw->dict->len;
+			offset += (guint64) cw->dict->len * sizeof (guint64);
+		}
+		else if (cw->bin) {
+			cw->desc.dict_offset = offset;
+			cw->desc.dict_size = cw->bin->len;
+			offset = SNAP_ALIGN (offset + cw->bin->len);
+		}
+	}
+
+	memset (&header, 0, sizeof (header));
+	memcpy (header.magic, SNAP_MAGIC, sizeof (SNAP_MAGIC));
+	header.version = SNAP_VERSION;
+	header.byte_order = SNAP_BYTE_ORDER;
+	header.n_columns = writer->n_columns;
+	header.n_rows = writer->n_rows;
+	header.strings_offset = offset;
+	header.strings_size = writer->strings->len;
+
+	/* write */
+	pos = 0;
+	if (! write_section (ostream, &pos, 0, &header, sizeof (header), error))
+		return FALSE;
+	for (i = 0; i < writer->n_columns; i++) {
+		if (! write_section (ostream, &pos, pos, &(writer->columns [i].desc), sizeof (SnapColumn), error))
+			return FALSE;
+	}
+	for (i = 0; i < writer->n_columns; i++) {
+		ColumnWriter *cw = &(writer->columns [i]);
+		if (cw->nulls &&
+		    ! write_section (ostream, &pos, cw->desc.nulls_offset, cw->nulls->data, cw->nulls->len, error))
+			return FALSE;
+		if (! write_section (ostream, &pos, cw->desc.data_offset, cw->data->data, cw->data->len, error))
+			return FALSE;
+		if (cw->dict &&
+		    ! write_section (ostream, &pos, cw->desc.dict_offset, cw->dict->data,
+				     cw->dict->len * sizeof (guint64), error))
+			return FALSE;
+		if (cw->bin &&
+		    ! write_section (ostream, &pos, cw->desc.dict_offset, cw->bin->data, cw->bin->len, error))
+			return FALSE;
+	}
+	return write_section (ostream, &pos, header.strings_offset, writer->strings->data,
+			      writer->strings->len, error);
+}
+
+/**
+ * gda_data_model_snapshot_save:
+ * @model: a #GdaDataModel
+ * @filename: the name of the file to write
+ * @error: (nullable): a place to store errors, or %NULL
+ *
+ * Saves the contents of @model to @filename, which can then be opened using gda_data_model_snapshot_new().
+ * @model's rows are read only once, from the first one to the last one, so @model does not need
+ * to support random access.
+ *
+ * If @filename already exists, it is replaced only once the new contents has been completely written.
+ *
+ * Returns: %TRUE if no error occurred
+ *
+ * Since: 6.0
+ */
+gboolean
+gda_data_model_snapshot_save (GdaDataModel *model, const gchar *filename, GError **error)
+{
+	SnapWriter writer;
+	GdaDataModelCursor *cursor = NULL;
+	GOutputStream *ostream = NULL;
+	GFile *file;
+	GError *lerror = NULL;
+	gboolean retval = FALSE;
+	gint i;
+
+	g_return_val_if_fail (GDA_IS_DATA_MODEL (model), FALSE);
+	g_return_val_if_fail (filename && *filename, FALSE);
+
+	writer.strings = g_byte_array_new ();
+	writer.strings_hash = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+	strings_add (&writer, "");
+	writer.n_rows = 0;
+	writer.n_columns = gda_data_model_get_n_columns (model);
+	writer.columns = g_new0 (ColumnWriter, MAX (writer.n_columns, 1));
+	for (i = 0; i < writer.n_columns; i++) {
+		ColumnWriter *cw = &(writer.columns [i]);
+		GdaColumn *column;
+		const gchar *name = NULL;
+		GType type = GDA_TYPE_NULL;
+
+		column = gda_data_model_describe_column (model, i);
+		if (column) {
+			name = gda_column_get_name (column);
+			type = gda_column_get_g_type (column);
+			if (type == G_TYPE_INVALID)
+				type = GDA_TYPE_NULL;
+		}
+		cw->desc.name = strings_add (&writer, name ? name : "");
+		cw->data = g_byte_array_new ();
+		column_writer_set_type (cw, type, 0);
+	}
+
+	/* read the rows once, storing the values column by column */
+	cursor = gda_data_model_cursor_new (model);
+	while (gda_data_model_cursor_move_next (cursor, &lerror)) {
+		for (i = 0; i < writer.n_columns; i++) {
+			if (! column_writer_add (&writer, &(writer.columns [i]), i,
+						 gda_data_model_cursor_get_value (cursor, i), error))
+				goto out;
+		}
+		writer.n_rows ++;
+	}
+	if (lerror) {
+		g_propagate_error (error, lerror);
+		goto out;
+	}
+
+	file = g_file_new_for_path (filename);
+	ostream = (GOutputStream*) g_file_replace (file, NULL, FALSE, G_FILE_CREATE_REPLACE_DESTINATION,
+						   NULL, error);
+	g_object_unref (file);
+	if (!ostream)
+		goto out;
+
+	if (snapshot_write (&writer, ostream, error))
+		retval = g_output_stream_close (ostream, NULL, error);
+	else {
+		/* closing a cancelled stream leaves the original file untouched */
+		GCancellable *cancellable;
+		cancellable = g_cancellable_new ();
+		g_cancellable_cancel (cancellable);
+		g_output_stream_close (ostream, cancellable, NULL);
+		g_object_unref (cancellable);
+	}
+
+ out:
+	if (ostream)
+		g_object_unref (ostream);
+	if (cursor)
+		gda_data_model_cursor_unref (cursor);
+	for (i = 0; i < writer.n_columns; i++) {
+		ColumnWriter *cw = &(writer.columns [i]);
+		if (cw->nulls)
+			g_array_free (cw->nulls, TRUE);
+		if (cw->data)
+			g_byte_array_unref (cw->data);
+		if (cw->dict)
+			g_array_free (cw->dict, TRUE);
+		if (cw->dict_hash)
+			g_hash_table_destroy (cw->dict_hash);
+		if (cw->bin)
+			g_byte_array_unref (cw->bin);
+	}
+	g_free (writer.columns);
+	g_hash_table_destroy (writer.strings_hash);
+	g_byte_array_unref (writer.strings);
+	return retval;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __GDA_DATA_MODEL_SNAPSHOT_H__
+#define __GDA_DATA_MODEL_SNAPSHOT_H__
+
+#include <libgda/gda-data-model.h>
+
+G_BEGIN_DECLS
+
+#define GDA_TYPE_DATA_MODEL_SNAPSHOT            (gda_data_model_snapshot_get_type())
+G_DECLARE_DERIVABLE_TYPE(GdaDataModelSnapshot, gda_data_model_snapshot, GDA, DATA_MODEL_SNAPSHOT, GObject)
+struct _GdaDataModelSnapshotClass {
+	GObjectClass            parent_class;
+
+	/*< private >*/
+	/* Padding for future expansion */
+	void (*_gda_reserved1) (void);
+	void (*_gda_reserved2) (void);
+	void (*_gda_reserved3) (void);
+	void (*_gda_reserved4) (void);
+};
+
+/* error reporting */
+extern GQuark gda_data_model_snapshot_error_quark (void);
+#define GDA_DATA_MODEL_SNAPSHOT_ERROR gda_data_model_snapshot_error_quark ()
+
+typedef enum {
+	GDA_DATA_MODEL_SNAPSHOT_FORMAT_ERROR,
+	GDA_DATA_MODEL_SNAPSHOT_VERSION_ERROR,
+	GDA_DATA_MODEL_SNAPSHOT_TYPE_ERROR
+} GdaDataModelSnapshotError;
+
+/**
+ * SECTION:gda-data-model-snapshot
+ * @short_description: Binary snapshot of a data model, stored in a file
+ * @title: GdaDataModelSnapshot
+ * @stability: Stable
+ * @see_also: #GdaDataModel, #GdaDataModelImport
+ *
+ * gda_data_model_snapshot_save() writes the contents of any #GdaDataModel to a file using a compact
+ * binary, column oriented, format; the #GdaDataModelSnapshot object gives read-only access to the
+ * contents of such a file, for example to cache the result of expensive SELECT statements.
+ *
+ * Contrary to gda_data_model_export_to_file() and #GdaDataModelImport, no text needs to be
+ * parsed when opening a snapshot: the file is mapped in memory and only checked for consistency, and
+ * the values are read directly from the mapping when they are first requested:
+ * <itemizedlist>
+ *   <listitem><para>values of fixed size types (booleans, integers and floating point numbers)
+ *       are stored as arrays of native values, and read into a single #GValue per column;</para></listitem>
+ *   <listitem><para>strings are dictionary encoded: each distinct string is stored only once, and the
+ *       returned #GValue point directly into the mapped file;</para></listitem>
+ *   <listitem><para>binary and blob values are stored as is, and the returned #GValue (a single one per
+ *       column) point directly into the mapped file;</para></listitem>
+ *   <listitem><para>values of any other type (dates, timestamps, numerics, ...) are stored as dictionary
+ *       encoded strings, converted back using gda_value_new_from_string();</para></listitem>
+ *   <listitem><para>NULL values are recorded in a bitmap per column.</para></listitem>
+ * </itemizedlist>
+ *
+ * As for any #GdaDataModel, a value returned by gda_data_model_get_value_at() must be copied to be kept:
+ * requesting another row of the same column may change it.
+ *
+ * A snapshot can only be opened on a machine with the same byte order as the one which has written it.
+ */
+
+GdaDataModel *gda_data_model_snapshot_new  (const gchar *filename, GError **error);
+gboolean      gda_data_model_snapshot_save (GdaDataModel *model, const gchar *filename, GError **error);
+
+G_END_DECLS
+
+#endif
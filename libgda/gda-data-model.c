@@ -45,6 +45,7 @@
 #include <libgda/gda-data-model-private.h>
 #include <libgda/gda-data-model-extra.h>
 #include <libgda/gda-data-model-iter.h>
+#include <libgda/gda-data-model-cursor.h>
 #include <libgda/gda-data-model-import.h>
 #include <libgda/gda-data-access-wrapper.h>
 #include <libgda/gda-log.h>
@@ -1090,10 +1091,10 @@ static gchar *export_to_text_separated (GdaDataModel *model, const gint *cols, g
  * gda_data_model_export_to_file() documentation for more information about the @options argument (except for the
  * "OVERWRITE" option).
  *
- * Warning: this function uses a #GdaDataModelIter iterator, and if @model does not offer a random access
- * (check using gda_data_model_get_access_flags()), the iterator will be the same as normally used
- * to access data in @model previously to calling this method, and this iterator will be moved (point to
- * another row).
+ * Warning: this function uses a #GdaDataModelCursor, and if @model does not offer a random access
+ * (check using gda_data_model_get_access_flags()), the cursor shares its position with the iterator
+ * normally used to access data in @model previously to calling this method: the export starts at the row
+ * that iterator is positioned on (if any), and that iterator is positioned after the last row once done.
  *
  * See also gda_data_model_dump_as_string();
  *
@@ -1428,10 +1429,10 @@ gda_data_model_export_to_string (GdaDataModel *model, GdaDataModelIOFormat forma
  *             </para></listitem>
  * </itemizedlist>
  *
- * Warning: this function uses a #GdaDataModelIter iterator, and if @model does not offer a random access
- * (check using gda_data_model_get_access_flags()), the iterator will be the same as normally used
- * to access data in @model previously to calling this method, and this iterator will be moved (point to
- * another row).
+ * Warning: this function uses a #GdaDataModelCursor, and if @model does not offer a random access
+ * (check using gda_data_model_get_access_flags()), the cursor shares its position with the iterator
+ * normally used to access data in @model previously to calling this method: the export starts at the row
+ * that iterator is positioned on (if any), and that iterator is positioned after the last row once done.
  *
  * Upon errors %FALSE will be returned and @error will be assigned a
  * #GError from the #GDA_DATA_MODEL_ERROR domain.
@@ -1490,26 +1491,19 @@ export_to_text_separated (GdaDataModel *model, const gint *cols, gint nb_cols,
 {
 	GString *str;
 	gint c;
-	GdaDataModelIter *iter;
+	GdaDataModelCursor *cursor;
 	gboolean addnl = FALSE;
 
 	g_return_val_if_fail (GDA_IS_DATA_MODEL (model), NULL);
 
 	str = g_string_new ("");
-	iter = gda_data_model_create_iter (model);
-	if (!iter)
-		return g_string_free (str, FALSE);
+	cursor = gda_data_model_cursor_new (model);
 
-	if ((gda_data_model_iter_get_row (iter) == -1) && ! gda_data_model_iter_move_next (iter)) {
-		g_object_unref (iter);
-		return g_string_free (str, FALSE);
-	}
-
-	for (; gda_data_model_iter_is_valid (iter); gda_data_model_iter_move_next (iter)) {
+	while (gda_data_model_cursor_move_next (cursor, NULL)) {
 		if (rows) {
 			gint r;
 			for (r = 0; r < nb_rows; r++) { 
-				if (gda_data_model_iter_get_row (iter) == rows[r])
+				if (gda_data_model_cursor_get_row (cursor) == rows[r])
 					break;
 			}
 			if (r == nb_rows)
@@ -1525,7 +1519,7 @@ export_to_text_separated (GdaDataModel *model, const gint *cols, gint nb_cols,
 			GValue *value;
 			gchar *txt;
 
-			value = (GValue*) gda_data_model_iter_get_value_at (iter, cols[c]);
+			value = (GValue*) gda_data_model_cursor_get_value (cursor, cols[c]);
 			if (value && invalid_as_null) {
 				if (g_type_is_a (G_VALUE_TYPE (value), G_TYPE_DATE)) {
 					GDate *date = (GDate*) g_value_get_boxed (value);
@@ -1598,7 +1592,7 @@ export_to_text_separated (GdaDataModel *model, const gint *cols, gint nb_cols,
 		}
 	}
 
-	g_object_unref (iter);
+	gda_data_model_cursor_unref (cursor);
 	return g_string_free (str, FALSE);
 }
 
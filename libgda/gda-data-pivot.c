@@ -29,6 +29,8 @@
 #include <libgda/gda-data-model.h>
 #include <libgda/gda-data-model-array.h>
 #include <libgda/gda-data-model-iter.h>
+#include <libgda/gda-data-select.h>
+#include <libgda/gda-data-select-extra.h>
 #include <libgda/gda-row.h>
 #include <libgda/gda-util.h>
 #include <libgda/gda-blob-op.h>
@@ -66,6 +68,7 @@ static void cell_data_compute_aggregate (CellData *cdata);
 
 static GValue *aggregate_get_empty_value (GdaDataPivotAggregate aggregate);
 static gboolean aggregate_handle_new_value (CellData *cdata, const GValue *new_value);
+static void aggregate_handle_partial_value (CellData *cdata, const GValue *partial_value, gint64 count);
 
 
 #define TABLE_NAME "data"
@@ -107,6 +110,10 @@ typedef struct {
 	GArray        *column_fields; /* array of (gchar *) field specifications */
 	GArray        *data_fields; /* array of (gchar *) field specifications */
 	GArray        *data_aggregates; /* array of GdaDataPivotAggregate, corresponding to @data_fields */
+	GArray        *data_exprs; /* array of (gchar *) @data_fields without their alias */
+	GArray        *data_aliases; /* array of (gchar *) aliases of @data_fields, or %NULL */
+	GArray        *data_types; /* array of GType: type of the source column of @data_fields if they are
+				    * a column of @model, or G_TYPE_INVALID */
 
 	/* computed data */
 	GArray        *columns; /* Array of GdaColumn objects, for ALL columns! */
@@ -242,6 +249,20 @@ gda_data_pivot_dispose (GObject *object)
 		priv->data_aggregates = NULL;
 	}
 
+	if (priv->data_exprs) {
+		guint i;
+		for (i = 0; i < priv->data_exprs->len; i++) {
+			g_free (g_array_index (priv->data_exprs, gchar*, i));
+			g_free (g_array_index (priv->data_aliases, gchar*, i));
+		}
+		g_array_free (priv->data_exprs, TRUE);
+		g_array_free (priv->data_aliases, TRUE);
+		g_array_free (priv->data_types, TRUE);
+		priv->data_exprs = NULL;
+		priv->data_aliases = NULL;
+		priv->data_types = NULL;
+	}
+
 	if (priv->vcnc) {
 		g_object_unref (priv->vcnc);
 		priv->vcnc = NULL;
@@ -1121,6 +1142,41 @@ aggregate_handle_new_value (CellData *cdata, const GValue *new_value)
 	}
 }
 
+/*
+ * Takes into account @partial_value, an aggregate already computed by the database over @count
+ * values of the source data model. For COUNT aggregates, only @count is used and for AVG aggregates,
+ * @partial_value is the sum of the @count values.
+ */
+static void
+aggregate_handle_partial_value (CellData *cdata, const GValue *partial_value, gint64 count)
+{
+	if (cdata->error || (count <= 0))
+		return;
+
+	if (cdata->aggregate == GDA_DATA_PIVOT_COUNT) {
+		guint64 tmp;
+		tmp = (guint64) count;
+		if (cdata->data_value)
+			tmp += g_value_get_uint (cdata->data_value);
+		if (tmp >= G_MAXUINT)
+			g_set_error (&(cdata->error),
+				     GDA_DATA_PIVOT_ERROR, GDA_DATA_PIVOT_OVERFLOW_ERROR,
+				     "%s", _("Integer overflow"));
+		else {
+			if (! cdata->data_value)
+				cdata->data_value = gda_value_new (G_TYPE_UINT);
+			g_value_set_uint (cdata->data_value, (guint) tmp);
+		}
+		return;
+	}
+
+	if (!partial_value || (G_VALUE_TYPE (partial_value) == GDA_TYPE_NULL))
+		return;
+	if (aggregate_handle_new_value (cdata, partial_value) &&
+	    (cdata->aggregate == GDA_DATA_PIVOT_AVG))
+		cdata->nvalues += (gint) (count - 1);
+}
+
 /*
  * Sets cdata->computed_value to a #GValue
  * if an error occurs then cdata->computed_value is set to %NULL
@@ -1239,23 +1295,18 @@ parse_field_spec (GdaDataPivot *pivot, const gchar *field, const gchar *alias, G
 	  g_free (tmp);
 	*/
 
-	/* further tests */
-	GdaDataModel *model;
-	model = gda_connection_statement_execute_select (priv->vcnc, stmt, NULL, &lerror);
-	g_object_unref (stmt);
-	if (!model) {
+	/* further tests: preparing the statement checks the columns without reading the source
+	 * data model, which must remain unread for execute_select_on_source() */
+	if (! gda_connection_statement_prepare (priv->vcnc, stmt, &lerror)) {
+		g_object_unref (stmt);
+		gda_sql_statement_free (sqlst);
 		g_set_error (error, GDA_DATA_PIVOT_ERROR, GDA_DATA_PIVOT_FIELD_FORMAT_ERROR,
 			     _("Wrong field format error: %s"),
 			     lerror && lerror->message ? lerror->message : _("No detail"));
 		g_clear_error (&lerror);
 		return NULL;
 	}
-	/*
-	  g_print ("================= Pivot source:\n");
-	  gda_data_model_dump (model, NULL);
-	*/
-
-	g_object_unref (model);
+	g_object_unref (stmt);
 	return sqlst;
 }
 
@@ -1429,6 +1480,11 @@ gda_data_pivot_add_data (GdaDataPivot *pivot, GdaDataPivotAggregate aggregate_ty
 		priv->data_fields = g_array_new (FALSE, FALSE, sizeof (gchar*));
 	if (! priv->data_aggregates)
 		priv->data_aggregates = g_array_new (FALSE, FALSE, sizeof (GdaDataPivotAggregate));
+	if (! priv->data_exprs) {
+		priv->data_exprs = g_array_new (FALSE, FALSE, sizeof (gchar*));
+		priv->data_aliases = g_array_new (FALSE, FALSE, sizeof (gchar*));
+		priv->data_types = g_array_new (FALSE, FALSE, sizeof (GType));
+	}
 
 	GdaSqlStatementSelect *sel;
 	GSList *sf_list;
@@ -1477,15 +1533,30 @@ gda_data_pivot_add_data (GdaDataPivot *pivot, GdaDataPivotAggregate aggregate_ty
 		/*g_print ("PART [%s][%s]\n", sql, sf->as);*/
 		tmp = sql + 7; /* remove the "SELECT " start */
 		tmp [strlen (tmp) - 7] = 0; /* remove the " FROM T" end */
+		gchar *expr, *alias = NULL;
+		expr = g_strdup (tmp);
 		if (sf->as && *(sf->as)) {
 			gchar *tmp2;
 			tmp2 = g_strdup_printf ("%s AS %s", tmp, sf->as);
 			g_array_append_val (priv->data_fields, tmp2);
+			alias = g_strdup (sf->as);
 		}
 		else {
 			tmp = g_strdup (tmp);
 			g_array_append_val (priv->data_fields, tmp);
 		}
+		GType type = G_TYPE_INVALID;
+		gint col;
+		col = gda_data_model_get_column_index (priv->model, expr);
+		if (col >= 0) {
+			GdaColumn *column;
+			column = gda_data_model_describe_column (priv->model, col);
+			if (column && (gda_column_get_g_type (column) != GDA_TYPE_NULL))
+				type = gda_column_get_g_type (column);
+		}
+		g_array_append_val (priv->data_exprs, expr);
+		g_array_append_val (priv->data_aliases, alias);
+		g_array_append_val (priv->data_types, type);
 		g_array_append_val (priv->data_aggregates, aggregate_type);
 		g_free (sql);
 	}
@@ -1497,42 +1568,29 @@ gda_data_pivot_add_data (GdaDataPivot *pivot, GdaDataPivotAggregate aggregate_ty
 	return TRUE;
 }
 
-/**
- * gda_data_pivot_populate:
- * @pivot: a #GdaDataPivot object
- * @error: (nullable): ta place to store errors, or %NULL
- *
- * Acutally populates @pivot by analysing the data from the provided data model.
- *
- * Returns: %TRUE if no error occurred.
+/*
+ * Builds the SQL of the SELECT statement extracting data from @source (a table name or a sub select).
+ * The resulting data model's columns are:
+ *   - for priv->row_fields: 0 to priv->row_fields->len - 1
+ *   - for priv->column_fields:
+ *     priv->row_fields->len to priv->row_fields->len + priv->column_fields->len - 1
+ *   - for priv->data_fields: the following columns
  *
- * Since: 5.0
+ * If @grouped is %TRUE, then the aggregates are computed using a GROUP BY clause on the row and column
+ * fields, and each data field has the following column(s):
+ *   - COUNT (field) for the GDA_DATA_PIVOT_COUNT aggregate
+ *   - SUM (field), MIN (field) or MAX (field) for the GDA_DATA_PIVOT_SUM, GDA_DATA_PIVOT_MIN
+ *     and GDA_DATA_PIVOT_MAX aggregates
+ *   - SUM (field), COUNT (field) for the GDA_DATA_PIVOT_AVG aggregate
+ * or, if there is no data field, a COUNT (*) column.
  */
-gboolean
-gda_data_pivot_populate (GdaDataPivot *pivot, GError **error)
+static gchar *
+build_select_sql (GdaDataPivot *pivot, const gchar *source, gboolean grouped)
 {
-	gboolean retval = FALSE;
-	g_return_val_if_fail (GDA_IS_DATA_PIVOT (pivot), FALSE);
 	GdaDataPivotPrivate *priv = gda_data_pivot_get_instance_private (pivot);
-
-	if (!priv->row_fields || (priv->row_fields->len == 0)) {
-		g_set_error (error, GDA_DATA_PIVOT_ERROR, GDA_DATA_PIVOT_USAGE_ERROR,
-			     "%s", _("No row field defined"));
-		return FALSE;
-	}
-
-	clean_previous_population (pivot);
-
-	/*
-	 * create data model extracted using the virtual connection.
-	 * The resulting data model's columns are:
-	 *   - for priv->row_fields: 0 to priv->row_fields->len - 1
-	 *   - for priv->column_fields:
-	 *     priv->row_fields->len to priv->row_fields->len + priv->column_fields->len - 1
-	 *   - for priv->data_fields: priv->row_fields->len + priv->column_fields->len to priv->row_fields->len + priv->column_fields->len + priv->data_fields->len - 1
-	 */
 	GString *string;
-	guint i;
+	guint i, ngroup;
+
 	string = g_string_new ("SELECT ");
 	for (i = 0; i < priv->row_fields->len; i++) {
 		gchar *part;
@@ -1541,6 +1599,7 @@ gda_data_pivot_populate (GdaDataPivot *pivot, GError **error)
 			g_string_append (string, ", ");
 		g_string_append (string, part);
 	}
+	ngroup = priv->row_fields->len;
 	if (priv->column_fields) {
 		for (i = 0; i < priv->column_fields->len; i++) {
 			gchar *part;
@@ -1548,32 +1607,417 @@ gda_data_pivot_populate (GdaDataPivot *pivot, GError **error)
 			g_string_append (string, ", ");
 			g_string_append (string, part);
 		}
+		ngroup += priv->column_fields->len;
 	}
-	if (priv->data_fields) {
+	if (priv->data_fields && (priv->data_fields->len > 0)) {
 		for (i = 0; i < priv->data_fields->len; i++) {
-			gchar *part;
-			part = g_array_index (priv->data_fields, gchar *, i);
-			g_string_append (string, ", ");
-			g_string_append (string, part);
+			if (grouped) {
+				const gchar *expr;
+				expr = g_array_index (priv->data_exprs, gchar *, i);
+				switch (g_array_index (priv->data_aggregates, GdaDataPivotAggregate, i)) {
+				case GDA_DATA_PIVOT_AVG:
+					g_string_append_printf (string, ", SUM (%s), COUNT (%s)", expr, expr);
+					break;
+				case GDA_DATA_PIVOT_COUNT:
+					g_string_append_printf (string, ", COUNT (%s)", expr);
+					break;
+				case GDA_DATA_PIVOT_MAX:
+					g_string_append_printf (string, ", MAX (%s)", expr);
+					break;
+				case GDA_DATA_PIVOT_MIN:
+					g_string_append_printf (string, ", MIN (%s)", expr);
+					break;
+				case GDA_DATA_PIVOT_SUM:
+					g_string_append_printf (string, ", SUM (%s)", expr);
+					break;
+				default:
+					g_assert_not_reached ();
+				}
+			}
+			else {
+				gchar *part;
+				part = g_array_index (priv->data_fields, gchar *, i);
+				g_string_append (string, ", ");
+				g_string_append (string, part);
+			}
 		}
 	}
-	g_string_append (string, " FROM " TABLE_NAME);
-	
-	GdaStatement *stmt;
-	stmt = gda_connection_parse_sql_string (priv->vcnc, string->str, NULL, NULL);
-	g_string_free (string, TRUE);
-	if (!stmt) {
-		g_set_error (error, GDA_DATA_PIVOT_ERROR, GDA_DATA_PIVOT_INTERNAL_ERROR,
-			     "%s", _("Could not get information from source data model"));
-		return FALSE;
+	else if (grouped)
+		g_string_append (string, ", COUNT (*)");
+
+	g_string_append (string, " FROM ");
+	g_string_append (string, source);
+
+	if (grouped) {
+		g_string_append (string, " GROUP BY ");
+		for (i = 0; i < ngroup; i++) {
+			if (i != 0)
+				g_string_append (string, ", ");
+			g_string_append_printf (string, "%u", i + 1);
+		}
 	}
 
+	return g_string_free (string, FALSE);
+}
+
+/*
+ * Executes the SELECT statement built by build_select_sql() using @cnc
+ *
+ * Returns: (transfer full): a new cursor based #GdaDataModel, or %NULL if an error occurred
+ */
+static GdaDataModel *
+execute_select (GdaDataPivot *pivot, GdaConnection *cnc, const gchar *source, gboolean grouped)
+{
+	GdaStatement *stmt;
 	GdaDataModel *model;
-	model = gda_connection_statement_execute_select_full (priv->vcnc, stmt, NULL,
+	gchar *sql;
+
+	sql = build_select_sql (pivot, source, grouped);
+	stmt = gda_connection_parse_sql_string (cnc, sql, NULL, NULL);
+	g_free (sql);
+	if (!stmt)
+		return NULL;
+
+	model = gda_connection_statement_execute_select_full (cnc, stmt, NULL,
 							      GDA_STATEMENT_MODEL_CURSOR_FORWARD,
-							      //GDA_STATEMENT_MODEL_RANDOM_ACCESS,
 							      NULL, NULL);
 	g_object_unref (stmt);
+	return model;
+}
+
+/*
+ * If @pivot's source data model is the fresh result of a SELECT statement, then computes the
+ * aggregates using that statement as a sub select, directly by the connection which executed it,
+ * avoiding transferring all the source data.
+ *
+ * The source data model must not have been read nor modified (see _gda_data_select_is_fresh()), as
+ * re-executing its SELECT statement could otherwise produce different data. The SUM, MIN and MAX
+ * aggregates must also be computed on columns of the source data model, so their results can be
+ * converted back to the type of those columns (see partial_value_cast()). The statement
+ * is executed as a #GdaStatement so it is rendered by the connection's provider, using its own SQL
+ * dialect.
+ *
+ * Returns: (transfer full): a new #GdaDataModel, or %NULL if the aggregates could not be computed that way
+ */
+static GdaDataModel *
+execute_select_on_source (GdaDataPivot *pivot)
+{
+	GdaDataPivotPrivate *priv = gda_data_pivot_get_instance_private (pivot);
+	GdaConnection *cnc;
+	GdaStatement *stmt = NULL, *gstmt;
+	GdaSqlStatement *sqlst, *subsqlst;
+	GdaSqlStatementSelect *sel;
+	GdaSqlSelectTarget *target;
+	GdaSqlParser *parser;
+	GdaSet *params = NULL;
+	GdaDataModel *model = NULL;
+	gchar *sql;
+
+	if (!GDA_IS_DATA_SELECT (priv->model) ||
+	    ! _gda_data_select_is_fresh (GDA_DATA_SELECT (priv->model)))
+		return NULL;
+	if (priv->data_fields) {
+		guint i;
+		for (i = 0; i < priv->data_fields->len; i++) {
+			GdaDataPivotAggregate aggregate;
+			aggregate = g_array_index (priv->data_aggregates, GdaDataPivotAggregate, i);
+			if (((aggregate == GDA_DATA_PIVOT_SUM) || (aggregate == GDA_DATA_PIVOT_MIN) ||
+			     (aggregate == GDA_DATA_PIVOT_MAX)) &&
+			    (g_array_index (priv->data_types, GType, i) == G_TYPE_INVALID))
+				return NULL;
+		}
+	}
+	cnc = gda_data_select_get_connection (GDA_DATA_SELECT (priv->model));
+	if (!cnc || !gda_connection_is_opened (cnc))
+		return NULL;
+
+	g_object_get (priv->model, "select-stmt", &stmt, "exec-params", &params, NULL);
+	if (!stmt) {
+		if (params)
+			g_object_unref (params);
+		return NULL;
+	}
+	g_object_get (stmt, "structure", &subsqlst, NULL);
+	g_object_unref (stmt);
+	if (!subsqlst || ((subsqlst->stmt_type != GDA_SQL_STATEMENT_SELECT) &&
+			  (subsqlst->stmt_type != GDA_SQL_STATEMENT_COMPOUND)))
+		goto out;
+
+	/* the fields have been rendered using the generic SQL dialect, see gda_data_pivot_add_field() */
+	sql = build_select_sql (pivot, TABLE_NAME, TRUE);
+	parser = gda_sql_parser_new ();
+	gstmt = gda_sql_parser_parse_string (parser, sql, NULL, NULL);
+	g_object_unref (parser);
+	g_free (sql);
+	if (!gstmt)
+		goto out;
+	g_object_get (gstmt, "structure", &sqlst, NULL);
+	g_object_unref (gstmt);
+
+	/* replace the TABLE_NAME target with the source's SELECT statement */
+	g_free (sqlst->sql);
+	sqlst->sql = NULL;
+	sel = (GdaSqlStatementSelect*) sqlst->contents;
+	g_assert (sel->from && sel->from->targets);
+	target = (GdaSqlSelectTarget*) sel->from->targets->data;
+	g_free (target->table_name);
+	target->table_name = NULL;
+	g_free (target->as);
+	target->as = g_strdup (TABLE_NAME);
+	gda_sql_expr_free (target->expr);
+	target->expr = gda_sql_expr_new (GDA_SQL_ANY_PART (target));
+	target->expr->select = subsqlst->contents;
+	GDA_SQL_ANY_PART (target->expr->select)->parent = GDA_SQL_ANY_PART (target->expr);
+	subsqlst->contents = NULL;
+
+	gstmt = g_object_new (GDA_TYPE_STATEMENT, "structure", sqlst, NULL);
+	gda_sql_statement_free (sqlst);
+	model = gda_connection_statement_execute_select_full (cnc, gstmt, params,
+							      GDA_STATEMENT_MODEL_CURSOR_FORWARD,
+							      NULL, NULL);
+	g_object_unref (gstmt);
+
+ out:
+	if (subsqlst)
+		gda_sql_statement_free (subsqlst);
+	if (params)
+		g_object_unref (params);
+	return model;
+}
+
+static gint64
+value_get_count (const GValue *value)
+{
+	GValue tmp = G_VALUE_INIT;
+	gint64 count = 0;
+
+	if (G_VALUE_TYPE (value) == G_TYPE_INT64)
+		return g_value_get_int64 (value);
+	else if (G_VALUE_TYPE (value) == G_TYPE_INT)
+		return g_value_get_int (value);
+
+	g_value_init (&tmp, G_TYPE_INT64);
+	if (g_value_type_transformable (G_VALUE_TYPE (value), G_TYPE_INT64) &&
+	    g_value_transform (value, &tmp))
+		count = g_value_get_int64 (&tmp);
+	g_value_unset (&tmp);
+	return count;
+}
+
+/*
+ * Reads from @iter the aggregate computed by the database for a data field which starts at column @col
+ * (see build_select_sql()), and sets @out_value and @out_count for aggregate_handle_partial_value().
+ *
+ * @tmp_value is used to store a converted value, if necessary: the COUNT (*) value when
+ * @no_data_field is %TRUE (it is then accumulated as integers), or a #GdaNumeric returned by the
+ * database (it is then accumulated as a double).
+ */
+static gboolean
+iter_get_partial_value (GdaDataModelIter *iter, gint col, GdaDataPivotAggregate aggregate,
+			gboolean no_data_field, const GValue **out_value, gint64 *out_count,
+			GValue *tmp_value, GError **error)
+{
+	const GValue *cvalue;
+	cvalue = gda_data_model_iter_get_value_at_e (iter, col, error);
+	if (!cvalue)
+		return FALSE;
+
+	*out_value = cvalue;
+	*out_count = 1;
+	if (no_data_field) {
+		*out_count = value_get_count (cvalue);
+		if (*out_count > G_MAXINT) {
+			g_set_error (error, GDA_DATA_PIVOT_ERROR, GDA_DATA_PIVOT_OVERFLOW_ERROR,
+				     "%s", _("Integer overflow"));
+			return FALSE;
+		}
+		if (G_IS_VALUE (tmp_value))
+			g_value_unset (tmp_value);
+		g_value_init (tmp_value, G_TYPE_INT);
+		g_value_set_int (tmp_value, (gint) *out_count);
+		*out_value = tmp_value;
+		return TRUE;
+	}
+	else if (aggregate == GDA_DATA_PIVOT_COUNT)
+		*out_count = value_get_count (cvalue);
+	else if (aggregate == GDA_DATA_PIVOT_AVG) {
+		const GValue *nvalue;
+		nvalue = gda_data_model_iter_get_value_at_e (iter, col + 1, error);
+		if (!nvalue)
+			return FALSE;
+		*out_count = value_get_count (nvalue);
+	}
+
+	if (G_VALUE_TYPE (cvalue) == GDA_TYPE_NULL)
+		*out_value = NULL;
+	else if (G_VALUE_TYPE (cvalue) == GDA_TYPE_NUMERIC) {
+		if (G_IS_VALUE (tmp_value))
+			g_value_unset (tmp_value);
+		g_value_init (tmp_value, G_TYPE_DOUBLE);
+		g_value_set_double (tmp_value,
+				    gda_numeric_get_double (gda_value_get_numeric (cvalue)));
+		*out_value = tmp_value;
+	}
+	return TRUE;
+}
+
+/*
+ * Converts @value, a SUM, MIN or MAX aggregate computed by the database, to @type, the type of the
+ * source column it has been computed on, so the result has the same type as when the source data
+ * is read row by row (databases usually compute the SUM of integers as a 64 bits integer, for
+ * example).
+ *
+ * @tmp_value is used to store the converted value. Values of types which can't be aggregated row by
+ * row are returned as is.
+ *
+ * Returns: the value to take into account, or %NULL if it does not fit into @type
+ */
+static const GValue *
+partial_value_cast (const GValue *value, GType type, GValue *tmp_value, GError **error)
+{
+	GValue tmp = G_VALUE_INIT;
+
+	if (G_VALUE_TYPE (value) == type)
+		return value;
+
+	if ((type == G_TYPE_FLOAT) || (type == G_TYPE_DOUBLE)) {
+		gdouble dval;
+		g_value_init (&tmp, G_TYPE_DOUBLE);
+		if (! g_value_type_transformable (G_VALUE_TYPE (value), G_TYPE_DOUBLE) ||
+		    ! g_value_transform (value, &tmp))
+			return value;
+		dval = g_value_get_double (&tmp);
+		if (G_IS_VALUE (tmp_value))
+			g_value_unset (tmp_value);
+		if (type == G_TYPE_DOUBLE) {
+			g_value_init (tmp_value, G_TYPE_DOUBLE);
+			g_value_set_double (tmp_value, dval);
+			return tmp_value;
+		}
+		if ((dval > G_MAXFLOAT) || (dval < -G_MAXFLOAT))
+			goto overflow;
+		g_value_init (tmp_value, G_TYPE_FLOAT);
+		g_value_set_float (tmp_value, (gfloat) dval);
+		return tmp_value;
+	}
+
+	gint64 min, max, ival;
+	if (type == G_TYPE_INT) {
+		min = G_MININT;
+		max = G_MAXINT;
+	}
+	else if (type == G_TYPE_UINT) {
+		min = 0;
+		max = G_MAXUINT;
+	}
+	else if ((type == G_TYPE_INT64) || (type == G_TYPE_UINT64)) {
+		min = (type == G_TYPE_INT64) ? G_MININT64 : 0;
+		max = G_MAXINT64;
+	}
+	else if (type == G_TYPE_CHAR) {
+		min = G_MININT8;
+		max = G_MAXINT8;
+	}
+	else if (type == G_TYPE_UCHAR) {
+		min = 0;
+		max = G_MAXUINT8;
+	}
+	else if (type == GDA_TYPE_SHORT) {
+		min = G_MINSHORT;
+		max = G_MAXSHORT;
+	}
+	else if (type == GDA_TYPE_USHORT) {
+		min = 0;
+		max = G_MAXUSHORT;
+	}
+	else
+		return value;
+
+	g_value_init (&tmp, G_TYPE_INT64);
+	if (! g_value_type_transformable (G_VALUE_TYPE (value), G_TYPE_INT64) ||
+	    ! g_value_transform (value, &tmp))
+		return value;
+	ival = g_value_get_int64 (&tmp);
+	if ((ival < min) || (ival > max))
+		goto overflow;
+
+	if (G_IS_VALUE (tmp_value))
+		g_value_unset (tmp_value);
+	if (type == GDA_TYPE_SHORT)
+		gda_value_set_short (tmp_value, (gshort) ival);
+	else if (type == GDA_TYPE_USHORT)
+		gda_value_set_ushort (tmp_value, (gushort) ival);
+	else {
+		g_value_init (tmp_value, type);
+		if (type == G_TYPE_INT)
+			g_value_set_int (tmp_value, (gint) ival);
+		else if (type == G_TYPE_UINT)
+			g_value_set_uint (tmp_value, (guint) ival);
+		else if (type == G_TYPE_INT64)
+			g_value_set_int64 (tmp_value, ival);
+		else if (type == G_TYPE_UINT64)
+			g_value_set_uint64 (tmp_value, (guint64) ival);
+		else if (type == G_TYPE_CHAR)
+			g_value_set_schar (tmp_value, (gint8) ival);
+		else
+			g_value_set_uchar (tmp_value, (guchar) ival);
+	}
+	return tmp_value;
+
+ overflow:
+	g_set_error (error, GDA_DATA_PIVOT_ERROR, GDA_DATA_PIVOT_OVERFLOW_ERROR,
+		     "%s", _("Integer overflow"));
+	return NULL;
+}
+
+/**
+ * gda_data_pivot_populate:
+ * @pivot: a #GdaDataPivot object
+ * @error: (nullable): ta place to store errors, or %NULL
+ *
+ * Acutally populates @pivot by analysing the data from the provided data model.
+ *
+ * The aggregates are computed using a GROUP BY query, executed by the connection which produced
+ * the source data model if it is a #GdaDataSelect (so the source data does not need to be
+ * transferred) if it has not been read yet, or by an internal virtual connection otherwise. The
+ * data types of the aggregated values are the same as if the source data was read row by row
+ * (for example the SUM of integers is an integer).
+ *
+ * Returns: %TRUE if no error occurred.
+ *
+ * Since: 5.0
+ */
+gboolean
+gda_data_pivot_populate (GdaDataPivot *pivot, GError **error)
+{
+	gboolean retval = FALSE;
+	g_return_val_if_fail (GDA_IS_DATA_PIVOT (pivot), FALSE);
+	GdaDataPivotPrivate *priv = gda_data_pivot_get_instance_private (pivot);
+
+	if (!priv->row_fields || (priv->row_fields->len == 0)) {
+		g_set_error (error, GDA_DATA_PIVOT_ERROR, GDA_DATA_PIVOT_USAGE_ERROR,
+			     "%s", _("No row field defined"));
+		return FALSE;
+	}
+
+	clean_previous_population (pivot);
+
+	/*
+	 * create data model extracted from the source data model, see build_select_sql()
+	 * for the resulting data model's columns. The aggregates are preferably computed by
+	 * the database which holds the source data (if any), then by the virtual connection,
+	 * and if none of these is possible, the source data is read row by row.
+	 */
+	GdaDataModel *model;
+	gboolean grouped = TRUE;
+	guint i;
+	model = execute_select_on_source (pivot);
+	if (!model)
+		model = execute_select (pivot, priv->vcnc, TABLE_NAME, TRUE);
+	if (!model) {
+		grouped = FALSE;
+		model = execute_select (pivot, priv->vcnc, TABLE_NAME, FALSE);
+	}
 	if (!model) {
 		g_set_error (error, GDA_DATA_PIVOT_ERROR, GDA_DATA_PIVOT_INTERNAL_ERROR,
 			     "%s", _("Could not get information from source data model"));
@@ -1632,6 +2076,30 @@ gda_data_pivot_populate (GdaDataPivot *pivot, GError **error)
 	data_hash = g_hash_table_new_full (cell_data_hash, cell_data_equal,
 					   (GDestroyNotify) cell_data_free, NULL);
 
+	GArray *data_cols; /* array of gint, the column in @model of each data field */
+	GValue one_value = G_VALUE_INIT; /* to count rows when there is no data field */
+	GValue tmp_value = G_VALUE_INIT; /* see iter_get_partial_value() */
+	GValue cast_value = G_VALUE_INIT; /* see partial_value_cast() */
+	gint dcol;
+	data_cols = g_array_new (FALSE, FALSE, sizeof (gint));
+	dcol = priv->row_fields->len;
+	if (priv->column_fields)
+		dcol += priv->column_fields->len;
+	if (priv->data_fields) {
+		for (i = 0; i < priv->data_fields->len; i++) {
+			g_array_append_val (data_cols, dcol);
+			if (grouped && (g_array_index (priv->data_aggregates, GdaDataPivotAggregate, i) ==
+					GDA_DATA_PIVOT_AVG))
+				dcol += 2;
+			else
+				dcol ++;
+		}
+	}
+	if (data_cols->len == 0)
+		g_array_append_val (data_cols, dcol);
+	g_value_init (&one_value, G_TYPE_INT);
+	g_value_set_int (&one_value, 1);
+
 	for (;gda_data_model_iter_move_next (iter);) {
 		/*
 		 * Row handling
@@ -1744,18 +2212,23 @@ gda_data_pivot_populate (GdaDataPivot *pivot, GError **error)
 						g_free (tmp);
 					}
 					if ((di >= 0) && (dimax > 0)) {
-						GdaColumn *column;
-						gint vcol;
-						vcol = priv->row_fields->len + di;
+						const gchar *dname;
+						if (grouped) {
+							/* aggregated columns are not named after the data fields */
+							dname = g_array_index (priv->data_aliases, gchar*, di);
+							if (!dname)
+								dname = g_array_index (priv->data_exprs, gchar*, di);
+						}
+						else {
+							GdaColumn *column;
+							column = gda_data_model_describe_column (model,
+												 g_array_index (data_cols, gint, di));
+							dname = gda_column_get_name (column);
+						}
 						if (priv->column_fields)
-							vcol += priv->column_fields->len;
-						column = gda_data_model_describe_column (model, vcol);
-						if (priv->column_fields)
-							g_string_append_printf (name, "[%s]",
-										gda_column_get_name (column));
+							g_string_append_printf (name, "[%s]", dname);
 						else
-							g_string_append (name,
-									 gda_column_get_name (column));	
+							g_string_append (name, dname);
 					}
 
 					column = gda_column_new ();
@@ -1780,29 +2253,50 @@ gda_data_pivot_populate (GdaDataPivot *pivot, GError **error)
 							     colindex);
 				}
 				
-				/* compute value to take into account */
-				GValue *value = NULL;
-				if (di >= 0) {
+				/* compute value to take into account, and the number of
+				 * source values it represents */
+				const GValue *value = NULL;
+				gint64 count = 1;
+				GError *cast_error = NULL;
+				if (grouped) {
+					GError *lerror = NULL;
+					gint vcol;
+					vcol = g_array_index (data_cols, gint, di >= 0 ? di : 0);
+					if (! iter_get_partial_value (iter, vcol, aggregate, di < 0,
+								      &value, &count, &tmp_value, &lerror)) {
+						g_propagate_error (error, lerror);
+						goto out;
+					}
+					if (value && (di >= 0) &&
+					    ((aggregate == GDA_DATA_PIVOT_SUM) || (aggregate == GDA_DATA_PIVOT_MIN) ||
+					     (aggregate == GDA_DATA_PIVOT_MAX)) &&
+					    (g_array_index (priv->data_types, GType, di) != G_TYPE_INVALID)) {
+						const GValue *cvalue;
+						cvalue = partial_value_cast (value,
+									     g_array_index (priv->data_types, GType, di),
+									     &cast_value, &cast_error);
+						/* on overflow, the cell is set in error below */
+						if (cvalue)
+							value = cvalue;
+					}
+				}
+				else if (di >= 0) {
 					const GValue *cvalue;
 					GError *lerror = NULL;
 					gint vcol;
-					vcol = priv->row_fields->len + di;
-					if (priv->column_fields)
-						vcol += priv->column_fields->len;
+					vcol = g_array_index (data_cols, gint, di);
 					cvalue = gda_data_model_iter_get_value_at_e (iter, vcol, &lerror);
 					if (!cvalue || lerror) {
 						g_propagate_error (error, lerror);
 						goto out;
 					}
 					if (G_VALUE_TYPE (cvalue) != GDA_TYPE_NULL)
-						value = gda_value_copy (cvalue);
-				}
-				else {
-					value = gda_value_new (G_TYPE_INT);
-					g_value_set_int (value, 1);
+						value = cvalue;
 				}
+				else
+					value = &one_value;
 
-				if (value) {
+				if (value && (count > 0)) {
 					/* accumulate data */
 					CellData ccdata, *pcdata;
 					ccdata.row = *rowindex;
@@ -1822,15 +2316,27 @@ gda_data_pivot_populate (GdaDataPivot *pivot, GError **error)
 						pcdata->aggregate = aggregate;
 						g_hash_table_insert (data_hash, pcdata, pcdata);
 					}
-					if (!aggregate_handle_new_value (pcdata, value)) {
+					if (cast_error) {
+						if (!pcdata->error)
+							pcdata->error = cast_error;
+						else
+							g_error_free (cast_error);
+						cast_error = NULL;
+					}
+					if (grouped)
+						aggregate_handle_partial_value (pcdata, value, count);
+					else if (!aggregate_handle_new_value (pcdata, value)) {
+						GValue *copy;
 						if (!pcdata->values)
 							pcdata->values = g_array_new (FALSE, FALSE,
 										      sizeof (GValue*));
-						g_array_append_val (pcdata->values, value);
+						copy = gda_value_copy (value);
+						g_array_append_val (pcdata->values, copy);
 					}
 					/*g_print ("row %d col %d => [%s]\n", pcdata->row, pcdata->col,
 					  gda_value_stringify (value));*/
 				}
+				g_clear_error (&cast_error);
 			}
 		}
 	}
@@ -1921,6 +2427,13 @@ gda_data_pivot_populate (GdaDataPivot *pivot, GError **error)
 	if (data_hash)
 		g_hash_table_destroy (data_hash);
 
+	g_array_free (data_cols, TRUE);
+	g_value_unset (&one_value);
+	if (G_IS_VALUE (&tmp_value))
+		g_value_unset (&tmp_value);
+	if (G_IS_VALUE (&cast_value))
+		g_value_unset (&cast_value);
+
 	if (first_rows) {
 		guint i;
 		for (i = 0; i < first_rows->len; i++) {
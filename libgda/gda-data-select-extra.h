@@ -26,6 +26,7 @@
 #include <libgda/providers-support/gda-pstmt.h>
 #include <sql-parser/gda-sql-statement.h>
 #include <libgda/gda-data-select.h>
+#include <libgda/gda-connection-metrics.h>
 
 G_BEGIN_DECLS
 
@@ -60,6 +61,16 @@ GdaDataSelectInternals *_gda_data_select_internals_steal (GdaDataSelect *model);
 void                    _gda_data_select_internals_paste (GdaDataSelect *model, GdaDataSelectInternals *inter);
 void                    _gda_data_select_internals_free (GdaDataSelectInternals *inter);
 
+void                    _gda_data_select_set_metrics_entry (GdaDataSelect *model, GdaConnectionMetricsEntry *entry,
+							    gint64 start_time);
+
+gboolean                _gda_data_select_cursor_move_next (GdaDataSelect *model, gint *row, GdaRow **prow,
+							   GError **error);
+gboolean                _gda_data_select_cursor_get_current (GdaDataSelect *model, gint *row, GdaRow **prow);
+void                    _gda_data_select_cursor_sync_iter (GdaDataSelect *model, GdaRow *prow);
+gboolean                _gda_data_select_has_local_modifs (GdaDataSelect *model);
+gboolean                _gda_data_select_is_fresh (GdaDataSelect *model);
+
 G_END_DECLS
 
 #endif
@@ -35,15 +35,18 @@
 #include "providers-support/gda-data-select-priv.h"
 #include "gda-data-select-extra.h"
 #include "gda-row.h"
+#include "gda-row-private.h"
 #include "providers-support/gda-pstmt.h"
 #include <libgda/gda-statement.h>
 #include <libgda/gda-holder.h>
 #include <libgda/gda-connection.h>
 #include <libgda/gda-connection-internal.h>
 #include <libgda/gda-util.h>
+#include <libgda/gda-trace-private.h>
 #include <sql-parser/gda-sql-parser.h>
 #include <gda-statement-priv.h>
 #include <thread-wrapper/gda-worker.h>
+#include <libgda/gda-server-provider.h>
 #include <libgda/gda-server-provider-private.h> /* for gda_server_provider_get_real_main_context () */
 
 #define CLASS(x) (GDA_DATA_SELECT_CLASS (G_OBJECT_GET_CLASS (x)))
@@ -57,6 +60,20 @@ typedef struct {
 
 static void delayed_select_stmt_free (DelayedSelectStmt *dstmt);
 
+/*
+ * A modification which has not yet been sent to the database, when the "deferred-write"
+ * property is set
+ */
+typedef struct {
+	ModType       type;
+	gint          int_row; /* internal row number */
+	GdaStatement *stmt;
+	GdaSet       *params; /* copy of the modif_set when the modification was made */
+	gboolean      keyed; /* for INS_QUERY: TRUE if the inserted row's key is known without executing @stmt */
+} PendingModif;
+
+static void pending_modif_free (PendingModif *pm);
+
 /*
  * To go from an "external" row number to an "internal" row number and then to a GdaRow,
  * the following steps are required:
@@ -88,6 +105,10 @@ typedef struct {
 					   * sorted by row number (row numbers are internal row numbers )*/
 	GHashTable             *upd_rows; /* key = internal row number + 1, value = a DelayedSelectStmt pointer */
 
+	/* modifications not yet sent to the database, see the "deferred-write" property */
+	gboolean                deferred_write;
+	GSList                 *pending_modifs; /* list of PendingModif, most recent first */
+
 	gboolean                notify_changes;
 	gboolean                ref_count; /* when drop to 0 => free can be done */
 
@@ -139,8 +160,44 @@ typedef struct {
   GdaPStmt               *prep_stmt; /* use the "prepared-stmt" property to set this */
 	gint                    nb_stored_rows; /* number of GdaRow objects currently stored */
 	gint                    advertized_nrows; /* set when the number of rows becomes known, -1 until then */
+
+	/* statement metrics, see the GdaConnection:statement-metrics property */
+	GdaConnectionMetricsEntry *metrics_entry;
+	gint64                  metrics_start_time;
+	gboolean                metrics_first_row_done;
+	gboolean                metrics_fetch_all_done;
+
+	/* memory page in which rows' strings are currently copied, see gda_data_select_row_set_string() */
+	struct _RowArenaPage   *arena_page;
+
+	/* memory limits, see gda_data_select_check_limits() */
+	gboolean                limits_init;
+	guint                   max_rows;
+	guint64                 max_bytes;
+	guint64                 stored_bytes; /* estimated size of the stored rows, computed only if @max_bytes > 0 */
+	gboolean                limit_reached;
 } GdaDataSelectPrivate;
 
+/*
+ * Memory page in which the strings of several rows are copied, to avoid allocating and freeing
+ * each of them separately. Each row using a page holds a reference on it, see _gda_row_hold_data().
+ */
+#define ROW_ARENA_PAGE_SIZE 65536
+#define ROW_ARENA_MAX_STRING_SIZE (ROW_ARENA_PAGE_SIZE / 16)
+
+typedef struct _RowArenaPage {
+	gint   ref_count;
+	gsize  used;
+	gchar  data [ROW_ARENA_PAGE_SIZE];
+} RowArenaPage;
+
+static void
+row_arena_page_unref (RowArenaPage *page)
+{
+	if (g_atomic_int_dec_and_test (&(page->ref_count)))
+		g_free (page);
+}
+
 G_DEFINE_TYPE_WITH_CODE (GdaDataSelect, gda_data_select, G_TYPE_OBJECT,
 												 G_ADD_PRIVATE (GdaDataSelect)
 												 G_IMPLEMENT_INTERFACE (GDA_TYPE_DATA_MODEL, gda_data_select_data_model_init))
@@ -158,9 +215,13 @@ enum
 	PROP_UPD_QUERY,
 	PROP_DEL_QUERY,
 	PROP_SEL_STMT,
-	PROP_EXEC_DELAY
+	PROP_EXEC_DELAY,
+	PROP_DEFERRED_WRITE
 };
 
+static void metrics_row_fetched (GdaDataSelect *model);
+static void metrics_all_rows_fetched (GdaDataSelect *model);
+
 /* API to handle using a GdaWorker */
 static gint      _gda_data_select_fetch_nb_rows (GdaDataSelect *model);
 static gboolean  _gda_data_select_fetch_random  (GdaDataSelect *model, GdaRow **prow, gint rownum, GError **error);
@@ -206,6 +267,11 @@ static gboolean check_data_model_for_updates (GdaDataSelect *imodel,
                               gint col,
                               const GValue *value,
                               GError **error);
+static gboolean is_write_deferred (GdaDataSelect *model);
+static gboolean flush_if_not_deferred (GdaDataSelect *model, GError **error);
+static gboolean flush_if_unkeyed_insert (GdaDataSelect *model, gint int_row, GError **error);
+static PendingModif *pending_modif_add (GdaDataSelect *model, ModType type, gint int_row, GdaStatement *stmt);
+static GdaRow *create_pending_row (GdaDataSelect *model, gint row, const GValue **new_values, GError **error);
 static gboolean vector_set_value_at (GdaDataSelect *imodel, BVector *bv,
                                      GdaDataModelIter *iter, gint row,
                                      GError **error);
@@ -344,6 +410,21 @@ gda_data_select_class_init (GdaDataSelectClass *klass)
 							      0., G_MAXDOUBLE, 0.,
 							      G_PARAM_READABLE | G_PARAM_WRITABLE));
 
+	/**
+	 * GdaDataSelect:deferred-write:
+	 *
+	 * When %TRUE, the modifications made to the data model are not immediately propagated to the
+	 * database but kept until gda_data_select_flush() is called. Pending modifications are lost if the
+	 * data model is destroyed or re-run before being flushed.
+	 *
+	 * This property is only used for random access data models.
+	 *
+	 * Since: 6.0
+	 */
+	g_object_class_install_property (object_class, PROP_DEFERRED_WRITE,
+					 g_param_spec_boolean ("deferred-write", NULL, NULL,
+							       FALSE, G_PARAM_READABLE | G_PARAM_WRITABLE));
+
 	/* virtual functions */
 	object_class->dispose = gda_data_select_dispose;
 	object_class->finalize = gda_data_select_finalize;
@@ -393,6 +474,7 @@ gda_data_select_init (GdaDataSelect *model)
 	priv->sh->columns = NULL;
 	priv->nb_stored_rows = 0;
 	priv->advertized_nrows = -1; /* unknown number of rows */
+	priv->metrics_entry = NULL;
 
 	priv->sh->sel_stmt = NULL;
 	priv->sh->ext_params = NULL;
@@ -418,6 +500,8 @@ gda_data_select_init (GdaDataSelect *model)
 
 	priv->sh->upd_rows = NULL;
 	priv->sh->del_rows = NULL;
+	priv->sh->deferred_write = FALSE;
+	priv->sh->pending_modifs = NULL;
 
 	priv->sh->ref_count = 1;
 
@@ -466,6 +550,10 @@ free_private_shared_data (GdaDataSelect *model)
 			g_array_free (priv->sh->del_rows, TRUE);
 			priv->sh->del_rows = NULL;
 		}
+		if (priv->sh->pending_modifs) {
+			g_slist_free_full (priv->sh->pending_modifs, (GDestroyNotify) pending_modif_free);
+			priv->sh->pending_modifs = NULL;
+		}
 		if (priv->sh->rows) {
 			g_ptr_array_unref (priv->sh->rows);
 			priv->sh->rows = NULL;
@@ -497,6 +585,14 @@ gda_data_select_dispose (GObject *object)
 
 	/* free memory */
 	if (priv) {
+		if (priv->metrics_entry) {
+			_gda_connection_metrics_entry_unref (priv->metrics_entry);
+			priv->metrics_entry = NULL;
+		}
+		if (priv->arena_page) {
+			row_arena_page_unref (priv->arena_page);
+			priv->arena_page = NULL;
+		}
 		if (priv->exceptions) {
 			g_ptr_array_unref (priv->exceptions);
 			priv->exceptions = NULL;
@@ -766,6 +862,9 @@ gda_data_select_set_property (GObject *object,
 		case PROP_EXEC_DELAY:
 			priv->exec_time = g_value_get_double (value);
 			break;
+		case PROP_DEFERRED_WRITE:
+			priv->sh->deferred_write = g_value_get_boolean (value);
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
 			break;
@@ -819,6 +918,9 @@ gda_data_select_get_property (GObject *object,
 		case PROP_EXEC_DELAY:
 			g_value_set_double (value, priv->exec_time);
 			break;
+		case PROP_DEFERRED_WRITE:
+			g_value_set_boolean (value, priv->sh->deferred_write);
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
 			break;
@@ -826,6 +928,49 @@ gda_data_select_get_property (GObject *object,
 	}
 }
 
+/*
+ * Reads the limits applying to @model from its connection and statement, the first time only
+ */
+static void
+init_limits (GdaDataSelect *model)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	GdaStatement *stmt = NULL;
+
+	if (priv->limits_init || !priv->cnc)
+		return;
+	priv->limits_init = TRUE;
+	if (priv->prep_stmt)
+		stmt = gda_pstmt_get_gda_statement (priv->prep_stmt);
+	_gda_connection_get_row_limits (priv->cnc, stmt, &(priv->max_rows), &(priv->max_bytes));
+}
+
+/*
+ * Estimates the memory used by @row's values
+ */
+static guint64
+row_estimate_size (GdaRow *row)
+{
+	guint64 size;
+	gint i, ncols;
+
+	ncols = gda_row_get_length (row);
+	size = sizeof (GObject) + ncols * sizeof (GValue);
+	for (i = 0; i < ncols; i++) {
+		GValue *value;
+		GType type;
+		value = gda_row_get_value (row, i);
+		type = G_VALUE_TYPE (value);
+		if ((type == G_TYPE_STRING) && g_value_get_string (value))
+			size += strlen (g_value_get_string (value)) + 1;
+		else if ((type == GDA_TYPE_BINARY) && gda_value_get_binary (value))
+			size += gda_binary_get_size (gda_value_get_binary (value));
+		else if ((type == GDA_TYPE_BLOB) && gda_value_get_blob (value))
+			size += gda_binary_get_size (gda_blob_get_binary ((GdaBlob*) gda_value_get_blob (value)));
+	}
+	return size;
+}
+
 /**
  * gda_data_select_take_row:
  * @model: a #GdaDataSelect data model
@@ -863,6 +1008,55 @@ gda_data_select_take_row (GdaDataSelect *model, GdaRow *row, gint rownum)
 	g_hash_table_insert (priv->sh->index, ptr, ptr+1);
 	g_ptr_array_add (priv->sh->rows, row);
 	priv->nb_stored_rows = priv->sh->rows->len;
+	init_limits (model);
+	if (priv->max_bytes > 0)
+		priv->stored_bytes += row_estimate_size (row);
+	if (priv->metrics_entry)
+		metrics_row_fetched (model);
+}
+
+/**
+ * gda_data_select_check_limits:
+ * @model: a #GdaDataSelect data model
+ * @error: a place to store errors, or %NULL
+ *
+ * Checks if @model may store more rows (using gda_data_select_take_row()) without exceeding the
+ * limits set by the #GdaConnection:max-rows and #GdaConnection:max-bytes properties of its
+ * connection, or by the #GdaStatement:max-rows and #GdaStatement:max-bytes properties of the executed
+ * statement. Database providers must call this function before fetching each row they intend to
+ * store, and stop fetching rows if it returns %FALSE.
+ *
+ * The first time a limit is reached, the error is also added to @model's exceptions.
+ *
+ * This function is used by database provider's implementations
+ *
+ * Returns: %TRUE if more rows may be stored, and %FALSE if a limit has been reached, with @error set
+ *
+ * Since: 6.0
+ */
+gboolean
+gda_data_select_check_limits (GdaDataSelect *model, GError **error)
+{
+	g_return_val_if_fail (GDA_IS_DATA_SELECT (model), FALSE);
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	GError *lerror = NULL;
+
+	init_limits (model);
+	if ((priv->max_rows > 0) && ((guint) priv->nb_stored_rows >= priv->max_rows))
+		g_set_error (&lerror, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_LIMIT_ERROR,
+			     _("Data model can't hold more than %u rows"), priv->max_rows);
+	else if ((priv->max_bytes > 0) && (priv->stored_bytes >= priv->max_bytes))
+		g_set_error (&lerror, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_LIMIT_ERROR,
+			     _("Data model can't hold more than %" G_GUINT64_FORMAT " bytes"), priv->max_bytes);
+	else
+		return TRUE;
+
+	if (!priv->limit_reached) {
+		priv->limit_reached = TRUE;
+		gda_data_select_add_exception (model, g_error_copy (lerror));
+	}
+	g_propagate_error (error, lerror);
+	return FALSE;
 }
 
 /**
@@ -889,6 +1083,86 @@ gda_data_select_get_stored_row (GdaDataSelect *model, gint rownum)
 		return NULL;
 }
 
+/**
+ * gda_data_select_row_set_string:
+ * @model: a #GdaDataSelect data model
+ * @row: a #GdaRow being filled by @model's implementation
+ * @value: a #GValue of @row
+ * @str: the string to store in @value
+ * @len: the length of @str in bytes, or -1 if @str is NUL terminated
+ *
+ * Sets @value to a copy of @str (which does not need to be NUL terminated if @len is not -1).
+ * Small strings are copied in memory pages shared by the rows created by @model, which avoids
+ * allocating and freeing each of them separately; a page is freed when all the rows using it
+ * have been destroyed. The value's contents is copied as usual if @value is copied.
+ *
+ * This function is used by database provider's implementations when creating rows.
+ *
+ * Since: 6.0
+ */
+void
+gda_data_select_row_set_string (GdaDataSelect *model, GdaRow *row, GValue *value, const gchar *str, gssize len)
+{
+	g_return_if_fail (GDA_IS_DATA_SELECT (model));
+	g_return_if_fail (GDA_IS_ROW (row));
+	g_return_if_fail (value);
+	g_return_if_fail (str);
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	RowArenaPage *page;
+	gchar *copy;
+
+	if (len < 0)
+		len = strlen (str);
+	gda_value_reset_with_type (value, G_TYPE_STRING);
+	if (len >= ROW_ARENA_MAX_STRING_SIZE) {
+		g_value_take_string (value, g_strndup (str, len));
+		return;
+	}
+
+	page = priv->arena_page;
+	if (!page || (page->used + len + 1 > ROW_ARENA_PAGE_SIZE)) {
+		if (page)
+			row_arena_page_unref (page);
+		page = g_malloc (sizeof (RowArenaPage));
+		page->ref_count = 1;
+		page->used = 0;
+		priv->arena_page = page;
+	}
+	if (! _gda_row_holds_data (row, page)) {
+		g_atomic_int_inc (&(page->ref_count));
+		_gda_row_hold_data (row, page, (GDestroyNotify) row_arena_page_unref);
+	}
+
+	copy = page->data + page->used;
+	memcpy (copy, str, len); /* Flawfinder: ignore */
+	copy [len] = 0;
+	page->used += len + 1;
+	g_value_set_static_string (value, copy);
+}
+
+/**
+ * gda_data_select_row_reset:
+ * @model: a #GdaDataSelect data model
+ * @row: a #GdaRow created by @model's implementation
+ *
+ * Sets all the values of @row to NULL and releases the memory pages its strings have been
+ * copied into by gda_data_select_row_set_string(). This function must be called before
+ * filling again a #GdaRow which is reused for several rows (for example in cursor mode),
+ * otherwise @row keeps all the memory pages it has ever used.
+ *
+ * This function is used by database provider's implementations when creating rows.
+ *
+ * Since: 6.0
+ */
+void
+gda_data_select_row_reset (GdaDataSelect *model, GdaRow *row)
+{
+	g_return_if_fail (GDA_IS_DATA_SELECT (model));
+	g_return_if_fail (GDA_IS_ROW (row));
+
+	_gda_row_release_held_data (row);
+}
+
 /**
  * gda_data_select_get_connection:
  * @model: a #GdaDataSelect data model
@@ -2187,6 +2461,149 @@ gda_data_select_iter_next (GdaDataModel *model, GdaDataModelIter *iter)
 	}
 }
 
+/*
+ * _gda_data_select_has_local_modifs:
+ *
+ * Tells if @model's contents may differ from what re-executing its SELECT statement would return,
+ * that is if some rows have been modified, inserted or removed through @model (including modifications
+ * not yet written when writes are deferred).
+ *
+ * Returns: %TRUE if @model has been modified
+ */
+gboolean
+_gda_data_select_has_local_modifs (GdaDataSelect *model)
+{
+	g_return_val_if_fail (GDA_IS_DATA_SELECT (model), FALSE);
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+
+	if (!priv->sh)
+		return FALSE;
+	return (priv->sh->upd_rows && (g_hash_table_size (priv->sh->upd_rows) > 0)) ||
+		(priv->sh->del_rows && (priv->sh->del_rows->len > 0)) ||
+		priv->sh->pending_modifs;
+}
+
+/*
+ * _gda_data_select_is_fresh:
+ *
+ * Tells if no row of @model has been fetched or read yet and @model has not been modified, so
+ * re-executing its SELECT statement is the same as reading @model for the first time.
+ *
+ * Returns: %TRUE if @model is fresh
+ */
+gboolean
+_gda_data_select_is_fresh (GdaDataSelect *model)
+{
+	g_return_val_if_fail (GDA_IS_DATA_SELECT (model), FALSE);
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+
+	if (priv->nb_stored_rows > 0)
+		return FALSE;
+	if (priv->sh && (priv->sh->iter_row != G_MININT))
+		return FALSE;
+	return ! _gda_data_select_has_local_modifs (model);
+}
+
+/*
+ * _gda_data_select_cursor_move_next:
+ *
+ * Same as gda_data_select_iter_next() for a model which does not support random access,
+ * but without updating any iterator: the row is returned in @prow (which is set to %NULL when
+ * the end of the data model is reached) and its number in @row.
+ *
+ * Used by #GdaDataModelCursor.
+ *
+ * Returns: %FALSE if an error occurred
+ */
+gboolean
+_gda_data_select_cursor_move_next (GdaDataSelect *model, gint *row, GdaRow **prow, GError **error)
+{
+	gint target_iter_row;
+	gint int_row;
+
+	g_return_val_if_fail (GDA_IS_DATA_SELECT (model), FALSE);
+	g_return_val_if_fail (row && prow, FALSE);
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	g_return_val_if_fail (CLASS (model)->fetch_next, FALSE);
+
+	*prow = NULL;
+	*row = -1;
+	if ((priv->sh->iter_row == G_MAXINT) || (gda_data_model_get_n_rows ((GdaDataModel*) model) == 0)) {
+		priv->sh->iter_row = G_MAXINT;
+		return TRUE;
+	}
+	else if (priv->sh->iter_row == G_MININT)
+		target_iter_row = 0;
+	else
+		target_iter_row = priv->sh->iter_row + 1;
+
+	int_row = external_to_internal_row (model, target_iter_row, error);
+	if (int_row < 0)
+		return FALSE;
+
+	*prow = gda_data_select_get_stored_row (model, int_row);
+	if (!*prow && !_gda_data_select_fetch_next (model, prow, int_row, error))
+		return FALSE;
+
+	if (*prow) {
+		priv->sh->iter_row = target_iter_row;
+		*row = target_iter_row;
+	}
+	else
+		priv->sh->iter_row = G_MAXINT;
+	return TRUE;
+}
+
+/*
+ * _gda_data_select_cursor_get_current:
+ *
+ * Get the row on which @model's iterator is positioned, for a model which does not support random access:
+ * the row is returned in @prow and its number in @row.
+ *
+ * Used by #GdaDataModelCursor to start reading from that row.
+ *
+ * Returns: %TRUE if @model's iterator is positioned on a row
+ */
+gboolean
+_gda_data_select_cursor_get_current (GdaDataSelect *model, gint *row, GdaRow **prow)
+{
+	g_return_val_if_fail (GDA_IS_DATA_SELECT (model), FALSE);
+	g_return_val_if_fail (row && prow, FALSE);
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+
+	*prow = NULL;
+	*row = -1;
+	if (!priv->iter || (priv->sh->iter_row < 0) || (priv->sh->iter_row == G_MAXINT) ||
+	    !priv->sh->current_prow || (priv->sh->current_prow_row != priv->sh->iter_row))
+		return FALSE;
+	*prow = priv->sh->current_prow;
+	*row = priv->sh->iter_row;
+	return TRUE;
+}
+
+/*
+ * _gda_data_select_cursor_sync_iter:
+ *
+ * Updates @model's iterator after _gda_data_select_cursor_move_next() has been used, so its
+ * holders contain the values of @prow, the row on which @model is now positioned, or is invalidated
+ * if @prow is %NULL (the end of the data model has been reached).
+ */
+void
+_gda_data_select_cursor_sync_iter (GdaDataSelect *model, GdaRow *prow)
+{
+	g_return_if_fail (GDA_IS_DATA_SELECT (model));
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+
+	if (!priv->iter)
+		return;
+	if (prow && (priv->sh->iter_row >= 0) && (priv->sh->iter_row != G_MAXINT))
+		update_iter (model, prow);
+	else {
+		gda_data_model_iter_invalidate_contents (priv->iter);
+		g_object_set (G_OBJECT (priv->iter), "current-row", -1, NULL);
+	}
+}
+
 static gboolean
 gda_data_select_iter_prev (GdaDataModel *model, GdaDataModelIter *iter)
 {
@@ -2751,6 +3168,8 @@ vector_set_value_at (GdaDataSelect *imodel, BVector *bv, GdaDataModelIter *iter,
 			     "%s", _("No UPDATE statement provided"));
 		return FALSE;
 	}
+	if (! flush_if_not_deferred (imodel, error))
+		return FALSE;
 
 	if (iter)
 		row = gda_data_model_iter_get_row (iter);
@@ -2758,6 +3177,8 @@ vector_set_value_at (GdaDataSelect *imodel, BVector *bv, GdaDataModelIter *iter,
 	int_row = external_to_internal_row (imodel, row, error);
 	if (int_row < 0)
 		return FALSE;
+	if (! flush_if_unkeyed_insert (imodel, int_row, error))
+		return FALSE;
 
 	/* compute UPDATE statement */
 	if (! priv->sh->modif_internals->upd_stmts)
@@ -2821,9 +3242,28 @@ vector_set_value_at (GdaDataSelect *imodel, BVector *bv, GdaDataModelIter *iter,
 	g_free (sql);
 #endif
 
-	if (gda_connection_statement_execute_non_select (priv->cnc, stmt,
-							 priv->sh->modif_internals->modif_set,
-							 NULL, error) == -1)
+	GdaRow *pending_row = NULL;
+	if (is_write_deferred (imodel)) {
+		/* the modified row's values are computed now, and the UPDATE statement is only
+		 * executed by gda_data_select_flush() */
+		const GValue **new_values;
+		new_values = g_new0 (const GValue *, ncols);
+		for (i = 0; i < ncols; i++) {
+			str = g_strdup_printf ("+%d", i);
+			holder = gda_set_get_holder (priv->sh->modif_internals->modif_set, str);
+			g_free (str);
+			if (holder && gda_holder_is_valid (holder))
+				new_values [i] = gda_holder_get_value (holder);
+		}
+		pending_row = create_pending_row (imodel, row, new_values, error);
+		g_free (new_values);
+		if (!pending_row)
+			return FALSE;
+		pending_modif_add (imodel, UPD_QUERY, int_row, stmt);
+	}
+	else if (gda_connection_statement_execute_non_select (priv->cnc, stmt,
+							      priv->sh->modif_internals->modif_set,
+							      NULL, error) == -1)
 		return FALSE;
 
 	/* mark that this row has been modified */
@@ -2877,7 +3317,7 @@ vector_set_value_at (GdaDataSelect *imodel, BVector *bv, GdaDataModelIter *iter,
 			}
 		}
 	}
-	dstmt->row = NULL;
+	dstmt->row = pending_row;
 	if (! priv->sh->upd_rows)
 		priv->sh->upd_rows = g_hash_table_new_full (g_int_hash, g_int_equal,
 								g_free,
@@ -2987,47 +3427,245 @@ delayed_select_stmt_free (DelayedSelectStmt *dstmt)
 	g_free (dstmt);
 }
 
-static gboolean
-gda_data_select_set_values (GdaDataModel *model, gint row, GList *values, GError **error)
+/*
+ * Sets @dstmt's SELECT statement and its parameters' values from @last_insert, the values
+ * of the row which has just been inserted
+ */
+static void
+set_dstmt_params_from_last_insert (GdaDataSelect *model, DelayedSelectStmt *dstmt, GdaSet *last_insert)
 {
-	gint i, ncols, nvalues;
-	GdaHolder *holder;
-	gchar *str;
-	GList *list;
-	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (GDA_DATA_SELECT (model));
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
 
+	if (! priv->sh->modif_internals->one_row_select_stmt)
+		return;
+	if (! dstmt->select)
+		dstmt->select = g_object_ref (priv->sh->modif_internals->one_row_select_stmt);
+	if (dstmt->params) {
+		g_object_unref (dstmt->params);
+		dstmt->params = NULL;
+	}
+	gda_statement_get_parameters (dstmt->select, &(dstmt->params), NULL);
+	if (! dstmt->params)
+		return;
 
-	/* arguments check */
-	g_return_val_if_fail (priv, FALSE);
+	GSList *list;
+	if (! priv->sh->modif_internals->insert_to_select_mapping)
+		priv->sh->modif_internals->insert_to_select_mapping =
+			compute_insert_select_params_mapping (dstmt->params, last_insert,
+							      priv->sh->modif_internals->unique_row_condition);
+	if (priv->sh->modif_internals->insert_to_select_mapping) {
+		for (list = gda_set_get_holders (dstmt->params); list; list = list->next) {
+			GdaHolder *holder = GDA_HOLDER (list->data);
+			GdaHolder *eholder;
+			gint pos;
 
-	if (! (priv->sh->usage_flags & GDA_DATA_MODEL_ACCESS_RANDOM)) {
-		g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ACCESS_ERROR,
-			     "%s", _("Data model does only support random access"));
-		return FALSE;
-	}
+			g_assert (param_name_to_int (gda_holder_get_id (holder), &pos, NULL));
 
-	ncols = gda_data_select_get_n_columns (model);
-	nvalues = g_list_length (values);
-	if (nvalues > ncols) {
-		g_set_error (error, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_MISSING_MODIFICATION_STATEMENT_ERROR,
-			     _("Too many values (%d as maximum)"), ncols);
-		return FALSE;
+			eholder = g_slist_nth_data (gda_set_get_holders (last_insert),
+						    priv->sh->modif_internals->insert_to_select_mapping[pos]);
+			if (!eholder ||
+			    ! gda_holder_set_value (holder, gda_holder_get_value (eholder), NULL)) {
+				g_object_unref (dstmt->params);
+				dstmt->params = NULL;
+				break;
+			}
+		}
 	}
+}
 
-	/* BVector */
-	BVector *bv;
-	gboolean has_mods = FALSE;
+/*
+ * Sets @dstmt's SELECT statement and its parameters' values from @new_values, the values of
+ * a row which has not yet been inserted.
+ *
+ * Returns: %TRUE if all the values identifying the row are part of @new_values (i.e. if they
+ * are not computed by the database)
+ */
+static gboolean
+set_dstmt_params_from_values (GdaDataSelect *model, DelayedSelectStmt *dstmt, const GValue **new_values)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	GSList *list;
+	gint ncols;
 
-	bv = g_new (BVector, 1);
-	bv->size = nvalues;
-	bv->data = g_new0 (guchar, bv->size);
-	for (i = 0, list = values; list; i++, list = list->next) {
-		if (list->data) {
-			bv->data[i] = 1;
-			has_mods = TRUE;
+	if (! priv->sh->modif_internals->one_row_select_stmt)
+		return FALSE;
+	dstmt->select = g_object_ref (priv->sh->modif_internals->one_row_select_stmt);
+	gda_statement_get_parameters (dstmt->select, &(dstmt->params), NULL);
+	if (! dstmt->params)
+		return FALSE;
+
+	ncols = gda_data_select_get_n_columns ((GdaDataModel*) model);
+	for (list = gda_set_get_holders (dstmt->params); list; list = list->next) {
+		GdaHolder *holder = GDA_HOLDER (list->data);
+		GdaHolder *iholder = NULL;
+		gint pos;
+
+		if (param_name_to_int (gda_holder_get_id (holder), &pos, NULL) &&
+		    (pos < ncols) && new_values [pos] && !gda_value_is_null (new_values [pos])) {
+			gchar *str;
+			str = g_strdup_printf ("+%d", pos);
+			iholder = gda_set_get_holder (priv->sh->modif_internals->modif_set, str);
+			g_free (str);
+		}
+		if (!iholder ||
+		    !g_slist_find (priv->sh->modif_internals->modif_params[INS_QUERY], iholder) ||
+		    ! gda_holder_set_value (holder, new_values [pos], NULL)) {
+			g_object_unref (dstmt->params);
+			dstmt->params = NULL;
+			return FALSE;
 		}
 	}
-	if (!has_mods) {
+	return TRUE;
+}
+
+static void
+pending_modif_free (PendingModif *pm)
+{
+	g_object_unref (pm->stmt);
+	g_object_unref (pm->params);
+	g_free (pm);
+}
+
+/*
+ * Returns: %TRUE if the modifications made to @model must be kept in memory until
+ * gda_data_select_flush() is called
+ */
+static gboolean
+is_write_deferred (GdaDataSelect *model)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	return priv->sh->deferred_write && (priv->sh->usage_flags & GDA_DATA_MODEL_ACCESS_RANDOM);
+}
+
+/*
+ * Makes sure modifications made while the "deferred-write" property was set are sent to the
+ * database before any new modification is made when that property is not set anymore
+ */
+static gboolean
+flush_if_not_deferred (GdaDataSelect *model, GError **error)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	if (!priv->sh->pending_modifs || is_write_deferred (model))
+		return TRUE;
+	return gda_data_select_flush (model, error);
+}
+
+/*
+ * Sends the pending modifications to the database if the row at @int_row has been inserted
+ * while writes were deferred and the database computes its key: that row can't be identified
+ * by an UPDATE or DELETE statement until the INSERT has been executed.
+ */
+static gboolean
+flush_if_unkeyed_insert (GdaDataSelect *model, gint int_row, GError **error)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	GSList *list;
+
+	for (list = priv->sh->pending_modifs; list; list = list->next) {
+		PendingModif *pm = (PendingModif*) list->data;
+		if ((pm->type == INS_QUERY) && !pm->keyed && (pm->int_row == int_row))
+			return gda_data_select_flush (model, error);
+	}
+	return TRUE;
+}
+
+/*
+ * Records a modification to be executed by gda_data_select_flush(), using the current
+ * values of the modif_set's holders
+ */
+static PendingModif *
+pending_modif_add (GdaDataSelect *model, ModType type, gint int_row, GdaStatement *stmt)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	PendingModif *pm;
+
+	pm = g_new0 (PendingModif, 1);
+	pm->type = type;
+	pm->int_row = int_row;
+	pm->stmt = g_object_ref (stmt);
+	pm->params = gda_set_copy (priv->sh->modif_internals->modif_set);
+	priv->sh->pending_modifs = g_slist_prepend (priv->sh->pending_modifs, pm);
+	return pm;
+}
+
+/*
+ * Creates a new #GdaRow with the values of @new_values (an array of as many values as there are columns),
+ * and for each NULL value in that array, the value of the same column at the @row "external" row
+ * number (or NULL if @row is -1)
+ */
+static GdaRow *
+create_pending_row (GdaDataSelect *model, gint row, const GValue **new_values, GError **error)
+{
+	GdaRow *prow;
+	gint i, ncols;
+
+	ncols = gda_data_select_get_n_columns ((GdaDataModel*) model);
+	prow = gda_row_new (ncols);
+	for (i = 0; i < ncols; i++) {
+		const GValue *cvalue;
+		GValue *value;
+
+		cvalue = new_values [i];
+		if (!cvalue && (row >= 0)) {
+			cvalue = gda_data_model_get_value_at ((GdaDataModel*) model, i, row, error);
+			if (!cvalue) {
+				g_object_unref (prow);
+				return NULL;
+			}
+		}
+
+		value = gda_row_get_value (prow, i);
+		if (cvalue && !gda_value_is_null (cvalue)) {
+			gda_value_reset_with_type (value, G_VALUE_TYPE (cvalue));
+			g_value_copy (cvalue, value);
+		}
+		else
+			gda_value_set_null (value);
+	}
+	return prow;
+}
+
+static gboolean
+gda_data_select_set_values (GdaDataModel *model, gint row, GList *values, GError **error)
+{
+	gint i, ncols, nvalues;
+	GdaHolder *holder;
+	gchar *str;
+	GList *list;
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (GDA_DATA_SELECT (model));
+
+
+	/* arguments check */
+	g_return_val_if_fail (priv, FALSE);
+
+	if (! (priv->sh->usage_flags & GDA_DATA_MODEL_ACCESS_RANDOM)) {
+		g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ACCESS_ERROR,
+			     "%s", _("Data model does only support random access"));
+		return FALSE;
+	}
+
+	ncols = gda_data_select_get_n_columns (model);
+	nvalues = g_list_length (values);
+	if (nvalues > ncols) {
+		g_set_error (error, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_MISSING_MODIFICATION_STATEMENT_ERROR,
+			     _("Too many values (%d as maximum)"), ncols);
+		return FALSE;
+	}
+
+	/* BVector */
+	BVector *bv;
+	gboolean has_mods = FALSE;
+
+	bv = g_new (BVector, 1);
+	bv->size = nvalues;
+	bv->data = g_new0 (guchar, bv->size);
+	for (i = 0, list = values; list; i++, list = list->next) {
+		if (list->data) {
+			bv->data[i] = 1;
+			has_mods = TRUE;
+		}
+	}
+	if (!has_mods) {
 		/* no actual modification to do */
 		bvector_free (bv);
 		return TRUE;
@@ -3092,6 +3730,8 @@ gda_data_select_append_values (GdaDataModel *model, const GList *values, GError
 			     "%s", _("No INSERT statement provided"));
 		return -1;
 	}
+	if (! flush_if_not_deferred (GDA_DATA_SELECT (model), error))
+		return -1;
 	if (gda_data_select_get_n_rows (model) < 0) {
 		g_set_error (error, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_ACCESS_ERROR,
 			     "%s", _("Cannot add a row because the number of rows is unknown"));
@@ -3200,50 +3840,39 @@ gda_data_select_append_values (GdaDataModel *model, const GList *values, GError
 			compute_single_select_stmt (GDA_DATA_SELECT (model), error);
 	}
 
-	GdaSet *last_insert;
-	if (gda_connection_statement_execute_non_select (priv->cnc, stmt,
-							 priv->sh->modif_internals->modif_set,
-							 &last_insert, error) == -1)
-		return -1;
-
-	/* mark that this row has been modified */
 	DelayedSelectStmt *dstmt;
-	dstmt = g_new0 (DelayedSelectStmt, 1);
-	if (last_insert && priv->sh->modif_internals->one_row_select_stmt) {
-		dstmt->select = g_object_ref (priv->sh->modif_internals->one_row_select_stmt);
-		gda_statement_get_parameters (dstmt->select, &(dstmt->params), NULL);
-		if (dstmt->params) {
-			GSList *list;
-			if (! priv->sh->modif_internals->insert_to_select_mapping)
-				priv->sh->modif_internals->insert_to_select_mapping =
-					compute_insert_select_params_mapping (dstmt->params, last_insert,
-									      priv->sh->modif_internals->unique_row_condition);
-			if (priv->sh->modif_internals->insert_to_select_mapping) {
-				for (list = gda_set_get_holders (dstmt->params); list; list = list->next) {
-					GdaHolder *holder = GDA_HOLDER (list->data);
-					GdaHolder *eholder;
-					gint pos;
-
-					g_assert (param_name_to_int (gda_holder_get_id (holder), &pos, NULL));
-
-					eholder = g_slist_nth_data (gda_set_get_holders (last_insert),
-								    priv->sh->modif_internals->insert_to_select_mapping[pos]);
-					if (!eholder ||
-					    ! gda_holder_set_value (holder, gda_holder_get_value (eholder), error)) {
-						g_object_unref (dstmt->params);
-						dstmt->params = NULL;
-						break;
-					}
-				}
-			}
-		}
-	}
-	if (last_insert) {
-		g_object_unref (last_insert);
-		last_insert = NULL;
+	if (is_write_deferred (GDA_DATA_SELECT (model))) {
+		/* the INSERT statement is only executed by gda_data_select_flush() */
+		const GValue **new_values;
+		PendingModif *pm;
+		gint ncols;
+
+		ncols = gda_data_select_get_n_columns (model);
+		new_values = g_new0 (const GValue *, ncols);
+		for (i = 0, list = values; list && (i < ncols); i++, list = list->next)
+			new_values [i] = (const GValue *) list->data;
+
+		pm = pending_modif_add (GDA_DATA_SELECT (model), INS_QUERY, int_row, stmt);
+		dstmt = g_new0 (DelayedSelectStmt, 1);
+		dstmt->row = create_pending_row (GDA_DATA_SELECT (model), -1, new_values, NULL);
+		pm->keyed = set_dstmt_params_from_values (GDA_DATA_SELECT (model), dstmt, new_values);
+		g_free (new_values);
 	}
+	else {
+		GdaSet *last_insert;
+		if (gda_connection_statement_execute_non_select (priv->cnc, stmt,
+								 priv->sh->modif_internals->modif_set,
+								 &last_insert, error) == -1)
+			return -1;
 
-	dstmt->row = NULL;
+		/* mark that this row has been modified */
+		dstmt = g_new0 (DelayedSelectStmt, 1);
+		if (last_insert) {
+			set_dstmt_params_from_last_insert (GDA_DATA_SELECT (model), dstmt, last_insert);
+			g_object_unref (last_insert);
+		}
+		dstmt->row = NULL;
+	}
 	if (! priv->sh->upd_rows)
 		priv->sh->upd_rows = g_hash_table_new_full (g_int_hash, g_int_equal,
 								g_free,
@@ -3287,10 +3916,14 @@ gda_data_select_remove_row (GdaDataModel *model, gint row, GError **error)
 			     "%s", _("No DELETE statement provided"));
 		return FALSE;
 	}
+	if (! flush_if_not_deferred (GDA_DATA_SELECT (model), error))
+		return FALSE;
 
 	int_row = external_to_internal_row (GDA_DATA_SELECT (model), row, error);
 	if (int_row < 0)
 		return FALSE;
+	if (! flush_if_unkeyed_insert (GDA_DATA_SELECT (model), int_row, error))
+		return FALSE;
 
 	ncols = gda_data_select_get_n_columns (model);
 	for (i = 0; i < ncols; i++) {
@@ -3325,9 +3958,12 @@ gda_data_select_remove_row (GdaDataModel *model, gint row, GError **error)
 		g_print ("\tERR: %s\n", lerror && lerror->message ? lerror->message : "No detail");
 	g_free (sql);
 #endif
-	if (gda_connection_statement_execute_non_select (priv->cnc,
-							 priv->sh->modif_internals->modif_stmts [DEL_QUERY],
-							 priv->sh->modif_internals->modif_set, NULL, error) == -1)
+	if (is_write_deferred (GDA_DATA_SELECT (model)))
+		pending_modif_add (GDA_DATA_SELECT (model), DEL_QUERY, int_row,
+				   priv->sh->modif_internals->modif_stmts [DEL_QUERY]);
+	else if (gda_connection_statement_execute_non_select (priv->cnc,
+							      priv->sh->modif_internals->modif_stmts [DEL_QUERY],
+							      priv->sh->modif_internals->modif_set, NULL, error) == -1)
 		return FALSE;
 
 	/* mark that this row has been removed */
@@ -3344,6 +3980,601 @@ gda_data_select_remove_row (GdaDataModel *model, gint row, GError **error)
 	return TRUE;
 }
 
+/*
+ * Maximum number of rows handled by a single statement when flushing pending modifications
+ */
+#define FLUSH_BATCH_SIZE 500
+
+/*
+ * Converts @value to an expression which can be rendered as SQL without any parameter,
+ * or returns %NULL if @value can't be rendered that way
+ */
+static GdaSqlExpr *
+value_to_sql_expr (GdaDataSelect *model, const GValue *value, GdaSqlAnyPart *parent)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	GdaSqlExpr *expr;
+	gchar *str;
+
+	if (!value || gda_value_is_null (value))
+		str = g_strdup ("NULL");
+	else {
+		GdaDataHandler *dh;
+		if (G_VALUE_TYPE (value) == GDA_TYPE_BLOB)
+			return NULL;
+		dh = gda_server_provider_get_data_handler_g_type (gda_connection_get_provider (priv->cnc),
+								  priv->cnc, G_VALUE_TYPE (value));
+		if (!dh)
+			return NULL;
+		str = gda_data_handler_get_sql_from_value (dh, value);
+		if (!str)
+			return NULL;
+	}
+
+	expr = gda_sql_expr_new (parent);
+	expr->value = gda_value_new (G_TYPE_STRING);
+	g_value_take_string (expr->value, str);
+	return expr;
+}
+
+typedef struct {
+	GdaDataSelect *model;
+	GdaSet        *params;
+} InlineData;
+
+/*
+ * Replaces each parameter in an expression by its value in @data->params
+ */
+static gboolean
+inline_params_foreach_func (GdaSqlAnyPart *part, InlineData *data, GError **error)
+{
+	GdaSqlExpr *expr, *vexpr;
+	GdaHolder *holder;
+
+	if (part->type != GDA_SQL_ANY_EXPR)
+		return TRUE;
+	expr = (GdaSqlExpr*) part;
+	if (!expr->param_spec)
+		return TRUE;
+
+	holder = gda_set_get_holder (data->params, expr->param_spec->name);
+	vexpr = holder ? value_to_sql_expr (data->model, gda_holder_get_value (holder), NULL) : NULL;
+	if (!vexpr) {
+		g_set_error (error, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_MODIFICATION_STATEMENT_ERROR,
+			     _("Can't use the value of parameter '%s'"), expr->param_spec->name);
+		return FALSE;
+	}
+	if (expr->value)
+		gda_value_free (expr->value);
+	expr->value = vexpr->value;
+	vexpr->value = NULL;
+	gda_sql_expr_free (vexpr);
+	gda_sql_param_spec_free (expr->param_spec);
+	expr->param_spec = NULL;
+	return TRUE;
+}
+
+/*
+ * Executes a single pending modification
+ */
+static gboolean
+pending_modif_execute (GdaDataSelect *model, PendingModif *pm, GError **error)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	GdaSet *last_insert = NULL;
+
+	if (gda_connection_statement_execute_non_select (priv->cnc, pm->stmt, pm->params,
+							 (pm->type == INS_QUERY) && !pm->keyed ? &last_insert : NULL,
+							 error) == -1)
+		return FALSE;
+
+	if (last_insert) {
+		/* now the inserted row can be identified */
+		DelayedSelectStmt *dstmt = NULL;
+		if (priv->sh->upd_rows)
+			dstmt = g_hash_table_lookup (priv->sh->upd_rows, &(pm->int_row));
+		if (dstmt)
+			set_dstmt_params_from_last_insert (model, dstmt, last_insert);
+		g_object_unref (last_insert);
+	}
+	return TRUE;
+}
+
+static gboolean
+pending_modifs_execute (GdaDataSelect *model, GPtrArray *pms, GError **error)
+{
+	guint i;
+	for (i = 0; i < pms->len; i++) {
+		if (! pending_modif_execute (model, g_ptr_array_index (pms, i), error))
+			return FALSE;
+	}
+	return TRUE;
+}
+
+/*
+ * Executes the pending DELETEs in @pms (which all use the same statement) as a single
+ * "DELETE ... WHERE <key> IN (...)" statement if the rows are identified by a single column
+ */
+static gboolean
+flush_deletes (GdaDataSelect *model, GPtrArray *pms, GError **error)
+{
+	PendingModif *pm;
+	GdaSqlStatement *sqlst;
+	GdaSqlStatementDelete *del;
+	GdaSqlOperation *op;
+	GdaSqlExpr *key_expr = NULL, *param_expr = NULL;
+	GdaStatement *stmt;
+	GSList *values = NULL;
+	guint i;
+	gboolean retval;
+
+	if (pms->len == 1)
+		return pending_modifs_execute (model, pms, error);
+
+	pm = g_ptr_array_index (pms, 0);
+	g_object_get (G_OBJECT (pm->stmt), "structure", &sqlst, NULL);
+	del = (GdaSqlStatementDelete*) sqlst->contents;
+
+	/* the condition must be "<key> = <parameter>" */
+	op = del->cond ? del->cond->cond : NULL;
+	if (op && (op->operator_type == GDA_SQL_OPERATOR_TYPE_EQ) && (g_slist_length (op->operands) == 2)) {
+		GdaSqlExpr *e1, *e2;
+		e1 = (GdaSqlExpr*) op->operands->data;
+		e2 = (GdaSqlExpr*) op->operands->next->data;
+		if (e2->param_spec && !e1->param_spec && !e1->cond && !e1->select) {
+			key_expr = e1;
+			param_expr = e2;
+		}
+		else if (e1->param_spec && !e2->param_spec && !e2->cond && !e2->select) {
+			key_expr = e2;
+			param_expr = e1;
+		}
+	}
+	if (!key_expr) {
+		gda_sql_statement_free (sqlst);
+		return pending_modifs_execute (model, pms, error);
+	}
+
+	for (i = 0; i < pms->len; i++) {
+		GdaHolder *holder;
+		GdaSqlExpr *vexpr = NULL;
+		pm = g_ptr_array_index (pms, i);
+		holder = gda_set_get_holder (pm->params, param_expr->param_spec->name);
+		if (holder && !gda_value_is_null (gda_holder_get_value (holder)))
+			vexpr = value_to_sql_expr (model, gda_holder_get_value (holder), NULL);
+		if (!vexpr) {
+			/* a NULL key would never match */
+			g_slist_free_full (values, (GDestroyNotify) gda_sql_expr_free);
+			gda_sql_statement_free (sqlst);
+			return pending_modifs_execute (model, pms, error);
+		}
+		values = g_slist_prepend (values, vexpr);
+	}
+	values = g_slist_reverse (values);
+
+	/* build the IN condition */
+	GdaSqlExpr *cond;
+	GSList *list;
+	cond = gda_sql_expr_new (GDA_SQL_ANY_PART (del));
+	cond->cond = gda_sql_operation_new (GDA_SQL_ANY_PART (cond));
+	cond->cond->operator_type = GDA_SQL_OPERATOR_TYPE_IN;
+	key_expr = gda_sql_expr_copy (key_expr);
+	cond->cond->operands = g_slist_prepend (values, key_expr);
+	for (list = cond->cond->operands; list; list = list->next)
+		GDA_SQL_ANY_PART (list->data)->parent = GDA_SQL_ANY_PART (cond->cond);
+	gda_sql_expr_free (del->cond);
+	del->cond = cond;
+	g_free (sqlst->sql);
+	sqlst->sql = NULL;
+
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	stmt = (GdaStatement *) g_object_new (GDA_TYPE_STATEMENT, "structure", sqlst, NULL);
+	gda_sql_statement_free (sqlst);
+	retval = gda_connection_statement_execute_non_select (priv->cnc, stmt, NULL, NULL, error) != -1;
+	g_object_unref (stmt);
+	return retval;
+}
+
+/*
+ * Executes the pending INSERTs in @pms (which all use the same statement and have a known key)
+ * as a single multi rows INSERT statement
+ */
+static gboolean
+flush_inserts (GdaDataSelect *model, GPtrArray *pms, GError **error)
+{
+	PendingModif *pm;
+	GdaSqlStatement *sqlst;
+	GdaSqlStatementInsert *ins;
+	GSList *values_list = NULL, *list;
+	GdaStatement *stmt;
+	guint i;
+	gboolean retval;
+
+	if (pms->len == 1)
+		return pending_modifs_execute (model, pms, error);
+
+	pm = g_ptr_array_index (pms, 0);
+	g_object_get (G_OBJECT (pm->stmt), "structure", &sqlst, NULL);
+	ins = (GdaSqlStatementInsert*) sqlst->contents;
+	if (ins->select || !ins->values_list || ins->values_list->next) {
+		gda_sql_statement_free (sqlst);
+		return pending_modifs_execute (model, pms, error);
+	}
+
+	for (i = 0; i < pms->len; i++) {
+		GSList *values = NULL;
+		pm = g_ptr_array_index (pms, i);
+		for (list = (GSList*) ins->values_list->data; list; list = list->next) {
+			GdaSqlExpr *expr = (GdaSqlExpr*) list->data;
+			GdaSqlExpr *vexpr;
+			if (expr->param_spec) {
+				GdaHolder *holder;
+				holder = gda_set_get_holder (pm->params, expr->param_spec->name);
+				vexpr = value_to_sql_expr (model, holder ? gda_holder_get_value (holder) : NULL,
+							   GDA_SQL_ANY_PART (ins));
+			}
+			else {
+				vexpr = gda_sql_expr_copy (expr);
+				GDA_SQL_ANY_PART (vexpr)->parent = GDA_SQL_ANY_PART (ins);
+			}
+			if (!vexpr) {
+				g_slist_free_full (values, (GDestroyNotify) gda_sql_expr_free);
+				break;
+			}
+			values = g_slist_prepend (values, vexpr);
+		}
+		if (list) {
+			for (list = values_list; list; list = list->next)
+				g_slist_free_full ((GSList*) list->data, (GDestroyNotify) gda_sql_expr_free);
+			g_slist_free (values_list);
+			gda_sql_statement_free (sqlst);
+			return pending_modifs_execute (model, pms, error);
+		}
+		values_list = g_slist_prepend (values_list, g_slist_reverse (values));
+	}
+
+	g_slist_free_full ((GSList*) ins->values_list->data, (GDestroyNotify) gda_sql_expr_free);
+	g_slist_free (ins->values_list);
+	ins->values_list = g_slist_reverse (values_list);
+	g_free (sqlst->sql);
+	sqlst->sql = NULL;
+
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	stmt = (GdaStatement *) g_object_new (GDA_TYPE_STATEMENT, "structure", sqlst, NULL);
+	gda_sql_statement_free (sqlst);
+	retval = gda_connection_statement_execute_non_select (priv->cnc, stmt, NULL, NULL, error) != -1;
+	g_object_unref (stmt);
+	return retval;
+}
+
+/*
+ * Converts an "internal" row number to an "external" row number
+ */
+static gint
+internal_to_external_row (GdaDataSelect *model, gint int_row)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	gint ext_row = int_row;
+	if (priv->sh->del_rows) {
+		guint i;
+		for (i = 0; i < priv->sh->del_rows->len; i++) {
+			gint indexed = g_array_index (priv->sh->del_rows, gint, i);
+			if (indexed == int_row)
+				return -1;
+			else if (indexed < int_row)
+				ext_row --;
+			else
+				break;
+		}
+	}
+	return ext_row;
+}
+
+/*
+ * Computes a string identifying a row from the values of the columns used in @dstmt->params
+ * (either using @dstmt->params' values or using @model's values at row @row if @model is not %NULL)
+ */
+static gchar *
+compute_row_key (DelayedSelectStmt *dstmt, GdaDataModel *model, gint row)
+{
+	GString *string;
+	GSList *list;
+
+	string = g_string_new ("");
+	for (list = gda_set_get_holders (dstmt->params); list; list = list->next) {
+		GdaHolder *holder = GDA_HOLDER (list->data);
+		const GValue *cvalue = NULL;
+		gchar *str;
+		gint col;
+
+		if (model) {
+			if (param_name_to_int (gda_holder_get_id (holder), &col, NULL))
+				cvalue = gda_data_model_get_value_at (model, col, row, NULL);
+		}
+		else
+			cvalue = gda_holder_get_value (holder);
+		str = gda_value_stringify (cvalue);
+		if (list != gda_set_get_holders (dstmt->params))
+			g_string_append_c (string, '\x1f');
+		g_string_append (string, str);
+		g_free (str);
+	}
+	return g_string_free (string, FALSE);
+}
+
+/*
+ * Re-reads the rows in @dstmts using a single SELECT statement
+ */
+static void
+refresh_rows (GdaDataSelect *model, GPtrArray *dstmts, GArray *int_rows)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	GdaSqlStatement *sqlst;
+	GdaSqlStatementSelect *sel;
+	GdaSqlExpr *or_expr;
+	GHashTable *keys; /* key = row key, value = index in @dstmts */
+	GdaStatement *stmt;
+	GdaDataModel *tmpmodel;
+	guint i;
+
+	g_object_get (G_OBJECT (priv->sh->modif_internals->one_row_select_stmt), "structure", &sqlst, NULL);
+	sel = (GdaSqlStatementSelect*) sqlst->contents;
+	if (!sel->where_cond) {
+		gda_sql_statement_free (sqlst);
+		return;
+	}
+
+	or_expr = gda_sql_expr_new (GDA_SQL_ANY_PART (sel));
+	or_expr->cond = gda_sql_operation_new (GDA_SQL_ANY_PART (or_expr));
+	or_expr->cond->operator_type = GDA_SQL_OPERATOR_TYPE_OR;
+	keys = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+	for (i = 0; i < dstmts->len; i++) {
+		DelayedSelectStmt *dstmt = g_ptr_array_index (dstmts, i);
+		InlineData data;
+		GdaSqlExpr *cond;
+
+		data.model = model;
+		data.params = dstmt->params;
+		cond = gda_sql_expr_copy (sel->where_cond);
+		if (! gda_sql_any_part_foreach (GDA_SQL_ANY_PART (cond),
+						(GdaSqlForeachFunc) inline_params_foreach_func, &data, NULL)) {
+			/* this row will be re-read later by itself */
+			gda_sql_expr_free (cond);
+			continue;
+		}
+		GDA_SQL_ANY_PART (cond)->parent = GDA_SQL_ANY_PART (or_expr->cond);
+		or_expr->cond->operands = g_slist_prepend (or_expr->cond->operands, cond);
+		g_hash_table_insert (keys, compute_row_key (dstmt, NULL, 0), GUINT_TO_POINTER (i));
+	}
+
+	if (! or_expr->cond->operands) {
+		gda_sql_expr_free (or_expr);
+		gda_sql_statement_free (sqlst);
+		g_hash_table_destroy (keys);
+		return;
+	}
+	if (! or_expr->cond->operands->next) {
+		/* a single condition */
+		GdaSqlExpr *cond;
+		cond = (GdaSqlExpr*) or_expr->cond->operands->data;
+		g_slist_free (or_expr->cond->operands);
+		or_expr->cond->operands = NULL;
+		gda_sql_expr_free (or_expr);
+		or_expr = cond;
+	}
+	gda_sql_expr_free (sel->where_cond);
+	sel->where_cond = or_expr;
+	GDA_SQL_ANY_PART (or_expr)->parent = GDA_SQL_ANY_PART (sel);
+	g_free (sqlst->sql);
+	sqlst->sql = NULL;
+	stmt = (GdaStatement *) g_object_new (GDA_TYPE_STATEMENT, "structure", sqlst, NULL);
+	gda_sql_statement_free (sqlst);
+
+	GType *types = NULL;
+	if (priv->prep_stmt && gda_pstmt_get_types (priv->prep_stmt)) {
+		types = g_new (GType, gda_pstmt_get_ncols (priv->prep_stmt) + 1);
+		memcpy (types, gda_pstmt_get_types (priv->prep_stmt), /* Flawfinder: ignore */
+			sizeof (GType) * gda_pstmt_get_ncols (priv->prep_stmt));
+		types [gda_pstmt_get_ncols (priv->prep_stmt)] = G_TYPE_NONE;
+	}
+	tmpmodel = gda_connection_statement_execute_select_full (priv->cnc, stmt, NULL,
+								 GDA_STATEMENT_MODEL_RANDOM_ACCESS,
+								 types, NULL);
+	g_free (types);
+	g_object_unref (stmt);
+
+	if (tmpmodel) {
+		gint row, nrows, ncols;
+		nrows = gda_data_model_get_n_rows (tmpmodel);
+		ncols = gda_data_model_get_n_columns (tmpmodel);
+		for (row = 0; row < nrows; row++) {
+			DelayedSelectStmt *dstmt;
+			gchar *key;
+			gpointer index;
+			gboolean found;
+
+			key = compute_row_key (g_ptr_array_index (dstmts, 0), tmpmodel, row);
+			found = g_hash_table_lookup_extended (keys, key, NULL, &index);
+			g_free (key);
+			if (!found)
+				continue;
+
+			GdaRow *prow;
+			gint col;
+			prow = gda_row_new (ncols);
+			for (col = 0; col < ncols; col++) {
+				const GValue *cvalue;
+				GValue *value;
+				cvalue = gda_data_model_get_value_at (tmpmodel, col, row, NULL);
+				if (!cvalue)
+					break;
+				value = gda_row_get_value (prow, col);
+				if (!gda_value_is_null (cvalue)) {
+					gda_value_reset_with_type (value, G_VALUE_TYPE (cvalue));
+					g_value_copy (cvalue, value);
+				}
+				else
+					gda_value_set_null (value);
+			}
+			if (col < ncols) {
+				g_object_unref (prow);
+				continue;
+			}
+
+			dstmt = g_ptr_array_index (dstmts, GPOINTER_TO_UINT (index));
+			if (dstmt->row)
+				g_object_unref (dstmt->row);
+			dstmt->row = prow;
+			g_clear_error (&(dstmt->exec_error));
+
+			gint ext_row;
+			ext_row = internal_to_external_row (model, g_array_index (int_rows, gint, GPOINTER_TO_UINT (index)));
+			if (ext_row >= 0)
+				gda_data_model_row_updated ((GdaDataModel*) model, ext_row);
+		}
+		g_object_unref (tmpmodel);
+	}
+	g_hash_table_destroy (keys);
+}
+
+/*
+ * Re-reads the rows which have been inserted or updated by the modifications in @pending
+ */
+static void
+refresh_modified_rows (GdaDataSelect *model, GSList *pending)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	GHashTable *done;
+	GPtrArray *dstmts;
+	GArray *int_rows;
+	GSList *list;
+
+	if (!priv->sh->upd_rows || !priv->sh->modif_internals->one_row_select_stmt)
+		return;
+
+	done = g_hash_table_new (g_direct_hash, g_direct_equal);
+	dstmts = g_ptr_array_new ();
+	int_rows = g_array_new (FALSE, FALSE, sizeof (gint));
+	for (list = pending; list; list = list->next) {
+		PendingModif *pm = (PendingModif*) list->data;
+		DelayedSelectStmt *dstmt;
+
+		if ((pm->type == DEL_QUERY) ||
+		    g_hash_table_contains (done, GINT_TO_POINTER (pm->int_row)))
+			continue;
+		g_hash_table_add (done, GINT_TO_POINTER (pm->int_row));
+
+		dstmt = g_hash_table_lookup (priv->sh->upd_rows, &(pm->int_row));
+		if (!dstmt || !dstmt->params ||
+		    (dstmt->select != priv->sh->modif_internals->one_row_select_stmt) ||
+		    (internal_to_external_row (model, pm->int_row) < 0))
+			continue;
+
+		g_ptr_array_add (dstmts, dstmt);
+		g_array_append_val (int_rows, pm->int_row);
+		if (dstmts->len == FLUSH_BATCH_SIZE) {
+			refresh_rows (model, dstmts, int_rows);
+			g_ptr_array_set_size (dstmts, 0);
+			g_array_set_size (int_rows, 0);
+		}
+	}
+	if (dstmts->len > 0)
+		refresh_rows (model, dstmts, int_rows);
+
+	g_ptr_array_free (dstmts, TRUE);
+	g_array_free (int_rows, TRUE);
+	g_hash_table_destroy (done);
+}
+
+/**
+ * gda_data_select_flush:
+ * @model: a #GdaDataSelect data model
+ * @error: (nullable): a place to store errors, or %NULL
+ *
+ * Sends to the database the modifications made to @model while the #GdaDataSelect:deferred-write
+ * property was set. The modifications are executed in the order in which they were made, within a
+ * transaction if none was already started, and consecutive INSERTs or DELETEs are grouped
+ * in multi rows statements where possible. The inserted and modified rows are then re-read using
+ * as few SELECT statements as possible.
+ *
+ * If an error occurs and a transaction has been started by this method, then that transaction is rolled back
+ * and the modifications are kept so this method can be called again; otherwise it is up to the caller to
+ * roll back its transaction and to re-run @model.
+ *
+ * Returns: %TRUE if no error occurred (including if there was no modification to send)
+ *
+ * Since: 6.0
+ */
+gboolean
+gda_data_select_flush (GdaDataSelect *model, GError **error)
+{
+	g_return_val_if_fail (GDA_IS_DATA_SELECT (model), FALSE);
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	GSList *pending, *list;
+	gboolean started = FALSE, retval = TRUE;
+
+	if (! priv->sh->pending_modifs)
+		return TRUE;
+	if (priv->sh->modif_internals->safely_locked) {
+		g_set_error (error, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_SAFETY_LOCKED_ERROR,
+			     "%s", _("Modifications are not allowed anymore"));
+		return FALSE;
+	}
+
+	pending = g_slist_reverse (priv->sh->pending_modifs);
+	priv->sh->pending_modifs = NULL;
+
+	if (! gda_connection_get_transaction_status (priv->cnc))
+		started = gda_connection_begin_transaction (priv->cnc, NULL,
+							    GDA_TRANSACTION_ISOLATION_UNKNOWN, NULL);
+
+	for (list = pending; list && retval; list = list->next) {
+		PendingModif *pm = (PendingModif*) list->data;
+		GPtrArray *pms;
+
+		/* UPDATEs can't be grouped, and an INSERT for which the key is unknown needs
+		 * to be executed alone to get the inserted row */
+		if ((pm->type == UPD_QUERY) || ((pm->type == INS_QUERY) && !pm->keyed)) {
+			retval = pending_modif_execute (model, pm, error);
+			continue;
+		}
+
+		/* group consecutive similar modifications */
+		pms = g_ptr_array_new ();
+		g_ptr_array_add (pms, pm);
+		while (list->next && (pms->len < FLUSH_BATCH_SIZE)) {
+			PendingModif *npm = (PendingModif*) list->next->data;
+			if ((npm->type != pm->type) || (npm->stmt != pm->stmt) ||
+			    ((npm->type == INS_QUERY) && !npm->keyed))
+				break;
+			g_ptr_array_add (pms, npm);
+			list = list->next;
+		}
+
+		if (pm->type == DEL_QUERY)
+			retval = flush_deletes (model, pms, error);
+		else
+			retval = flush_inserts (model, pms, error);
+		g_ptr_array_free (pms, TRUE);
+	}
+
+	if (retval && started)
+		retval = gda_connection_commit_transaction (priv->cnc, NULL, error);
+	if (!retval) {
+		if (started) {
+			gda_connection_rollback_transaction (priv->cnc, NULL, NULL);
+			priv->sh->pending_modifs = g_slist_reverse (pending);
+		}
+		else
+			g_slist_free_full (pending, (GDestroyNotify) pending_modif_free);
+		return FALSE;
+	}
+
+	refresh_modified_rows (model, pending);
+	g_slist_free_full (pending, (GDestroyNotify) pending_modif_free);
+	return TRUE;
+}
+
 static void
 gda_data_select_freeze (GdaDataModel *model)
 {
@@ -3721,6 +4952,7 @@ gda_data_select_rerun (GdaDataSelect *model, GError **error)
 	GdaDataSelectInternals *mi;
 
 	priv->sh->notify_changes = old_priv->sh->notify_changes;
+	priv->sh->deferred_write = old_priv->sh->deferred_write;
 	mi = old_priv->sh->modif_internals;
 	old_priv->sh->modif_internals = priv->sh->modif_internals;
 	priv->sh->modif_internals = mi;
@@ -3813,7 +5045,7 @@ gda_data_select_prepare_for_offline (GdaDataSelect *model, GError **error)
 			     "%s", _("Data model does not support random access"));
 		return FALSE;
 	}
-	if (priv->sh->upd_rows || priv->sh->del_rows) {
+	if (priv->sh->upd_rows || priv->sh->del_rows || priv->sh->pending_modifs) {
 		g_set_error (error, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_ACCESS_ERROR,
 			     "%s", _("Data model has been modified"));
 		return FALSE;
@@ -3834,8 +5066,11 @@ gda_data_select_prepare_for_offline (GdaDataSelect *model, GError **error)
 		if (CLASS (model)->fetch_nb_rows)
 			_gda_data_select_fetch_nb_rows (model);
 		if (priv->advertized_nrows < 0) {
-			g_set_error (error, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_ACCESS_ERROR,
-				     "%s", _("Can't get the number of rows of data model"));
+			if (priv->limit_reached)
+				gda_data_select_check_limits (model, error);
+			else
+				g_set_error (error, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_ACCESS_ERROR,
+					     "%s", _("Can't get the number of rows of data model"));
 			return FALSE;
 		}
 	}
@@ -3870,10 +5105,12 @@ worker_fetch_nb_rows (GdaDataSelect *model, GError **error)
 {
 	gint *nbrows;
 	nbrows = g_slice_new (gint);
+	GDA_TRACE (fetch_chunk, begin, model, -1);
 	if (CLASS (model)->fetch_nb_rows)
 		*nbrows = CLASS (model)->fetch_nb_rows (model);
 	else
 		*nbrows = -1;
+	GDA_TRACE (fetch_chunk, end, model, *nbrows);
 
 	return (gpointer) nbrows;
 }
@@ -3910,10 +5147,12 @@ static gpointer
 worker_fetch_random (WorkerData *data, GError **error)
 {
 	gboolean res;
+	GDA_TRACE (fetch_chunk, begin, data->model, data->rownum);
 	if (CLASS (data->model)->fetch_random)
 		res = CLASS (data->model)->fetch_random (data->model, data->prow, data->rownum, error);
 	else
 		res = FALSE;
+	GDA_TRACE (fetch_chunk, end, data->model, (res && *(data->prow)) ? 1 : 0);
 
 	return res ? (gpointer) 0x01 : NULL;
 }
@@ -3923,6 +5162,12 @@ _gda_data_select_fetch_random  (GdaDataSelect *model, GdaRow **prow, gint rownum
 {
 	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
 	GMainContext *context;
+
+	/* the requested row would be stored */
+	if (! gda_data_select_check_limits (model, error)) {
+		*prow = NULL;
+		return FALSE;
+	}
 	context = gda_server_provider_get_real_main_context (priv->cnc);
 
 	WorkerData jdata;
@@ -3935,6 +5180,8 @@ _gda_data_select_fetch_random  (GdaDataSelect *model, GdaRow **prow, gint rownum
 			   (GdaWorkerFunc) worker_fetch_random, &jdata, NULL, NULL, error);
 	if (context)
 		g_main_context_unref (context);
+	if (result && *prow && priv->metrics_entry)
+		metrics_row_fetched (model);
 	return result ? TRUE : FALSE;
 }
 
@@ -3944,10 +5191,12 @@ static gpointer
 worker_store_all (GdaDataSelect *model, GError **error)
 {
 	gboolean res;
+	GDA_TRACE (fetch_chunk, begin, model, -1);
 	if (CLASS (model)->store_all)
 		res = CLASS (model)->store_all (model, error);
 	else
 		res = FALSE;
+	GDA_TRACE (fetch_chunk, end, model, gda_data_select_get_nb_stored_rows (model));
 
 	return res ? (gpointer) 0x01 : NULL;
 }
@@ -3957,6 +5206,9 @@ _gda_data_select_store_all (GdaDataSelect *model, GError **error)
 {
 	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
 	GMainContext *context;
+
+	if (! gda_data_select_check_limits (model, error))
+		return FALSE;
 	context = gda_server_provider_get_real_main_context (priv->cnc);
 
 	gpointer result;
@@ -3973,10 +5225,12 @@ static gpointer
 worker_fetch_next (WorkerData *data, GError **error)
 {
 	gboolean res;
+	GDA_TRACE (fetch_chunk, begin, data->model, data->rownum);
 	if (CLASS (data->model)->fetch_next)
 		res = CLASS (data->model)->fetch_next (data->model, data->prow, data->rownum, error);
 	else
 		res = FALSE;
+	GDA_TRACE (fetch_chunk, end, data->model, (res && *(data->prow)) ? 1 : 0);
 
 	return res ? (gpointer) 0x01 : NULL;
 }
@@ -3998,6 +5252,8 @@ _gda_data_select_fetch_next    (GdaDataSelect *model, GdaRow **prow, gint rownum
 			   (GdaWorkerFunc) worker_fetch_next, &jdata, NULL, NULL, error);
 	if (context)
 		g_main_context_unref (context);
+	if (result && *prow && priv->metrics_entry)
+		metrics_row_fetched (model);
 	return result ? TRUE : FALSE;
 }
 
@@ -4007,10 +5263,12 @@ static gpointer
 worker_fetch_prev (WorkerData *data, GError **error)
 {
 	gboolean res;
+	GDA_TRACE (fetch_chunk, begin, data->model, data->rownum);
 	if (CLASS (data->model)->fetch_prev)
 		res = CLASS (data->model)->fetch_prev (data->model, data->prow, data->rownum, error);
 	else
 		res = FALSE;
+	GDA_TRACE (fetch_chunk, end, data->model, (res && *(data->prow)) ? 1 : 0);
 
 	return res ? (gpointer) 0x01 : NULL;
 }
@@ -4032,6 +5290,8 @@ _gda_data_select_fetch_prev    (GdaDataSelect *model, GdaRow **prow, gint rownum
 			   (GdaWorkerFunc) worker_fetch_prev, &jdata, NULL, NULL, error);
 	if (context)
 		g_main_context_unref (context);
+	if (result && *prow && priv->metrics_entry)
+		metrics_row_fetched (model);
 	return result ? TRUE : FALSE;
 }
 
@@ -4041,10 +5301,12 @@ static gpointer
 worker_fetch_at (WorkerData *data, GError **error)
 {
 	gboolean res;
+	GDA_TRACE (fetch_chunk, begin, data->model, data->rownum);
 	if (CLASS (data->model)->fetch_at)
 		res = CLASS (data->model)->fetch_at (data->model, data->prow, data->rownum, error);
 	else
 		res = FALSE;
+	GDA_TRACE (fetch_chunk, end, data->model, (res && *(data->prow)) ? 1 : 0);
 
 	return res ? (gpointer) 0x01 : NULL;
 }
@@ -4066,6 +5328,8 @@ _gda_data_select_fetch_at      (GdaDataSelect *model, GdaRow **prow, gint rownum
 			   (GdaWorkerFunc) worker_fetch_at, &jdata, NULL, NULL, error);
 	if (context)
 		g_main_context_unref (context);
+	if (result && *prow && priv->metrics_entry)
+		metrics_row_fetched (model);
 	return result ? TRUE : FALSE;
 }
 
@@ -4096,4 +5360,59 @@ gda_data_select_set_advertized_nrows (GdaDataSelect *model, gint n)
 {
 	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
 	priv->advertized_nrows = n;
+	if (priv->metrics_entry && (n >= 0))
+		metrics_all_rows_fetched (model);
+}
+
+/*
+ * Statement metrics
+ */
+static void
+metrics_row_fetched (GdaDataSelect *model)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	if (priv->metrics_first_row_done)
+		return;
+	priv->metrics_first_row_done = TRUE;
+	_gda_connection_metrics_entry_add_time (priv->metrics_entry, GDA_CONNECTION_METRICS_FIRST_ROW,
+						g_get_monotonic_time () - priv->metrics_start_time);
+}
+
+static void
+metrics_all_rows_fetched (GdaDataSelect *model)
+{
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+	if (priv->metrics_fetch_all_done)
+		return;
+	if (priv->advertized_nrows > 0)
+		metrics_row_fetched (model);
+	priv->metrics_fetch_all_done = TRUE;
+	_gda_connection_metrics_entry_add_time (priv->metrics_entry, GDA_CONNECTION_METRICS_FETCH_ALL,
+						g_get_monotonic_time () - priv->metrics_start_time);
+	_gda_connection_metrics_entry_add_rows (priv->metrics_entry, priv->advertized_nrows);
+}
+
+/*
+ * Makes @model report when its first and last rows are fetched to @entry,
+ * the statement's execution having started at @start_time (as returned by g_get_monotonic_time())
+ */
+void
+_gda_data_select_set_metrics_entry (GdaDataSelect *model, GdaConnectionMetricsEntry *entry, gint64 start_time)
+{
+	g_return_if_fail (GDA_IS_DATA_SELECT (model));
+	g_return_if_fail (entry);
+	GdaDataSelectPrivate *priv = gda_data_select_get_instance_private (model);
+
+	if (priv->metrics_entry)
+		_gda_connection_metrics_entry_unref (priv->metrics_entry);
+	priv->metrics_entry = _gda_connection_metrics_entry_ref (entry);
+	priv->metrics_start_time = start_time;
+	priv->metrics_first_row_done = FALSE;
+	priv->metrics_fetch_all_done = FALSE;
+
+	/* rows may have been fetched during the execution */
+	if (priv->nb_stored_rows > 0)
+		metrics_row_fetched (model);
+	if (priv->advertized_nrows >= 0)
+		metrics_all_rows_fetched (model);
 }
@@ -75,7 +75,8 @@ typedef enum {
 	GDA_DATA_SELECT_CONNECTION_ERROR,
 	GDA_DATA_SELECT_ACCESS_ERROR,
 	GDA_DATA_SELECT_SQL_ERROR,
-	GDA_DATA_SELECT_SAFETY_LOCKED_ERROR
+	GDA_DATA_SELECT_SAFETY_LOCKED_ERROR,
+	GDA_DATA_SELECT_LIMIT_ERROR
 } GdaDataSelectError;
 
 /**
@@ -135,6 +136,11 @@ typedef enum {
  *      <phrase>GdaDataSelect data model's contents after some modifications</phrase>
  *    </textobject>
  *  </mediaobject>
+ *
+ *  When many rows are modified at once, the #GdaDataSelect:deferred-write property can be set to %TRUE: the
+ *  modifications are then kept in memory (and are visible when reading the data model) until
+ *  gda_data_select_flush() is called, which sends them to the database server within a single transaction,
+ *  grouping them in multi-rows statements where possible.
  */
 
 gboolean       gda_data_select_set_row_selection_condition     (GdaDataSelect *model, GdaSqlExpr *expr, GError **error);
@@ -152,6 +158,7 @@ gboolean       gda_data_select_compute_columns_attributes      (GdaDataSelect *m
 GdaConnection *gda_data_select_get_connection                  (GdaDataSelect *model);
 
 gboolean       gda_data_select_prepare_for_offline             (GdaDataSelect *model, GError **error);
+gboolean       gda_data_select_flush                           (GdaDataSelect *model, GError **error);
 
 #define GDA_TYPE_DATA_SELECT_ITER gda_data_select_iter_get_type()
 
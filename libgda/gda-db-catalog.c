@@ -915,6 +915,132 @@ gda_db_catalog_append_view (GdaDbCatalog *self,
   priv->mp_views = g_list_append (priv->mp_views, g_object_ref (view));
 }
 
+/* Sorting state of a table, see _gda_db_catalog_sort_tables() */
+enum {
+  TABLE_NOT_SORTED = 0,
+  TABLE_SORTING,
+  TABLE_SORTED
+};
+
+static void
+_gda_db_catalog_sort_table (GdaDbTable *table,
+                            GHashTable *names,
+                            GHashTable *states,
+                            GList **sorted)
+{
+  if (GPOINTER_TO_INT (g_hash_table_lookup (states, table)) != TABLE_NOT_SORTED)
+    return; /* already sorted, or foreign keys cycle */
+
+  g_hash_table_insert (states, table, GINT_TO_POINTER (TABLE_SORTING));
+
+  GList *it = NULL;
+  for (it = gda_db_table_get_fkeys (table); it; it = it->next)
+    {
+      const gchar *reftable_name = gda_db_fkey_get_ref_table (GDA_DB_FKEY (it->data));
+      GdaDbTable *reftable;
+
+      if (!reftable_name)
+        continue;
+
+      reftable = g_hash_table_lookup (names, reftable_name);
+      if (reftable && reftable != table)
+        _gda_db_catalog_sort_table (reftable, names, states, sorted);
+    }
+
+  g_hash_table_insert (states, table, GINT_TO_POINTER (TABLE_SORTED));
+  *sorted = g_list_prepend (*sorted, table);
+}
+
+/*
+ * @tables: a list of #GdaDbTable
+ *
+ * Sorts @tables so that each table comes after the tables its foreign keys reference. The
+ * order of @tables is kept between tables which don't depend on each other. For tables
+ * referencing each other (directly or not), the depth first traversal starting from the
+ * first of them in @tables puts the table it references first, and that first table last.
+ *
+ * Returns: (transfer container): a new list with the same #GdaDbTable objects
+ */
+static GList *
+_gda_db_catalog_sort_tables (GList *tables)
+{
+  GHashTable *names;
+  GHashTable *states;
+  GList *sorted = NULL;
+  GList *it = NULL;
+
+  /* foreign keys reference tables either by name or by full name */
+  names = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+  for (it = tables; it; it = it->next)
+    {
+      const gchar *name;
+
+      name = gda_db_base_get_name (GDA_DB_BASE (it->data));
+      if (name && !g_hash_table_contains (names, name))
+        g_hash_table_insert (names, g_strdup (name), it->data);
+
+      name = gda_db_base_get_full_name (GDA_DB_BASE (it->data));
+      if (name && !g_hash_table_contains (names, name))
+        g_hash_table_insert (names, g_strdup (name), it->data);
+    }
+
+  states = g_hash_table_new (NULL, NULL);
+  for (it = tables; it; it = it->next)
+    _gda_db_catalog_sort_table (GDA_DB_TABLE (it->data), names, states, &sorted);
+
+  g_hash_table_destroy (states);
+  g_hash_table_destroy (names);
+
+  return g_list_reverse (sorted);
+}
+
+/*
+ * A modification of the database by gda_db_catalog_perform_operation(): either the update of
+ * an existing table (@mobj being its meta data), or the creation of a table using @op
+ */
+typedef struct {
+  GdaDbTable         *table;
+  GdaMetaDbObject    *mobj;
+  GdaServerOperation *op;
+} CatalogTableStep;
+
+static void
+_gda_db_catalog_table_step_free (CatalogTableStep *step)
+{
+  if (step->op)
+    g_object_unref (step->op);
+  g_free (step);
+}
+
+/*
+ * Creates the CREATE_TABLE operation for @table, as gda_ddl_modifiable_create() would execute it
+ */
+static GdaServerOperation *
+_gda_db_catalog_prepare_create_table (GdaDbTable *table,
+                                      GdaConnection *cnc,
+                                      GError **error)
+{
+  GdaServerOperation *op;
+
+  op = gda_server_provider_create_operation (gda_connection_get_provider (cnc),
+                                             cnc,
+                                             GDA_SERVER_OPERATION_CREATE_TABLE,
+                                             NULL,
+                                             error);
+  if (!op)
+    return NULL;
+
+  g_object_set_data_full (G_OBJECT (op), "connection", g_object_ref (cnc), g_object_unref);
+
+  if (!gda_db_table_prepare_create (table, op, TRUE, error))
+    {
+      g_object_unref (op);
+      return NULL;
+    }
+
+  return op;
+}
+
 /**
  * gda_db_catalog_perform_operation:
  * @self: a #GdaDbCatalog object
@@ -937,6 +1063,13 @@ gda_db_catalog_append_view (GdaDbCatalog *self,
  * column exists but has different parameters, e.g. nonnull it will not be
  * modified.
  *
+ * Tables are handled in the order of their foreign keys: a table is created, or updated if
+ * it already exists, after the tables it references. All the CREATE_TABLE operations are prepared before the database
+ * is modified, and if the connection supports transactions and no transaction is already
+ * started, all the modifications are executed in a single transaction which is rolled back
+ * if an error occurs. Note that some databases (e.g. MySQL) implicitly commit each DDL
+ * statement, in which case the modifications already executed are not rolled back.
+ *
  * Note: Pkeys are not checked. This is a limitation that should be removed. The corresponding
  * issue was open on gitlab page.
  */
@@ -961,7 +1094,10 @@ gda_db_catalog_perform_operation (GdaDbCatalog *self,
   gda_lockable_lock ((GdaLockable*)priv->cnc);
 // We need to get MetaData
   if(!gda_connection_update_meta_store (priv->cnc, NULL, error))
-    return FALSE;
+    {
+      gda_lockable_unlock ((GdaLockable*) priv->cnc);
+      return FALSE;
+    }
 
   GdaMetaStore *mstore = gda_connection_get_meta_store (priv->cnc);
   GdaMetaStruct *mstruct = (GdaMetaStruct*) g_object_new (GDA_TYPE_META_STRUCT,
@@ -981,8 +1117,14 @@ gda_db_catalog_perform_operation (GdaDbCatalog *self,
   schema  = gda_value_new (G_TYPE_STRING);
   name    = gda_value_new (G_TYPE_STRING);
 
+  /* Tables to update and CREATE_TABLE operations (CatalogTableStep), in the order of the
+   * foreign keys, so that an existing table is also updated after the tables it references */
+  GList *sorted_tables = _gda_db_catalog_sort_tables (priv->mp_tables);
+  GList *steps = NULL;
+  gboolean transaction = FALSE;
+
   GList *it = NULL;
-  for (it = priv->mp_tables; it; it = it->next)
+  for (it = sorted_tables; it; it = it->next)
     {
       /* SQLite accepts only one possible value for schema: "main".
        * Other databases may also ignore schema and reference objects only by database and
@@ -994,20 +1136,23 @@ gda_db_catalog_perform_operation (GdaDbCatalog *self,
 
       mobj = gda_meta_struct_complement (mstruct, GDA_META_DB_TABLE, catalog, schema,name, NULL);
 
+      CatalogTableStep *step = g_new0 (CatalogTableStep, 1);
+      step->table = GDA_DB_TABLE (it->data);
+      steps = g_list_prepend (steps, step);
+
       if (mobj)
 				{
 					g_debug("Object %s was found in the database\n", gda_db_base_get_name(GDA_DB_BASE(it->data)));
-					st = gda_db_table_update (it->data,GDA_META_TABLE(mobj), priv->cnc, error);
-
-					if (!st)
-						break;
+					step->mobj = mobj;
 				}
 			else
 				{
-					st = gda_ddl_modifiable_create (GDA_DDL_MODIFIABLE (it->data), priv->cnc, NULL, error);
-
-					if (!st)
-						break;
+					step->op = _gda_db_catalog_prepare_create_table (step->table, priv->cnc, error);
+					if (!step->op)
+						{
+							st = FALSE;
+							break;
+						}
 				}
     } /* End of for loop */
 
@@ -1015,6 +1160,41 @@ gda_db_catalog_perform_operation (GdaDbCatalog *self,
   gda_value_free (schema);
   gda_value_free (name);
 
+  steps = g_list_reverse (steps);
+
+  if (st && gda_connection_supports_feature (priv->cnc, GDA_CONNECTION_FEATURE_TRANSACTIONS) &&
+      !gda_connection_get_transaction_status (priv->cnc))
+    {
+      st = gda_connection_begin_transaction (priv->cnc, NULL,
+                                             GDA_TRANSACTION_ISOLATION_SERVER_DEFAULT, error);
+      transaction = st;
+    }
+
+  if (st)
+    {
+      GdaServerProvider *provider = gda_connection_get_provider (priv->cnc);
+
+      for (it = steps; it; it = it->next)
+        {
+          CatalogTableStep *step = (CatalogTableStep*) it->data;
+
+          if (step->op)
+            {
+#ifdef GDA_DEBUG
+              gchar* str = gda_server_operation_render (step->op, NULL);
+              g_message ("Operation: %s", str);
+              g_free (str);
+#endif
+              st = gda_server_provider_perform_operation (provider, priv->cnc, step->op, error);
+            }
+          else
+            st = gda_db_table_update (step->table, GDA_META_TABLE (step->mobj), priv->cnc, error);
+
+          if (!st)
+            break;
+        }
+    }
+
   if (st) {
   /*TODO: add update option for views */
     for (it = priv->mp_views; it; it = it->next) {
@@ -1025,6 +1205,17 @@ gda_db_catalog_perform_operation (GdaDbCatalog *self,
     } /* End of for loop */
   }
 
+  if (transaction)
+    {
+      if (st)
+        st = gda_connection_commit_transaction (priv->cnc, NULL, error);
+
+      if (!st)
+        gda_connection_rollback_transaction (priv->cnc, NULL, NULL);
+    }
+
+  g_list_free_full (steps, (GDestroyNotify) _gda_db_catalog_table_step_free);
+  g_list_free (sorted_tables);
   g_object_unref (mstruct);
   gda_lockable_unlock ((GdaLockable*) priv->cnc);
 
@@ -309,9 +309,41 @@ compute_view_dependencies (GdaMetaStruct *mstruct, GdaMetaDbObject *view_dbobj,
 		g_assert_not_reached ();
 }
 
-static GdaMetaDbObject * _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
-						  const GValue *icatalog, const GValue *ischema, const GValue *iname, 
-						  const GValue *short_name, const GValue *full_name, 
+/*
+ * Bulk loading mode, used when all the database objects of a schema (or of the whole meta store)
+ * are complemented: each meta store table is read once, ordered so that the rows describing a
+ * database object (or one of its constraints) are contiguous, instead of running queries for each object.
+ */
+typedef struct {
+	gint first;
+	gint nrows;
+} MetaBulkRange;
+
+typedef struct {
+	GdaDataModel *model;
+	GHashTable   *ranges; /* key = [catalog].[schema].[name] or [catalog].[schema].[name].[constraint],
+			       * value = a MetaBulkRange */
+} MetaBulkSet;
+
+typedef struct {
+	MetaBulkSet  views;
+	MetaBulkSet  columns;
+	MetaBulkSet  pkeys;
+	MetaBulkSet  pk_columns;
+	MetaBulkSet  fkeys;
+	MetaBulkSet  fk_columns;
+	MetaBulkSet  declared_fkeys;
+	MetaBulkSet  declared_fk_columns;
+	GHashTable  *new_tables; /* tables completed while in bulk mode, their @reverse_fk_list is computed at the end */
+} MetaBulk;
+
+static GdaDataModel *meta_struct_extract (GdaMetaStruct *mstruct, MetaBulkSet *set, const gchar *sql,
+					  const GValue *catalog, const GValue *schema, const GValue *name,
+					  const GValue *constraint, gint *first, gint *nrows, GError **error);
+
+static GdaMetaDbObject * _meta_struct_complement (GdaMetaStruct *mstruct, MetaBulk *bulk, GdaMetaDbObjectType type,
+						  const GValue *icatalog, const GValue *ischema, const GValue *iname,
+						  const GValue *short_name, const GValue *full_name,
 						  const GValue *owner, GError **error);
 static gboolean determine_db_object_from_schema_and_name (GdaMetaStruct *mstruct,
 							  GdaMetaDbObjectType *int_out_type, GValue **out_catalog,
@@ -490,7 +522,7 @@ gda_meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 		}
 	}
 	type = real_type;
-	dbo = _meta_struct_complement (mstruct, type, icatalog, ischema, iname, short_name, full_name, owner, error);
+	dbo = _meta_struct_complement (mstruct, NULL, type, icatalog, ischema, iname, short_name, full_name, owner, error);
 
 	gda_value_free (icatalog);
 	gda_value_free (ischema);
@@ -528,7 +560,7 @@ policy_string_to_value (const gchar *string)
 
 /*
  * Find if there is already a declared foreign for @dbo to @ref_dbo using the columns
- * listed in @columns
+ * listed in the @nrows rows of @columns starting at @first
  *
  * @columns contains 4 columns, with no NULL value, and with nrows>0
  *  - @dbo's column name (string)
@@ -537,10 +569,10 @@ policy_string_to_value (const gchar *string)
  *  - @ref_dbo's column name ordinal position (int)
  */
 static GdaMetaTableForeignKey *
-find_real_foreign_key (GdaMetaTable *table, GdaMetaDbObject *ref_dbo, GdaDataModel *columns)
+find_real_foreign_key (GdaMetaTable *table, GdaMetaDbObject *ref_dbo, GdaDataModel *columns,
+		       gint first, gint nrows)
 {
 	GSList *list;
-	gint nrows = -1;
 	for (list = table->fk_list; list; list = list->next) {
 		GdaMetaTableForeignKey *fk = (GdaMetaTableForeignKey*) list->data;
 		gint i;
@@ -548,9 +580,6 @@ find_real_foreign_key (GdaMetaTable *table, GdaMetaDbObject *ref_dbo, GdaDataMod
 		if (fk->depend_on != ref_dbo)
 			continue;
 
-		if (nrows == -1)
-			nrows = gda_data_model_get_n_rows (columns);
-
 		if (nrows != fk->cols_nb)
 			continue;
 
@@ -561,7 +590,7 @@ find_real_foreign_key (GdaMetaTable *table, GdaMetaDbObject *ref_dbo, GdaDataMod
 			gint fk_pos, ref_pos;
 			gint j;
 			for (j = 0; j < 4; j++) {
-				cvalues[j] = gda_data_model_get_value_at (columns, j, i, NULL);
+				cvalues[j] = gda_data_model_get_value_at (columns, j, first + i, NULL);
 				if (!cvalues[j]) {
 					g_free (mapping);
 					goto out;
@@ -604,12 +633,12 @@ find_real_foreign_key (GdaMetaTable *table, GdaMetaDbObject *ref_dbo, GdaDataMod
 }
 
 static gboolean
-add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **error)
+add_declared_foreign_keys (GdaMetaStruct *mstruct, MetaBulk *bulk, GdaMetaTable *mt, GError **error)
 {
 	const gchar *sql1 = "SELECT DISTINCT constraint_name, ref_table_catalog, ref_table_schema, ref_table_name FROM __declared_fk WHERE table_catalog = ##tc::string AND table_schema = ##ts::string AND table_name = ##tname::string ORDER BY constraint_name, ref_table_catalog, ref_table_schema, ref_table_name";
 	const gchar *sql2 = "select de.column_name, c.ordinal_position, de.ref_column_name, rc.ordinal_position FROM __declared_fk de LEFT JOIN _columns c ON (de.table_catalog=c.table_catalog AND de.table_schema=c.table_schema AND de.table_name=c.table_name AND de.column_name=c.column_name) LEFT JOIN _columns rc ON (de.ref_table_catalog=rc.table_catalog AND de.ref_table_schema=rc.table_schema AND de.ref_table_name=rc.table_name AND de.ref_column_name=rc.column_name) WHERE de.constraint_name=##cname::string AND de.table_catalog=##tc::string AND de.table_schema=##ts::string AND de.table_name=##tname::string";
 	GdaDataModel *model, *cmodel = NULL;
-	gint i, nrows;
+	gint i, first, nrows;
 	GValue *v1, *v2, *v3;
 	GdaMetaDbObject *dbo;
 	GdaMetaStructPrivate *priv = gda_meta_struct_get_instance_private (mstruct);
@@ -618,17 +647,17 @@ add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **er
 	g_value_set_string ((v1 = gda_value_new (G_TYPE_STRING)), dbo->obj_catalog);
 	g_value_set_string ((v2 = gda_value_new (G_TYPE_STRING)), dbo->obj_schema);
 	g_value_set_string ((v3 = gda_value_new (G_TYPE_STRING)), dbo->obj_name);
-	model = gda_meta_store_extract (priv->store, sql1,
-					error, "tc", v1, "ts", v2, "tname", v3, NULL);
+	model = meta_struct_extract (mstruct, bulk ? &(bulk->declared_fkeys) : NULL, sql1,
+				     v1, v2, v3, NULL, &first, &nrows, error);
 	if (!model) 
 		goto onerror;
 
-	nrows = gda_data_model_get_n_rows (model);
-	for (i = 0; i < nrows; i++) {
+	for (i = first; i < first + nrows; i++) {
 		GdaMetaDbObject *ref_dbo = NULL;
 		GdaMetaTableForeignKey *tfk = NULL;
 		const GValue *fk_catalog, *fk_schema, *fk_tname, *fk_name;
 		gboolean ignore = FALSE;
+		gint j, cfirst, cnrows;
 
 		fk_name = gda_data_model_get_value_at (model, 0, i, error);
 		if (!fk_name) goto onerror;		
@@ -640,9 +669,12 @@ add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **er
 		if (!fk_tname) goto onerror;
 
 		/* get columns */
-		cmodel = gda_meta_store_extract (priv->store, sql2,
-						 error, "tc", v1, "ts", v2, "tname", v3,
-						 "cname", fk_name, NULL);
+		if (cmodel) {
+			g_object_unref (cmodel);
+			cmodel = NULL;
+		}
+		cmodel = meta_struct_extract (mstruct, bulk ? &(bulk->declared_fk_columns) : NULL, sql2,
+					      v1, v2, v3, fk_name, &cfirst, &cnrows, error);
 		if (!cmodel) 
 			goto onerror;
 
@@ -656,8 +688,6 @@ add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **er
 		
 		/* ignore if some columns are not found in the schema
 		 * (maybe wrong or outdated FK decl) */
-		gint j, cnrows;
-		cnrows = gda_data_model_get_n_rows (cmodel);
 		if (cnrows == 0)
 			ignore = TRUE;
 		else {
@@ -669,7 +699,7 @@ add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **er
 		}
 		for (j = 0; j < cnrows; j++) {
 			const GValue *ov;
-			ov = gda_data_model_get_value_at (cmodel, 0, j, error);
+			ov = gda_data_model_get_value_at (cmodel, 0, cfirst + j, error);
 			if (!ov) goto onerror;
 			if (G_VALUE_TYPE (ov) != G_TYPE_STRING) {
 				ignore = TRUE;
@@ -677,7 +707,7 @@ add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **er
 			}
 			tfk->fk_names_array [j] = g_value_dup_string (ov);
 
-			ov = gda_data_model_get_value_at (cmodel, 1, j, error);
+			ov = gda_data_model_get_value_at (cmodel, 1, cfirst + j, error);
 			if (!ov) goto onerror;
 			if (G_VALUE_TYPE (ov) != G_TYPE_INT) {
 				ignore = TRUE;
@@ -685,7 +715,7 @@ add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **er
 			}
 			tfk->fk_cols_array [j] = g_value_get_int (ov);
 
-			ov = gda_data_model_get_value_at (cmodel, 2, j, error);
+			ov = gda_data_model_get_value_at (cmodel, 2, cfirst + j, error);
 			if (!ov) goto onerror;
 			if (G_VALUE_TYPE (ov) != G_TYPE_STRING) {
 				ignore = TRUE;
@@ -693,7 +723,7 @@ add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **er
 			}
 			tfk->ref_pk_names_array [j] = g_value_dup_string (ov);
 
-			ov = gda_data_model_get_value_at (cmodel, 3, j, error);
+			ov = gda_data_model_get_value_at (cmodel, 3, cfirst + j, error);
 			if (!ov) goto onerror;
 			if (G_VALUE_TYPE (ov) != G_TYPE_INT) {
 				ignore = TRUE;
@@ -706,7 +736,7 @@ add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **er
 		if (! ignore) {
 			ref_dbo = _meta_struct_get_db_object (mstruct, fk_catalog,
 							      fk_schema, fk_tname);
-			if (ref_dbo && find_real_foreign_key (mt, ref_dbo, cmodel))
+			if (ref_dbo && find_real_foreign_key (mt, ref_dbo, cmodel, cfirst, cnrows))
 				ignore = TRUE;
 		}
 		if (ignore) {
@@ -730,7 +760,8 @@ add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **er
 					       g_value_get_string (fk_tname));
 			g_hash_table_insert (priv->index, str, tfk->depend_on);
 		}
-		else if (tfk->depend_on->obj_type == GDA_META_DB_TABLE) {
+		else if ((tfk->depend_on->obj_type == GDA_META_DB_TABLE) &&
+			 (!bulk || !g_hash_table_contains (bulk->new_tables, tfk->depend_on))) {
 			GdaMetaTable *dot = GDA_META_TABLE (tfk->depend_on);
 			dot->reverse_fk_list = g_slist_prepend (dot->reverse_fk_list, tfk);
 		}
@@ -760,13 +791,80 @@ add_declared_foreign_keys (GdaMetaStruct *mstruct, GdaMetaTable *mt, GError **er
 	return FALSE;
 }
 
+/*
+ * Computes @tfk's @ref_pk_cols_array and adds @tfk to the @reverse_fk_list of the table it references
+ */
+static gboolean
+add_reverse_fk (GdaMetaStruct *mstruct, GdaMetaTableForeignKey *tfk, gboolean append, GError **error)
+{
+	GdaMetaTable *ref_mt = GDA_META_TABLE (tfk->depend_on);
+	gint i;
+
+	for (i = 0; i < tfk->cols_nb; i++) {
+		gint col;
+		GdaMetaTableColumn *r_tcol;
+		GValue *r_val;
+
+		if (tfk->ref_pk_cols_array[i] != -1) /* already correctly set */
+			continue;
+
+		if (tfk->depend_on->obj_type != GDA_META_DB_TABLE)
+			continue; /* can't be set now */
+
+		g_value_set_string ((r_val = gda_value_new (G_TYPE_STRING)), tfk->ref_pk_names_array[i]);
+		r_tcol = gda_meta_struct_get_table_column (mstruct, ref_mt, r_val);
+		gda_value_free (r_val);
+		col = g_slist_index (ref_mt->columns, r_tcol);
+		if (!r_tcol || (col < 0)) {
+			g_set_error (error, GDA_META_STRUCT_ERROR, GDA_META_STRUCT_INCOHERENCE_ERROR,
+				     _("Foreign key column '%s' not found in table '%s'"),
+				     tfk->ref_pk_names_array[i], tfk->depend_on->obj_name);
+			return FALSE;
+		}
+		tfk->ref_pk_cols_array[i] = col;
+	}
+
+	if (append)
+		ref_mt->reverse_fk_list = g_slist_append (ref_mt->reverse_fk_list, tfk);
+	else
+		ref_mt->reverse_fk_list = g_slist_prepend (ref_mt->reverse_fk_list, tfk);
+	return TRUE;
+}
+
+/*
+ * compute GdaMetaTableForeignKey's @ref_pk_cols_array arrays and GdaMetaTable' @reverse_fk_list lists
+ * for the foreign keys referencing @dbo
+ */
+static gboolean
+compute_reverse_fks (GdaMetaStruct *mstruct, GdaMetaDbObject *dbo, GError **error)
+{
+	GdaMetaStructPrivate *priv = gda_meta_struct_get_instance_private (mstruct);
+	GSList *list;
+	for (list = priv->db_objects; list; list = list->next) {
+		GdaMetaDbObject *tmpdbo;
+		tmpdbo = GDA_META_DB_OBJECT (list->data);
+		if (tmpdbo->obj_type != GDA_META_DB_TABLE)
+			continue;
+
+		GdaMetaTable *mt = GDA_META_TABLE (tmpdbo);
+		GSList *klist;
+		for (klist = mt->fk_list; klist; klist = klist->next) {
+			GdaMetaTableForeignKey *tfk = GDA_META_TABLE_FOREIGN_KEY (klist->data);
+			if ((tfk->depend_on == dbo) && !add_reverse_fk (mstruct, tfk, TRUE, error))
+				return FALSE;
+		}
+	}
+	return TRUE;
+}
+
 static GdaMetaDbObject *
-_meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
+_meta_struct_complement (GdaMetaStruct *mstruct, MetaBulk *bulk, GdaMetaDbObjectType type,
 			 const GValue *icatalog, const GValue *ischema, const GValue *iname, 
 			 const GValue *short_name, const GValue *full_name, const GValue *owner, GError **error)
 {
 	/* at this point icatalog, ischema and iname are NOT NULL */
 	GdaMetaDbObject *dbo = NULL;
+	gboolean is_new = FALSE;
 	const GValue *cvalue;
 	GdaMetaStructPrivate *priv = gda_meta_struct_get_instance_private (mstruct);
 
@@ -774,6 +872,7 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 	dbo = _meta_struct_get_db_object (mstruct, icatalog, ischema, iname);
 	if (!dbo) {
 		dbo = g_new0 (GdaMetaDbObject, 1);
+		is_new = TRUE;
 		dbo->obj_catalog = g_strdup (g_value_get_string (icatalog));
 		dbo->obj_schema = g_strdup (g_value_get_string (ischema));
 		dbo->obj_name = g_strdup (g_value_get_string (iname));
@@ -804,14 +903,13 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 			"WHERE table_catalog = ##tc::string "
 			"AND table_schema = ##ts::string AND table_name = ##tname::string";
 		GdaDataModel *model;
-		gint nrows;
+		gint first, nrows;
 		GdaMetaView *mv;
 
-		model = gda_meta_store_extract (priv->store, sql,
-						error, "tc", icatalog, "ts", ischema, "tname", iname, NULL);
+		model = meta_struct_extract (mstruct, bulk ? &(bulk->views) : NULL, sql,
+					     icatalog, ischema, iname, NULL, &first, &nrows, error);
 		if (!model) 
 			goto onerror;
-		nrows = gda_data_model_get_n_rows (model);
 		if (nrows < 1) {
 			g_object_unref (model);
 			g_set_error (error, GDA_META_STRUCT_ERROR, GDA_META_STRUCT_UNKNOWN_OBJECT_ERROR,
@@ -822,36 +920,37 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 		}
 		
 		if (!dbo->obj_short_name) {
-			cvalue = gda_data_model_get_value_at (model, 2, 0, error);
-			if (!cvalue) goto onerror;
+			cvalue = gda_data_model_get_value_at (model, 2, first, error);
+			if (!cvalue) goto onviewerror;
 			dbo->obj_short_name = g_value_dup_string (cvalue);
 		}
 		if (!dbo->obj_full_name) {
-			cvalue = gda_data_model_get_value_at (model, 3, 0, error);
-			if (!cvalue) goto onerror;
+			cvalue = gda_data_model_get_value_at (model, 3, first, error);
+			if (!cvalue) goto onviewerror;
 			dbo->obj_full_name = g_value_dup_string (cvalue);
 		}
 		if (!dbo->obj_owner) {
-			cvalue = gda_data_model_get_value_at (model, 4, 0, error);
-			if (!cvalue) goto onerror;
+			cvalue = gda_data_model_get_value_at (model, 4, first, error);
+			if (!cvalue) goto onviewerror;
 			if (!gda_value_is_null (cvalue))
 				dbo->obj_owner = g_value_dup_string (cvalue);
 		}
 
 		mv = GDA_META_VIEW (dbo);
-		cvalue = gda_data_model_get_value_at (model, 0, 0, error);
-		if (!cvalue) goto onerror;
+		cvalue = gda_data_model_get_value_at (model, 0, first, error);
+		if (!cvalue) goto onviewerror;
 		if (G_VALUE_TYPE (cvalue) != GDA_TYPE_NULL)
 			mv->view_def = g_value_dup_string (cvalue);
 		else
 			mv->view_def = g_strdup ("");
 
-		cvalue = gda_data_model_get_value_at (model, 1, 0, error);
-		if (!cvalue) goto onerror;
+		cvalue = gda_data_model_get_value_at (model, 1, first, error);
+		if (!cvalue) goto onviewerror;
 		if (G_VALUE_TYPE (cvalue) != GDA_TYPE_NULL)
 			mv->is_updatable = g_value_get_boolean (cvalue);
 		else
 			mv->is_updatable = FALSE;
+		g_object_unref (model);
 
 		/* view's dependencies, from its definition */
 		if ((priv->features & GDA_META_STRUCT_FEATURE_VIEW_DEPENDENCIES) &&
@@ -878,20 +977,23 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 			}
 		}
         	break;
+
+	onviewerror:
+		g_object_unref (model);
+		goto onerror;
 	}
 	case GDA_META_DB_TABLE: {
 		/* columns */
 		gchar *sql = "SELECT c.column_name, c.data_type, c.gtype, c.is_nullable, t.table_short_name, t.table_full_name, c.column_default, t.table_owner, c.array_spec, c.extra, c.column_comments, coalesce (c.character_maximum_length, c.character_octet_length) FROM _tables as t LEFT NATURAL JOIN _columns as c WHERE table_catalog = ##tc::string AND table_schema = ##ts::string AND table_name = ##tname::string ORDER BY ordinal_position";
 		GdaMetaTable *mt;
 		GdaDataModel *model;
-		gint i, nrows;
+		gint i, first, nrows;
 
-		model = gda_meta_store_extract (priv->store, sql,
-						error, "tc", icatalog, "ts", ischema, "tname", iname, NULL);
+		model = meta_struct_extract (mstruct, bulk ? &(bulk->columns) : NULL, sql,
+					     icatalog, ischema, iname, NULL, &first, &nrows, error);
 		if (!model) 
 			goto onerror;
 
-		nrows = gda_data_model_get_n_rows (model);
 		if (nrows < 1) {
 			g_object_unref (model);
 			g_set_error (error, GDA_META_STRUCT_ERROR, GDA_META_STRUCT_UNKNOWN_OBJECT_ERROR,
@@ -901,23 +1003,23 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 			goto onerror;
 		}
 		if (!dbo->obj_short_name) {
-			cvalue = gda_data_model_get_value_at (model, 4, 0, error);
+			cvalue = gda_data_model_get_value_at (model, 4, first, error);
 			if (!cvalue) goto onerror;
 			dbo->obj_short_name = g_value_dup_string (cvalue);
 		}
 		if (!dbo->obj_full_name) {
-			cvalue = gda_data_model_get_value_at (model, 5, 0, error);
+			cvalue = gda_data_model_get_value_at (model, 5, first, error);
 			if (!cvalue) goto onerror;
 			dbo->obj_full_name = g_value_dup_string (cvalue);
 		}
 		if (!dbo->obj_owner) {
-			cvalue = gda_data_model_get_value_at (model, 7, 0, error);
+			cvalue = gda_data_model_get_value_at (model, 7, first, error);
 			if (!cvalue) goto onerror;
 			if (!gda_value_is_null (cvalue))
 				dbo->obj_owner = g_value_dup_string (cvalue);
 		}
 
-		cvalue = gda_data_model_get_value_at (model, 0, 0, error);
+		cvalue = gda_data_model_get_value_at (model, 0, first, error);
 		if (cvalue && (G_VALUE_TYPE (cvalue) == GDA_TYPE_NULL)) {
 			if (type == GDA_META_DB_VIEW) {
 				/* we don't have the list of columns for the view.
@@ -926,7 +1028,7 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 			}
 		}
 		mt = GDA_META_TABLE (dbo);
-		for (i = 0; i < nrows; i++) {
+		for (i = first; i < first + nrows; i++) {
 			GdaMetaTableColumn *tcol;
 			const gchar *cstr = NULL;
 			gint len = -1;
@@ -1005,32 +1107,28 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 
 		/* primary key */
 		sql = "SELECT constraint_name FROM _table_constraints WHERE constraint_type='PRIMARY KEY' AND table_catalog = ##tc::string AND table_schema = ##ts::string AND table_name = ##tname::string";
-		model = gda_meta_store_extract (priv->store, sql,
-						error, "tc", icatalog, "ts", ischema, "tname", iname, NULL);
+		model = meta_struct_extract (mstruct, bulk ? &(bulk->pkeys) : NULL, sql,
+					     icatalog, ischema, iname, NULL, &first, &nrows, error);
 		if (!model) 
 			goto onerror;
 
-		nrows = gda_data_model_get_n_rows (model);
 		if (nrows >= 1) {
 			GdaDataModel *pkmodel;
-			sql = "SELECT column_name FROM _key_column_usage WHERE table_catalog = ##cc::string AND table_schema = ##cs::string AND table_name = ##tname::string AND constraint_name = ##cname::string ORDER BY ordinal_position";
-			cvalue = gda_data_model_get_value_at (model, 0, 0, error);
+			gint pkfirst;
+			sql = "SELECT column_name FROM _key_column_usage WHERE table_catalog = ##tc::string AND table_schema = ##ts::string AND table_name = ##tname::string AND constraint_name = ##cname::string ORDER BY ordinal_position";
+			cvalue = gda_data_model_get_value_at (model, 0, first, error);
 			if (!cvalue) goto onerror;
-			pkmodel = gda_meta_store_extract (priv->store, sql, error,
-							  "cc", icatalog,
-							  "cs", ischema,
-							  "tname", iname,
-							  "cname", cvalue, NULL);
+			pkmodel = meta_struct_extract (mstruct, bulk ? &(bulk->pk_columns) : NULL, sql,
+						       icatalog, ischema, iname, cvalue, &pkfirst, &nrows, error);
 			if (!pkmodel) {
 				g_object_unref (model);
 				goto onerror;
 			}
-			nrows = gda_data_model_get_n_rows (pkmodel);
 			mt->pk_cols_nb = nrows;
 			mt->pk_cols_array = g_new0 (gint, mt->pk_cols_nb);
 			for (i = 0; i < nrows; i++) {
 				GdaMetaTableColumn *tcol;
-				cvalue = gda_data_model_get_value_at (pkmodel, 0, i, error);
+				cvalue = gda_data_model_get_value_at (pkmodel, 0, pkfirst + i, error);
 				if (!cvalue) goto onerror;
 				tcol = gda_meta_struct_get_table_column (mstruct, mt, cvalue);
 				if (!tcol) {
@@ -1053,21 +1151,20 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 		/* foreign keys */
 		if (priv->features & GDA_META_STRUCT_FEATURE_FOREIGN_KEYS) {
 			sql = "SELECT ref_table_catalog, ref_table_schema, ref_table_name, constraint_name, ref_constraint_name, update_rule, delete_rule, constraint_name FROM _referential_constraints WHERE table_catalog = ##tc::string AND table_schema = ##ts::string AND table_name = ##tname::string";
-			model = gda_meta_store_extract (priv->store, sql, error,
-							"tc", icatalog, 
-							"ts", ischema, 
-							"tname", iname, NULL);
+			model = meta_struct_extract (mstruct, bulk ? &(bulk->fkeys) : NULL, sql,
+						     icatalog, ischema, iname, NULL, &first, &nrows, error);
 			if (!model) 
 				goto onerror;
 			
-			nrows = gda_data_model_get_n_rows (model);
-			for (i = 0; i < nrows; i++) {
+			for (i = first; i < first + nrows; i++) {
 				GdaMetaTableForeignKey *tfk = NULL;
 				const GValue *fk_catalog, *fk_schema, *fk_tname, *fk_name;
 				const GValue *upd_policy, *del_policy;
 
 				GdaDataModel *fk_cols = NULL;
 				GdaDataModel *ref_pk_cols = NULL;
+				gint fk_first, ref_pk_first;
+				gint fk_nrows, ref_pk_nrows;
 
 				fk_catalog = gda_data_model_get_value_at (model, 0, i, error);
 				if (!fk_catalog) goto onfkerror;
@@ -1099,7 +1196,8 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 							       g_value_get_string (fk_tname));
 					g_hash_table_insert (priv->index, str, tfk->depend_on);
 				}
-				else if (tfk->depend_on->obj_type == GDA_META_DB_TABLE) {
+				else if ((tfk->depend_on->obj_type == GDA_META_DB_TABLE) &&
+					 (!bulk || !g_hash_table_contains (bulk->new_tables, tfk->depend_on))) {
 					GdaMetaTable *dot = GDA_META_TABLE (tfk->depend_on);
 					dot->reverse_fk_list = g_slist_prepend (dot->reverse_fk_list, tfk);
 				}
@@ -1123,28 +1221,21 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 				gboolean fkerror = FALSE;
 				cvalue = gda_data_model_get_value_at (model, 3, i, error);
 				if (!cvalue) goto onfkerror;
-				fk_cols = gda_meta_store_extract (priv->store, sql, error,
-								  "tc", icatalog, 
-								  "ts", ischema, 
-								  "tname", iname, 
-								  "cname", cvalue, NULL);
+				fk_cols = meta_struct_extract (mstruct, bulk ? &(bulk->fk_columns) : NULL, sql,
+							       icatalog, ischema, iname, cvalue,
+							       &fk_first, &fk_nrows, error);
 				/*g_print ("tname=%s cvalue=%s\n", gda_value_stringify (iname),
 				  gda_value_stringify (cvalue));*/
 
 				cvalue = gda_data_model_get_value_at (model, 4, i, error);
 				if (!cvalue) goto onfkerror;
-				ref_pk_cols = gda_meta_store_extract (priv->store, sql, error,
-								      "tc", fk_catalog,
-								      "ts", fk_schema,
-								      "tname", fk_tname,
-								      "cname", cvalue, NULL);
+				ref_pk_cols = meta_struct_extract (mstruct, bulk ? &(bulk->fk_columns) : NULL, sql,
+								   fk_catalog, fk_schema, fk_tname, cvalue,
+								   &ref_pk_first, &ref_pk_nrows, error);
 				/*g_print ("tname=%s cvalue=%s\n", gda_value_stringify (fk_tname),
 				  gda_value_stringify (cvalue));*/
 				
 				if (fk_cols && ref_pk_cols) {
-					gint fk_nrows, ref_pk_nrows;
-					fk_nrows = gda_data_model_get_n_rows (fk_cols);
-					ref_pk_nrows = gda_data_model_get_n_rows (ref_pk_cols);
 					if (fk_nrows != ref_pk_nrows) {
 						/*gda_data_model_dump (fk_cols, stdout);
 						  gda_data_model_dump (ref_pk_cols, stdout);*/
@@ -1165,19 +1256,19 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 						tfk->ref_pk_names_array = g_new0 (gchar *, fk_nrows);
 						for (n = 0; n < fk_nrows; n++) {
 							const GValue *cv;
-							cv = gda_data_model_get_value_at (fk_cols, 1, n, error);
+							cv = gda_data_model_get_value_at (fk_cols, 1, fk_first + n, error);
 							if (!cv) goto onfkerror;
 							tfk->fk_cols_array [n] = g_value_get_int (cv);
 
-							cv = gda_data_model_get_value_at (fk_cols, 0, n, error);
+							cv = gda_data_model_get_value_at (fk_cols, 0, fk_first + n, error);
 							if (!cv) goto onfkerror;
 							tfk->fk_names_array [n] = g_value_dup_string (cv);
 
-							cv = gda_data_model_get_value_at (ref_pk_cols, 1, n, error);
+							cv = gda_data_model_get_value_at (ref_pk_cols, 1, ref_pk_first + n, error);
 							if (!cv) goto onfkerror;
 							tfk->ref_pk_cols_array [n] = g_value_get_int (cv);
 
-							cv = gda_data_model_get_value_at (ref_pk_cols, 0, n, error);
+							cv = gda_data_model_get_value_at (ref_pk_cols, 0, ref_pk_first + n, error);
 							if (!cv) goto onfkerror;
 							tfk->ref_pk_names_array [n] = g_value_dup_string (cv);
 						}
@@ -1219,7 +1310,7 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 			g_object_unref (model);
 			/* Note: mt->reverse_fk_list is not determined here */
 
-			add_declared_foreign_keys (mstruct, mt, NULL);
+			add_declared_foreign_keys (mstruct, bulk, mt, NULL);
 		}
 		
 		break;
@@ -1228,7 +1319,7 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 		TO_IMPLEMENT;
 	}
 
-	if (dbo && !g_slist_find (priv->db_objects, dbo)) {
+	if (dbo && is_new) {
 		gchar *str;
 		priv->db_objects = g_slist_append (priv->db_objects, dbo);
 		str = g_strdup_printf ("%s.%s.%s", g_value_get_string (icatalog), 
@@ -1238,52 +1329,12 @@ _meta_struct_complement (GdaMetaStruct *mstruct, GdaMetaDbObjectType type,
 	}
 	if (dbo && (dbo->obj_type == GDA_META_DB_TABLE) &&
 	    (priv->features & GDA_META_STRUCT_FEATURE_FOREIGN_KEYS)) {
-		/* compute GdaMetaTableForeignKey's @ref_pk_cols_array arrays and GdaMetaTable' @reverse_fk_list lists*/
-		GSList *list;
-		for (list = priv->db_objects; list; list = list->next) {
-			GdaMetaDbObject *tmpdbo;
-			tmpdbo = GDA_META_DB_OBJECT (list->data);
-			if (tmpdbo->obj_type != GDA_META_DB_TABLE)
-				continue;
-
-			GdaMetaTable *mt = GDA_META_TABLE (tmpdbo);
-			GSList *klist;
-			for (klist = mt->fk_list; klist; klist = klist->next) {
-				GdaMetaTableForeignKey *tfk = GDA_META_TABLE_FOREIGN_KEY (klist->data);
-				GdaMetaTable *ref_mt = GDA_META_TABLE (tfk->depend_on);
-				gint i;
-
-				if (tfk->depend_on != dbo)
-					continue;
-
-				for (i = 0; i < tfk->cols_nb; i++) {
-					gint col;
-					GdaMetaTableColumn *r_tcol;
-					GValue *r_val;
-
-					if (tfk->ref_pk_cols_array[i] != -1) /* already correctly set */
-						continue;
-
-					if (tfk->depend_on->obj_type != GDA_META_DB_TABLE)
-						continue; /* can't be set now */
-
-					g_value_set_string ((r_val = gda_value_new (G_TYPE_STRING)), tfk->ref_pk_names_array[i]);
-					r_tcol = gda_meta_struct_get_table_column (mstruct, ref_mt, r_val);
-					gda_value_free (r_val);
-					col = g_slist_index (ref_mt->columns, r_tcol);
-					if (!r_tcol || (col < 0)) {
-						g_set_error (error, GDA_META_STRUCT_ERROR, GDA_META_STRUCT_INCOHERENCE_ERROR,
-							     _("Foreign key column '%s' not found in table '%s'"),
-							     tfk->ref_pk_names_array[i], tfk->depend_on->obj_name);
-						dbo = NULL;
-						goto onerror;
-					}
-					tfk->ref_pk_cols_array[i] = col;
-				}
-				
-				GDA_META_TABLE (dbo)->reverse_fk_list = g_slist_append (GDA_META_TABLE (dbo)->reverse_fk_list,
-											tfk);
-			}
+		if (bulk)
+			/* done once all the tables have been loaded, see meta_bulk_compute_reverse_fks() */
+			g_hash_table_add (bulk->new_tables, dbo);
+		else if (!compute_reverse_fks (mstruct, dbo, error)) {
+			dbo = NULL;
+			goto onerror;
 		}
 	}
 	return dbo;
@@ -1339,6 +1390,311 @@ array_type_to_sql (GdaMetaStore *store, const GValue *specific_name)
 	return str;
 }
 
+/*
+ * Returns: a new key for the "ranges" hash table of a MetaBulkSet, or %NULL if one of the values
+ * is not a string
+ */
+static gchar *
+meta_bulk_make_key (const GValue *catalog, const GValue *schema, const GValue *name, const GValue *constraint)
+{
+	if ((G_VALUE_TYPE (catalog) != G_TYPE_STRING) || (G_VALUE_TYPE (schema) != G_TYPE_STRING) ||
+	    (G_VALUE_TYPE (name) != G_TYPE_STRING) ||
+	    (constraint && (G_VALUE_TYPE (constraint) != G_TYPE_STRING)))
+		return NULL;
+	if (constraint)
+		return g_strdup_printf ("%s.%s.%s.%s", g_value_get_string (catalog), g_value_get_string (schema),
+					g_value_get_string (name), g_value_get_string (constraint));
+	else
+		return g_strdup_printf ("%s.%s.%s", g_value_get_string (catalog), g_value_get_string (schema),
+					g_value_get_string (name));
+}
+
+/*
+ * Runs @sql, whose columns @key_col to @key_col + 2 are the catalog, schema and name of a database
+ * object (followed by a constraint name if @with_constraint is %TRUE), and whose rows are ordered
+ * by those columns.
+ */
+static gboolean
+meta_bulk_set_load (MetaBulkSet *set, GdaMetaStore *store, const gchar *sql, GHashTable *vars,
+		    gint key_col, gboolean with_constraint, GError **error)
+{
+	MetaBulkRange *range = NULL;
+	const gchar *current_key = NULL;
+	gint i, nrows;
+
+	set->model = gda_meta_store_extract_v (store, sql, vars, error);
+	if (!set->model)
+		return FALSE;
+	set->ranges = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+
+	nrows = gda_data_model_get_n_rows (set->model);
+	for (i = 0; i < nrows; i++) {
+		const GValue *cvalues[4];
+		gchar *key;
+		gint k;
+
+		for (k = 0; k < (with_constraint ? 4 : 3); k++) {
+			cvalues [k] = gda_data_model_get_value_at (set->model, key_col + k, i, error);
+			if (!cvalues [k])
+				return FALSE;
+		}
+		key = meta_bulk_make_key (cvalues [0], cvalues [1], cvalues [2],
+					  with_constraint ? cvalues [3] : NULL);
+		if (!key) {
+			range = NULL;
+			continue;
+		}
+		if (range && !strcmp (key, current_key)) {
+			range->nrows++;
+			g_free (key);
+			continue;
+		}
+		if (g_hash_table_lookup (set->ranges, key)) {
+			g_set_error (error, GDA_META_STRUCT_ERROR, GDA_META_STRUCT_INCOHERENCE_ERROR,
+				     _("Internal GdaMetaStore error: rows for %s are not contiguous"), key);
+			g_free (key);
+			return FALSE;
+		}
+		range = g_new (MetaBulkRange, 1);
+		range->first = i;
+		range->nrows = 1;
+		g_hash_table_insert (set->ranges, key, range);
+		current_key = key;
+	}
+	return TRUE;
+}
+
+static void
+meta_bulk_set_clear (MetaBulkSet *set)
+{
+	if (set->model)
+		g_object_unref (set->model);
+	if (set->ranges)
+		g_hash_table_destroy (set->ranges);
+}
+
+static void
+meta_bulk_free (MetaBulk *bulk)
+{
+	meta_bulk_set_clear (&(bulk->views));
+	meta_bulk_set_clear (&(bulk->columns));
+	meta_bulk_set_clear (&(bulk->pkeys));
+	meta_bulk_set_clear (&(bulk->pk_columns));
+	meta_bulk_set_clear (&(bulk->fkeys));
+	meta_bulk_set_clear (&(bulk->fk_columns));
+	meta_bulk_set_clear (&(bulk->declared_fkeys));
+	meta_bulk_set_clear (&(bulk->declared_fk_columns));
+	g_hash_table_destroy (bulk->new_tables);
+	g_free (bulk);
+}
+
+/*
+ * Reads all the meta store tables used by _meta_struct_complement(), restricted to the @schema schema
+ * (and @catalog catalog) if not %NULL. Foreign keys columns are not restricted as they are also used
+ * for the referenced tables.
+ */
+static MetaBulk *
+meta_bulk_new (GdaMetaStruct *mstruct, const GValue *catalog, const GValue *schema, GError **error)
+{
+	MetaBulk *bulk;
+	GHashTable *vars;
+	gchar *where, *and_where, *de_where, *sql;
+	gboolean ok;
+	GdaMetaStructPrivate *priv = gda_meta_struct_get_instance_private (mstruct);
+
+	vars = g_hash_table_new (g_str_hash, g_str_equal);
+	if (schema) {
+		const gchar *cond = catalog ? "table_schema = ##schema::string AND table_catalog = ##cat::string" :
+			"table_schema = ##schema::string";
+		const gchar *de_cond = catalog ? "de.table_schema = ##schema::string AND de.table_catalog = ##cat::string" :
+			"de.table_schema = ##schema::string";
+		where = g_strdup_printf (" WHERE %s", cond);
+		and_where = g_strdup_printf (" AND %s", cond);
+		de_where = g_strdup_printf (" WHERE %s", de_cond);
+		g_hash_table_insert (vars, "schema", (gpointer) schema);
+		if (catalog)
+			g_hash_table_insert (vars, "cat", (gpointer) catalog);
+	}
+	else {
+		where = g_strdup ("");
+		and_where = g_strdup ("");
+		de_where = g_strdup ("");
+	}
+
+	bulk = g_new0 (MetaBulk, 1);
+	bulk->new_tables = g_hash_table_new (NULL, NULL);
+
+	sql = g_strdup_printf ("SELECT view_definition, is_updatable, table_short_name, table_full_name, table_owner, "
+			       "table_catalog, table_schema, table_name "
+			       "FROM _views NATURAL JOIN _tables%s "
+			       "ORDER BY table_catalog, table_schema, table_name", where);
+	ok = meta_bulk_set_load (&(bulk->views), priv->store, sql, vars, 5, FALSE, error);
+	g_free (sql);
+	if (!ok) goto onerror;
+
+	sql = g_strdup_printf ("SELECT c.column_name, c.data_type, c.gtype, c.is_nullable, t.table_short_name, "
+			       "t.table_full_name, c.column_default, t.table_owner, c.array_spec, c.extra, "
+			       "c.column_comments, coalesce (c.character_maximum_length, c.character_octet_length), "
+			       "table_catalog, table_schema, table_name "
+			       "FROM _tables as t LEFT NATURAL JOIN _columns as c%s "
+			       "ORDER BY table_catalog, table_schema, table_name, ordinal_position", where);
+	ok = meta_bulk_set_load (&(bulk->columns), priv->store, sql, vars, 12, FALSE, error);
+	g_free (sql);
+	if (!ok) goto onerror;
+
+	sql = g_strdup_printf ("SELECT constraint_name, table_catalog, table_schema, table_name "
+			       "FROM _table_constraints WHERE constraint_type='PRIMARY KEY'%s "
+			       "ORDER BY table_catalog, table_schema, table_name, constraint_name", and_where);
+	ok = meta_bulk_set_load (&(bulk->pkeys), priv->store, sql, vars, 1, FALSE, error);
+	g_free (sql);
+	if (!ok) goto onerror;
+
+	sql = g_strdup_printf ("SELECT column_name, table_catalog, table_schema, table_name, constraint_name "
+			       "FROM _key_column_usage%s "
+			       "ORDER BY table_catalog, table_schema, table_name, constraint_name, ordinal_position",
+			       where);
+	ok = meta_bulk_set_load (&(bulk->pk_columns), priv->store, sql, vars, 1, TRUE, error);
+	g_free (sql);
+	if (!ok) goto onerror;
+
+	if (priv->features & GDA_META_STRUCT_FEATURE_FOREIGN_KEYS) {
+		sql = g_strdup_printf ("SELECT ref_table_catalog, ref_table_schema, ref_table_name, constraint_name, "
+				       "ref_constraint_name, update_rule, delete_rule, constraint_name, "
+				       "table_catalog, table_schema, table_name "
+				       "FROM _referential_constraints%s "
+				       "ORDER BY table_catalog, table_schema, table_name, constraint_name", where);
+		ok = meta_bulk_set_load (&(bulk->fkeys), priv->store, sql, vars, 8, FALSE, error);
+		g_free (sql);
+		if (!ok) goto onerror;
+
+		if (!meta_bulk_set_load (&(bulk->fk_columns), priv->store,
+					 "SELECT k.column_name, c.ordinal_position, k.table_catalog, k.table_schema, "
+					 "k.table_name, k.constraint_name "
+					 "FROM _key_column_usage k INNER JOIN _columns c ON (c.table_catalog = k.table_catalog "
+					 "AND c.table_schema = k.table_schema AND c.table_name=k.table_name "
+					 "AND c.column_name=k.column_name) "
+					 "ORDER BY k.table_catalog, k.table_schema, k.table_name, k.constraint_name, "
+					 "k.ordinal_position", vars, 2, TRUE, error))
+			goto onerror;
+
+		sql = g_strdup_printf ("SELECT DISTINCT constraint_name, ref_table_catalog, ref_table_schema, ref_table_name, "
+				       "table_catalog, table_schema, table_name FROM __declared_fk%s "
+				       "ORDER BY table_catalog, table_schema, table_name, constraint_name, "
+				       "ref_table_catalog, ref_table_schema, ref_table_name", where);
+		ok = meta_bulk_set_load (&(bulk->declared_fkeys), priv->store, sql, vars, 4, FALSE, error);
+		g_free (sql);
+		if (!ok) goto onerror;
+
+		sql = g_strdup_printf ("SELECT de.column_name, c.ordinal_position, de.ref_column_name, rc.ordinal_position, "
+				       "de.table_catalog, de.table_schema, de.table_name, de.constraint_name "
+				       "FROM __declared_fk de LEFT JOIN _columns c ON (de.table_catalog=c.table_catalog "
+				       "AND de.table_schema=c.table_schema AND de.table_name=c.table_name "
+				       "AND de.column_name=c.column_name) LEFT JOIN _columns rc ON "
+				       "(de.ref_table_catalog=rc.table_catalog AND de.ref_table_schema=rc.table_schema "
+				       "AND de.ref_table_name=rc.table_name AND de.ref_column_name=rc.column_name)%s "
+				       "ORDER BY de.table_catalog, de.table_schema, de.table_name, de.constraint_name",
+				       de_where);
+		ok = meta_bulk_set_load (&(bulk->declared_fk_columns), priv->store, sql, vars, 4, TRUE, error);
+		g_free (sql);
+		if (!ok) goto onerror;
+	}
+
+	g_hash_table_destroy (vars);
+	g_free (where);
+	g_free (and_where);
+	g_free (de_where);
+	return bulk;
+
+ onerror:
+	g_hash_table_destroy (vars);
+	g_free (where);
+	g_free (and_where);
+	g_free (de_where);
+	meta_bulk_free (bulk);
+	return NULL;
+}
+
+/*
+ * Same as compute_reverse_fks() for all the tables completed in bulk mode, in a single pass
+ */
+static gboolean
+meta_bulk_compute_reverse_fks (GdaMetaStruct *mstruct, MetaBulk *bulk, GError **error)
+{
+	GdaMetaStructPrivate *priv = gda_meta_struct_get_instance_private (mstruct);
+	GHashTableIter iter;
+	gpointer key;
+	GSList *list;
+
+	if (g_hash_table_size (bulk->new_tables) == 0)
+		return TRUE;
+
+	for (list = priv->db_objects; list; list = list->next) {
+		GdaMetaDbObject *tmpdbo;
+		GSList *klist;
+		tmpdbo = GDA_META_DB_OBJECT (list->data);
+		if (tmpdbo->obj_type != GDA_META_DB_TABLE)
+			continue;
+
+		for (klist = GDA_META_TABLE (tmpdbo)->fk_list; klist; klist = klist->next) {
+			GdaMetaTableForeignKey *tfk = GDA_META_TABLE_FOREIGN_KEY (klist->data);
+			if (g_hash_table_contains (bulk->new_tables, tfk->depend_on) &&
+			    !add_reverse_fk (mstruct, tfk, FALSE, error))
+				return FALSE;
+		}
+	}
+
+	/* keep the same order as compute_reverse_fks() */
+	g_hash_table_iter_init (&iter, bulk->new_tables);
+	while (g_hash_table_iter_next (&iter, &key, NULL)) {
+		GdaMetaTable *mt = GDA_META_TABLE (key);
+		mt->reverse_fk_list = g_slist_reverse (mt->reverse_fk_list);
+	}
+	return TRUE;
+}
+
+/*
+ * Get the rows describing the @catalog.@schema.@name database object (or its @constraint constraint
+ * if not %NULL): in bulk loading mode they are looked up in @set, and otherwise @sql is run
+ * using the "tc", "ts", "tname" (and "cname") variables.
+ *
+ * Returns: (transfer full): a #GdaDataModel where the rows to use are @first to @first + @nrows - 1
+ */
+static GdaDataModel *
+meta_struct_extract (GdaMetaStruct *mstruct, MetaBulkSet *set, const gchar *sql,
+		     const GValue *catalog, const GValue *schema, const GValue *name,
+		     const GValue *constraint, gint *first, gint *nrows, GError **error)
+{
+	GdaMetaStructPrivate *priv = gda_meta_struct_get_instance_private (mstruct);
+	GdaDataModel *model;
+
+	*first = 0;
+	*nrows = 0;
+	if (set) {
+		gchar *key;
+		key = meta_bulk_make_key (catalog, schema, name, constraint);
+		if (key) {
+			MetaBulkRange *range;
+			range = g_hash_table_lookup (set->ranges, key);
+			if (range) {
+				*first = range->first;
+				*nrows = range->nrows;
+			}
+			g_free (key);
+		}
+		return g_object_ref (set->model);
+	}
+
+	if (constraint)
+		model = gda_meta_store_extract (priv->store, sql, error, "tc", catalog, "ts", schema,
+						"tname", name, "cname", constraint, NULL);
+	else
+		model = gda_meta_store_extract (priv->store, sql, error, "tc", catalog, "ts", schema,
+						"tname", name, NULL);
+	if (model)
+		*nrows = gda_data_model_get_n_rows (model);
+	return model;
+}
+
 
 /**
  * gda_meta_struct_complement_schema:
@@ -1352,6 +1708,8 @@ array_type_to_sql (GdaMetaStore *store, const GValue *specific_name)
  * If @catalog is %NULL, then any catalog will be used, and
  * if @schema is %NULL then any schema will be used (if @schema is %NULL then catalog must also be %NULL).
  *
+ * As for gda_meta_struct_complement_all(), each table of the meta store is read only once.
+ *
  * Please refer to gda_meta_struct_complement() form more information.
  *
  * Returns: TRUE if no error occurred
@@ -1361,15 +1719,17 @@ gda_meta_struct_complement_schema (GdaMetaStruct *mstruct, const GValue *catalog
 				   GError **error)
 {
 	GdaDataModel *tables_model = NULL, *views_model = NULL;
+	MetaBulk *bulk = NULL;
+	gboolean retval = FALSE;
 	gint i, nrows, k;
 	const GValue *cvalues[6];
 	
 	/* schema and catalog are known */
-	const gchar *sql1 = "SELECT table_name "
-		"FROM _tables WHERE table_short_name, table_full_name, table_owner, table_catalog = ##cat::string AND table_schema = ##schema::string "
+	const gchar *sql1 = "SELECT table_short_name, table_full_name, table_owner, table_name, table_catalog, table_schema "
+		"FROM _tables WHERE table_catalog = ##cat::string AND table_schema = ##schema::string "
 		"AND table_type LIKE '%TABLE%' "
 		"ORDER BY table_schema, table_name";
-	const gchar *sql2 = "SELECT table_short_name, table_full_name, table_owner, table_name "
+	const gchar *sql2 = "SELECT table_short_name, table_full_name, table_owner, table_name, table_catalog, table_schema "
 		"FROM _tables WHERE table_catalog = ##cat::string AND table_schema = ##schema::string "
 		"AND table_type LIKE '%VIEW%' "
 		"ORDER BY table_schema, table_name";
@@ -1420,63 +1780,66 @@ gda_meta_struct_complement_schema (GdaMetaStruct *mstruct, const GValue *catalog
 	}
 
 	if (!tables_model || !views_model)
-		return FALSE;
+		goto out;
+
+	bulk = meta_bulk_new (mstruct, catalog, schema, error);
+	if (!bulk)
+		goto out;
 	
 	/* tables */
 	nrows = gda_data_model_get_n_rows (tables_model);
 	for (i = 0; i < nrows; i++) {
 		for (k = 0; k <= 5; k++) {
 			cvalues [k] = gda_data_model_get_value_at (tables_model, k, i, error);
-			if (!cvalues [k]) {
-				g_object_unref (tables_model);
-				g_object_unref (views_model);
-				return FALSE;
-			}
+			if (!cvalues [k])
+				goto out;
 		}
-		if (!_meta_struct_complement (mstruct, GDA_META_DB_TABLE,
+		if (!_meta_struct_complement (mstruct, bulk, GDA_META_DB_TABLE,
 					      catalog ? catalog : cvalues [4],
 					      schema ? schema : cvalues [5],
 					      cvalues [3],
 					      cvalues [0],
 					      cvalues [1],
-					      cvalues [2], error)) {
-			g_object_unref (tables_model);
-			g_object_unref (views_model);
-			return FALSE;
-		}
+					      cvalues [2], error))
+			goto out;
 	}
-	g_object_unref (tables_model);
 
 	/* views */
 	nrows = gda_data_model_get_n_rows (views_model);
 	for (i = 0; i < nrows; i++) {
 		for (k = 0; k <= 5; k++) {
 			cvalues [k] = gda_data_model_get_value_at (views_model, k, i, error);
-			if (!cvalues [k]) {
-				g_object_unref (views_model);
-				return FALSE;
-			}
+			if (!cvalues [k])
+				goto out;
 		}
-		if (!_meta_struct_complement (mstruct, GDA_META_DB_VIEW,
+		if (!_meta_struct_complement (mstruct, bulk, GDA_META_DB_VIEW,
 					      catalog ? catalog : cvalues [4],
 					      schema ? schema : cvalues [5],
 					      cvalues [3],
 					      cvalues [0],
 					      cvalues [1],
-					      cvalues [2], error)) {
-			g_object_unref (views_model);
-			return FALSE;
-		}
+					      cvalues [2], error))
+			goto out;
 	}
-	g_object_unref (views_model);
 
-	return TRUE;
+	retval = meta_bulk_compute_reverse_fks (mstruct, bulk, error);
+
+ out:
+	if (bulk)
+		meta_bulk_free (bulk);
+	if (tables_model)
+		g_object_unref (tables_model);
+	if (views_model)
+		g_object_unref (views_model);
+
+	return retval;
 }
 
 static gboolean
 real_gda_meta_struct_complement_all (GdaMetaStruct *mstruct, gboolean default_only, GError **error)
 {
 	GdaDataModel *model;
+	MetaBulk *bulk;
 	gint i, nrows, k;
 	const GValue *cvalues[6];
 	const gchar *sql1 = "SELECT table_catalog, table_schema, table_name, table_short_name, table_full_name, table_owner "
@@ -1496,25 +1859,29 @@ real_gda_meta_struct_complement_all (GdaMetaStruct *mstruct, gboolean default_on
 	GdaMetaStructPrivate *priv = gda_meta_struct_get_instance_private (mstruct);
 	g_return_val_if_fail (priv->store, FALSE);
 
+	bulk = meta_bulk_new (mstruct, NULL, NULL, error);
+	if (!bulk)
+		return FALSE;
+
 	/* tables */
 	model = gda_meta_store_extract (priv->store, default_only ? sql1 : sql3, error, NULL);
 	if (!model)
-		return FALSE;
+		goto onerror;
 	nrows = gda_data_model_get_n_rows (model);
 	for (i = 0; i < nrows; i++) {
 		for (k = 0; k <= 5; k++) {
 			cvalues [k] = gda_data_model_get_value_at (model, k, i, error);
 			if (!cvalues [k]) {
 				g_object_unref (model);
-				return FALSE;
+				goto onerror;
 			}
 		}
-		if (!_meta_struct_complement (mstruct, GDA_META_DB_TABLE,
+		if (!_meta_struct_complement (mstruct, bulk, GDA_META_DB_TABLE,
 					      cvalues [0], cvalues [1],
 					      cvalues [2], cvalues [3],
 					      cvalues [4], cvalues [5], error)) {
 			g_object_unref (model);
-			return FALSE;
+			goto onerror;
 		}
 	}
 	g_object_unref (model);
@@ -1522,26 +1889,34 @@ real_gda_meta_struct_complement_all (GdaMetaStruct *mstruct, gboolean default_on
 	/* views */
 	model = gda_meta_store_extract (priv->store, default_only ? sql2 : sql4, error, NULL);
 	if (!model)
-		return FALSE;
+		goto onerror;
 	nrows = gda_data_model_get_n_rows (model);
 	for (i = 0; i < nrows; i++) {
 		for (k = 0; k <= 5; k++) {
 			cvalues [k] = gda_data_model_get_value_at (model, k, i, error);
 			if (!cvalues [k]) {
 				g_object_unref (model);
-				return FALSE;
+				goto onerror;
 			}
 		}
-		if (!_meta_struct_complement (mstruct, GDA_META_DB_VIEW,
+		if (!_meta_struct_complement (mstruct, bulk, GDA_META_DB_VIEW,
 					      cvalues [0], cvalues [1],
 					      cvalues [2], cvalues [3],
 					      cvalues [4], cvalues [5], error)) {
 			g_object_unref (model);
-			return FALSE;
+			goto onerror;
 		}
 	}
 	g_object_unref (model);
+
+	if (!meta_bulk_compute_reverse_fks (mstruct, bulk, error))
+		goto onerror;
+	meta_bulk_free (bulk);
 	return TRUE;
+
+ onerror:
+	meta_bulk_free (bulk);
+	return FALSE;
 }
 
 /**
@@ -1571,6 +1946,9 @@ gda_meta_struct_complement_default (GdaMetaStruct *mstruct, GError **error)
  *
  * This method is similar to gda_meta_struct_complement() and gda_meta_struct_complement_default()
  * but creates #GdaMetaDbObject for all the database object.
+ *
+ * Each table of the meta store is read only once, instead of once per database object, so this
+ * method is much faster than calling gda_meta_struct_complement() for each database object.
  * 
  * Please refer to gda_meta_struct_complement() form more information.
  *
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __GDA_ROW_PRIVATE_H__
+#define __GDA_ROW_PRIVATE_H__
+
+#include <libgda/gda-row.h>
+
+G_BEGIN_DECLS
+
+gboolean _gda_row_holds_data (GdaRow *row, gpointer data);
+void     _gda_row_hold_data  (GdaRow *row, gpointer data, GDestroyNotify release);
+void     _gda_row_release_held_data (GdaRow *row);
+guint    _gda_row_get_n_held_data   (GdaRow *row);
+
+G_END_DECLS
+
+#endif
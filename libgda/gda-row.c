@@ -32,6 +32,7 @@
 #define G_LOG_DOMAIN "GDA-row"
 
 #include "gda-row.h"
+#include "gda-row-private.h"
 #include <string.h>
 #include <glib/gi18n-lib.h>
 #include "gda-data-model.h"
@@ -45,7 +46,17 @@ typedef struct {
   GValue       *fields; /* GValues */
   GError      **errors; /* GError for each invalid value at the same position */
   guint         nfields;
+
+  /* data which must be kept as long as the row exists, see _gda_row_hold_data() */
+  gpointer       held_data;
+  GDestroyNotify held_release;
+  GSList        *more_held; /* list of HeldData */
 } GdaRowPrivate;
+
+typedef struct {
+  gpointer       data;
+  GDestroyNotify release;
+} HeldData;
 G_DEFINE_TYPE_WITH_PRIVATE (GdaRow, gda_row, G_TYPE_OBJECT)
 
 /* properties */
@@ -119,6 +130,26 @@ gda_row_dispose (GObject *object)
 	G_OBJECT_CLASS (gda_row_parent_class)->dispose (object);
 }
 
+static void
+release_held_data (GdaRowPrivate *priv)
+{
+	if (priv->held_data) {
+		priv->held_release (priv->held_data);
+		priv->held_data = NULL;
+		priv->held_release = NULL;
+	}
+	if (priv->more_held) {
+		GSList *list;
+		for (list = priv->more_held; list; list = list->next) {
+			HeldData *hd = (HeldData*) list->data;
+			hd->release (hd->data);
+			g_free (hd);
+		}
+		g_slist_free (priv->more_held);
+		priv->more_held = NULL;
+	}
+}
+
 static void
 gda_row_finalize (GObject *object)
 {
@@ -138,6 +169,8 @@ gda_row_finalize (GObject *object)
 		g_free (priv->fields);
 		g_free (priv->errors);
 
+		/* the values may have pointed to some held data */
+		release_held_data (priv);
 	} else {
 		g_object_unref (priv->model);
 		priv->model = NULL;
@@ -410,3 +443,84 @@ gda_row_get_length (GdaRow *row)
     return priv->nfields;
   return gda_data_model_get_n_columns (priv->model);
 }
+
+/*
+ * _gda_row_holds_data:
+ * @row: a #GdaRow
+ * @data: some data
+ *
+ * Returns: %TRUE if @data is the last data @row has been asked to hold using _gda_row_hold_data()
+ */
+gboolean
+_gda_row_holds_data (GdaRow *row, gpointer data)
+{
+	GdaRowPrivate *priv = gda_row_get_instance_private (row);
+	if (priv->more_held)
+		return ((HeldData*) priv->more_held->data)->data == data;
+	return priv->held_data == data;
+}
+
+/*
+ * _gda_row_hold_data:
+ * @row: a #GdaRow
+ * @data: (transfer full): some data
+ * @release: function called with @data as argument when @row is destroyed
+ *
+ * Makes @row keep @data until it is destroyed, which allows @row's values to point to memory
+ * owned by @data (for example static strings, see g_value_set_static_string()).
+ */
+void
+_gda_row_hold_data (GdaRow *row, gpointer data, GDestroyNotify release)
+{
+	g_return_if_fail (GDA_IS_ROW (row));
+	g_return_if_fail (data && release);
+	GdaRowPrivate *priv = gda_row_get_instance_private (row);
+
+	if (!priv->held_data) {
+		priv->held_data = data;
+		priv->held_release = release;
+	}
+	else {
+		HeldData *hd;
+		hd = g_new (HeldData, 1);
+		hd->data = data;
+		hd->release = release;
+		priv->more_held = g_slist_prepend (priv->more_held, hd);
+	}
+}
+
+/*
+ * _gda_row_release_held_data:
+ * @row: a #GdaRow
+ *
+ * Sets all of @row's values to NULL and releases all the data @row has been asked to hold
+ * using _gda_row_hold_data(), so that @row can be filled again.
+ */
+void
+_gda_row_release_held_data (GdaRow *row)
+{
+	g_return_if_fail (GDA_IS_ROW (row));
+	GdaRowPrivate *priv = gda_row_get_instance_private (row);
+	guint i;
+
+	for (i = 0; i < priv->nfields; i++)
+		gda_value_set_null (&(priv->fields [i]));
+	release_held_data (priv);
+}
+
+/*
+ * _gda_row_get_n_held_data:
+ * @row: a #GdaRow
+ *
+ * Returns: the number of data @row currently holds
+ */
+guint
+_gda_row_get_n_held_data (GdaRow *row)
+{
+	g_return_val_if_fail (GDA_IS_ROW (row), 0);
+	GdaRowPrivate *priv = gda_row_get_instance_private (row);
+
+	if (!priv->held_data)
+		return 0;
+	return 1 + g_slist_length (priv->more_held);
+}
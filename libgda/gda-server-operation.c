@@ -60,6 +60,8 @@ typedef struct {
 	GSList                 *allnodes; /* list of all the Node structures, referenced here only */
 	GSList                 *topnodes; /* list of the "/(*)" named nodes, not referenced here  */
 	GHashTable             *info_hash; /* key = path, value = a GdaServerOperationNode */
+	GHashTable             *nodes_hash; /* key = complete path, value = the first Node of allnodes
+					     * with that path; NULL when it needs to be recomputed */
   GHashTable             *doc_hash;
 } GdaServerOperationPrivate;
 
@@ -132,6 +134,15 @@ static Node  *node_find (GdaServerOperation *op, const gchar *path);
 static Node  *node_find_or_create (GdaServerOperation *op, const gchar *path);
 static gchar *node_get_complete_path (GdaServerOperation *op, Node *node);
 static void   clean_nodes_info_cache (GdaServerOperation *operation); 
+static void   clean_nodes_hash (GdaServerOperation *operation);
+
+/*
+ * XML specifications loaded from resources (the providers' "*_specs_*.xml" files), shared by all
+ * the GdaServerOperation objects: key = resource name, value = a validated xmlDocPtr, which
+ * is never modified nor freed
+ */
+static GHashTable *spec_resources = NULL;
+static GMutex      spec_resources_mutex;
 
 
 
@@ -234,6 +245,16 @@ clean_nodes_info_cache (GdaServerOperation *operation)
 	priv->info_hash = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
 }
 
+/*
+ * To call every time the complete path of some nodes may change
+ */
+static void
+clean_nodes_hash (GdaServerOperation *operation)
+{
+	GdaServerOperationPrivate *priv = gda_server_operation_get_instance_private (operation);
+
+	g_clear_pointer (&priv->nodes_hash, g_hash_table_destroy);
+}
 
 static void
 gda_server_operation_dispose (GObject *object)
@@ -254,6 +275,7 @@ gda_server_operation_dispose (GObject *object)
 	while (priv->topnodes)
 		node_destroy (operation, NODE (priv->topnodes->data));
 	g_assert (!priv->allnodes);
+	clean_nodes_hash (operation);
 
 	/* don't free priv->xml_spec_doc */
 
@@ -344,6 +366,7 @@ node_destroy (GdaServerOperation *op, Node *node)
 
 		priv->topnodes = g_slist_remove (priv->topnodes, node);
 		priv->allnodes = g_slist_remove (priv->allnodes, node);
+		clean_nodes_hash (op);
 	}
 
 	g_free (node);
@@ -357,21 +380,26 @@ node_find (GdaServerOperation *op, const gchar *path)
 {
 	GdaServerOperationPrivate *priv = gda_server_operation_get_instance_private (op);
 	Node *node = NULL;
-	GSList *list;
 
 	if (!path || !*path || (*path != '/'))
 		return NULL;
 
-	for (list = priv->allnodes; list; list = list->next) {
-		gchar *str;
-		str = node_get_complete_path (op, NODE (list->data));
-		if (!strcmp (str, path)) {
-			node = NODE (list->data);
-			g_free (str);
-			break;
+	if (!priv->nodes_hash) {
+		GSList *list;
+
+		/* index the complete path of all the nodes, the first node of priv->allnodes wins */
+		priv->nodes_hash = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+		for (list = priv->allnodes; list; list = list->next) {
+			gchar *str;
+			str = node_get_complete_path (op, NODE (list->data));
+			if (g_hash_table_contains (priv->nodes_hash, str))
+				g_free (str);
+			else
+				g_hash_table_insert (priv->nodes_hash, str, list->data);
 		}
-		g_free (str);
 	}
+
+	node = g_hash_table_lookup (priv->nodes_hash, path);
 	/*g_print ("%s(%s) => %p\n", __FUNCTION__, path, node);*/
 	return node;
 }
@@ -504,6 +532,7 @@ sequence_add_item (GdaServerOperation *op, Node *node)
 	for (list = seq_item_nodes; list; list = list->next)
 		((Node*) list->data)->parent = new_node;
 
+	clean_nodes_hash (op);
 	clean_nodes_info_cache (op);
 #ifdef GDA_DEBUG_signal
 	g_print (">> 'SEQUENCE_ITEM_ADDED' from %s\n", __FUNCTION__);
@@ -604,22 +633,24 @@ gda_server_operation_set_property (GObject *object,
 		if (! resource_name)
 			return;
 
+		/* the specifications are parsed and validated only once, then shared */
 		xmlDocPtr doc = NULL;
-		if (priv->doc_hash) {
-			doc = g_hash_table_lookup (priv->doc_hash, resource_name);
-			if (doc) {
-				priv->xml_spec_doc = doc;
-				break;
-			}
+		g_mutex_lock (&spec_resources_mutex);
+		if (!spec_resources)
+			spec_resources = g_hash_table_new (g_str_hash, g_str_equal);
+		doc = g_hash_table_lookup (spec_resources, resource_name);
+		if (doc) {
+			priv->xml_spec_doc = doc;
+			g_mutex_unlock (&spec_resources_mutex);
+			break;
 		}
 
 		GBytes *bytes = NULL;
-		if (resource_name) {
-			bytes = g_resources_lookup_data (resource_name, G_RESOURCE_LOOKUP_FLAGS_NONE, NULL);
-			if (!bytes) {
-				g_warning ("Resource %s not found", resource_name);
-				return;
-			}
+		bytes = g_resources_lookup_data (resource_name, G_RESOURCE_LOOKUP_FLAGS_NONE, NULL);
+		if (!bytes) {
+			g_mutex_unlock (&spec_resources_mutex);
+			g_warning ("Resource %s not found", resource_name);
+			return;
 		}
 
 		const gchar *xmldata;
@@ -628,14 +659,15 @@ gda_server_operation_set_property (GObject *object,
 		doc = xmlParseMemory (xmldata, strlen (xmldata));
 		g_bytes_unref (bytes);
 		if (doc) {
-			if (!use_xml_spec (op, doc, NULL))
+			if (!use_xml_spec (op, doc, NULL)) {
+				g_mutex_unlock (&spec_resources_mutex);
 				return;
-			if (!priv->doc_hash)
-				priv->doc_hash = g_hash_table_new_full (g_str_hash, g_str_equal,
-								  g_free, (GDestroyNotify) xmlFreeDoc);
-			g_hash_table_insert (priv->doc_hash, g_strdup (resource_name), doc);
+			}
+			g_hash_table_insert (spec_resources, g_strdup (resource_name), doc);
+			g_mutex_unlock (&spec_resources_mutex);
 		}
 		else {
+			g_mutex_unlock (&spec_resources_mutex);
 			g_warning (_("GdaServerOperation: could not load specified contents"));
 			return;
 		}
@@ -891,12 +923,9 @@ load_xml_spec (GdaServerOperation *op, xmlNodePtr specnode, const gchar *root, G
 		Node *opnode = NULL;
 		Node *old_opnode;
 
+		/* @specnode's document may be shared with other operations: it is never modified */
 		if (xmlNodeIsText (node)) {
-			xmlNodePtr nextnode;
-			nextnode = node->next;
-			xmlUnlinkNode (node);
-			xmlFreeNode (node);
-			node = nextnode;
+			node = node->next;
 			continue;
 		}
 
@@ -904,12 +933,8 @@ load_xml_spec (GdaServerOperation *op, xmlNodePtr specnode, const gchar *root, G
 		this_lang = xmlGetProp(node, (xmlChar*)"lang");
 		if (this_lang) {
 			if (strncmp ((gchar*)this_lang, lang, strlen ((gchar*)this_lang))) {
-				xmlNodePtr nextnode;
 				xmlFree (this_lang);
-				nextnode = node->next;
-				xmlUnlinkNode (node);
-				xmlFreeNode (node);
-				node = nextnode;
+				node = node->next;
 				continue;
 			}
 
@@ -1044,6 +1069,14 @@ load_xml_spec (GdaServerOperation *op, xmlNodePtr specnode, const gchar *root, G
 
 			/* insert */
 			priv->allnodes = g_slist_append (priv->allnodes, opnode);
+			if (priv->nodes_hash) {
+				gchar *str;
+				str = node_get_complete_path (op, opnode);
+				if (g_hash_table_contains (priv->nodes_hash, str))
+					g_free (str);
+				else
+					g_hash_table_insert (priv->nodes_hash, str, opnode);
+			}
 			retlist = g_slist_append (retlist, opnode);
 			/*g_print ("+ %s (node's path = %s) %p\n", complete_path, opnode->path_name, opnode);*/
 
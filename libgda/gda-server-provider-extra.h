@@ -82,6 +82,15 @@ void            _gda_server_provider_handlers_clear_for_cnc (GdaServerProvider *
  */
 gchar         *gda_server_provider_load_resource_contents   (const gchar *prov_name, const gchar *resource);
 
+/*
+ * Transfer of BLOB parameters in chunks
+ */
+typedef gboolean (*GdaServerProviderBlobChunkFunc) (const guchar *data, glong size, glong offset,
+						    gpointer user_data, GError **error);
+gboolean       gda_server_provider_blob_stream              (GdaConnection *cnc, GdaBlob *blob,
+							     GdaServerProviderBlobChunkFunc func,
+							     gpointer user_data, GError **error);
+
 G_END_DECLS
 
 #endif
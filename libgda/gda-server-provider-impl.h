@@ -164,10 +164,21 @@ typedef struct {
 						 GdaStatement *stmt, GdaSet *params,
 						 GdaStatementModelUsage model_usage,
 						 GType *col_types, GdaSet **last_inserted_row, GError **error);
+	/**
+	 * get_max_params:
+	 * @provider: a #GdaServerProvider
+	 * @cnc: a #GdaConnection
+	 *
+	 * Get the maximum number of parameters a single statement can have when executed using @cnc.
+	 *
+	 * Returns: the maximum number of parameters, or 0 if there is no known limit
+	 *
+	 * Since: 6.0
+	 */
+	gint          (* get_max_params)        (GdaServerProvider *provider, GdaConnection *cnc); /* may be NULL */
 
 	/*< private >*/
 	/* Padding for future expansion */
-	void (*_gda_reserved11) (void);
 	void (*_gda_reserved12) (void);
 	void (*_gda_reserved13) (void);
 	void (*_gda_reserved14) (void);
@@ -43,6 +43,7 @@
 #include <libgda/gda-data-handler.h>
 #include <libgda/gda-util.h>
 #include <libgda/gda-set.h>
+#include <libgda/gda-blob-op.h>
 #include <sql-parser/gda-sql-parser.h>
 #include <gio/gio.h>
 #include <string.h>
@@ -51,6 +52,7 @@
 #include <libgda/gda-connection-private.h>
 #include <libgda/gda-connection-internal.h>
 #include <libgda/gda-debug-macros.h>
+#include <libgda/gda-trace-private.h>
 #include <libgda/handlers/gda-handler-boolean.h>
 #include <libgda/handlers/gda-handler-string.h>
 #include <libgda/handlers/gda-handler-text.h>
@@ -703,6 +705,68 @@ gda_server_provider_get_server_version (GdaServerProvider *provider, GdaConnecti
 	return (const gchar*) retval;
 }
 
+/* code executed in GdaWorker's worker thread */
+static gpointer
+worker_get_max_params (WorkerGetInfoData *data, G_GNUC_UNUSED GError **error)
+{
+	GdaServerProviderBase *fset;
+	fset = _gda_server_provider_get_impl_functions (data->provider, data->worker, GDA_SERVER_PROVIDER_FUNCTIONS_BASE);
+
+	gint retval = 0;
+	if (fset->get_max_params)
+		retval = fset->get_max_params (data->provider, data->cnc);
+	return GINT_TO_POINTER (retval);
+}
+
+/**
+ * gda_server_provider_get_max_params:
+ * @provider: a #GdaServerProvider object.
+ * @cnc: a #GdaConnection object
+ *
+ * Get the maximum number of parameters (variables) a single statement can have when executed using @cnc;
+ * this is for example useful to know how many rows can be inserted using a single multi-row INSERT statement.
+ *
+ * Returns: the maximum number of parameters, or 0 if it is unknown
+ *
+ * Since: 6.0
+ */
+gint
+gda_server_provider_get_max_params (GdaServerProvider *provider, GdaConnection *cnc)
+{
+	g_return_val_if_fail (GDA_IS_SERVER_PROVIDER (provider), 0);
+	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), 0);
+	g_return_val_if_fail (gda_connection_get_provider (cnc) == provider, 0);
+	g_return_val_if_fail (gda_connection_is_opened (cnc), 0);
+
+	gda_lockable_lock ((GdaLockable*) cnc); /* CNC LOCK */
+
+	GdaServerProviderConnectionData *cdata;
+	cdata = gda_connection_internal_get_provider_data_error (cnc, NULL);
+	if (!cdata) {
+		gda_lockable_unlock ((GdaLockable*) cnc); /* CNC UNLOCK */
+		g_warning ("Internal error: connection reported as opened, yet no provider's data has been setted");
+		return 0;
+	}
+
+	GMainContext *context;
+	context = gda_server_provider_get_real_main_context (cnc);
+
+	WorkerGetInfoData data;
+	data.worker = cdata->worker;
+	data.provider = provider;
+	data.cnc = cnc;
+
+	gpointer retval = NULL;
+	gda_worker_do_job (cdata->worker, context, 0, &retval, NULL,
+			   (GdaWorkerFunc) worker_get_max_params, (gpointer) &data, NULL, NULL, NULL);
+	if (context)
+		g_main_context_unref (context);
+
+	gda_lockable_unlock ((GdaLockable*) cnc); /* CNC UNLOCK */
+
+	return GPOINTER_TO_INT (retval);
+}
+
 typedef struct {
 	GdaWorker             *worker;
 	GdaServerProvider     *provider;
@@ -2431,7 +2495,9 @@ worker_statement_prepare (WorkerPrepareStatementData *data, GError **error)
 	fset = _gda_server_provider_get_impl_functions (data->provider, data->worker, GDA_SERVER_PROVIDER_FUNCTIONS_BASE);
 
 	gboolean result;
+	GDA_TRACE (prepare, begin, data->stmt, 0);
 	result = fset->statement_prepare (data->provider, data->cnc, data->stmt, error);
+	GDA_TRACE (prepare, end, data->stmt, result ? 1 : 0);
 	return result ? (gpointer) 0x01 : NULL;
 }
 
@@ -2507,12 +2573,14 @@ typedef struct {
 	GdaStatementModelUsage model_usage;
 	GType                 *col_types;
 	GdaSet               **last_inserted_row;
+	gint64                 job_start_time; /* when the worker started the job */
 } WorkerExecuteStatementData;
 
 static gpointer
 worker_statement_execute (WorkerExecuteStatementData *data, GError **error)
 {
 	GdaServerProviderBase *fset;
+	data->job_start_time = g_get_monotonic_time ();
 	fset = _gda_server_provider_get_impl_functions (data->provider, data->worker, GDA_SERVER_PROVIDER_FUNCTIONS_BASE);
 
 	guint delay;
@@ -2523,8 +2591,10 @@ worker_statement_execute (WorkerExecuteStatementData *data, GError **error)
 	}
 
 	GObject *result;
+	GDA_TRACE (execute, begin, data->stmt, 0);
 	result = fset->statement_execute (data->provider, data->cnc, data->stmt, data->params, data->model_usage,
 					  data->col_types, data->last_inserted_row, error);
+	GDA_TRACE (execute, end, data->stmt, result ? 1 : 0);
 
 	if (GDA_IS_DATA_SELECT (result)) {
 		/* adjust flags because the providers don't necessarily do it: make sure extra flags as OFFLINE and
@@ -2572,12 +2642,21 @@ _gda_server_provider_statement_execute (GdaServerProvider *provider, GdaConnecti
 	g_return_val_if_fail (gda_connection_get_provider (cnc) == provider, NULL);
 	g_return_val_if_fail (gda_connection_is_opened (cnc), NULL);
 
+	/* time spent waiting for the connection and its worker thread */
+	GdaConnectionMetricsEntry *mentry;
+	gint64 queue_start_time = 0;
+	mentry = _gda_connection_get_metrics_entry (cnc, stmt);
+	if (mentry)
+		queue_start_time = g_get_monotonic_time ();
+
 	gda_lockable_lock ((GdaLockable*) cnc); /* CNC LOCK */
 
 	GdaServerProviderConnectionData *cdata;
 	cdata = gda_connection_internal_get_provider_data_error (cnc, NULL);
 	if (!cdata) {
 		gda_lockable_unlock ((GdaLockable*) cnc); /* CNC UNLOCK */
+		if (mentry)
+			_gda_connection_metrics_entry_unref (mentry);
 		g_warning ("Internal error: connection reported as opened, yet no provider's data has been setted");
 		return FALSE;
 	}
@@ -2587,6 +2666,7 @@ _gda_server_provider_statement_execute (GdaServerProvider *provider, GdaConnecti
 	context = gda_server_provider_get_real_main_context (cnc);
 
 	WorkerExecuteStatementData data;
+	data.job_start_time = 0;
 	data.worker = worker;
 	data.provider = provider;
 	data.cnc = cnc;
@@ -2608,6 +2688,13 @@ _gda_server_provider_statement_execute (GdaServerProvider *provider, GdaConnecti
 
 	gda_worker_unref (worker);
 
+	if (mentry) {
+		if (data.job_start_time > 0)
+			_gda_connection_metrics_entry_add_time (mentry, GDA_CONNECTION_METRICS_QUEUE_WAIT,
+								data.job_start_time - queue_start_time);
+		_gda_connection_metrics_entry_unref (mentry);
+	}
+
 	return retval;
 }
 
@@ -4362,3 +4449,103 @@ gda_server_provider_load_resource_contents (const gchar *prov_name, const gchar
 	g_bytes_unref (bytes);
 	return retval;
 }
+
+/**
+ * GdaServerProviderBlobChunkFunc:
+ * @data: a chunk of the BLOB's contents
+ * @size: the size of @data, in bytes
+ * @offset: the offset of @data from the start of the BLOB
+ * @user_data: the user data passed to gda_server_provider_blob_stream()
+ * @error: a place to store errors
+ *
+ * Function called by gda_server_provider_blob_stream() for each chunk of a BLOB.
+ *
+ * Returns: %TRUE if the chunk has been handled, and %FALSE to stop the transfer (in which case
+ * @error should be set)
+ *
+ * Since: 6.0
+ */
+
+/**
+ * gda_server_provider_blob_stream:
+ * @cnc: (nullable): the #GdaConnection used by the provider, or %NULL
+ * @blob: a #GdaBlob
+ * @func: (scope call): the function to call for each chunk of @blob's contents
+ * @user_data: data passed to @func
+ * @error: a place to store errors, or %NULL
+ *
+ * Calls @func for each consecutive chunk of @blob's contents. If @blob has an associated #GdaBlobOp,
+ * the contents is read from it one chunk at a time, so the whole BLOB is never loaded in memory;
+ * otherwise the data already in @blob is split in chunks.
+ *
+ * The size of the chunks is the value of @cnc's GdaConnection:blob-chunk-size property.
+ * This function should only be used by database provider's implementations.
+ *
+ * Returns: %TRUE if the whole contents of @blob has been passed to @func
+ *
+ * Since: 6.0
+ */
+gboolean
+gda_server_provider_blob_stream (GdaConnection *cnc, GdaBlob *blob, GdaServerProviderBlobChunkFunc func,
+				 gpointer user_data, GError **error)
+{
+	GdaBlobOp *op;
+	glong chunk_size, offset = 0;
+	gboolean retval = TRUE;
+
+	g_return_val_if_fail (!cnc || GDA_IS_CONNECTION (cnc), FALSE);
+	g_return_val_if_fail (blob, FALSE);
+	g_return_val_if_fail (func, FALSE);
+
+	chunk_size = cnc ? _gda_connection_get_blob_chunk_size (cnc) : _GDA_BLOB_CHUNK_SIZE;
+	op = gda_blob_get_op (blob);
+	if (op) {
+		GdaBlob *tmpblob;
+		glong length;
+		tmpblob = gda_blob_new ();
+		gda_blob_set_op (tmpblob, op);
+		/* some providers report an error when reading at the end of the BLOB */
+		length = gda_blob_op_get_length (op);
+		while ((length < 0) || (offset < length)) {
+			GdaBinary *bin;
+			glong nread;
+			nread = gda_blob_op_read (op, tmpblob, offset, chunk_size);
+			if (nread < 0) {
+				g_set_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR,
+					     "%s", _("Can't read BLOB's contents"));
+				retval = FALSE;
+				break;
+			}
+			if (nread == 0)
+				break;
+
+			bin = gda_blob_get_binary (tmpblob);
+			if (! func (gda_binary_get_data (bin), gda_binary_get_size (bin), offset,
+				    user_data, error)) {
+				retval = FALSE;
+				break;
+			}
+			offset += gda_binary_get_size (bin);
+			if (nread < chunk_size)
+				/* nothing more to read */
+				break;
+		}
+		gda_blob_free (tmpblob);
+	}
+	else {
+		GdaBinary *bin;
+		const guchar *data;
+		glong size;
+		bin = gda_blob_get_binary (blob);
+		data = gda_binary_get_data (bin);
+		size = gda_binary_get_size (bin);
+		for (offset = 0; offset < size; offset += chunk_size) {
+			if (! func (data + offset, MIN (chunk_size, size - offset), offset, user_data, error)) {
+				retval = FALSE;
+				break;
+			}
+		}
+	}
+
+	return retval;
+}
@@ -68,7 +68,8 @@ typedef enum
 	GDA_SERVER_PROVIDER_DATA_ERROR,
 	GDA_SERVER_PROVIDER_DEFAULT_VALUE_HANDLING_ERROR,
 	GDA_SERVER_PROVIDER_MISUSE_ERROR,
-	GDA_SERVER_PROVIDER_FILE_NOT_FOUND_ERROR
+	GDA_SERVER_PROVIDER_FILE_NOT_FOUND_ERROR,
+	GDA_SERVER_PROVIDER_TIMEOUT_ERROR
 } GdaServerProviderError;
 
 /**
@@ -89,6 +90,7 @@ typedef enum
 const gchar           *gda_server_provider_get_name           (GdaServerProvider *provider);
 const gchar           *gda_server_provider_get_version        (GdaServerProvider *provider);
 const gchar           *gda_server_provider_get_server_version (GdaServerProvider *provider, GdaConnection *cnc);
+gint                   gda_server_provider_get_max_params     (GdaServerProvider *provider, GdaConnection *cnc);
 gboolean               gda_server_provider_supports_feature   (GdaServerProvider *provider, GdaConnection *cnc,
 							       GdaConnectionFeature feature);
 
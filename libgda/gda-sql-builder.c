@@ -1641,6 +1641,121 @@ gda_sql_builder_select_group_by (GdaSqlBuilder *builder, GdaSqlBuilderId expr_id
     }
 }
 
+/**
+ * gda_sql_builder_insert_add_values_v:
+ * @builder: a #GdaSqlBuilder object
+ * @value_ids: (array length=value_ids_size): an array of the IDs of the expressions to insert, one for each field
+ * @value_ids_size: size of @value_ids
+ *
+ * Valid only for: INSERT statements
+ *
+ * Adds a row of values to insert, which makes it possible to insert several rows using a single statement.
+ * The fields are defined beforehand using gda_sql_builder_add_field_value_id() (possibly with a %0 value
+ * ID if the first row of values is also added using this function), and there must be as many expressions
+ * in @value_ids as there are fields.
+ *
+ * Since: 6.0
+ */
+void
+gda_sql_builder_insert_add_values_v (GdaSqlBuilder *builder, const GdaSqlBuilderId *value_ids, gint value_ids_size)
+{
+  GdaSqlStatementInsert *ins;
+  SqlPart **parts;
+  GSList *row = NULL;
+  gint i;
+
+  g_return_if_fail (GDA_IS_SQL_BUILDER (builder));
+  GdaSqlBuilderPrivate *priv = gda_sql_builder_get_instance_private (builder);
+  g_return_if_fail (priv->main_stmt);
+  g_return_if_fail (value_ids);
+  g_return_if_fail (value_ids_size > 0);
+
+  if (priv->main_stmt->stmt_type != GDA_SQL_STATEMENT_INSERT) {
+    g_warning (_("Wrong statement type"));
+    return;
+  }
+
+  ins = (GdaSqlStatementInsert*) priv->main_stmt->contents;
+  if (ins->fields_list && (g_slist_length (ins->fields_list) != (guint) value_ids_size)) {
+    g_warning (_("Wrong number of values"));
+    return;
+  }
+  /* the values row started by gda_sql_builder_add_field_value_id() must be complete */
+  if (ins->values_list && (g_slist_length ((GSList*) ins->values_list->data) != (guint) value_ids_size)) {
+    g_warning (_("Wrong number of values"));
+    return;
+  }
+
+  parts = g_new (SqlPart *, value_ids_size);
+  for (i = 0; i < value_ids_size; i++)
+    {
+      parts [i] = get_part (builder, value_ids [i], GDA_SQL_ANY_EXPR);
+      if (!parts [i])
+        {
+          g_free (parts);
+          return;
+        }
+    }
+
+  for (i = value_ids_size - 1; i >= 0; i--)
+    row = g_slist_prepend (row, use_part (parts [i], GDA_SQL_ANY_PART (ins)));
+  g_free (parts);
+  ins->values_list = g_slist_append (ins->values_list, row);
+}
+
+/**
+ * gda_sql_builder_insert_set_upsert:
+ * @builder: a #GdaSqlBuilder object
+ * @conflict_fields: (array zero-terminated=1) (nullable): a %NULL terminated array of the fields' names making up
+ * the unique constraint which may be violated by the insertion, or %NULL
+ * @update_fields: (array zero-terminated=1) (nullable): a %NULL terminated array of the names of the fields to
+ * update when the insertion of a row conflicts with an existing row, or %NULL
+ *
+ * Valid only for: INSERT statements
+ *
+ * Turns the INSERT statement into an "upsert" statement: for each row which can't be inserted because of a
+ * unique constraint violation, the @update_fields columns of the existing row are set to the values which would
+ * have been inserted, or nothing is done if @update_fields is %NULL. The SQL rendered depends on the database:
+ * "ON CONFLICT (...) DO UPDATE SET ..." for PostgreSQL and SQLite, "ON DUPLICATE KEY UPDATE ..." for MySQL
+ * (which ignores @conflict_fields and checks all the unique constraints).
+ *
+ * @conflict_fields can't be %NULL if @update_fields is not %NULL, otherwise the statement can't be rendered.
+ *
+ * Passing %NULL for both @conflict_fields and @update_fields turns the statement back into a plain INSERT.
+ *
+ * Since: 6.0
+ */
+void
+gda_sql_builder_insert_set_upsert (GdaSqlBuilder *builder, const gchar * const *conflict_fields,
+                                   const gchar * const *update_fields)
+{
+  GSList *clist = NULL, *ulist = NULL;
+  gint i;
+
+  g_return_if_fail (GDA_IS_SQL_BUILDER (builder));
+  GdaSqlBuilderPrivate *priv = gda_sql_builder_get_instance_private (builder);
+  g_return_if_fail (priv->main_stmt);
+
+  if (priv->main_stmt->stmt_type != GDA_SQL_STATEMENT_INSERT) {
+    g_warning (_("Wrong statement type"));
+    return;
+  }
+
+  for (i = 0; conflict_fields && conflict_fields [i]; i++)
+    {
+      GdaSqlField *field = gda_sql_field_new (NULL);
+      field->field_name = g_strdup (conflict_fields [i]);
+      clist = g_slist_prepend (clist, field);
+    }
+  for (i = 0; update_fields && update_fields [i]; i++)
+    {
+      GdaSqlField *field = gda_sql_field_new (NULL);
+      field->field_name = g_strdup (update_fields [i]);
+      ulist = g_slist_prepend (ulist, field);
+    }
+  gda_sql_statement_insert_take_upsert (priv->main_stmt, g_slist_reverse (clist), g_slist_reverse (ulist));
+}
+
 /**
  * gda_sql_builder_add_function:
  * @builder: a #GdaSqlBuilder object
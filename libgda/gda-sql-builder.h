@@ -153,6 +153,12 @@ void              gda_sql_builder_select_set_limit (GdaSqlBuilder *builder,
 void              gda_sql_builder_select_set_having (GdaSqlBuilder *builder, GdaSqlBuilderId cond_id);
 void              gda_sql_builder_select_group_by (GdaSqlBuilder *builder, GdaSqlBuilderId expr_id);
 
+/* INSERT Statement API */
+void              gda_sql_builder_insert_add_values_v (GdaSqlBuilder *builder,
+                                                       const GdaSqlBuilderId *value_ids, gint value_ids_size);
+void              gda_sql_builder_insert_set_upsert (GdaSqlBuilder *builder, const gchar * const *conflict_fields,
+                                                     const gchar * const *update_fields);
+
 /* COMPOUND SELECT Statement API */
 void              gda_sql_builder_compound_set_type (GdaSqlBuilder *builder, GdaSqlStatementCompoundType compound_type);
 void              gda_sql_builder_compound_add_sub_select (GdaSqlBuilder *builder, GdaSqlStatement *sqlst);
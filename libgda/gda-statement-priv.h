@@ -25,6 +25,8 @@ G_BEGIN_DECLS
 
 GdaSqlStatement *_gda_statement_get_internal_struct (GdaStatement *stmt);
 const GType *_gda_statement_get_requested_types (GdaStatement *stmt);
+void         _gda_statement_clear_templates (GdaStatement *stmt);
+guint        _gda_statement_get_nb_compiled_templates (GdaStatement *stmt);
 
 G_END_DECLS
 
@@ -47,6 +47,7 @@
 #include <libgda/gda-meta-store.h>
 #include <libgda/gda-connection.h>
 #include <libgda/gda-util.h>
+#include <libgda/gda-trace-private.h>
 #include <libgda/libgda.h>
 
 /* 
@@ -66,6 +67,15 @@ static void gda_statement_get_property (GObject *object,
 typedef struct {
 	GdaSqlStatement *internal_struct;
 	GType           *requested_types;
+
+	/* execution limits, 0 to use the connection's settings */
+	guint            timeout;
+	guint            max_rows;
+	guint64          max_bytes;
+
+	/* compiled templates (StatementTemplate), protected by templates_mutex */
+	GSList          *templates;
+	guint            nb_compiled; /* number of templates compiled since the last clear */
 } GdaStatementPrivate;
 
 G_DEFINE_TYPE_WITH_PRIVATE (GdaStatement, gda_statement, G_TYPE_OBJECT)
@@ -79,11 +89,17 @@ enum
 
 static gint gda_statement_signals[LAST_SIGNAL] = { 0, 0 };
 
+static GMutex templates_mutex;
+static void statement_clear_templates (GdaStatementPrivate *priv);
+
 /* properties */
 enum
 {
 	PROP_0,
-	PROP_STRUCTURE
+	PROP_STRUCTURE,
+	PROP_TIMEOUT,
+	PROP_MAX_ROWS,
+	PROP_MAX_BYTES
 };
 
 /* module error */
@@ -144,6 +160,51 @@ gda_statement_class_init (GdaStatementClass * klass)
 	g_object_class_install_property (object_class, PROP_STRUCTURE,
 					 g_param_spec_boxed ("structure", NULL, NULL, GDA_TYPE_SQL_STATEMENT,
 							       G_PARAM_WRITABLE | G_PARAM_READABLE));
+
+	/**
+	 * GdaStatement:timeout:
+	 *
+	 * Maximum execution time of the statement, in milliseconds, overriding the
+	 * #GdaConnection:statement-timeout property of the connection used to execute it.
+	 * 0 means the connection's setting is used.
+	 *
+	 * Since: 6.0
+	 */
+	g_object_class_install_property (object_class, PROP_TIMEOUT,
+					 g_param_spec_uint ("timeout", NULL,
+							    _("Maximum execution time, in milliseconds"),
+							    0, G_MAXUINT, 0,
+							    G_PARAM_WRITABLE | G_PARAM_READABLE));
+
+	/**
+	 * GdaStatement:max-rows:
+	 *
+	 * Maximum number of rows the data model returned when executing the statement may hold in memory,
+	 * overriding the #GdaConnection:max-rows property of the connection used to execute it.
+	 * 0 means the connection's setting is used.
+	 *
+	 * Since: 6.0
+	 */
+	g_object_class_install_property (object_class, PROP_MAX_ROWS,
+					 g_param_spec_uint ("max-rows", NULL,
+							    _("Maximum number of rows held in memory"),
+							    0, G_MAXINT, 0,
+							    G_PARAM_WRITABLE | G_PARAM_READABLE));
+
+	/**
+	 * GdaStatement:max-bytes:
+	 *
+	 * Maximum size, in bytes, of the rows the data model returned when executing the statement
+	 * may hold in memory, overriding the #GdaConnection:max-bytes property of the connection
+	 * used to execute it. 0 means the connection's setting is used.
+	 *
+	 * Since: 6.0
+	 */
+	g_object_class_install_property (object_class, PROP_MAX_BYTES,
+					 g_param_spec_uint64 ("max-bytes", NULL,
+							      _("Maximum size of the rows held in memory"),
+							      0, G_MAXUINT64, 0,
+							      G_PARAM_WRITABLE | G_PARAM_READABLE));
 }
 
 static void
@@ -152,6 +213,7 @@ gda_statement_init (GdaStatement * stmt)
 	GdaStatementPrivate *priv = gda_statement_get_instance_private (stmt);
 	priv->internal_struct = NULL;
 	priv->requested_types = NULL;
+	priv->templates = NULL;
 }
 
 /**
@@ -178,6 +240,34 @@ _gda_statement_get_internal_struct (GdaStatement *stmt)
 	return priv->internal_struct;
 }
 
+/*
+ * Drops the compiled templates of @stmt, to be called when its internal structure is modified
+ * in place
+ */
+void
+_gda_statement_clear_templates (GdaStatement *stmt)
+{
+	g_return_if_fail (GDA_IS_STATEMENT (stmt));
+	GdaStatementPrivate *priv = gda_statement_get_instance_private (stmt);
+	statement_clear_templates (priv);
+}
+
+/*
+ * Returns: the number of templates compiled for @stmt since its structure was last modified
+ */
+guint
+_gda_statement_get_nb_compiled_templates (GdaStatement *stmt)
+{
+	guint nb;
+	g_return_val_if_fail (GDA_IS_STATEMENT (stmt), 0);
+	GdaStatementPrivate *priv = gda_statement_get_instance_private (stmt);
+
+	g_mutex_lock (&templates_mutex);
+	nb = priv->nb_compiled;
+	g_mutex_unlock (&templates_mutex);
+	return nb;
+}
+
 /**
  * gda_statement_copy:
  * @orig: a #GdaStatement to make a copy of
@@ -194,7 +284,9 @@ gda_statement_copy (GdaStatement *orig)
 	g_return_val_if_fail (GDA_IS_STATEMENT (orig), NULL);
 	GdaStatementPrivate *priv = gda_statement_get_instance_private (orig);
 
-	obj = g_object_new (GDA_TYPE_STATEMENT, "structure", priv->internal_struct, NULL);
+	obj = g_object_new (GDA_TYPE_STATEMENT, "structure", priv->internal_struct,
+			    "timeout", priv->timeout, "max-rows", priv->max_rows,
+			    "max-bytes", priv->max_bytes, NULL);
 	return GDA_STATEMENT (obj);
 }
 
@@ -212,6 +304,7 @@ gda_statement_dispose (GObject *object)
 		g_free (priv->requested_types);
 		priv->requested_types = NULL;
 	}
+	statement_clear_templates (priv);
 	if (priv->internal_struct != NULL) {
 		gda_sql_statement_free (priv->internal_struct);
 		priv->internal_struct = NULL;
@@ -241,9 +334,19 @@ gda_statement_set_property (GObject *object,
 				g_free (priv->requested_types);
 				priv->requested_types = NULL;
 			}
+			statement_clear_templates (priv);
 			priv->internal_struct = g_value_dup_boxed (value);
 			g_signal_emit (stmt, gda_statement_signals [RESET], 0);
 			break;
+		case PROP_TIMEOUT:
+			priv->timeout = g_value_get_uint (value);
+			break;
+		case PROP_MAX_ROWS:
+			priv->max_rows = g_value_get_uint (value);
+			break;
+		case PROP_MAX_BYTES:
+			priv->max_bytes = g_value_get_uint64 (value);
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
 			break;
@@ -264,6 +367,15 @@ gda_statement_get_property (GObject *object,
 		case PROP_STRUCTURE:
 			g_value_set_boxed (value, priv->internal_struct);
 			break;
+		case PROP_TIMEOUT:
+			g_value_set_uint (value, priv->timeout);
+			break;
+		case PROP_MAX_ROWS:
+			g_value_set_uint (value, priv->max_rows);
+			break;
+		case PROP_MAX_BYTES:
+			g_value_set_uint64 (value, priv->max_bytes);
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
 			break;
@@ -403,6 +515,7 @@ gda_statement_normalize (GdaStatement *stmt, GdaConnection *cnc, GError **error)
 	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), FALSE);
 	GdaStatementPrivate *priv = gda_statement_get_instance_private (stmt);
 
+	statement_clear_templates (priv);
 	return gda_sql_statement_normalize (priv->internal_struct, cnc, error);
 }
 
@@ -614,6 +727,394 @@ static gchar *default_render_select_from (GdaSqlSelectFrom *from, GdaSqlRenderin
 static gchar *default_render_select_order (GdaSqlSelectOrder *order, GdaSqlRenderingContext *context, GError **error);
 static gchar *default_render_distinct (GdaSqlStatementSelect *select, GdaSqlRenderingContext *context, GError **error);
 
+/*
+ * Compiled statement templates
+ *
+ * Once a statement has been rendered a second time with a given rendering context, the resulting
+ * SQL is split into literal fragments and parameter slots, so the next renderings with the same
+ * context only have to render each parameter and splice it into a preallocated buffer, instead of
+ * walking the whole statement's structure again. The first rendering only records the context, so
+ * statements rendered once don't pay for the compilation.
+ *
+ * As the structure around a parameter may depend on its value being NULL or DEFAULT (for example
+ * "a = ##p" is rendered as "a IS NULL" when ##p is NULL), a template can only be used if those
+ * properties are the same as when it was compiled; otherwise a full rendering is done, and the
+ * template is compiled again from it, for the new properties.
+ */
+#define STATEMENT_MAX_TEMPLATES 4
+#define TEMPLATE_SLOT_START '\001'
+#define TEMPLATE_SLOT_END '\002'
+
+typedef struct {
+	GdaSqlParamSpec *pspec;
+	GdaSqlExpr      *expr;
+	gsize            position; /* offset in the template's SQL where the parameter is rendered */
+	gboolean         check_default;
+	gboolean         is_default;
+	gboolean         check_null;
+	gboolean         is_null;
+} TemplateSlot;
+
+typedef struct {
+	gint                    ref_count;
+	GdaSqlRenderingContext  context; /* flags and rendering functions, without any parameter,
+					  * provider or connection */
+	gboolean                has_provider;
+	GWeakRef                provider; /* the context's provider, if @has_provider */
+	gboolean                has_cnc;
+	GWeakRef                cnc; /* the context's connection, if @has_cnc */
+	gboolean                compiled; /* %FALSE if the statement has only been rendered once */
+	gchar                  *sql; /* literal parts, or %NULL if not compiled or if the statement can't be */
+	gsize                   sql_len;
+	GArray                 *slots; /* array of TemplateSlot, in rendering order */
+} StatementTemplate;
+
+/* rendering context used while compiling a template */
+typedef struct {
+	GdaSqlRenderingContext    context;
+	GdaSqlRenderingPSpecFunc  real_render_param_spec;
+	GArray                   *slots;
+	GPtrArray                *rendered; /* parameters' rendering, one for each slot */
+} TemplateCompileContext;
+
+static void
+statement_template_unref (StatementTemplate *template)
+{
+	if (g_atomic_int_dec_and_test (&(template->ref_count))) {
+		g_weak_ref_clear (&(template->provider));
+		g_weak_ref_clear (&(template->cnc));
+		g_free (template->sql);
+		if (template->slots)
+			g_array_free (template->slots, TRUE);
+		g_free (template);
+	}
+}
+
+static void
+statement_clear_templates (GdaStatementPrivate *priv)
+{
+	GSList *templates;
+
+	g_mutex_lock (&templates_mutex);
+	templates = priv->templates;
+	priv->templates = NULL;
+	priv->nb_compiled = 0;
+	g_mutex_unlock (&templates_mutex);
+
+	g_slist_free_full (templates, (GDestroyNotify) statement_template_unref);
+}
+
+/*
+ * Returns: %TRUE if @template's object referenced by @ref is @object; the template only holds
+ * weak references, so a template compiled for a finalized object never matches, even if a new
+ * object is allocated at the same address.
+ */
+static gboolean
+template_object_matches (gboolean has_object, GWeakRef *ref, gpointer object)
+{
+	GObject *tobj;
+	gboolean retval;
+
+	if (!has_object)
+		return object ? FALSE : TRUE;
+	if (!object)
+		return FALSE;
+	tobj = g_weak_ref_get (ref);
+	retval = (tobj == object);
+	if (tobj)
+		g_object_unref (tobj);
+	return retval;
+}
+
+/* Returns: %TRUE if @template was compiled for a connection which has since been finalized */
+static gboolean
+template_is_stale (StatementTemplate *template)
+{
+	GObject *cnc;
+
+	if (!template->has_cnc)
+		return FALSE;
+	cnc = g_weak_ref_get (&(template->cnc));
+	if (!cnc)
+		return TRUE;
+	g_object_unref (cnc);
+	return FALSE;
+}
+
+static gboolean
+template_context_matches (StatementTemplate *template, const GdaSqlRenderingContext *context)
+{
+	const GdaSqlRenderingContext *tc = &(template->context);
+	gsize offset = G_STRUCT_OFFSET (GdaSqlRenderingContext, render_value);
+
+	return (tc->flags == context->flags) &&
+		! memcmp ((const guint8*) tc + offset, (const guint8*) context + offset,
+			  sizeof (GdaSqlRenderingContext) - offset) &&
+		template_object_matches (template->has_provider, &(template->provider), context->provider) &&
+		template_object_matches (template->has_cnc, &(template->cnc), context->cnc);
+}
+
+/* Returns: (transfer full): a template compiled with a context compatible with @context, or %NULL */
+static StatementTemplate *
+statement_lookup_template (GdaStatementPrivate *priv, GdaSqlRenderingContext *context)
+{
+	StatementTemplate *template = NULL;
+	GSList *list;
+
+	g_mutex_lock (&templates_mutex);
+	for (list = priv->templates; list; ) {
+		StatementTemplate *tmpl = (StatementTemplate*) list->data;
+		if (template_is_stale (tmpl)) {
+			/* the connection is gone, and the template can't be used anymore */
+			GSList *next = list->next;
+			priv->templates = g_slist_delete_link (priv->templates, list);
+			statement_template_unref (tmpl);
+			list = next;
+			continue;
+		}
+		if (template_context_matches (tmpl, context)) {
+			template = tmpl;
+			g_atomic_int_inc (&(template->ref_count));
+			if (list != priv->templates) {
+				/* keep the most recently used templates first */
+				priv->templates = g_slist_delete_link (priv->templates, list);
+				priv->templates = g_slist_prepend (priv->templates, template);
+			}
+			break;
+		}
+		list = list->next;
+	}
+	g_mutex_unlock (&templates_mutex);
+	return template;
+}
+
+/*
+ * Adds @template to @priv's templates, in place of @old if not %NULL (and still there)
+ */
+static void
+statement_add_template (GdaStatementPrivate *priv, StatementTemplate *template, StatementTemplate *old)
+{
+	GSList *list;
+
+	g_mutex_lock (&templates_mutex);
+	if (template->compiled)
+		priv->nb_compiled ++;
+	list = old ? g_slist_find (priv->templates, old) : NULL;
+	if (list) {
+		list->data = template;
+		statement_template_unref (old);
+	}
+	else {
+		priv->templates = g_slist_prepend (priv->templates, template);
+		list = g_slist_nth (priv->templates, STATEMENT_MAX_TEMPLATES);
+		if (list) {
+			priv->templates = g_slist_remove_link (priv->templates, list);
+			statement_template_unref ((StatementTemplate*) list->data);
+			g_slist_free_1 (list);
+		}
+	}
+	g_mutex_unlock (&templates_mutex);
+}
+
+/*
+ * Renders the parameter using the real rendering function, keeps track of the result, and
+ * returns a marker in place of the parameter's rendering
+ */
+static gchar *
+template_render_param_spec (GdaSqlParamSpec *pspec, GdaSqlExpr *expr, GdaSqlRenderingContext *context,
+			    gboolean *is_default, gboolean *is_null, GError **error)
+{
+	TemplateCompileContext *cctx = (TemplateCompileContext*) context;
+	TemplateSlot slot;
+	gchar *str;
+
+	memset (&slot, 0, sizeof (slot));
+	str = cctx->real_render_param_spec (pspec, expr, context, &(slot.is_default), &(slot.is_null), error);
+	if (!str)
+		return NULL;
+	slot.pspec = pspec;
+	slot.expr = expr;
+	if (is_default) {
+		slot.check_default = TRUE;
+		*is_default = slot.is_default;
+	}
+	if (is_null) {
+		slot.check_null = TRUE;
+		*is_null = slot.is_null;
+	}
+	g_array_append_val (cctx->slots, slot);
+	g_ptr_array_add (cctx->rendered, str);
+
+	return g_strdup_printf ("%c%u%c", TEMPLATE_SLOT_START, cctx->slots->len - 1, TEMPLATE_SLOT_END);
+}
+
+static gchar *render_statement_contents (GdaSqlStatement *sqlst, GdaSqlRenderingContext *context, GError **error);
+
+/* Returns: (transfer full): a new template, not compiled, recording @context */
+static StatementTemplate *
+statement_template_new (GdaSqlRenderingContext *context)
+{
+	StatementTemplate *template;
+
+	template = g_new0 (StatementTemplate, 1);
+	template->ref_count = 1;
+	template->context = *context;
+	template->context.params = NULL;
+	template->context.params_used = NULL;
+	template->context.provider = NULL;
+	template->context.cnc = NULL;
+	template->has_provider = context->provider ? TRUE : FALSE;
+	g_weak_ref_init (&(template->provider), context->provider);
+	template->has_cnc = context->cnc ? TRUE : FALSE;
+	g_weak_ref_init (&(template->cnc), context->cnc);
+	return template;
+}
+
+/*
+ * Compiles a template for @context, where @sql is the result of the complete rendering of @priv's
+ * statement with @context.
+ *
+ * If the rendering using markers for the parameters can't be converted back to @sql, then
+ * the returned template is marked as not usable, so the statement is always completely rendered
+ * with @context.
+ */
+static StatementTemplate *
+statement_compile_template (GdaStatementPrivate *priv, GdaSqlRenderingContext *context, const gchar *sql)
+{
+	StatementTemplate *template;
+	TemplateCompileContext cctx;
+	gchar *marked;
+	GString *literal = NULL;
+
+	template = statement_template_new (context);
+	template->compiled = TRUE;
+
+	if (strchr (sql, TEMPLATE_SLOT_START))
+		return template;
+
+	memset (&cctx, 0, sizeof (cctx));
+	cctx.context = *context;
+	cctx.context.params_used = NULL;
+	cctx.context.render_param_spec = template_render_param_spec;
+	cctx.real_render_param_spec = context->render_param_spec;
+	cctx.slots = g_array_new (FALSE, FALSE, sizeof (TemplateSlot));
+	cctx.rendered = g_ptr_array_new_with_free_func (g_free);
+
+	marked = render_statement_contents (priv->internal_struct, (GdaSqlRenderingContext*) &cctx, NULL);
+	g_slist_free (cctx.context.params_used);
+	if (marked) {
+		GString *check;
+		const gchar *ptr, *start;
+		guint next = 0;
+
+		/* split into literal parts and slots, each slot appearing once, in the rendering order */
+		literal = g_string_sized_new (strlen (marked));
+		check = g_string_sized_new (strlen (sql));
+		for (ptr = start = marked; *ptr; ptr++) {
+			gchar *end;
+			guint64 index;
+
+			if (*ptr != TEMPLATE_SLOT_START)
+				continue;
+			g_string_append_len (literal, start, ptr - start);
+			g_string_append_len (check, start, ptr - start);
+			index = g_ascii_strtoull (ptr + 1, &end, 10);
+			if ((end == ptr + 1) || (*end != TEMPLATE_SLOT_END) ||
+			    (index != next) || (next >= cctx.slots->len))
+				break;
+			g_array_index (cctx.slots, TemplateSlot, next).position = literal->len;
+			g_string_append (check, g_ptr_array_index (cctx.rendered, next));
+			next++;
+			ptr = end;
+			start = end + 1;
+		}
+		if (!*ptr) {
+			g_string_append (literal, start);
+			g_string_append (check, start);
+		}
+
+		/* the template must produce exactly the same SQL as the complete rendering */
+		if (!*ptr && (next == cctx.slots->len) && !strcmp (check->str, sql)) {
+			template->sql_len = literal->len;
+			template->sql = g_string_free (literal, FALSE);
+			template->slots = cctx.slots;
+			cctx.slots = NULL;
+			literal = NULL;
+		}
+		g_string_free (check, TRUE);
+		g_free (marked);
+	}
+
+	if (literal)
+		g_string_free (literal, TRUE);
+	if (cctx.slots)
+		g_array_free (cctx.slots, TRUE);
+	g_ptr_array_unref (cctx.rendered);
+
+	return template;
+}
+
+/*
+ * Renders the statement from @template, only rendering each parameter.
+ *
+ * Returns: a new string, or %NULL if an error occurred or if @template can't be used, in which
+ * case @fallback is set to %TRUE
+ */
+static gchar *
+statement_template_render (StatementTemplate *template, GdaSqlRenderingContext *context,
+			   gboolean *fallback, GError **error)
+{
+	GString *string;
+	guint i, nb_used;
+	gsize prev = 0;
+
+	*fallback = FALSE;
+	if (!template->sql) {
+		*fallback = TRUE;
+		return NULL;
+	}
+
+	nb_used = g_slist_length (context->params_used);
+	string = g_string_sized_new (template->sql_len + 16 * template->slots->len + 1);
+	for (i = 0; i < template->slots->len; i++) {
+		TemplateSlot *slot = &g_array_index (template->slots, TemplateSlot, i);
+		gboolean is_default, is_null;
+		gchar *str;
+
+		str = context->render_param_spec (slot->pspec, slot->expr, context, &is_default, &is_null, error);
+		if (!str)
+			goto err;
+		if ((slot->check_default && (is_default != slot->is_default)) ||
+		    (slot->check_null && (is_null != slot->is_null))) {
+			g_free (str);
+			*fallback = TRUE;
+			goto err;
+		}
+		g_string_append_len (string, template->sql + prev, slot->position - prev);
+		g_string_append (string, str);
+		g_free (str);
+		prev = slot->position;
+	}
+	g_string_append_len (string, template->sql + prev, template->sql_len - prev);
+
+	return g_string_free (string, FALSE);
+
+ err:
+	/* forget about the parameters used by the partial rendering */
+	if (nb_used == 0) {
+		g_slist_free (context->params_used);
+		context->params_used = NULL;
+	}
+	else {
+		GSList *last;
+		last = g_slist_nth (context->params_used, nb_used - 1);
+		g_slist_free (last->next);
+		last->next = NULL;
+	}
+	g_string_free (string, TRUE);
+	return NULL;
+}
+
 /**
  * gda_statement_to_sql_real:
  * @stmt: a #GdaStatement object
@@ -624,6 +1125,12 @@ static gchar *default_render_distinct (GdaSqlStatementSelect *select, GdaSqlRend
  * be rendered. This function is mainly used by database provider's implementations which require
  * to specialize some aspects of SQL rendering to be adapted to the database,'s own SQL dialect
  * (for example SQLite rewrites the 'FALSE' and 'TRUE' literals as '0' and 'NOT 0').
+ *
+ * The second rendering of @stmt with a given set of flags and rendering functions is compiled into
+ * a template, made of the literal parts of the SQL and of the positions of the parameters, so the
+ * next renderings with the same flags and rendering functions only render the parameters. The
+ * template is compiled again when a parameter's value becomes or stops being NULL or DEFAULT, and
+ * it is discarded when @stmt's structure changes.
  * 
  * Returns: (transfer full): a new string, or %NULL if an error occurred
  */
@@ -631,6 +1138,8 @@ gchar *
 gda_statement_to_sql_real (GdaStatement *stmt, GdaSqlRenderingContext *context, GError **error)
 {
 	GdaSqlStatementContentsInfo *cinfo;
+	StatementTemplate *template;
+	gchar *str;
 	g_return_val_if_fail (GDA_IS_STATEMENT (stmt), NULL);
 	GdaStatementPrivate *priv = gda_statement_get_instance_private (stmt);
 
@@ -677,57 +1186,87 @@ gda_statement_to_sql_real (GdaStatement *stmt, GdaSqlRenderingContext *context,
 	if (!context->render_distinct)
 		context->render_distinct = (GdaSqlRenderingFunc) default_render_distinct;
 
+	template = statement_lookup_template (priv, context);
+	if (template && template->sql) {
+		gboolean fallback;
+		str = statement_template_render (template, context, &fallback, error);
+		if (str || !fallback) {
+			statement_template_unref (template);
+			return str;
+		}
+	}
+
 	cinfo = gda_sql_statement_get_contents_infos (priv->internal_struct->stmt_type);
 	if (cinfo->check_structure_func && !cinfo->check_structure_func (GDA_SQL_ANY_PART (priv->internal_struct->contents),
-									 NULL, error))
+									 NULL, error)) {
+		if (template)
+			statement_template_unref (template);
 		return NULL;
+	}
 
-	switch (GDA_SQL_ANY_PART (priv->internal_struct->contents)->type) {
+	str = render_statement_contents (priv->internal_struct, context, error);
+	if (str) {
+		if (!template)
+			/* first rendering with @context, compiled by the next one if any */
+			statement_add_template (priv, statement_template_new (context), NULL);
+		else if (!template->compiled || template->sql)
+			/* second rendering, or NULL or DEFAULT parameters since the compilation */
+			statement_add_template (priv, statement_compile_template (priv, context, str), template);
+	}
+	if (template)
+		statement_template_unref (template);
+	return str;
+}
+
+static gchar *
+render_statement_contents (GdaSqlStatement *sqlst, GdaSqlRenderingContext *context, GError **error)
+{
+	switch (GDA_SQL_ANY_PART (sqlst->contents)->type) {
 	case GDA_SQL_ANY_STMT_UNKNOWN:
-		return context->render_unknown (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+		return context->render_unknown (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 	case GDA_SQL_ANY_STMT_BEGIN:
 		if (context->render_begin)
-			return context->render_begin (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+			return context->render_begin (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 		break;
 	case GDA_SQL_ANY_STMT_ROLLBACK:
 		if (context->render_rollback)
-			return context->render_rollback (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+			return context->render_rollback (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 		break;
         case GDA_SQL_ANY_STMT_COMMIT:
 		if (context->render_commit)
-			return context->render_commit (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+			return context->render_commit (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 		break;
         case GDA_SQL_ANY_STMT_SAVEPOINT:
 		if (context->render_savepoint)
-			return context->render_savepoint (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+			return context->render_savepoint (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 		break;
         case GDA_SQL_ANY_STMT_ROLLBACK_SAVEPOINT:
 		if (context->render_rollback_savepoint)
-			return context->render_rollback_savepoint (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+			return context->render_rollback_savepoint (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 		break;
         case GDA_SQL_ANY_STMT_DELETE_SAVEPOINT:
 		if (context->render_delete_savepoint)
-			return context->render_delete_savepoint (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+			return context->render_delete_savepoint (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 		break;
 	case GDA_SQL_ANY_STMT_SELECT:
-		return context->render_select (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+		return context->render_select (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 	case GDA_SQL_ANY_STMT_INSERT:
-		return context->render_insert (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+		return context->render_insert (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 	case GDA_SQL_ANY_STMT_DELETE:
-		return context->render_delete (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+		return context->render_delete (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 	case GDA_SQL_ANY_STMT_UPDATE:
-		return context->render_update (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+		return context->render_update (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 	case GDA_SQL_ANY_STMT_COMPOUND:
-		return context->render_compound (GDA_SQL_ANY_PART (priv->internal_struct->contents), context, error);
+		return context->render_compound (GDA_SQL_ANY_PART (sqlst->contents), context, error);
 	default:
 		TO_IMPLEMENT;
 		return NULL;
 		break;
 	}
 
-	/* default action is to use priv->internal_struct->sql */
-	if (priv->internal_struct->sql)
-		return g_strdup (priv->internal_struct->sql);
+	/* default action is to use sqlst->sql */
+	if (sqlst->sql)
+		return g_strdup (sqlst->sql);
 	else {
 		g_set_error (error, GDA_SQL_ERROR, GDA_SQL_STRUCTURE_CONTENTS_ERROR,
 			     "%s", _("Missing SQL code"));
@@ -830,14 +1369,18 @@ gda_statement_to_sql_extended (GdaStatement *stmt, GdaConnection *cnc, GdaSet *p
 
 	g_return_val_if_fail (GDA_IS_STATEMENT (stmt), NULL);
 
+	GDA_TRACE (render, begin, stmt, 0);
 	memset (&context, 0, sizeof (context));
 	context.params = params;
 	context.flags = flags;
 	if (cnc) {
-		if (gda_connection_is_opened (cnc))
-			return _gda_server_provider_statement_to_sql (gda_connection_get_provider (cnc), cnc,
-								      stmt, params, flags,
-								      params_used, error);
+		if (gda_connection_is_opened (cnc)) {
+			str = _gda_server_provider_statement_to_sql (gda_connection_get_provider (cnc), cnc,
+								     stmt, params, flags,
+								     params_used, error);
+			GDA_TRACE (render, end, stmt, str ? 1 : 0);
+			return str;
+		}
 		else
 			context.provider = gda_connection_get_provider (cnc);
 	}
@@ -855,6 +1398,7 @@ gda_statement_to_sql_extended (GdaStatement *stmt, GdaConnection *cnc, GdaSet *p
 			*params_used = NULL;
 		g_slist_free (context.params_used);
 	}
+	GDA_TRACE (render, end, stmt, str ? 1 : 0);
 	return str;
 }
 
@@ -963,6 +1507,40 @@ default_render_insert (GdaSqlStatementInsert *stmt, GdaSqlRenderingContext *cont
 			g_string_append (string, " DEFAULT VALUES");
 	}
 
+	/* upsert, using the SQL dialect of PostgreSQL and SQLite */
+	if (stmt->conflict_fields || stmt->update_fields) {
+		if (pretty)
+			g_string_append (string, "\nON CONFLICT");
+		else
+			g_string_append (string, " ON CONFLICT");
+		for (list = stmt->conflict_fields; list; list = list->next) {
+			if (list == stmt->conflict_fields)
+				g_string_append (string, " (");
+			else
+				g_string_append (string, ", ");
+			str = context->render_field (GDA_SQL_ANY_PART (list->data), context, error);
+			if (!str) goto err;
+			g_string_append (string, str);
+			g_free (str);
+		}
+		if (stmt->conflict_fields)
+			g_string_append_c (string, ')');
+
+		if (stmt->update_fields) {
+			g_string_append (string, " DO UPDATE SET ");
+			for (list = stmt->update_fields; list; list = list->next) {
+				if (list != stmt->update_fields)
+					g_string_append (string, ", ");
+				str = context->render_field (GDA_SQL_ANY_PART (list->data), context, error);
+				if (!str) goto err;
+				g_string_append_printf (string, "%s = EXCLUDED.%s", str, str);
+				g_free (str);
+			}
+		}
+		else
+			g_string_append (string, " DO NOTHING");
+	}
+
 	str = g_string_free (string, FALSE);
 	return str;
 
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __GDA_TRACE_PRIVATE_H__
+#define __GDA_TRACE_PRIVATE_H__
+
+#include <libgda/gda-trace.h>
+
+#ifdef GDA_ENABLE_SDT
+#include <sys/sdt.h>
+#endif
+
+G_BEGIN_DECLS
+
+/*
+ * Set to a non zero value when a #GdaTraceFunc has been set, read without lock by GDA_TRACE()
+ */
+extern gint _gda_trace_enabled;
+
+void _gda_trace_emit (GdaTracePoint point, GdaTraceEvent event, gpointer object, gint64 value);
+
+/*
+ * GDA_TRACE:
+ * @point: the lower case name of the point, as in "execute" for GDA_TRACE_POINT_EXECUTE
+ * @event: "begin" or "end"
+ * @object: the object concerned by the event
+ * @value: a value, see #GdaTracePoint
+ *
+ * Fires the @point__@event static probe if compiled in, and calls the #GdaTraceFunc if any
+ */
+#ifdef GDA_ENABLE_SDT
+#define _GDA_TRACE_SDT(point,event,object,value) DTRACE_PROBE2 (libgda, point##__##event, (gpointer) (object), (gint64) (value))
+#else
+#define _GDA_TRACE_SDT(point,event,object,value)
+#endif
+
+#define _GDA_TRACE_POINT_parse       GDA_TRACE_POINT_PARSE
+#define _GDA_TRACE_POINT_render      GDA_TRACE_POINT_RENDER
+#define _GDA_TRACE_POINT_prepare     GDA_TRACE_POINT_PREPARE
+#define _GDA_TRACE_POINT_bind        GDA_TRACE_POINT_BIND
+#define _GDA_TRACE_POINT_execute     GDA_TRACE_POINT_EXECUTE
+#define _GDA_TRACE_POINT_fetch_chunk GDA_TRACE_POINT_FETCH_CHUNK
+#define _GDA_TRACE_POINT_row_build   GDA_TRACE_POINT_ROW_BUILD
+#define _GDA_TRACE_POINT_blob_read   GDA_TRACE_POINT_BLOB_READ
+#define _GDA_TRACE_POINT_blob_write  GDA_TRACE_POINT_BLOB_WRITE
+
+#define _GDA_TRACE_EVENT_begin GDA_TRACE_EVENT_BEGIN
+#define _GDA_TRACE_EVENT_end   GDA_TRACE_EVENT_END
+
+#define GDA_TRACE(point,event,object,value) G_STMT_START {		\
+	_GDA_TRACE_SDT (point, event, object, value);			\
+	if (G_UNLIKELY (_gda_trace_enabled))				\
+		_gda_trace_emit (_GDA_TRACE_POINT_##point, _GDA_TRACE_EVENT_##event, \
+				 (gpointer) (object), (gint64) (value)); \
+	} G_STMT_END
+
+G_END_DECLS
+
+#endif
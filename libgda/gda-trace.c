@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+#define G_LOG_DOMAIN "GDA-trace"
+
+#include <glib.h>
+#include <libgda/gda-trace.h>
+#include <libgda/gda-trace-private.h>
+
+gint _gda_trace_enabled = 0;
+
+/*
+ * The trace function is protected by a read-write lock: emitting events only takes a reader lock, and
+ * once gda_trace_set_func() returns, the previous function is guaranteed not to be running anymore
+ */
+static GRWLock trace_lock;
+static GdaTraceFunc trace_func = NULL;
+static gpointer trace_data = NULL;
+static GDestroyNotify trace_notify = NULL;
+
+/**
+ * gda_trace_set_func:
+ * @func: (nullable) (scope notified): a #GdaTraceFunc, or %NULL
+ * @data: (nullable): data passed to @func
+ * @notify: (nullable): function called to free @data when @func is replaced, or %NULL
+ *
+ * Sets the function called for each event of the statement execution pipeline, replacing any
+ * previously set function. Passing %NULL as @func disables tracing.
+ *
+ * Since: 6.0
+ */
+void
+gda_trace_set_func (GdaTraceFunc func, gpointer data, GDestroyNotify notify)
+{
+	gpointer old_data;
+	GDestroyNotify old_notify;
+
+	g_rw_lock_writer_lock (&trace_lock);
+	old_data = trace_data;
+	old_notify = trace_notify;
+	trace_func = func;
+	trace_data = data;
+	trace_notify = notify;
+	g_atomic_int_set (&_gda_trace_enabled, func ? 1 : 0);
+	g_rw_lock_writer_unlock (&trace_lock);
+
+	if (old_notify)
+		old_notify (old_data);
+}
+
+/**
+ * gda_trace_point_to_string:
+ * @point: a #GdaTracePoint
+ *
+ * Get the name of @point, as used by the static probes.
+ *
+ * Returns: (transfer none): the name of @point
+ *
+ * Since: 6.0
+ */
+const gchar *
+gda_trace_point_to_string (GdaTracePoint point)
+{
+	switch (point) {
+	case GDA_TRACE_POINT_PARSE:
+		return "parse";
+	case GDA_TRACE_POINT_RENDER:
+		return "render";
+	case GDA_TRACE_POINT_PREPARE:
+		return "prepare";
+	case GDA_TRACE_POINT_BIND:
+		return "bind";
+	case GDA_TRACE_POINT_EXECUTE:
+		return "execute";
+	case GDA_TRACE_POINT_FETCH_CHUNK:
+		return "fetch_chunk";
+	case GDA_TRACE_POINT_ROW_BUILD:
+		return "row_build";
+	case GDA_TRACE_POINT_BLOB_READ:
+		return "blob_read";
+	case GDA_TRACE_POINT_BLOB_WRITE:
+		return "blob_write";
+	default:
+		g_return_val_if_reached (NULL);
+	}
+}
+
+void
+_gda_trace_emit (GdaTracePoint point, GdaTraceEvent event, gpointer object, gint64 value)
+{
+	g_rw_lock_reader_lock (&trace_lock);
+	if (trace_func)
+		trace_func (point, event, object, value, trace_data);
+	g_rw_lock_reader_unlock (&trace_lock);
+}
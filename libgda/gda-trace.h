@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __GDA_TRACE_H__
+#define __GDA_TRACE_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * GdaTracePoint:
+ * @GDA_TRACE_POINT_PARSE: parsing of an SQL string, the object is the #GdaSqlParser, and the value of the end
+ *                         event is 1 if a statement was parsed and 0 otherwise
+ * @GDA_TRACE_POINT_RENDER: rendering of a statement as SQL, the object is the #GdaStatement, and the value of the
+ *                          end event is 1 on success and 0 on error
+ * @GDA_TRACE_POINT_PREPARE: preparation of a statement by the provider, the object is the #GdaStatement, and the
+ *                           value of the end event is 1 on success and 0 on error
+ * @GDA_TRACE_POINT_BIND: binding of the statement's parameters by the provider, the object is the #GdaStatement,
+ *                        the value of the begin event is the number of parameters, and the value of the end
+ *                        event is 1 on success and 0 on error
+ * @GDA_TRACE_POINT_EXECUTE: execution of a statement by the provider (in the connection's worker thread), the
+ *                           object is the #GdaStatement, and the value of the end event is 1 on success and 0 on error
+ * @GDA_TRACE_POINT_FETCH_CHUNK: fetching of rows from the provider by a #GdaDataSelect (the object), the value of
+ *                               the begin event is the requested row number (or -1 when counting the rows), and
+ *                               the value of the end event is the number of rows obtained
+ * @GDA_TRACE_POINT_ROW_BUILD: creation of a #GdaRow from the provider's data, the object is the #GdaDataSelect,
+ *                             and the value is the row number
+ * @GDA_TRACE_POINT_BLOB_READ: reading from a blob, the object is the #GdaBlobOp, the value of the begin event is
+ *                             the offset, and the value of the end event is the number of bytes read, or -1 on error
+ * @GDA_TRACE_POINT_BLOB_WRITE: writing to a blob, the object is the #GdaBlobOp, the value of the begin event is
+ *                              the offset, and the value of the end event is the number of bytes written, or -1 on error
+ *
+ * Defines the stages of the statement execution pipeline which can be traced.
+ *
+ * Since: 6.0
+ */
+typedef enum {
+	GDA_TRACE_POINT_PARSE,
+	GDA_TRACE_POINT_RENDER,
+	GDA_TRACE_POINT_PREPARE,
+	GDA_TRACE_POINT_BIND,
+	GDA_TRACE_POINT_EXECUTE,
+	GDA_TRACE_POINT_FETCH_CHUNK,
+	GDA_TRACE_POINT_ROW_BUILD,
+	GDA_TRACE_POINT_BLOB_READ,
+	GDA_TRACE_POINT_BLOB_WRITE
+} GdaTracePoint;
+
+/**
+ * GdaTraceEvent:
+ * @GDA_TRACE_EVENT_BEGIN: the stage is starting
+ * @GDA_TRACE_EVENT_END: the stage is finished
+ *
+ * Since: 6.0
+ */
+typedef enum {
+	GDA_TRACE_EVENT_BEGIN,
+	GDA_TRACE_EVENT_END
+} GdaTraceEvent;
+
+/**
+ * GdaTraceFunc:
+ * @point: the traced stage
+ * @event: the event
+ * @object: the object concerned by the event, see #GdaTracePoint
+ * @value: a value specific to @point and @event, see #GdaTracePoint
+ * @data: the data passed to gda_trace_set_func()
+ *
+ * Function called for each traced event. It may be called from any thread (for example from a connection's
+ * worker thread), and must not call back into the object it receives, nor call gda_trace_set_func().
+ *
+ * Since: 6.0
+ */
+typedef void (*GdaTraceFunc) (GdaTracePoint point, GdaTraceEvent event, gpointer object, gint64 value, gpointer data);
+
+void         gda_trace_set_func          (GdaTraceFunc func, gpointer data, GDestroyNotify notify);
+const gchar *gda_trace_point_to_string   (GdaTracePoint point);
+
+/**
+ * SECTION:gda-trace
+ * @short_description: Tracing of the statement execution pipeline
+ * @title: Tracing
+ * @stability: Stable
+ * @see_also: #GdaConnection
+ *
+ * Libgda can report when each stage of the statement execution pipeline begins and ends (parsing,
+ * rendering, preparation, parameters binding, execution, rows fetching, rows building and blob I/O),
+ * which allows one to see where time goes when a statement is executed.
+ *
+ * The events can be observed in two ways:
+ * <itemizedlist>
+ *   <listitem><para>by an application, through a #GdaTraceFunc function set using gda_trace_set_func()</para></listitem>
+ *   <listitem><para>by external tools such as perf, bpftrace or SystemTap, through static (USDT) probes in
+ *       the "libgda" provider, named after the point and the event (for example "execute__begin" and
+ *       "execute__end"), with the object and the value as arguments. These probes are only compiled in when Libgda
+ *       is built with the "dtrace" option.</para></listitem>
+ * </itemizedlist>
+ *
+ * When no function is set and no external tool is attached, tracing only costs a test of a global variable
+ * (and a no-op instruction for each static probe).
+ */
+
+G_END_DECLS
+
+#endif
@@ -49,6 +49,7 @@
 #include <libgda/gda-server-provider-private.h>
 #include <libgda/gda-column.h>
 #include <libgda/gda-data-model-iter.h>
+#include <libgda/gda-data-model-cursor.h>
 #ifdef HAVE_LOCALE_H
 #include <locale.h>
 #endif
@@ -57,6 +58,7 @@
 #include <libgda/gda-set.h>
 #include <libgda/gda-blob-op.h>
 #include <libgda/gda-statement-priv.h>
+#include <libgda/gda-connection-internal.h>
 #include <libgda/gda-debug-macros.h>
 #include <libgda/binreloc/gda-binreloc.h>
 
@@ -430,10 +432,10 @@ gda_utility_check_data_model (GdaDataModel *model, gint nbcols, ...)
  *
  * Dump the data in a #GdaDataModel into a xmlNodePtr (as used in libxml).
  *
- * Warning: this function uses a #GdaDataModelIter iterator, and if @model does not offer a random access
- * (check using gda_data_model_get_access_flags()), the iterator will be the same as normally used
- * to access data in @model previously to calling this method, and this iterator will be moved (point to
- * another row).
+ * Warning: this function uses a #GdaDataModelCursor, and if @model does not offer a random access
+ * (check using gda_data_model_get_access_flags()), the cursor shares its position with the iterator
+ * normally used to access data in @model previously to calling this method: the export starts at the row
+ * that iterator is positioned on (if any), and that iterator is positioned after the last row once done.
  *
  * Returns: %TRUE if no error occurred
  */
@@ -447,7 +449,7 @@ gda_utility_data_model_dump_data_to_xml (GdaDataModel *model, xmlNodePtr parent,
 	gint *rcols, rnb_cols;
 	gchar **col_ids = NULL;
 	xmlNodePtr data = NULL;
-	GdaDataModelIter *iter;
+	GdaDataModelCursor *cursor;
 
 	/* compute columns if not provided */
 	if (!cols) {
@@ -482,21 +484,18 @@ gda_utility_data_model_dump_data_to_xml (GdaDataModel *model, xmlNodePtr parent,
 	}
 
 	/* add the model data to the XML output */
-	iter = gda_data_model_create_iter (model);
-	if (iter && (gda_data_model_iter_get_row (iter) == -1) && ! gda_data_model_iter_move_next (iter)) {
-		g_object_unref (iter);
-		iter = NULL;
-	}
-	if (iter) {
+	cursor = gda_data_model_cursor_new (model);
+	if (gda_data_model_cursor_move_next (cursor, NULL)) {
 		xmlNodePtr row;
 		
 		data = xmlNewChild (parent, NULL, (xmlChar*)"gda_array_data", NULL);
-		for (; retval && gda_data_model_iter_is_valid (iter); gda_data_model_iter_move_next (iter)) {
+		for (; retval && (gda_data_model_cursor_get_row (cursor) >= 0);
+		     gda_data_model_cursor_move_next (cursor, NULL)) {
 			gint c;
 			if (rows) {
 				gint r;
 				for (r = 0; r < nb_rows; r++) { 
-					if (gda_data_model_iter_get_row (iter) == rows[r])
+					if (gda_data_model_cursor_get_row (cursor) == rows[r])
 						break;
 				}
 				if (r == nb_rows)
@@ -509,7 +508,7 @@ gda_utility_data_model_dump_data_to_xml (GdaDataModel *model, xmlNodePtr parent,
 				gchar *str = NULL;
 				xmlNodePtr field = NULL;
 
-				value = (GValue*) gda_data_model_iter_get_value_at (iter, rcols[c]);
+				value = (GValue*) gda_data_model_cursor_get_value (cursor, rcols[c]);
 				if (value && !gda_value_is_null ((GValue *) value)) { 
 					if (G_VALUE_TYPE (value) == G_TYPE_BOOLEAN)
 						str = g_strdup (g_value_get_boolean (value) ? "TRUE" : "FALSE");
@@ -548,8 +547,8 @@ gda_utility_data_model_dump_data_to_xml (GdaDataModel *model, xmlNodePtr parent,
 				g_free (str);
 			}
 		}
-		g_object_unref (iter);
 	}
+	gda_data_model_cursor_unref (cursor);
 
 	if (!cols)
 		g_free (rcols);
@@ -1944,6 +1943,7 @@ _gda_modify_statement_param_types (GdaStatement *stmt, GdaDataModel *model)
 		GdaSqlAnyPart *top;
 		top = (GdaSqlAnyPart*) sqlst->contents;
 		gda_sql_any_part_foreach (top, (GdaSqlForeachFunc) foreach_modify_param_type, model, NULL);
+		_gda_statement_clear_templates (stmt);
 	}
 }
 
@@ -2359,6 +2359,75 @@ gda_sql_identifier_split (const gchar *id)
 
 static gboolean _sql_identifier_needs_quotes (const gchar *str);
 
+#define QUOTE_CACHE_MAX_ID_LEN 128
+#define QUOTE_CACHE_MAX_SIZE 1024
+
+/* key: a #GdaServerProvider, or %NULL, value: a #GHashTable of quoted identifiers */
+static GHashTable *quote_caches = NULL;
+static GMutex quote_caches_mutex;
+
+static gchar *sql_identifier_quote_real (const gchar *id, GdaConnection *cnc, GdaServerProvider *prov,
+					 gboolean for_meta_store, gboolean force_quotes);
+
+static void
+quote_cache_provider_finalized (G_GNUC_UNUSED gpointer data, GObject *prov)
+{
+	g_mutex_lock (&quote_caches_mutex);
+	g_hash_table_remove (quote_caches, prov);
+	g_mutex_unlock (&quote_caches_mutex);
+}
+
+/* a provider's properties may change how identifiers are quoted */
+static void
+quote_cache_provider_notify (GObject *prov, G_GNUC_UNUSED GParamSpec *pspec, G_GNUC_UNUSED gpointer data)
+{
+	GHashTable *cache;
+
+	g_mutex_lock (&quote_caches_mutex);
+	cache = g_hash_table_lookup (quote_caches, prov);
+	if (cache)
+		g_hash_table_remove_all (cache);
+	g_mutex_unlock (&quote_caches_mutex);
+}
+
+static gchar *
+quote_cache_lookup (GdaServerProvider *prov, const gchar *key)
+{
+	GHashTable *cache = NULL;
+	gchar *quoted = NULL;
+
+	g_mutex_lock (&quote_caches_mutex);
+	if (quote_caches)
+		cache = g_hash_table_lookup (quote_caches, prov);
+	if (cache)
+		quoted = g_strdup (g_hash_table_lookup (cache, key));
+	g_mutex_unlock (&quote_caches_mutex);
+	return quoted;
+}
+
+static void
+quote_cache_add (GdaServerProvider *prov, const gchar *key, const gchar *quoted)
+{
+	GHashTable *cache;
+
+	g_mutex_lock (&quote_caches_mutex);
+	if (!quote_caches)
+		quote_caches = g_hash_table_new_full (NULL, NULL, NULL, (GDestroyNotify) g_hash_table_destroy);
+	cache = g_hash_table_lookup (quote_caches, prov);
+	if (!cache) {
+		cache = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+		g_hash_table_insert (quote_caches, prov, cache);
+		if (prov) {
+			g_object_weak_ref ((GObject*) prov, quote_cache_provider_finalized, NULL);
+			g_signal_connect (prov, "notify", G_CALLBACK (quote_cache_provider_notify), NULL);
+		}
+	}
+	else if (g_hash_table_size (cache) >= QUOTE_CACHE_MAX_SIZE)
+		g_hash_table_remove_all (cache);
+	g_hash_table_insert (cache, g_strdup (key), g_strdup (quoted));
+	g_mutex_unlock (&quote_caches_mutex);
+}
+
 /**
  * gda_sql_identifier_quote:
  * @id: an SQL identifier
@@ -2546,6 +2615,10 @@ gchar *
 gda_sql_identifier_quote (const gchar *id, GdaConnection *cnc, GdaServerProvider *prov,
 			  gboolean for_meta_store, gboolean force_quotes)
 {
+	gchar key [QUOTE_CACHE_MAX_ID_LEN + 2];
+	gsize len;
+	gchar *quoted;
+
 #if GDA_DEBUG
 	test_keywords ();
 #endif
@@ -2563,6 +2636,36 @@ gda_sql_identifier_quote (const gchar *id, GdaConnection *cnc, GdaServerProvider
 	if ((*id == '*') && (! id [1]))
 	    return g_strdup (id);
 
+	/* the same identifiers are usually quoted over and over (SQL rendering, meta data, DDL), and
+	 * quoting them may require the provider's worker thread, so the results are cached, for each
+	 * connection, or for each provider when there is no connection */
+	len = strlen (id);
+	if ((len > QUOTE_CACHE_MAX_ID_LEN) || (cnc && !gda_connection_is_opened (cnc)))
+		return sql_identifier_quote_real (id, cnc, prov, for_meta_store, force_quotes);
+
+	key [0] = '0' + (for_meta_store ? 1 : 0) + (force_quotes ? 2 : 0);
+	memcpy (key + 1, id, len + 1);
+	if (cnc)
+		quoted = _gda_connection_lookup_quoted_identifier (cnc, key);
+	else
+		quoted = quote_cache_lookup (prov, key);
+	if (quoted)
+		return quoted;
+
+	quoted = sql_identifier_quote_real (id, cnc, prov, for_meta_store, force_quotes);
+	if (quoted) {
+		if (cnc)
+			_gda_connection_add_quoted_identifier (cnc, key, quoted);
+		else
+			quote_cache_add (prov, key, quoted);
+	}
+	return quoted;
+}
+
+static gchar *
+sql_identifier_quote_real (const gchar *id, GdaConnection *cnc, GdaServerProvider *prov,
+			   gboolean for_meta_store, gboolean force_quotes)
+{
 	if (prov) {
 		gchar *quoted;
 		quoted = _gda_server_provider_identifier_quote (prov, cnc, id, for_meta_store, force_quotes);
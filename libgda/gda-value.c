@@ -44,6 +44,7 @@
 #include <time.h>
 #include <locale.h>
 #include <libgda/gda-value.h>
+#include <libgda/gda-value-private.h>
 #include <libgda/gda-blob-op.h>
 #include <libgda/gda-util.h>
 #include <libxml/parser.h>
@@ -63,18 +64,34 @@
  * @precision: precision to use when @number is converted (not implemented jet)
  * @width: not implemented jet
  *
- * Holds numbers represented as strings.
+ * Holds decimal numbers, with an arbitrary precision.
+ *
+ * A number is stored as a coefficient and a scale (the number of digits after the decimal point): as long
+ * as the coefficient fits in 128 bits (about 38 significant digits), it is stored natively, which makes
+ * comparisons, hashing and arithmetic fast and free of memory allocations. Larger numbers are stored
+ * as a string of digits, and the "NaN", "Infinity" and "-Infinity" special values are also supported.
+ * The string representation is only computed when requested.
  *
  * This struct must be considered as opaque. Any access to its members must use its
  * accessors added since version 5.0.2.
  */
+typedef enum {
+	NUMERIC_DECIMAL, /* the coefficient is in @lo and @hi */
+	NUMERIC_BIG,     /* the coefficient is in @number, as a string of digits */
+	NUMERIC_SPECIAL  /* "NaN", "Infinity" or "-Infinity", in @number */
+} NumericKind;
+
 struct _GdaNumeric {
-	gchar*   number; /* stored in the "C" locale, never NULL */
+	gchar*   number; /* NULL for NUMERIC_DECIMAL, see NumericKind */
 	glong    precision;
 	glong    width;
-	
+
 	/*< private >*/
-	gpointer reserved; /* reserved for future usage with GMP (http://gmplib.org/) */
+	guint64  lo;       /* absolute value of the coefficient, low 64 bits */
+	guint64  hi;       /* absolute value of the coefficient, high 64 bits */
+	gint     scale;    /* number of digits after the decimal point, never negative */
+	guint8   kind;     /* a NumericKind */
+	gboolean negative; /* never set for zero */
 };
 
 
@@ -694,6 +711,24 @@ gda_binary_take_data (GdaBinary *binary, guchar *val, glong size)
 }
 
 
+/*
+ * _gda_binary_set_static_data:
+ * @binary: a #GdaBinary pointer, with no data or static data
+ * @val: (nullable): data, or %NULL
+ * @size: the size of @val
+ *
+ * Makes @binary point to @val, without any copy and without taking ownership of @val, which must
+ * outlive @binary. Before @binary is freed or modified by any other function, this function must
+ * be called again with a %NULL @val.
+ */
+void
+_gda_binary_set_static_data (GdaBinary *binary, const guchar *val, glong size)
+{
+	g_return_if_fail (binary);
+	binary->data = (guchar*) val;
+	binary->binary_length = val ? size : 0;
+}
+
 /**
  * gda_binary_get_data:
  * @binary: a #GdaBinary pointer
@@ -1130,8 +1165,480 @@ gda_geometric_point_set_y (GdaGeometricPoint* gp, double y)
 
 
 /*
- * Register the GdaNumeric type in the GType system
+ * 128 bits unsigned integers, used to store the coefficient of a GdaNumeric
+ */
+typedef struct {
+	guint64 hi;
+	guint64 lo;
+} NumU128;
+
+#define NUMERIC_MAX_EXPONENT 1000 /* larger exponents are rejected when parsing */
+
+static inline gboolean
+u128_is_zero (const NumU128 *v)
+{
+	return (v->hi == 0) && (v->lo == 0);
+}
+
+static inline gint
+u128_cmp (const NumU128 *a, const NumU128 *b)
+{
+	if (a->hi != b->hi)
+		return a->hi < b->hi ? -1 : 1;
+	if (a->lo != b->lo)
+		return a->lo < b->lo ? -1 : 1;
+	return 0;
+}
+
+/* @v = @v * @mul + @add, returns FALSE on overflow, in which case @v is unchanged */
+static gboolean
+u128_mul_add (NumU128 *v, guint32 mul, guint32 add)
+{
+	guint64 limbs[4];
+	guint64 carry = add;
+	gint i;
+
+	limbs[0] = v->lo & 0xFFFFFFFF;
+	limbs[1] = v->lo >> 32;
+	limbs[2] = v->hi & 0xFFFFFFFF;
+	limbs[3] = v->hi >> 32;
+	for (i = 0; i < 4; i++) {
+		guint64 t;
+		t = limbs[i] * mul + carry;
+		limbs[i] = t & 0xFFFFFFFF;
+		carry = t >> 32;
+	}
+	if (carry)
+		return FALSE;
+	v->lo = limbs[0] | (limbs[1] << 32);
+	v->hi = limbs[2] | (limbs[3] << 32);
+	return TRUE;
+}
+
+/* @v = @v / @div, returns the remainder */
+static guint32
+u128_div_small (NumU128 *v, guint32 div)
+{
+	guint64 limbs[4];
+	guint64 rem = 0;
+	gint i;
+
+	limbs[0] = v->hi >> 32;
+	limbs[1] = v->hi & 0xFFFFFFFF;
+	limbs[2] = v->lo >> 32;
+	limbs[3] = v->lo & 0xFFFFFFFF;
+	for (i = 0; i < 4; i++) {
+		guint64 cur;
+		cur = (rem << 32) | limbs[i];
+		limbs[i] = cur / div;
+		rem = cur % div;
+	}
+	v->hi = (limbs[0] << 32) | limbs[1];
+	v->lo = (limbs[2] << 32) | limbs[3];
+	return (guint32) rem;
+}
+
+/* @r = @a + @b, returns FALSE on overflow */
+static gboolean
+u128_add (NumU128 *r, const NumU128 *a, const NumU128 *b)
+{
+	guint64 lo, hi, carry;
+
+	lo = a->lo + b->lo;
+	carry = (lo < a->lo) ? 1 : 0;
+	hi = a->hi + b->hi;
+	if (hi < a->hi)
+		return FALSE;
+	if (hi + carry < hi)
+		return FALSE;
+	r->hi = hi + carry;
+	r->lo = lo;
+	return TRUE;
+}
+
+/* @r = @a - @b, where @a >= @b */
+static void
+u128_sub (NumU128 *r, const NumU128 *a, const NumU128 *b)
+{
+	guint64 borrow;
+	borrow = (a->lo < b->lo) ? 1 : 0;
+	r->lo = a->lo - b->lo;
+	r->hi = a->hi - b->hi - borrow;
+}
+
+/* @r = @a * @b, returns FALSE on overflow */
+static gboolean
+u128_mul (NumU128 *r, const NumU128 *a, const NumU128 *b)
+{
+	guint64 x[4], y[4], z[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+	gint i, j;
+
+	x[0] = a->lo & 0xFFFFFFFF; x[1] = a->lo >> 32; x[2] = a->hi & 0xFFFFFFFF; x[3] = a->hi >> 32;
+	y[0] = b->lo & 0xFFFFFFFF; y[1] = b->lo >> 32; y[2] = b->hi & 0xFFFFFFFF; y[3] = b->hi >> 32;
+	for (i = 0; i < 4; i++) {
+		guint64 carry = 0;
+		if (x[i] == 0)
+			continue;
+		for (j = 0; j < 4; j++) {
+			guint64 t;
+			t = x[i] * y[j] + z[i + j] + carry;
+			z[i + j] = t & 0xFFFFFFFF;
+			carry = t >> 32;
+		}
+		z[i + 4] = carry;
+	}
+	if (z[4] || z[5] || z[6] || z[7])
+		return FALSE;
+	r->lo = z[0] | (z[1] << 32);
+	r->hi = z[2] | (z[3] << 32);
+	return TRUE;
+}
+
+/* @v = @v * 10^@n, returns FALSE on overflow */
+static gboolean
+u128_scale_up (NumU128 *v, gint n)
+{
+	static const guint32 pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+					1000000000};
+	for (; n >= 9; n -= 9) {
+		if (! u128_mul_add (v, pow10[9], 0))
+			return FALSE;
+	}
+	return (n > 0) ? u128_mul_add (v, pow10[n], 0) : TRUE;
+}
+
+/* parses @len decimal digits, returns FALSE on overflow */
+static gboolean
+u128_from_digits (NumU128 *v, const gchar *digits, gsize len)
+{
+	gsize i;
+	v->hi = 0;
+	v->lo = 0;
+	for (i = 0; i < len; i++) {
+		if (! u128_mul_add (v, 10, digits[i] - '0'))
+			return FALSE;
+	}
+	return TRUE;
+}
+
+/* renders @v as decimal digits in @buf, which must be at least 40 bytes long, returns the first digit */
+static gchar *
+u128_to_digits (NumU128 v, gchar *buf)
+{
+	gint pos = 39;
+	buf[pos] = 0;
+	do {
+		guint32 chunk;
+		gboolean last;
+		gint k;
+		chunk = u128_div_small (&v, 1000000000);
+		last = u128_is_zero (&v);
+		for (k = 0; (k < 9) && (!last || chunk || (k == 0)); k++) {
+			buf[--pos] = '0' + (chunk % 10);
+			chunk /= 10;
+		}
+	} while (! u128_is_zero (&v));
+	return buf + pos;
+}
+
+static void
+numeric_clear (GdaNumeric *numeric)
+{
+	g_free (numeric->number);
+	numeric->number = NULL;
+	numeric->lo = 0;
+	numeric->hi = 0;
+	numeric->scale = 0;
+	numeric->kind = NUMERIC_DECIMAL;
+	numeric->negative = FALSE;
+}
+
+/* sets @numeric from an absolute value as a string of digits (which is stolen) */
+static void
+numeric_take_digits (GdaNumeric *numeric, gboolean negative, gchar *digits, gint scale)
+{
+	gchar *ptr;
+	NumU128 v;
+
+	numeric_clear (numeric);
+	for (ptr = digits; (*ptr == '0') && ptr[1]; ptr++);
+	if (!*ptr) {
+		g_free (digits);
+		return;
+	}
+
+	numeric->scale = scale;
+	if (u128_from_digits (&v, ptr, strlen (ptr))) {
+		numeric->lo = v.lo;
+		numeric->hi = v.hi;
+		numeric->negative = negative && ! u128_is_zero (&v);
+		g_free (digits);
+	}
+	else {
+		numeric->kind = NUMERIC_BIG;
+		numeric->negative = negative;
+		if (ptr != digits)
+			memmove (digits, ptr, strlen (ptr) + 1);
+		numeric->number = digits;
+	}
+}
+
+/* returns the absolute value of the coefficient of @numeric as a new string of digits */
+static gchar *
+numeric_dup_digits (const GdaNumeric *numeric)
+{
+	if (numeric->kind == NUMERIC_BIG)
+		return g_strdup (numeric->number);
+	else {
+		gchar buf[40];
+		NumU128 v;
+		v.lo = numeric->lo;
+		v.hi = numeric->hi;
+		return g_strdup (u128_to_digits (v, buf));
+	}
+}
+
+static void
+numeric_set_special (GdaNumeric *numeric, gdouble number)
+{
+	numeric_clear (numeric);
+	numeric->kind = NUMERIC_SPECIAL;
+	if (number != number)
+		numeric->number = g_strdup ("NaN");
+	else
+		numeric->number = g_strdup (number > 0 ? "Infinity" : "-Infinity");
+}
+
+/*
+ * Parses @str as [sign] digits [. digits] [e [sign] digits], without going through a floating
+ * point representation. Returns FALSE if @str is not a valid number.
+ */
+static gboolean
+numeric_parse (GdaNumeric *numeric, const gchar *str)
+{
+	const gchar *ptr = str;
+	const gchar *int_part, *frac_part;
+	gsize int_len = 0, frac_len = 0;
+	gboolean negative = FALSE;
+	gint64 exponent = 0;
+	gint scale;
+
+	while (g_ascii_isspace (*ptr))
+		ptr++;
+	if ((*ptr == '-') || (*ptr == '+')) {
+		negative = (*ptr == '-') ? TRUE : FALSE;
+		ptr++;
+	}
+	for (int_part = ptr; g_ascii_isdigit (*ptr); ptr++)
+		int_len++;
+	frac_part = ptr;
+	if (*ptr == '.') {
+		ptr++;
+		for (frac_part = ptr; g_ascii_isdigit (*ptr); ptr++)
+			frac_len++;
+	}
+	if ((int_len == 0) && (frac_len == 0))
+		return FALSE;
+	if ((*ptr == 'e') || (*ptr == 'E')) {
+		gchar *end;
+		ptr++;
+		if (! g_ascii_isdigit (*ptr) &&
+		    ! (((*ptr == '-') || (*ptr == '+')) && g_ascii_isdigit (ptr[1])))
+			return FALSE;
+		exponent = g_ascii_strtoll (ptr, &end, 10);
+		if ((exponent > NUMERIC_MAX_EXPONENT) || (exponent < - NUMERIC_MAX_EXPONENT))
+			return FALSE;
+		ptr = end;
+	}
+	while (g_ascii_isspace (*ptr))
+		ptr++;
+	if (*ptr)
+		return FALSE;
+
+	scale = (gint) frac_len - (gint) exponent;
+
+	/* fast path: the coefficient fits in 128 bits */
+	NumU128 v = {0, 0};
+	gsize i;
+	gboolean fits = TRUE;
+	for (i = 0; fits && (i < int_len); i++)
+		fits = u128_mul_add (&v, 10, int_part[i] - '0');
+	for (i = 0; fits && (i < frac_len); i++)
+		fits = u128_mul_add (&v, 10, frac_part[i] - '0');
+	if (fits && (scale < 0)) {
+		if (u128_is_zero (&v))
+			scale = 0;
+		else
+			fits = u128_scale_up (&v, - scale);
+	}
+	if (fits) {
+		numeric_clear (numeric);
+		numeric->lo = v.lo;
+		numeric->hi = v.hi;
+		numeric->scale = MAX (scale, 0);
+		numeric->negative = negative && ! u128_is_zero (&v);
+		return TRUE;
+	}
+
+	/* arbitrary precision */
+	GString *digits;
+	digits = g_string_sized_new (int_len + frac_len + (scale < 0 ? - scale : 0) + 1);
+	g_string_append_len (digits, int_part, int_len);
+	g_string_append_len (digits, frac_part, frac_len);
+	for (; scale < 0; scale++)
+		g_string_append_c (digits, '0');
+	numeric_take_digits (numeric, negative, g_string_free (digits, FALSE), scale);
+	return TRUE;
+}
+
+/*
+ * Arbitrary precision helpers, working on strings of digits without leading zeros
  */
+
+/* pads @digits with zeros on the right */
+static gchar *
+digits_pad (const gchar *digits, gint nzeros)
+{
+	gsize len = strlen (digits);
+	gchar *res = g_new (gchar, len + nzeros + 1);
+	memcpy (res, digits, len);
+	memset (res + len, '0', nzeros);
+	res[len + nzeros] = 0;
+	return res;
+}
+
+static gint
+digits_cmp (const gchar *a, const gchar *b)
+{
+	gsize la, lb;
+	gint res;
+	while ((*a == '0') && a[1])
+		a++;
+	while ((*b == '0') && b[1])
+		b++;
+	la = strlen (a);
+	lb = strlen (b);
+	if (la != lb)
+		return la < lb ? -1 : 1;
+	res = strcmp (a, b);
+	return (res < 0) ? -1 : ((res > 0) ? 1 : 0);
+}
+
+static gchar *
+digits_add (const gchar *a, const gchar *b)
+{
+	gsize la = strlen (a), lb = strlen (b), len = MAX (la, lb) + 1;
+	gchar *res = g_new (gchar, len + 1);
+	gint carry = 0;
+	gsize i;
+
+	res[len] = 0;
+	for (i = 0; i < len; i++) {
+		gint d = carry;
+		if (i < la)
+			d += a[la - 1 - i] - '0';
+		if (i < lb)
+			d += b[lb - 1 - i] - '0';
+		res[len - 1 - i] = '0' + (d % 10);
+		carry = d / 10;
+	}
+	return res;
+}
+
+/* @a - @b, where @a >= @b */
+static gchar *
+digits_sub (const gchar *a, const gchar *b)
+{
+	gsize la = strlen (a), lb = strlen (b);
+	gchar *res = g_new (gchar, la + 1);
+	gint borrow = 0;
+	gsize i;
+
+	res[la] = 0;
+	for (i = 0; i < la; i++) {
+		gint d = a[la - 1 - i] - '0' - borrow;
+		if (i < lb)
+			d -= b[lb - 1 - i] - '0';
+		borrow = (d < 0) ? 1 : 0;
+		res[la - 1 - i] = '0' + d + 10 * borrow;
+	}
+	return res;
+}
+
+static gchar *
+digits_mul (const gchar *a, const gchar *b)
+{
+	gsize la = strlen (a), lb = strlen (b), len = la + lb;
+	guint *acc = g_new0 (guint, len);
+	gchar *res = g_new (gchar, len + 1);
+	gsize i, j;
+
+	for (i = 0; i < la; i++)
+		for (j = 0; j < lb; j++)
+			acc[i + j + 1] += (a[i] - '0') * (b[j] - '0');
+	for (i = len - 1; i > 0; i--) {
+		acc[i - 1] += acc[i] / 10;
+		acc[i] %= 10;
+	}
+	for (i = 0; i < len; i++)
+		res[i] = '0' + acc[i];
+	res[len] = 0;
+	g_free (acc);
+	return res;
+}
+
+/* compares the absolute values of @n1 and @n2, which must not be special values */
+static gint
+numeric_compare_abs (const GdaNumeric *n1, const GdaNumeric *n2)
+{
+	if ((n1->kind == NUMERIC_DECIMAL) && (n2->kind == NUMERIC_DECIMAL)) {
+		NumU128 v1, v2;
+		v1.lo = n1->lo; v1.hi = n1->hi;
+		v2.lo = n2->lo; v2.hi = n2->hi;
+		if (n1->scale < n2->scale) {
+			if (! u128_scale_up (&v1, n2->scale - n1->scale))
+				return 1;
+		}
+		else if (n1->scale > n2->scale) {
+			if (! u128_scale_up (&v2, n1->scale - n2->scale))
+				return -1;
+		}
+		return u128_cmp (&v1, &v2);
+	}
+	else {
+		gchar *d1, *d2;
+		gint res, scale;
+		scale = MAX (n1->scale, n2->scale);
+		d1 = numeric_dup_digits (n1);
+		d2 = numeric_dup_digits (n2);
+		if (n1->scale < scale) {
+			gchar *tmp = digits_pad (d1, scale - n1->scale);
+			g_free (d1);
+			d1 = tmp;
+		}
+		if (n2->scale < scale) {
+			gchar *tmp = digits_pad (d2, scale - n2->scale);
+			g_free (d2);
+			d2 = tmp;
+		}
+		res = digits_cmp (d1, d2);
+		g_free (d1);
+		g_free (d2);
+		return res;
+	}
+}
+
+/* -1 for -Infinity, 0 for finite numbers, 1 for Infinity and 2 for NaN */
+static gint
+numeric_special_rank (const GdaNumeric *numeric)
+{
+	if (numeric->kind != NUMERIC_SPECIAL)
+		return 0;
+	if (*numeric->number == 'N')
+		return 2;
+	return (*numeric->number == '-') ? -1 : 1;
+}
+
 static void
 numeric_to_string (const GValue *src, GValue *dest)
 {
@@ -1142,11 +1649,23 @@ numeric_to_string (const GValue *src, GValue *dest)
 
 	numeric = gda_value_get_numeric (src);
 	if (numeric)
-		g_value_set_string (dest, numeric->number);
+		g_value_take_string (dest, gda_numeric_get_string (numeric));
 	else
 		g_value_set_string (dest, "0.0");
 }
 
+static glong
+numeric_get_long (const GdaNumeric *numeric)
+{
+	gchar *str;
+	glong retval;
+
+	str = gda_numeric_get_string (numeric);
+	retval = atol (str); /* Flawfinder: ignore */
+	g_free (str);
+	return retval;
+}
+
 static void
 numeric_to_int (const GValue *src, GValue *dest)
 {
@@ -1158,7 +1677,7 @@ numeric_to_int (const GValue *src, GValue *dest)
 	numeric = gda_value_get_numeric (src);
 	if (numeric) {
 		glong tmp;
-		tmp = atol (numeric->number); /* Flawfinder: ignore */
+		tmp = numeric_get_long (numeric);
 		if ((tmp < G_MININT) || (tmp > G_MAXINT))
 			g_warning ("Integer overflow for value %ld", tmp);
 		g_value_set_int (dest, tmp);
@@ -1178,7 +1697,7 @@ numeric_to_uint (const GValue *src, GValue *dest)
 	numeric = gda_value_get_numeric (src);
 	if (numeric) {
 		glong tmp;
-		tmp = atol (numeric->number); /* Flawfinder: ignore */
+		tmp = numeric_get_long (numeric);
 		if ((tmp < 0) || (tmp > (glong)G_MAXUINT))
 			g_warning ("Unsigned integer overflow for value %ld", tmp);
 		g_value_set_uint (dest, tmp);
@@ -1197,7 +1716,7 @@ numeric_to_boolean (const GValue *src, GValue *dest)
 
 	numeric = gda_value_get_numeric (src);
 	if (numeric)
-		g_value_set_boolean (dest, atoi (numeric->number)); /* Flawfinder: ignore */
+		g_value_set_boolean (dest, numeric_get_long (numeric));
 	else
 		g_value_set_boolean (dest, 0);
 }
@@ -1232,6 +1751,9 @@ numeric_to_float (const GValue *src, GValue *dest)
 		g_value_set_float (dest, 0.0);
 }
 
+/*
+ * Register the GdaNumeric type in the GType system
+ */
 GType
 gda_numeric_get_type (void)
 {
@@ -1271,18 +1793,12 @@ GdaNumeric*
 gda_numeric_copy (GdaNumeric *src)
 {
 	GdaNumeric *copy;
-	gchar *str;
 
 	g_return_val_if_fail (src, NULL);
 
-	copy = gda_numeric_new ();
-
-	str = gda_numeric_get_string (src);
-	gda_numeric_set_from_string (copy, str);
-	g_free (str);
-
-	gda_numeric_set_width (copy, gda_numeric_get_width (src));
-	gda_numeric_set_precision (copy, gda_numeric_get_precision (src));
+	copy = g_new (GdaNumeric, 1);
+	*copy = *src;
+	copy->number = g_strdup (src->number);
 
 	return copy;
 }
@@ -1302,14 +1818,6 @@ gda_numeric_free (GdaNumeric *numeric)
 	g_free (numeric);
 }
 
-static gchar*
-gda_dtostr_dup (const double value)
-{
-	char buffer[G_ASCII_DTOSTR_BUF_SIZE];
-	g_ascii_dtostr (buffer, sizeof (buffer), value);
-	return g_strdup (buffer);
-}
-
 /**
  * gda_numeric_new:
  *
@@ -1321,9 +1829,7 @@ gda_dtostr_dup (const double value)
 GdaNumeric*
 gda_numeric_new (void)
 {
-	GdaNumeric *n = g_new0 (GdaNumeric, 1);
-	n->number = gda_dtostr_dup (0.0);
-	return n;
+	return g_new0 (GdaNumeric, 1);
 }
 
 /**
@@ -1332,6 +1838,7 @@ gda_numeric_new (void)
  * @str: a string representing a number, in the C locale format
  *
  * Sets @numeric with a number represented by @str, in the C locale format (dot as a fraction separator).
+ * All the digits of @str are kept, whatever their number.
  *
  * Since: 5.0.2
  */
@@ -1340,15 +1847,9 @@ gda_numeric_set_from_string (GdaNumeric *numeric, const gchar* str)
 {
 	g_return_if_fail (numeric);
 	g_return_if_fail (str);
-	g_free (numeric->number);
 
-	gdouble number;
-	gchar *endptr = NULL;
-	number = g_ascii_strtod (str, &endptr);
-	if (*endptr)
-		numeric->number = gda_dtostr_dup (number);
-	else
-		numeric->number = g_strdup (str);
+	if (! numeric_parse (numeric, str))
+		gda_numeric_set_double (numeric, g_ascii_strtod (str, NULL));
 }
 
 /**
@@ -1363,9 +1864,12 @@ gda_numeric_set_from_string (GdaNumeric *numeric, const gchar* str)
 void
 gda_numeric_set_double (GdaNumeric *numeric, gdouble number)
 {
+	char buffer[G_ASCII_DTOSTR_BUF_SIZE];
+
 	g_return_if_fail (numeric);
-	g_free (numeric->number);
-	numeric->number = gda_dtostr_dup (number);
+	g_ascii_dtostr (buffer, sizeof (buffer), number);
+	if (! numeric_parse (numeric, buffer))
+		numeric_set_special (numeric, number);
 }
 
 /**
@@ -1373,13 +1877,32 @@ gda_numeric_set_double (GdaNumeric *numeric, gdouble number)
  * @numeric: a #GdaNumeric
  *
  * Returns: a #gdouble representation of @numeric
+ *
  * Since: 5.0.2
  */
 gdouble
 gda_numeric_get_double (const GdaNumeric *numeric)
 {
+	/* powers of 10 which are exactly represented as doubles */
+	static const gdouble pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+					1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
 	g_return_val_if_fail (numeric, 0.0);
-	return g_ascii_strtod (numeric->number, NULL);
+
+	if ((numeric->kind == NUMERIC_DECIMAL) && (numeric->hi == 0) &&
+	    (numeric->lo <= G_GUINT64_CONSTANT (9007199254740992)) && (numeric->scale <= 22)) {
+		/* a single correctly rounded division */
+		gdouble d;
+		d = (gdouble) numeric->lo / pow10 [numeric->scale];
+		return numeric->negative ? -d : d;
+	}
+	else {
+		gchar *str;
+		gdouble d;
+		str = gda_numeric_get_string (numeric);
+		d = g_ascii_strtod (str, NULL);
+		g_free (str);
+		return d;
+	}
 }
 
 /**
@@ -1447,6 +1970,7 @@ gda_numeric_get_precision (const GdaNumeric *numeric)
 	g_return_val_if_fail (numeric, -1);
 	return numeric->precision;
 }
+
 /**
  * gda_numeric_get_string:
  * @numeric: a #GdaNumeric
@@ -1460,10 +1984,379 @@ gda_numeric_get_precision (const GdaNumeric *numeric)
 gchar*
 gda_numeric_get_string (const GdaNumeric *numeric)
 {
-	if (numeric)
-		return g_strdup (numeric->number);
-	else
+	GString *string;
+	const gchar *digits;
+	gchar buf[40];
+	gsize len;
+
+	if (!numeric)
 		return NULL;
+	if (numeric->kind == NUMERIC_SPECIAL)
+		return g_strdup (numeric->number);
+
+	if (numeric->kind == NUMERIC_BIG)
+		digits = numeric->number;
+	else {
+		NumU128 v;
+		v.lo = numeric->lo;
+		v.hi = numeric->hi;
+		digits = u128_to_digits (v, buf);
+	}
+	len = strlen (digits);
+
+	string = g_string_sized_new (len + numeric->scale + 3);
+	if (numeric->negative)
+		g_string_append_c (string, '-');
+	if (numeric->scale == 0)
+		g_string_append_len (string, digits, len);
+	else if (len > (gsize) numeric->scale) {
+		g_string_append_len (string, digits, len - numeric->scale);
+		g_string_append_c (string, '.');
+		g_string_append (string, digits + len - numeric->scale);
+	}
+	else {
+		gsize i;
+		g_string_append (string, "0.");
+		for (i = len; i < (gsize) numeric->scale; i++)
+			g_string_append_c (string, '0');
+		g_string_append_len (string, digits, len);
+	}
+	return g_string_free (string, FALSE);
+}
+
+/**
+ * gda_numeric_set_decimal:
+ * @numeric: a #GdaNumeric
+ * @unscaled: the unscaled value
+ * @scale: the number of digits after the decimal point
+ *
+ * Sets @numeric to @unscaled * 10^-@scale, for example 12345 with a scale of 2
+ * represents 123.45. This is the fastest way to set a #GdaNumeric.
+ *
+ * Since: 6.0
+ */
+void
+gda_numeric_set_decimal (GdaNumeric *numeric, gint64 unscaled, guint scale)
+{
+	g_return_if_fail (numeric);
+
+	numeric_clear (numeric);
+	numeric->negative = (unscaled < 0) ? TRUE : FALSE;
+	numeric->lo = (unscaled < 0) ? ((guint64) (- (unscaled + 1))) + 1 : (guint64) unscaled;
+	numeric->scale = scale;
+}
+
+/**
+ * gda_numeric_get_decimal:
+ * @numeric: a #GdaNumeric
+ * @unscaled: (out) (optional): a place to store the unscaled value, or %NULL
+ * @scale: (out) (optional): a place to store the number of digits after the decimal point, or %NULL
+ *
+ * Get the value of @numeric as an unscaled 64 bits integer and a scale, see gda_numeric_set_decimal().
+ *
+ * Returns: %TRUE if the unscaled value of @numeric fits in 64 bits (which is not the case of
+ * the "NaN" and "Infinity" values)
+ *
+ * Since: 6.0
+ */
+gboolean
+gda_numeric_get_decimal (const GdaNumeric *numeric, gint64 *unscaled, guint *scale)
+{
+	g_return_val_if_fail (numeric, FALSE);
+
+	if ((numeric->kind != NUMERIC_DECIMAL) || (numeric->hi != 0))
+		return FALSE;
+	if (numeric->negative) {
+		if (numeric->lo > ((guint64) G_MAXINT64) + 1)
+			return FALSE;
+		if (unscaled)
+			*unscaled = - (gint64) (numeric->lo - 1) - 1;
+	}
+	else {
+		if (numeric->lo > (guint64) G_MAXINT64)
+			return FALSE;
+		if (unscaled)
+			*unscaled = (gint64) numeric->lo;
+	}
+	if (scale)
+		*scale = numeric->scale;
+	return TRUE;
+}
+
+/**
+ * gda_numeric_compare:
+ * @n1: a #GdaNumeric
+ * @n2: a #GdaNumeric
+ *
+ * Compares the values of @n1 and @n2, regardless of their scale (1.5 and 1.50 are equal). "NaN" is
+ * considered equal to itself and greater than any other value.
+ *
+ * Returns: a negative value if @n1 is smaller than @n2, 0 if they are equal, and a positive value otherwise
+ *
+ * Since: 6.0
+ */
+gint
+gda_numeric_compare (const GdaNumeric *n1, const GdaNumeric *n2)
+{
+	gint r1, r2, res;
+
+	g_return_val_if_fail (n1, 0);
+	g_return_val_if_fail (n2, 0);
+
+	r1 = numeric_special_rank (n1);
+	r2 = numeric_special_rank (n2);
+	if (r1 || r2)
+		return (r1 < r2) ? -1 : ((r1 > r2) ? 1 : 0);
+
+	if (n1->negative != n2->negative)
+		return n1->negative ? -1 : 1;
+	res = numeric_compare_abs (n1, n2);
+	return n1->negative ? - res : res;
+}
+
+/**
+ * gda_numeric_equal:
+ * @n1: (type GdaNumeric): a #GdaNumeric
+ * @n2: (type GdaNumeric): a #GdaNumeric
+ *
+ * Tells if @n1 and @n2 have the same value, see gda_numeric_compare(). This function
+ * can be used with gda_numeric_hash() to create #GHashTable using #GdaNumeric keys.
+ *
+ * Returns: %TRUE if @n1 and @n2 are equal
+ *
+ * Since: 6.0
+ */
+gboolean
+gda_numeric_equal (gconstpointer n1, gconstpointer n2)
+{
+	return gda_numeric_compare ((const GdaNumeric*) n1, (const GdaNumeric*) n2) == 0 ? TRUE : FALSE;
+}
+
+/**
+ * gda_numeric_hash:
+ * @numeric: (type GdaNumeric): a #GdaNumeric
+ *
+ * Computes a hash value for @numeric, such that numbers which are equal according to
+ * gda_numeric_equal() have the same hash value.
+ *
+ * Returns: a hash value
+ *
+ * Since: 6.0
+ */
+guint
+gda_numeric_hash (gconstpointer numeric)
+{
+	const GdaNumeric *n = (const GdaNumeric*) numeric;
+	NumU128 v;
+	gint scale;
+
+	g_return_val_if_fail (n, 0);
+
+	if (n->kind == NUMERIC_SPECIAL)
+		return g_str_hash (n->number);
+
+	scale = n->scale;
+	if (n->kind == NUMERIC_DECIMAL) {
+		v.lo = n->lo;
+		v.hi = n->hi;
+	}
+	else {
+		/* remove the trailing zeros after the decimal point, the result may then fit in 128 bits */
+		gchar *digits;
+		gsize len;
+		guint hash;
+		digits = g_strdup (n->number);
+		len = strlen (digits);
+		for (; (scale > 0) && (len > 1) && (digits[len - 1] == '0'); scale--, len--)
+			digits[len - 1] = 0;
+		if (! u128_from_digits (&v, digits, len)) {
+			hash = g_str_hash (digits) ^ (guint) scale ^ (n->negative ? 0x80000000 : 0);
+			g_free (digits);
+			return hash;
+		}
+		g_free (digits);
+	}
+
+	/* remove the trailing zeros after the decimal point */
+	while (scale > 0) {
+		NumU128 tmp = v;
+		if (u128_div_small (&tmp, 10) != 0)
+			break;
+		v = tmp;
+		scale--;
+	}
+	guint64 h;
+	h = v.lo ^ (v.hi * G_GUINT64_CONSTANT (0x9E3779B97F4A7C15)) ^ ((guint64) scale << 56);
+	return (guint) (h ^ (h >> 32)) ^ (n->negative ? 0x80000000 : 0);
+}
+
+typedef enum {
+	NUMERIC_OP_ADD,
+	NUMERIC_OP_SUB,
+	NUMERIC_OP_MUL
+} NumericOp;
+
+static GdaNumeric *
+numeric_compute (const GdaNumeric *n1, const GdaNumeric *n2, NumericOp op)
+{
+	GdaNumeric *res;
+	gboolean neg2;
+
+	res = gda_numeric_new ();
+
+	if ((n1->kind == NUMERIC_SPECIAL) || (n2->kind == NUMERIC_SPECIAL)) {
+		/* IEEE 754 semantics for the special values */
+		gdouble d1, d2;
+		d1 = gda_numeric_get_double (n1);
+		d2 = gda_numeric_get_double (n2);
+		gda_numeric_set_double (res, (op == NUMERIC_OP_ADD) ? d1 + d2 :
+					((op == NUMERIC_OP_SUB) ? d1 - d2 : d1 * d2));
+		return res;
+	}
+
+	neg2 = (op == NUMERIC_OP_SUB) ? ! n2->negative : n2->negative;
+
+	/* fast path, using 128 bits integers */
+	if ((n1->kind == NUMERIC_DECIMAL) && (n2->kind == NUMERIC_DECIMAL)) {
+		NumU128 v1, v2, r;
+		v1.lo = n1->lo; v1.hi = n1->hi;
+		v2.lo = n2->lo; v2.hi = n2->hi;
+		if (op == NUMERIC_OP_MUL) {
+			if (u128_mul (&r, &v1, &v2)) {
+				res->lo = r.lo;
+				res->hi = r.hi;
+				res->scale = n1->scale + n2->scale;
+				res->negative = (n1->negative != n2->negative) && ! u128_is_zero (&r);
+				return res;
+			}
+		}
+		else {
+			gint scale;
+			gboolean ok = TRUE;
+			scale = MAX (n1->scale, n2->scale);
+			ok = u128_scale_up (&v1, scale - n1->scale) && u128_scale_up (&v2, scale - n2->scale);
+			if (ok) {
+				gboolean negative;
+				if (n1->negative == neg2) {
+					ok = u128_add (&r, &v1, &v2);
+					negative = n1->negative;
+				}
+				else if (u128_cmp (&v1, &v2) >= 0) {
+					u128_sub (&r, &v1, &v2);
+					negative = n1->negative;
+				}
+				else {
+					u128_sub (&r, &v2, &v1);
+					negative = neg2;
+				}
+				if (ok) {
+					res->lo = r.lo;
+					res->hi = r.hi;
+					res->scale = scale;
+					res->negative = negative && ! u128_is_zero (&r);
+					return res;
+				}
+			}
+		}
+	}
+
+	/* arbitrary precision */
+	gchar *d1, *d2, *digits;
+	gboolean negative;
+	gint scale;
+	d1 = numeric_dup_digits (n1);
+	d2 = numeric_dup_digits (n2);
+	if (op == NUMERIC_OP_MUL) {
+		digits = digits_mul (d1, d2);
+		scale = n1->scale + n2->scale;
+		negative = n1->negative != n2->negative;
+	}
+	else {
+		gchar *tmp;
+		scale = MAX (n1->scale, n2->scale);
+		tmp = digits_pad (d1, scale - n1->scale);
+		g_free (d1);
+		d1 = tmp;
+		tmp = digits_pad (d2, scale - n2->scale);
+		g_free (d2);
+		d2 = tmp;
+		if (n1->negative == neg2) {
+			digits = digits_add (d1, d2);
+			negative = n1->negative;
+		}
+		else if (digits_cmp (d1, d2) >= 0) {
+			digits = digits_sub (d1, d2);
+			negative = n1->negative;
+		}
+		else {
+			digits = digits_sub (d2, d1);
+			negative = neg2;
+		}
+	}
+	g_free (d1);
+	g_free (d2);
+	numeric_take_digits (res, negative, digits, scale);
+	return res;
+}
+
+/**
+ * gda_numeric_add:
+ * @n1: a #GdaNumeric
+ * @n2: a #GdaNumeric
+ *
+ * Computes @n1 + @n2 without any loss of precision, the scale of the result is the largest
+ * scale of @n1 and @n2.
+ *
+ * Returns: (transfer full): a new #GdaNumeric
+ *
+ * Since: 6.0
+ */
+GdaNumeric *
+gda_numeric_add (const GdaNumeric *n1, const GdaNumeric *n2)
+{
+	g_return_val_if_fail (n1, NULL);
+	g_return_val_if_fail (n2, NULL);
+	return numeric_compute (n1, n2, NUMERIC_OP_ADD);
+}
+
+/**
+ * gda_numeric_sub:
+ * @n1: a #GdaNumeric
+ * @n2: a #GdaNumeric
+ *
+ * Computes @n1 - @n2 without any loss of precision, the scale of the result is the largest
+ * scale of @n1 and @n2.
+ *
+ * Returns: (transfer full): a new #GdaNumeric
+ *
+ * Since: 6.0
+ */
+GdaNumeric *
+gda_numeric_sub (const GdaNumeric *n1, const GdaNumeric *n2)
+{
+	g_return_val_if_fail (n1, NULL);
+	g_return_val_if_fail (n2, NULL);
+	return numeric_compute (n1, n2, NUMERIC_OP_SUB);
+}
+
+/**
+ * gda_numeric_mul:
+ * @n1: a #GdaNumeric
+ * @n2: a #GdaNumeric
+ *
+ * Computes @n1 * @n2 without any loss of precision, the scale of the result is the sum
+ * of the scales of @n1 and @n2.
+ *
+ * Returns: (transfer full): a new #GdaNumeric
+ *
+ * Since: 6.0
+ */
+GdaNumeric *
+gda_numeric_mul (const GdaNumeric *n1, const GdaNumeric *n2)
+{
+	g_return_val_if_fail (n1, NULL);
+	g_return_val_if_fail (n2, NULL);
+	return numeric_compute (n1, n2, NUMERIC_OP_MUL);
 }
 
 /*
@@ -2908,7 +3801,7 @@ gda_value_differ (const GValue *value1, const GValue *value2)
 		num1= gda_value_get_numeric (value1);
 		num2 = gda_value_get_numeric (value2);
                 if (num1 && num2)
-			return strcmp (num1->number, num2->number);
+			return gda_numeric_compare (num1, num2) ? 1 : 0;
 		return 1;
 	}
 
@@ -3141,7 +4034,7 @@ gda_value_compare (const GValue *value1, const GValue *value2)
 		num2 = gda_value_get_numeric (value2);
                 if (num1) {
 			if (num2)
-				retval = strcmp (num1->number, num2->number);
+				retval = gda_numeric_compare (num1, num2);
 			else
 				retval = 1;
 		}
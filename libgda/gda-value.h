@@ -88,6 +88,14 @@ glong                             gda_numeric_get_precision (const GdaNumeric *n
 void                              gda_numeric_set_width (GdaNumeric *numeric, glong width);
 glong                             gda_numeric_get_width (const GdaNumeric *numeric);
 gchar*                            gda_numeric_get_string (const GdaNumeric *numeric);
+void                              gda_numeric_set_decimal (GdaNumeric *numeric, gint64 unscaled, guint scale);
+gboolean                          gda_numeric_get_decimal (const GdaNumeric *numeric, gint64 *unscaled, guint *scale);
+gint                              gda_numeric_compare (const GdaNumeric *n1, const GdaNumeric *n2);
+gboolean                          gda_numeric_equal (gconstpointer n1, gconstpointer n2);
+guint                             gda_numeric_hash (gconstpointer numeric);
+GdaNumeric*                       gda_numeric_add (const GdaNumeric *n1, const GdaNumeric *n2);
+GdaNumeric*                       gda_numeric_sub (const GdaNumeric *n1, const GdaNumeric *n2);
+GdaNumeric*                       gda_numeric_mul (const GdaNumeric *n1, const GdaNumeric *n2);
 void                              gda_numeric_free (GdaNumeric *numeric);
 
 /**
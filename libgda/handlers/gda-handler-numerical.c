@@ -160,16 +160,23 @@ _gda_handler_numerical_get_value_from_str_locale (const gchar *str, GType type,
 			p++;
 		}
 		if (ok) {
-			gdouble d;
 			char *end = NULL;
 			if (c_locale)
-				d = g_ascii_strtod (str, &end);
+				g_ascii_strtod (str, &end);
 			else
-				d = strtod (str, &end);
+				strtod (str, &end);
 			if (! *end) {
+				/* keep all the digits rather than going through a gdouble */
+				gchar *cstr, *ptr;
+				cstr = g_strdup (str);
+				for (ptr = cstr; *ptr; ptr++) {
+					if (*ptr == ',')
+						*ptr = '.';
+				}
 				value = g_value_init (g_new0 (GValue, 1), GDA_TYPE_NUMERIC);
-				gda_numeric_set_double (numeric, d);
+				gda_numeric_set_from_string (numeric, cstr);
 				gda_value_set_numeric (value, numeric);
+				g_free (cstr);
 			}
 		}
 		gda_numeric_free (numeric);
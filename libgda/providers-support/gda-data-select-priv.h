@@ -61,6 +61,10 @@ void           gda_data_select_take_row                     (GdaDataSelect *mode
 GdaRow        *gda_data_select_get_stored_row               (GdaDataSelect *model, gint rownum);
 GdaConnection *gda_data_select_get_connection               (GdaDataSelect *model);
 void           gda_data_select_set_columns                  (GdaDataSelect *model, GSList *columns);
+void           gda_data_select_row_set_string               (GdaDataSelect *model, GdaRow *row, GValue *value,
+							     const gchar *str, gssize len);
+void           gda_data_select_row_reset                    (GdaDataSelect *model, GdaRow *row);
+gboolean       gda_data_select_check_limits                 (GdaDataSelect *model, GError **error);
 
 void           gda_data_select_add_exception                (GdaDataSelect *model, GError *error);
 
@@ -32,6 +32,7 @@
 #include <libgda/sql-parser/gda-statement-struct-util.h>
 #include <libgda/sql-parser/token_types.h>
 #include <libgda/gda-lockable.h>
+#include <libgda/gda-trace-private.h>
 
 /*
  * Main static functions
@@ -424,6 +425,7 @@ gda_sql_parser_parse_string (GdaSqlParser *parser, const gchar *sql, const gchar
 		return NULL;
 
 	g_rec_mutex_lock (& (priv->mutex));
+	GDA_TRACE (parse, begin, parser, 0);
 
 	klass = (GdaSqlParserClass*) G_OBJECT_GET_CLASS (parser);
 	if (klass->delim_alloc) {
@@ -623,6 +625,7 @@ gda_sql_parser_parse_string (GdaSqlParser *parser, const gchar *sql, const gchar
 
 	priv->mode = parse_mode;
 
+	GDA_TRACE (parse, end, parser, stmt ? 1 : 0);
 	g_rec_mutex_unlock (& (priv->mutex));
 
 	return stmt;
@@ -867,7 +870,7 @@ static guint
 str_casehash (gconstpointer v)
 {
 	/* 31 bit hash function */
-	const signed char *p = v;
+	const guchar *p = v;
 	guint32 h = UpperToLower[*p];
 
 	if (h)
@@ -877,17 +880,19 @@ str_casehash (gconstpointer v)
 	return h;
 }
 
+/* longer than any keyword, so flavour specific keywords can be looked up without any allocation */
+#define KEYWORD_MAX_LEN 32
+
 static gint
 keywordCode (GdaSqlParser *parser, gchar *str, gint len)
 {
-	static GMutex mutex;
-	static GHashTable *keywords = NULL;
+	static GHashTable *keywords_table = NULL;
+	GHashTable *keywords;
 	gint type;
 	gchar oldc;
 	GdaSqlParserPrivate *priv = gda_sql_parser_get_instance_private (parser);
 
-	g_mutex_lock (&mutex);
-	if (!keywords) {
+	if (g_once_init_enter (&keywords_table)) {
 		/* if keyword begins with a number, it is the GdaSqlParserFlavour to which it only applies:
 		* for example "4start" would refer to the START keyword for PostgreSQL only */
 		keywords = g_hash_table_new (str_casehash, str_caseequal);
@@ -970,24 +975,25 @@ keywordCode (GdaSqlParser *parser, gchar *str, gint len)
 		g_hash_table_insert (keywords, "where", GINT_TO_POINTER (L_WHERE));
 		g_hash_table_insert (keywords, "work", GINT_TO_POINTER (L_TRANSACTION));
 		g_hash_table_insert (keywords, "write", GINT_TO_POINTER (L_WRITE));
+		g_once_init_leave (&keywords_table, keywords);
 	}
-	g_mutex_unlock (&mutex);
+	keywords = keywords_table;
 
 	oldc = str[len];
 	str[len] = 0;
 	type = GPOINTER_TO_INT (g_hash_table_lookup (keywords, str));
-	if (type == 0) {
+	if ((type == 0) && (len < KEYWORD_MAX_LEN)) {
 		/* try prepending the current flavour */
-		gchar *tmp;
-		tmp = g_strdup_printf ("%d%s", priv->flavour, str);
+		gchar tmp [KEYWORD_MAX_LEN + 2];
+		tmp [0] = '0' + priv->flavour;
+		memcpy (tmp + 1, str, len + 1);
 		type = GPOINTER_TO_INT (g_hash_table_lookup (keywords, tmp));
-		g_free (tmp);
-		if (type == 0) {
-			if (priv->mode == GDA_SQL_PARSER_MODE_PARSE)
-				type = L_ID;
-			else
-				type = L_RAWSTRING;
-		}
+	}
+	if (type == 0) {
+		if (priv->mode == GDA_SQL_PARSER_MODE_PARSE)
+			type = L_ID;
+		else
+			type = L_RAWSTRING;
 	}
 	/*g_print ("Looking for /%s/ -> %d\n", str, type);*/
 	str[len] = oldc;
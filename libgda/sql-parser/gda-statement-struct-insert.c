@@ -81,6 +81,8 @@ gda_sql_statement_insert_free (gpointer stmt)
 	g_slist_free (insert->values_list);
 
 	g_slist_free_full (insert->fields_list, (GDestroyNotify) gda_sql_field_free);
+	g_slist_free_full (insert->conflict_fields, (GDestroyNotify) gda_sql_field_free);
+	g_slist_free_full (insert->update_fields, (GDestroyNotify) gda_sql_field_free);
 	if (insert->select) {
 		if (GDA_SQL_ANY_PART (insert->select)->type == GDA_SQL_ANY_STMT_SELECT)
 			_gda_sql_statement_select_free (insert->select);
@@ -114,6 +116,20 @@ gda_sql_statement_insert_copy (gpointer src)
 	}
 	dest->fields_list = g_slist_reverse (dest->fields_list);
 
+	for (list = insert->conflict_fields; list; list = list->next) {
+		dest->conflict_fields = g_slist_prepend (dest->conflict_fields,
+							 gda_sql_field_copy ((GdaSqlField*) list->data));
+		gda_sql_any_part_set_parent (dest->conflict_fields->data, dest);
+	}
+	dest->conflict_fields = g_slist_reverse (dest->conflict_fields);
+
+	for (list = insert->update_fields; list; list = list->next) {
+		dest->update_fields = g_slist_prepend (dest->update_fields,
+						       gda_sql_field_copy ((GdaSqlField*) list->data));
+		gda_sql_any_part_set_parent (dest->update_fields->data, dest);
+	}
+	dest->update_fields = g_slist_reverse (dest->update_fields);
+
 	for (list = insert->values_list; list; list = list->next) {
 		GSList *vlist, *clist = NULL;
 		for (vlist = (GSList *) list->data; vlist; vlist = vlist->next) {
@@ -216,6 +232,30 @@ gda_sql_statement_insert_serialize (gpointer stmt)
 		g_string_append (string, str);
 		g_free (str);
 	}
+
+	/* upsert */
+	if (insert->conflict_fields) {
+		g_string_append (string, ",\"conflict_fields\":[");
+		for (list = insert->conflict_fields; list; list = list->next) {
+			if (list != insert->conflict_fields)
+				g_string_append_c (string, ',');
+			str = gda_sql_field_serialize ((GdaSqlField*) list->data);
+			g_string_append (string, str);
+			g_free (str);
+		}
+		g_string_append_c (string, ']');
+	}
+	if (insert->update_fields) {
+		g_string_append (string, ",\"update_fields\":[");
+		for (list = insert->update_fields; list; list = list->next) {
+			if (list != insert->update_fields)
+				g_string_append_c (string, ',');
+			str = gda_sql_field_serialize ((GdaSqlField*) list->data);
+			g_string_append (string, str);
+			g_free (str);
+		}
+		g_string_append_c (string, ']');
+	}
 	g_string_append_c (string, '}');
 	str = g_string_free (string, FALSE);
 	return str;	
@@ -341,6 +381,38 @@ gda_sql_statement_insert_take_select (GdaSqlStatement *stmt, GdaSqlStatement *se
 	gda_sql_any_part_set_parent (insert->select, insert);	
 }
 
+/**
+ * gda_sql_statement_insert_take_upsert:
+ * @stmt: a #GdaSqlStatement pointer
+ * @conflict_fields: (element-type Gda.SqlField) (nullable): a list of #GdaSqlField pointers
+ * @update_fields: (element-type Gda.SqlField) (nullable): a list of #GdaSqlField pointers
+ *
+ * Turns @stmt into an "upsert" statement: if inserting a row violates the unique constraint made of the
+ * @conflict_fields columns, then the @update_fields columns of the existing row are set to the values
+ * which would have been inserted (or nothing is done if @update_fields is %NULL). @conflict_fields can't
+ * be %NULL if @update_fields is not %NULL. Any previous upsert
+ * definition is replaced. @conflict_fields's and @update_fields's ownership is transferred to
+ * @stmt (which means @stmt is then responsible for freeing them when no longer needed).
+ *
+ * Since: 6.0
+ */
+void
+gda_sql_statement_insert_take_upsert (GdaSqlStatement *stmt, GSList *conflict_fields, GSList *update_fields)
+{
+	GSList *l;
+	GdaSqlStatementInsert *insert = (GdaSqlStatementInsert *) stmt->contents;
+
+	g_slist_free_full (insert->conflict_fields, (GDestroyNotify) gda_sql_field_free);
+	g_slist_free_full (insert->update_fields, (GDestroyNotify) gda_sql_field_free);
+
+	insert->conflict_fields = conflict_fields;
+	for (l = conflict_fields; l; l = l->next)
+		gda_sql_any_part_set_parent (l->data, insert);
+	insert->update_fields = update_fields;
+	for (l = update_fields; l; l = l->next)
+		gda_sql_any_part_set_parent (l->data, insert);
+}
+
 static gboolean
 gda_sql_statement_insert_check_structure (GdaSqlAnyPart *stmt, G_GNUC_UNUSED gpointer data, GError **error)
 {
@@ -413,5 +485,12 @@ gda_sql_statement_insert_check_structure (GdaSqlAnyPart *stmt, G_GNUC_UNUSED gpo
 				}
 		}
 	}
+
+	/* upsert: the columns to update are only known once the conflict target is */
+	if (insert->update_fields && !insert->conflict_fields) {
+		g_set_error (error, GDA_SQL_ERROR, GDA_SQL_STRUCTURE_CONTENTS_ERROR,
+			     "%s", _("INSERT statement updating the conflicting rows needs the columns of the unique constraint"));
+		return FALSE;
+	}
         return TRUE;
 }
@@ -40,10 +40,19 @@ G_BEGIN_DECLS
  * @fields_list: list of #GdaSqlField fields which are valued for insertion
  * @values_list: list of list of #GdaSqlExpr expressions (this is a list of list, not a simple list)
  * @select: a #GdaSqlStatementSelect or #GdaSqlStatementCompound structure representing the values to insert
+ * @conflict_fields: list of #GdaSqlField fields identifying the unique constraint which may be violated
+ *                   by the insertion (the conflict target), for an "upsert" statement
+ * @update_fields: list of #GdaSqlField fields to update with the values proposed for insertion
+ *                 when the insertion conflicts with an existing row, for an "upsert" statement
  *
  * The statement is an INSERT statement, any kind of INSERT statement can be represented using this structure 
  * (if this is not the case
  * then report a bug).
+ *
+ * The statement is an "upsert" statement if @conflict_fields or @update_fields is not %NULL: when inserting a
+ * row would violate a unique constraint, the existing row's @update_fields columns are updated instead
+ * (or nothing is done if @update_fields is %NULL); @conflict_fields is then required. How this is expressed depends on the database:
+ * "ON CONFLICT (...) DO UPDATE SET ..." for PostgreSQL and SQLite, "ON DUPLICATE KEY UPDATE ..." for MySQL.
  * <mediaobject>
  *   <imageobject role="html">
  *     <imagedata fileref="stmt-insert1.png" format="PNG"/>
@@ -75,10 +84,8 @@ struct _GdaSqlStatementInsert {
 	GSList                 *values_list; /* list of list of GdaSqlExpr */
 	GdaSqlAnyPart          *select; /* SELECT OR COMPOUND statements: GdaSqlStatementSelect or GdaSqlStatementCompound */
 
-	/*< private >*/
-	/* Padding for future expansion */
-	gpointer         _gda_reserved1;
-	gpointer         _gda_reserved2;
+	GSList                 *conflict_fields; /* list of GdaSqlField structures */
+	GSList                 *update_fields; /* list of GdaSqlField structures */
 };
 
 /*
@@ -96,6 +103,7 @@ void gda_sql_statement_insert_take_1_values_list (GdaSqlStatement *stmt, GSList
 void gda_sql_statement_insert_take_extra_values_list (GdaSqlStatement *stmt, GSList *list);
 
 void gda_sql_statement_insert_take_select (GdaSqlStatement *stmt, GdaSqlStatement *select);
+void gda_sql_statement_insert_take_upsert (GdaSqlStatement *stmt, GSList *conflict_fields, GSList *update_fields);
 
 G_END_DECLS
 
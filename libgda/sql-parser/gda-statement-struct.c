@@ -1269,6 +1269,12 @@ gda_sql_any_part_foreach (GdaSqlAnyPart *node, GdaSqlForeachFunc func, gpointer
 		}
 		if (!gda_sql_any_part_foreach (GDA_SQL_ANY_PART (stmt->select), func, data, error))
 			return FALSE;
+		for (l = stmt->conflict_fields; l; l = l->next)
+			if (!gda_sql_any_part_foreach (GDA_SQL_ANY_PART (l->data), func, data, error))
+				return FALSE;
+		for (l = stmt->update_fields; l; l = l->next)
+			if (!gda_sql_any_part_foreach (GDA_SQL_ANY_PART (l->data), func, data, error))
+				return FALSE;
 		break;
 	}
 	case GDA_SQL_ANY_STMT_UPDATE: {
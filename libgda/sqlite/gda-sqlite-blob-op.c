@@ -24,6 +24,7 @@
 #include "gda-sqlite.h"
 #include "gda-sqlite-blob-op.h"
 #include <libgda/gda-blob-op-impl.h>
+#include <libgda/gda-server-provider-extra.h>
 #include "gda-sqlite-util.h"
 #include <sql-parser/gda-sql-parser.h>
 
@@ -240,6 +241,36 @@ gda_sqlite_blob_op_read (GdaBlobOp *op, GdaBlob *blob, glong offset, glong size)
 /*
  * Blob write request
  */
+typedef struct {
+	GdaSqliteProvider *prov;
+	sqlite3_blob      *sblob;
+	int                len; /* size of @sblob */
+	glong              offset;
+	glong              nbwritten;
+} ChunkWriteData;
+
+static gboolean
+chunk_write (const guchar *data, glong size, G_GNUC_UNUSED glong chunk_offset, ChunkWriteData *cdata,
+	     GError **error)
+{
+	int wlen;
+	if (size + cdata->offset + cdata->nbwritten > cdata->len)
+		wlen = cdata->len - cdata->offset - cdata->nbwritten;
+	else
+		wlen = size;
+	if (wlen <= 0)
+		return TRUE;
+
+	if (SQLITE3_CALL (cdata->prov, sqlite3_blob_write) (cdata->sblob, data, wlen,
+							   cdata->offset + cdata->nbwritten) != SQLITE_OK) {
+		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR,
+			     "%s", _("Can't write to SQLite's BLOB"));
+		return FALSE;
+	}
+	cdata->nbwritten += wlen;
+	return TRUE;
+}
+
 static glong
 gda_sqlite_blob_op_write (GdaBlobOp *op, GdaBlob *blob, glong offset)
 {
@@ -264,45 +295,21 @@ gda_sqlite_blob_op_write (GdaBlobOp *op, GdaBlob *blob, glong offset)
 	}
 
 	if (gda_blob_get_op (blob) && (gda_blob_get_op (blob) != op)) {
-		/* use data through blob->op */
-		#define buf_size 16384
-		gint nread = 0;
-		GdaBlob *tmpblob = gda_blob_new ();
-		gda_blob_set_op (tmpblob, gda_blob_get_op (blob));
-
-		nbwritten = 0;
-
-		for (nread = gda_blob_op_read (gda_blob_get_op (tmpblob), tmpblob, nbwritten, buf_size);
-		     nread > 0;
-		     nread = gda_blob_op_read (gda_blob_get_op (tmpblob), tmpblob, nbwritten, buf_size)) {
-			int tmp_written;
-			int rc;
-			int wlen;
-			
-			if (nread + offset + nbwritten > len)
-				wlen = 	len - offset - nbwritten;
-			else
-				wlen = nread;
-
-			rc = SQLITE3_CALL (prov, sqlite3_blob_write) (priv->sblob,
-								gda_binary_get_data (gda_blob_get_binary (tmpblob)), wlen, offset + nbwritten);
-			if (rc != SQLITE_OK)
-				tmp_written = -1;
-			else
-				tmp_written = wlen;
-			
-			if (tmp_written < 0) {
-				/* treat error */
-				gda_blob_free ((gpointer) tmpblob);
-				g_object_unref (prov);
-				return -1;
-			}
-			nbwritten += tmp_written;
-			if (nread < buf_size)
-				/* nothing more to read */
-				break;
-		}
-		gda_blob_free ((gpointer) tmpblob);
+		/* use data through blob->op, one chunk at a time */
+		GdaConnection *cnc;
+		ChunkWriteData cdata;
+		cdata.prov = prov;
+		cdata.sblob = priv->sblob;
+		cdata.len = len;
+		cdata.offset = offset;
+		cdata.nbwritten = 0;
+
+		g_object_get (op, "connection", &cnc, NULL);
+		if (gda_server_provider_blob_stream (cnc, blob, (GdaServerProviderBlobChunkFunc) chunk_write,
+						     &cdata, NULL))
+			nbwritten = cdata.nbwritten;
+		if (cnc)
+			g_object_unref (cnc);
 	}
 	else {
 		/* write blob using bin->data and bin->binary_length */
@@ -48,6 +48,7 @@
 #include <libgda/gda-server-provider-extra.h>
 #include <libgda/gda-server-provider-impl.h>
 #include <libgda/gda-server-operation-private.h>
+#include <libgda/gda-trace-private.h>
 #include "gda-sqlite.h"
 #include "gda-sqlite-provider.h"
 #include "gda-sqlite-recordset.h"
@@ -58,6 +59,7 @@
 #include "gda-sqlite-handler-boolean.h"
 #include "gda-sqlite-blob-op.h"
 #include <libgda/gda-connection-private.h>
+#include <libgda/gda-connection-internal.h>
 #include <libgda/binreloc/gda-binreloc.h>
 #include <libgda/gda-set.h>
 #include <libgda/gda-statement-extra.h>
@@ -359,6 +361,7 @@ static GObject             *gda_sqlite_provider_statement_execute (GdaServerProv
 								   GType *col_types, GdaSet **last_inserted_row, GError **error);
 static GdaSqlStatement     *gda_sqlite_provider_statement_rewrite (GdaServerProvider *provider, GdaConnection *cnc,
 								   GdaStatement *stmt, GdaSet *params, GError **error);
+static gint                 gda_sqlite_provider_get_max_params (GdaServerProvider *provider, GdaConnection *cnc);
 
 /* string escaping */
 static gchar               *gda_sqlite_provider_escape_string (GdaServerProvider *provider, GdaConnection *cnc,
@@ -839,8 +842,9 @@ GdaServerProviderBase sqlite_base_functions = {
 	gda_sqlite_provider_delete_savepoint,
 	gda_sqlite_provider_statement_prepare,
 	gda_sqlite_provider_statement_execute,
+	gda_sqlite_provider_get_max_params,
 
-	NULL, NULL, NULL, NULL, /* padding */
+	NULL, NULL, NULL, /* padding */
 };
 
 GdaServerProviderMeta sqlite_meta_functions = {
@@ -1500,6 +1504,24 @@ gda_sqlite_provider_get_server_version (GdaServerProvider *provider, GdaConnecti
 	return (const gchar *) version_string;
 }
 
+/*
+ * Maximum number of parameters request: the SQLITE_LIMIT_VARIABLE_NUMBER limit of the connection
+ */
+static gint
+gda_sqlite_provider_get_max_params (GdaServerProvider *provider, GdaConnection *cnc)
+{
+	SqliteConnectionData *cdata;
+	GdaSqliteProvider *prov = GDA_SQLITE_PROVIDER (provider);
+
+	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), 0);
+	g_return_val_if_fail (gda_connection_get_provider (cnc) == provider, 0);
+
+	cdata = (SqliteConnectionData*) gda_connection_internal_get_provider_data_error (cnc, NULL);
+	if (!cdata)
+		return 0;
+	return SQLITE3_CALL (prov, sqlite3_limit) (cdata->connection, SQLITE_LIMIT_VARIABLE_NUMBER, -1);
+}
+
 /*
  * Support operation request
  */
@@ -3298,13 +3320,13 @@ fill_blob_data (GdaConnection *cnc, GdaSet *params,
 }
 
 /*
- * Execute statement request
+ * Execute statement request, see gda_sqlite_provider_statement_execute()
  */
 static GObject *
-gda_sqlite_provider_statement_execute (GdaServerProvider *provider, GdaConnection *cnc,
-				       GdaStatement *stmt, GdaSet *params,
-				       GdaStatementModelUsage model_usage,
-				       GType *col_types, GdaSet **last_inserted_row, GError **error)
+sqlite_statement_execute (GdaServerProvider *provider, GdaConnection *cnc,
+			  GdaStatement *stmt, GdaSet *params,
+			  GdaStatementModelUsage model_usage,
+			  GType *col_types, GdaSet **last_inserted_row, GError **error)
 {
 	GdaSqlitePStmt *ps;
 	SqliteConnectionData *cdata;
@@ -3420,6 +3442,7 @@ gda_sqlite_provider_statement_execute (GdaServerProvider *provider, GdaConnectio
 	int i;
 	GSList *blobs_list = NULL; /* list of PendingBlob structures */
 
+	GDA_TRACE (bind, begin, stmt, g_slist_length (gda_pstmt_get_param_ids (_GDA_PSTMT (ps))));
 	for (i = 1, list = gda_pstmt_get_param_ids (_GDA_PSTMT (ps)); list; list = list->next, i++) {
 		const gchar *pname = (gchar *) list->data;
 		GdaHolder *h = NULL;
@@ -3501,6 +3524,8 @@ gda_sqlite_provider_statement_execute (GdaServerProvider *provider, GdaConnectio
 			if (new_ps)
 				g_object_unref (ps);
 			pending_blobs_free_list (blobs_list);
+			/* binding continues when executing @rstmt */
+			GDA_TRACE (bind, end, stmt, 1);
 			res = gda_sqlite_provider_statement_execute (provider, cnc,
 								     rstmt, params,
 								     model_usage,
@@ -3516,6 +3541,10 @@ gda_sqlite_provider_statement_execute (GdaServerProvider *provider, GdaConnectio
 			if (! gda_rewrite_statement_for_null_parameters (stmt, params, &rstmt, error))
 				SQLITE3_CALL (prov, sqlite3_bind_null) (_gda_sqlite_pstmt_get_stmt (ps), i);
 			else if (rstmt == NULL) {
+				GDA_TRACE (bind, end, stmt, 0);
+				if (new_ps)
+					g_object_unref (ps);
+				pending_blobs_free_list (blobs_list);
 				return NULL;
       } else {
 				/* The strategy here is to execute @rstmt using its prepared
@@ -3526,9 +3555,17 @@ gda_sqlite_provider_statement_execute (GdaServerProvider *provider, GdaConnectio
 				GdaSqlitePStmt *tps;
 				GdaPStmt *gtps;
 				GSList *prep_param_ids, *copied_param_ids;
+
+				/* binding continues when executing @rstmt */
+				GDA_TRACE (bind, end, stmt, 1);
 				if (!gda_sqlite_provider_statement_prepare (provider, cnc,
-									    rstmt, error))
+									    rstmt, error)) {
+					g_object_unref (rstmt);
+					if (new_ps)
+						g_object_unref (ps);
+					pending_blobs_free_list (blobs_list);
 					return NULL;
+				}
 				tps = (GdaSqlitePStmt *)
 					gda_connection_get_prepared_statement (cnc, rstmt);
 				gtps = (GdaPStmt *) tps;
@@ -3693,7 +3730,7 @@ gda_sqlite_provider_statement_execute (GdaServerProvider *provider, GdaConnectio
 			const GdaNumeric *gdan;
 
 			gdan = gda_value_get_numeric (value);
-			SQLITE3_CALL (prov, sqlite3_bind_text) (_gda_sqlite_pstmt_get_stmt (ps), i, gda_numeric_get_string((GdaNumeric*)gdan), -1, SQLITE_TRANSIENT);
+			SQLITE3_CALL (prov, sqlite3_bind_text) (_gda_sqlite_pstmt_get_stmt (ps), i, gda_numeric_get_string (gdan), -1, g_free);
 		}
 		else {
 			gchar *str;
@@ -3707,6 +3744,7 @@ gda_sqlite_provider_statement_execute (GdaServerProvider *provider, GdaConnectio
 			break;
 		}
 	}
+	GDA_TRACE (bind, end, stmt, event ? 0 : 1);
 
 	if (event) {
 		gda_connection_add_event (cnc, event);
@@ -3914,6 +3952,51 @@ gda_sqlite_provider_statement_execute (GdaServerProvider *provider, GdaConnectio
 	}
 }
 
+/*
+ * Execute statement request, honoring the GdaConnection:statement-timeout and GdaStatement:timeout properties
+ */
+static GObject *
+gda_sqlite_provider_statement_execute (GdaServerProvider *provider, GdaConnection *cnc,
+				       GdaStatement *stmt, GdaSet *params,
+				       GdaStatementModelUsage model_usage,
+				       GType *col_types, GdaSet **last_inserted_row, GError **error)
+{
+	SqliteConnectionData *cdata;
+	GdaSqliteProvider *prov = GDA_SQLITE_PROVIDER (provider);
+	GObject *retval;
+	guint timeout;
+
+	g_return_val_if_fail (GDA_IS_CONNECTION (cnc), NULL);
+	g_return_val_if_fail (GDA_IS_STATEMENT (stmt), NULL);
+
+	cdata = (SqliteConnectionData*) gda_connection_internal_get_provider_data_error (cnc, error);
+	if (!cdata)
+		return NULL;
+
+	/* nested calls use the deadline of the outermost one */
+	timeout = _gda_connection_get_statement_timeout (cnc, stmt);
+	if (! _gda_sqlite_deadline_start (prov, cdata, timeout))
+		return sqlite_statement_execute (provider, cnc, stmt, params, model_usage, col_types,
+						 last_inserted_row, error);
+
+	retval = sqlite_statement_execute (provider, cnc, stmt, params, model_usage, col_types,
+					   last_inserted_row, error);
+	if (_gda_sqlite_deadline_stop (prov, cdata)) {
+		/* the statement may have been interrupted while the data model was reading its first rows */
+		if (retval)
+			g_object_unref (retval);
+		retval = NULL;
+		if (last_inserted_row && *last_inserted_row) {
+			g_object_unref (*last_inserted_row);
+			*last_inserted_row = NULL;
+		}
+		g_clear_error (error);
+		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_TIMEOUT_ERROR,
+			     _("Statement execution took more than %u ms"), timeout);
+	}
+	return retval;
+}
+
 /*
  * Rewrites a statement in case some parameters in @params are set to DEFAULT, for INSERT or UPDATE statements
  *
@@ -5325,6 +5408,8 @@ gda_sqlite_load_symbols (GModule *module, Sqlite3ApiRoutines** apilib)
 		goto onerror;
 	if (! g_module_symbol (module, "sqlite3_last_insert_rowid", (gpointer*) &((*apilib)->sqlite3_last_insert_rowid)))
 		goto onerror;
+	if (! g_module_symbol (module, "sqlite3_limit", (gpointer*) &((*apilib)->sqlite3_limit)))
+		goto onerror;
 	if (! g_module_symbol (module, "sqlite3_malloc", (gpointer*) &((*apilib)->sqlite3_malloc)))
 		goto onerror;
 	if (! g_module_symbol (module, "sqlite3_mprintf", (gpointer*) &((*apilib)->sqlite3_mprintf)))
@@ -5337,6 +5422,8 @@ gda_sqlite_load_symbols (GModule *module, Sqlite3ApiRoutines** apilib)
 		goto onerror;
 	if (! g_module_symbol (module, "sqlite3_prepare_v2", (gpointer*) &((*apilib)->sqlite3_prepare_v2)))
 		goto onerror;
+	if (! g_module_symbol (module, "sqlite3_progress_handler", (gpointer*) &((*apilib)->sqlite3_progress_handler)))
+		goto onerror;
 	if (! g_module_symbol (module, "sqlite3_reset", (gpointer*) &((*apilib)->sqlite3_reset)))
 		goto onerror;
 	if (! g_module_symbol (module, "sqlite3_result_blob", (gpointer*) &((*apilib)->sqlite3_result_blob)))
@@ -39,6 +39,8 @@
 #include <gda-data-select-private.h>
 #include <libgda/gda-util.h>
 #include <libgda/gda-connection-private.h>
+#include <libgda/gda-connection-internal.h>
+#include <libgda/gda-trace-private.h>
 
 #include "virtual/gda-vconnection-data-model.h"
 #include "virtual/gda-vconnection-data-model-private.h"
@@ -65,6 +67,7 @@ typedef struct {
 	gboolean      empty_forced;
 	gint          next_row_num;
 	GdaRow       *tmp_row; /* used in cursor mode */
+	guint         timeout; /* maximum duration of each sqlite3_step() call, in ms, or 0 */
 } GdaSqliteRecordsetPrivate;
 
 G_DEFINE_TYPE_WITH_PRIVATE(GdaSqliteRecordset, gda_sqlite_recordset, GDA_TYPE_DATA_SELECT)
@@ -276,6 +279,10 @@ _gda_sqlite_recordset_new (GdaConnection *cnc, GdaSqlitePStmt *ps, GdaSet *exec_
 		_gda_vconnection_set_working_obj ((GdaVconnectionDataModel*) cnc, NULL);
 	}
 
+	/* the statement is actually executed when the first row is fetched */
+	GdaSqliteRecordsetPrivate *priv = gda_sqlite_recordset_get_instance_private (model);
+	priv->timeout = _gda_connection_get_statement_timeout (cnc, gda_pstmt_get_gda_statement (_GDA_PSTMT (ps)));
+
         /* fill the data model */
         read_rows_to_init_col_types (model);
 
@@ -333,6 +340,9 @@ fetch_next_sqlite_row (GdaSqliteRecordset *model, gboolean do_store, GError **er
 	GdaSqliteProvider *prov;
 	glong length;
 
+	if (do_store && ! gda_data_select_check_limits ((GdaDataSelect*) model, error))
+		return NULL;
+
 	cnc = gda_data_select_get_connection ((GdaDataSelect*) model);
 	prov = GDA_SQLITE_PROVIDER (gda_connection_get_provider (cnc));
 	cdata = (SqliteConnectionData*) gda_connection_internal_get_provider_data_error (cnc, error);
@@ -344,13 +354,20 @@ fetch_next_sqlite_row (GdaSqliteRecordset *model, gboolean do_store, GError **er
 
   GdaSqliteRecordsetPrivate *priv = gda_sqlite_recordset_get_instance_private (model);
 
+	gboolean timed_out = FALSE;
 	if (priv->empty_forced)
 		rc = SQLITE_DONE;
-	else		
+	else {
+		gboolean deadline_set;
+		deadline_set = _gda_sqlite_deadline_start (prov, cdata, priv->timeout);
 		rc = SQLITE3_CALL (prov, sqlite3_step) (_gda_sqlite_pstmt_get_stmt (ps));
+		if (deadline_set)
+			timed_out = _gda_sqlite_deadline_stop (prov, cdata);
+	}
 	switch (rc) {
 	case  SQLITE_ROW: {
 		gint col, real_col;
+		GDA_TRACE (row_build, begin, model, priv->next_row_num);
 		prow = gda_row_new (gda_pstmt_get_ncols (_GDA_PSTMT (ps)));
 		for (col = 0; col < gda_pstmt_get_ncols (_GDA_PSTMT (ps)); col++) {
 			GValue *value;
@@ -444,9 +461,14 @@ fetch_next_sqlite_row (GdaSqliteRecordset *model, gboolean do_store, GError **er
 				else if (type == G_TYPE_DOUBLE)
 					g_value_set_double (value, SQLITE3_CALL (prov, sqlite3_column_double) (_gda_sqlite_pstmt_get_stmt (ps),
 											  real_col));
-				else if (type == G_TYPE_STRING)
-					g_value_set_string (value, (gchar *) SQLITE3_CALL (prov, sqlite3_column_text) (_gda_sqlite_pstmt_get_stmt (ps),
-												  real_col));
+				else if (type == G_TYPE_STRING) {
+					const gchar *text;
+					text = (const gchar *) SQLITE3_CALL (prov, sqlite3_column_text) (_gda_sqlite_pstmt_get_stmt (ps),
+													 real_col);
+					gda_data_select_row_set_string ((GdaDataSelect*) model, prow, value, text,
+									SQLITE3_CALL (prov, sqlite3_column_bytes) (_gda_sqlite_pstmt_get_stmt (ps),
+														   real_col));
+				}
 				else if (type == GDA_TYPE_TEXT) {
 					GdaText *text = gda_text_new ();
 					gda_text_set_string (text, (const gchar *) SQLITE3_CALL (prov, sqlite3_column_text) (_gda_sqlite_pstmt_get_stmt (ps),
@@ -623,6 +645,7 @@ fetch_next_sqlite_row (GdaSqliteRecordset *model, gboolean do_store, GError **er
 				}
 			}
 		}
+		GDA_TRACE (row_build, end, model, priv->next_row_num);
 		
 		if (do_store) {
 			/* insert row */
@@ -651,12 +674,16 @@ fetch_next_sqlite_row (GdaSqliteRecordset *model, gboolean do_store, GError **er
 		if (rc == SQLITE_IOERR_TRUNCATE)
 			g_set_error (&lerror, GDA_DATA_MODEL_ERROR,
 				     GDA_DATA_MODEL_TRUNCATED_ERROR, "%s", _("Truncated data"));
+		else if (timed_out)
+			g_set_error (&lerror, GDA_SERVER_PROVIDER_ERROR,
+				     GDA_SERVER_PROVIDER_TIMEOUT_ERROR,
+				     _("Statement execution took more than %u ms"), priv->timeout);
 		else
 			g_set_error (&lerror, GDA_SERVER_PROVIDER_ERROR,
 				     GDA_SERVER_PROVIDER_INTERNAL_ERROR, 
 				     "%s", SQLITE3_CALL (prov, sqlite3_errmsg) (cdata->connection));
 		gda_data_select_add_exception (GDA_DATA_SELECT (model), lerror);
-		if (rc == SQLITE_ERROR)
+		if ((rc == SQLITE_ERROR) || timed_out)
 			g_propagate_error (error, g_error_copy (lerror));
 		gda_data_select_set_advertized_nrows (GDA_DATA_SELECT (model), priv->next_row_num);
 		break;
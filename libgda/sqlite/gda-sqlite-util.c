@@ -375,3 +375,54 @@ _gda_sqlite_check_transaction_started (GdaConnection *cnc, gboolean *out_started
 	}
 	return TRUE;
 }
+
+/*
+ * Interrupts the running statement once the deadline set by _gda_sqlite_deadline_start() has passed
+ */
+static int
+deadline_progress_cb (SqliteConnectionData *cdata)
+{
+	if (g_get_monotonic_time () < cdata->deadline)
+		return 0;
+	cdata->timed_out = TRUE;
+	return 1;
+}
+
+/* number of SQLite virtual machine instructions between two calls to deadline_progress_cb() */
+#define DEADLINE_NB_OPS 1000
+
+/*
+ * _gda_sqlite_deadline_start:
+ * @timeout: a timeout in milliseconds, or 0
+ *
+ * Makes SQLite interrupt any statement running on @cdata's connection after @timeout. Nothing is done
+ * if @timeout is 0 or if a deadline has already been set (in which case that deadline applies).
+ *
+ * Returns: %TRUE if a deadline has been set, in which case _gda_sqlite_deadline_stop() must be called
+ */
+gboolean
+_gda_sqlite_deadline_start (GdaSqliteProvider *prov, SqliteConnectionData *cdata, guint timeout)
+{
+	if ((timeout == 0) || (cdata->deadline > 0))
+		return FALSE;
+	cdata->deadline = g_get_monotonic_time () + (gint64) timeout * 1000;
+	cdata->timed_out = FALSE;
+	SQLITE3_CALL (prov, sqlite3_progress_handler) (cdata->connection, DEADLINE_NB_OPS,
+						       (int (*)(void*)) deadline_progress_cb, cdata);
+	return TRUE;
+}
+
+/*
+ * _gda_sqlite_deadline_stop:
+ *
+ * Removes the deadline set by _gda_sqlite_deadline_start()
+ *
+ * Returns: %TRUE if a statement has been interrupted because the deadline had passed
+ */
+gboolean
+_gda_sqlite_deadline_stop (GdaSqliteProvider *prov, SqliteConnectionData *cdata)
+{
+	SQLITE3_CALL (prov, sqlite3_progress_handler) (cdata->connection, 0, NULL, NULL);
+	cdata->deadline = 0;
+	return cdata->timed_out;
+}
@@ -42,6 +42,9 @@ gchar                     *_gda_sqlite_identifier_quote          (GdaServerProvi
 
 gboolean _gda_sqlite_check_transaction_started (GdaConnection *cnc, gboolean *out_started, GError **error);
 
+gboolean _gda_sqlite_deadline_start (GdaSqliteProvider *prov, SqliteConnectionData *cdata, guint timeout);
+gboolean _gda_sqlite_deadline_stop  (GdaSqliteProvider *prov, SqliteConnectionData *cdata);
+
 G_END_DECLS
 
 #endif
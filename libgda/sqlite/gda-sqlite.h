@@ -53,6 +53,8 @@ typedef struct {
 	gchar        *file;
 	GHashTable   *types_hash; /* key = type name, value = pointer to a GType */
 	GType        *types_array;/* holds GType values, pointed by @types_hash */
+	gint64        deadline;   /* monotonic time after which the running statement is interrupted, or 0 */
+	gboolean      timed_out;  /* set when the running statement has been interrupted */
 } SqliteConnectionData;
 
 extern GHashTable *error_blobs_hash;
@@ -113,6 +115,7 @@ typedef struct {
 	void  (*sqlite3_free_table)(char**result);
 	int  (*sqlite3_get_table)(sqlite3*,const char*,char***,int*,int*,char**);
 	sqlite_int64  (*sqlite3_last_insert_rowid)(sqlite3*);
+	int  (*sqlite3_limit)(sqlite3*,int,int);
 
 	void *(*sqlite3_malloc)(int);
 	char * (*sqlite3_mprintf)(const char*,...);
@@ -120,6 +123,7 @@ typedef struct {
 	int  (*sqlite3_open_v2)(const char *filename, sqlite3 **ppDb, int flags, const char *zVfs);
 	int  (*sqlite3_prepare)(sqlite3*,const char*,int,sqlite3_stmt**,const char**);
 	int (*sqlite3_prepare_v2)(sqlite3*,const char*,int,sqlite3_stmt**,const char**);
+	void (*sqlite3_progress_handler)(sqlite3*,int,int(*)(void*),void*);
 
 	int  (*sqlite3_reset)(sqlite3_stmt*pStmt);
 	void  (*sqlite3_result_blob)(sqlite3_context*,const void*,int,void(*)(void*));
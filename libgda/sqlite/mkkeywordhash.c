@@ -24,11 +24,10 @@ static const char zHdr[] =
 	"/* file contains automatically generated code, DO NOT MODIFY *\n"
 	" *\n"
 	" * The code in this file implements a function that determines whether\n"
-	" * or not a given identifier is really an SQL keyword.  The same thing\n"
-	" * might be implemented more directly using a hand-written hash table.\n"
-	" * But by using this automatically generated code, the size of the code\n"
-	" * is substantially reduced.  This is important for embedded applications\n"
-	" * on platforms with limited memory.\n"
+	" * or not a given identifier is really an SQL keyword, using a minimal\n"
+	" * perfect hash: each lookup computes two hashes of the identifier and\n"
+	" * compares it to at most one keyword.  The keywords' text is compressed\n"
+	" * by overlapping keywords which share a prefix or a suffix.\n"
 	" *\n"
 	" * This code has been copied from SQLite's mkkeywordhash.c file and modified.\n"
 	" * to read the SQL keywords from a file instead of static ones\n"
@@ -117,12 +116,47 @@ static Keyword *findById(int id){
 	return &aKeywordTable[i];
 }
 
+/*
+** Case insensitive comparison of the first @n chars of two keywords
+*/
+static int keywordNCaseCmp(const char *zLeft, const char *zRight, int n){
+	int i;
+	for(i=0; i<n; i++){
+		int d = UpperToLower[(unsigned char)zLeft[i]] - UpperToLower[(unsigned char)zRight[i]];
+		if( d ) return d;
+	}
+	return 0;
+}
+
+/*
+** Case insensitive FNV-1a hash, the generated code uses the same function
+*/
+static unsigned int keywordHash(unsigned int seed, const char *z, int n){
+	unsigned int h = 2166136261u ^ (seed * 16777619u);
+	int i;
+	for(i=0; i<n; i++){
+		h ^= UpperToLower[(unsigned char)z[i]];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+/*
+** Comparison function to sort the perfect hash's buckets by decreasing size
+*/
+#define MAXSEED 10000000
+static int *aBucketSize = NULL;
+static int bucketCompare(const void *a, const void *b){
+	return aBucketSize[*(const int*)b] - aBucketSize[*(const int*)a];
+}
+
 /* @len is the number of chars, NOT including the \0 at the end */
 static void
 add_keywork (const char *keyword, int len)
 {
 #define MAXKEYWORDS 1000
 	const char *ptr;
+	int i;
 
 	if (len == 0)
 		return;
@@ -136,6 +170,14 @@ add_keywork (const char *keyword, int len)
 		}
 	}
 
+	for (i = 0; i < nKeyword; i++) {
+		if (((int) strlen (aKeywordTable [i].zName) == len) &&
+		    !keywordNCaseCmp (aKeywordTable [i].zName, keyword, len)) {
+			/* already listed */
+			return;
+		}
+	}
+
 	aKeywordTable [nKeyword].zName = malloc (sizeof (char) * (len + 1));
 	memcpy (aKeywordTable [nKeyword].zName, keyword, sizeof (char) * len);
 	aKeywordTable [nKeyword].zName [len] = 0;
@@ -155,9 +197,7 @@ parse_input (const char *filename)
 {
 #define BUFSIZE 500
 	FILE *stream;
-        char buffer[BUFSIZE+1];
-        int read;
-        char *end;
+	char buffer[BUFSIZE+1];
 
 	stream = fopen (filename, "r");
 	if (!stream)
@@ -167,52 +207,29 @@ parse_input (const char *filename)
 
 	aKeywordTable = malloc (sizeof (Keyword) * MAXKEYWORDS);
 	memset (aKeywordTable, 0, sizeof (Keyword) * MAXKEYWORDS);
-        read = fread (buffer, 1, BUFSIZE, stream);
-        end = buffer + read;
-	*end = 0;
-        while (read > 0) {
-		char *ptr;
-
-                /* read all complete lines in buffer */
-                while (end > buffer) {
-                        char *hold = NULL;
-                        for (ptr = buffer; (ptr < end) && *ptr && (*ptr != '\n'); ptr++);
-                        if (ptr == end)
-                                break;
-                        if (*ptr)
-                                hold = ptr+1;
-                        *ptr = 0;
-                        
-                        /* treat the line */
-			if (*buffer && *buffer != '#') {
-				char *tmp1, *tmp2;
-				printf (" *\n * From line: %s\n", buffer);
-				for (tmp1 = tmp2 = buffer; *tmp2; tmp2++) {
-					if (((*tmp2 < 'A') || (*tmp2 > 'Z')) &&
-					    ((*tmp2 < 'a') || (*tmp2 > 'z')) &&
-					    ((*tmp2 < '0') || (*tmp2 > '9')) &&
-					    (*tmp2 != '_')) {
-						/* keyword found */
-						add_keywork (tmp1, tmp2 - tmp1);
-						
-						tmp1 = tmp2 + 1;
-					}
-				}
-				if ((tmp1 != tmp2) && *tmp1)
+
+	/* read line by line, the last line may not end with a '\n' */
+	while (fgets (buffer, sizeof (buffer), stream)) {
+		buffer [strcspn (buffer, "\r\n")] = 0;
+
+		/* treat the line */
+		if (*buffer && *buffer != '#') {
+			char *tmp1, *tmp2;
+			printf (" *\n * From line: %s\n", buffer);
+			for (tmp1 = tmp2 = buffer; *tmp2; tmp2++) {
+				if (((*tmp2 < 'A') || (*tmp2 > 'Z')) &&
+				    ((*tmp2 < 'a') || (*tmp2 > 'z')) &&
+				    ((*tmp2 < '0') || (*tmp2 > '9')) &&
+				    (*tmp2 != '_')) {
+					/* keyword found */
 					add_keywork (tmp1, tmp2 - tmp1);
+
+					tmp1 = tmp2 + 1;
+				}
 			}
-                                
-                        if (hold) {
-                                int l = end - hold;
-                                end -= hold - buffer;
-                                memmove (buffer, hold, l);
-                        }
-                        else
-                                break;
-                }
-
-		read = fread (end, 1, BUFSIZE - (end - buffer), stream);
-                end += read;
+			if ((tmp1 != tmp2) && *tmp1)
+				add_keywork (tmp1, tmp2 - tmp1);
+		}
 	}
 
 	printf (" */\n");
@@ -236,11 +253,11 @@ int
 main (int argc, char **argv)
 {
 	int i, j, k, h;
-	int bestSize, bestCount;
-	int count;
+	int nBucket;
+	int *aBucketOrder, *aSlot, *aMember, *aMemberSlot;
+	unsigned int *aSeed, maxSeed;
 	int nChar;
 	int totalLen = 0;
-	int aHash[5000];  /* 2000 is much bigger than nKeyword */
 	char zText[10000];
 
 	if ((argc < 2)  || (argc > 3)) {
@@ -264,8 +281,6 @@ main (int argc, char **argv)
 		assert( (unsigned int) p->len < sizeof(p->zOrigName) );
 		strcpy(p->zOrigName, p->zName);
 		totalLen += p->len;
-		p->hash = (UpperToLower[(int)p->zName[0]]*4) ^
-			(UpperToLower[(int)p->zName[p->len-1]] *3) ^ p->len;
 		p->id = i+1;
 	}
 
@@ -344,34 +359,69 @@ main (int argc, char **argv)
 	/* Sort the table by offset */
 	qsort(aKeywordTable, nKeyword, sizeof(aKeywordTable[0]), keywordCompare3);
 
-	/* Figure out how big to make the hash table in order to minimize the
-	** number of collisions */
-	bestSize = nKeyword;
-	bestCount = nKeyword*nKeyword;
-	for(i=nKeyword/2; i<=2*nKeyword; i++){
-		for(j=0; j<i; j++) aHash[j] = 0;
+	/* Build a minimal perfect hash: the keywords are first distributed into buckets using
+	** keywordHash() with a 0 seed, then, starting with the biggest buckets, a seed is searched
+	** for each bucket so that keywordHash() with that seed places all the bucket's keywords into
+	** free slots of the final table. A lookup then computes two hashes and does a single
+	** comparison, without walking any collision chain. */
+	nBucket = nKeyword / 2 + 1;
+	aBucketSize = calloc (nBucket, sizeof (int));
+	aSeed = calloc (nBucket, sizeof (unsigned int));
+	aBucketOrder = malloc (nBucket * sizeof (int));
+	aSlot = malloc (nKeyword * sizeof (int));
+	aMember = malloc (nKeyword * sizeof (int));
+	aMemberSlot = malloc (nKeyword * sizeof (int));
+	for(i=0; i<nKeyword; i++){
+		Keyword *p = &aKeywordTable[i];
+		p->hash = keywordHash (0, p->zOrigName, strlen (p->zOrigName)) % nBucket;
+		aBucketSize[p->hash]++;
+		aSlot[i] = -1;
+	}
+	for(i=0; i<nBucket; i++) aBucketOrder[i] = i;
+	qsort(aBucketOrder, nBucket, sizeof(aBucketOrder[0]), bucketCompare);
+
+	maxSeed = 0;
+	for(i=0; i<nBucket && aBucketSize[aBucketOrder[i]]>0; i++){
+		int b = aBucketOrder[i];
+		int nMember = 0;
+		unsigned int seed;
+
 		for(j=0; j<nKeyword; j++){
-			h = aKeywordTable[j].hash % i;
-			aHash[h] *= 2;
-			aHash[h]++;
+			if( aKeywordTable[j].hash==b ) aMember[nMember++] = j;
 		}
-		for(j=count=0; j<i; j++) count += aHash[j];
-		if( count<bestCount ){
-			bestCount = count;
-			bestSize = i;
+		for(seed=1; ; seed++){
+			if( seed>MAXSEED ){
+				fprintf (stderr, "Could not compute a perfect hash for the SQL keywords\n");
+				exit (1);
+			}
+			for(k=0; k<nMember; k++){
+				Keyword *p = &aKeywordTable[aMember[k]];
+				h = keywordHash (seed, p->zOrigName, strlen (p->zOrigName)) % nKeyword;
+				if( aSlot[h]>=0 ) break;
+				aSlot[h] = aMember[k];
+				aMemberSlot[k] = h;
+			}
+			if( k==nMember ) break;
+			/* collision: undo this attempt */
+			for(k--; k>=0; k--) aSlot[aMemberSlot[k]] = -1;
 		}
-	}
-
-	/* Compute the hash */
-	for(i=0; i<bestSize; i++) aHash[i] = 0;
-	for(i=0; i<nKeyword; i++){
-		h = aKeywordTable[i].hash % bestSize;
-		aKeywordTable[i].iNext = aHash[h];
-		aHash[h] = i+1;
+		aSeed[b] = seed;
+		if( seed>maxSeed ) maxSeed = seed;
 	}
 
 	/* Begin generating code */
-	printf("/* Hash score: %d */\n", bestCount);
+	printf("/* Minimal perfect hash of %d keywords using %d buckets, max seed: %u */\n",
+	       nKeyword, nBucket, maxSeed);
+	printf("static unsigned int\n%skeywordHash (unsigned int seed, const char *z, int n)\n{\n",
+	       prefix ? prefix : "");
+	printf("  unsigned int h = 2166136261u ^ (seed * 16777619u);\n");
+	printf("  int i;\n");
+	printf("  for( i=0; i<n; i++ ){\n");
+	printf("    h ^= charMap(z[i]);\n");
+	printf("    h *= 16777619u;\n");
+	printf("  }\n");
+	printf("  return h;\n");
+	printf("}\n\n");
 	printf("static int %skeywordCode(const char *z, int n){\n", prefix ? prefix : "");
 	printf("  /* zText[] encodes %d bytes of keywords in %d bytes */\n",
 	       totalLen + nKeyword, nChar+1 );
@@ -414,46 +464,35 @@ main (int argc, char **argv)
 	if( j>0 ) printf("\n");
 	printf("  };\n");
 
-	printf("  static const unsigned int %saHash[%d] = {\n", prefix ? prefix : "", bestSize);
-	for(i=j=0; i<bestSize; i++){
+	printf("  static const unsigned int %saSeed[%d] = {\n", prefix ? prefix : "", nBucket);
+	for(i=j=0; i<nBucket; i++){
 		if( j==0 ) printf("    ");
-		printf(" %d,", aHash[i]);
+		printf(" %u,", aSeed[i]);
 		j++;
 		if( j>12 ){
 			printf("\n");
 			j = 0;
 		}
 	}
-	printf("%s  };\n", j==0 ? "" : "\n");    
-
-	printf("  static const unsigned int %saNext[%d] = {\n", prefix ? prefix : "", nKeyword);
-	for(i=j=0; i<nKeyword; i++){
-		if( j==0 ) printf("    ");
-		printf(" %3d,", aKeywordTable[i].iNext);
-		j++;
-		if( j>12 ){
-			printf("\n");
-			j = 0;
-		}
-	}
-	printf("%s  };\n", j==0 ? "" : "\n");    
+	printf("%s  };\n", j==0 ? "" : "\n");
 
+	/* the lengths and offsets are indexed by the keywords' positions in the perfect hash */
 	printf("  static const unsigned char %saLen[%d] = {\n", prefix ? prefix : "", nKeyword);
 	for(i=j=0; i<nKeyword; i++){
 		if( j==0 ) printf("    ");
-		printf(" %3d,", aKeywordTable[i].len+aKeywordTable[i].prefix);
+		printf(" %3d,", aKeywordTable[aSlot[i]].len+aKeywordTable[aSlot[i]].prefix);
 		j++;
 		if( j>12 ){
 			printf("\n");
 			j = 0;
 		}
 	}
-	printf("%s  };\n", j==0 ? "" : "\n");    
+	printf("%s  };\n", j==0 ? "" : "\n");
 
 	printf("  static const unsigned short int %saOffset[%d] = {\n", prefix ? prefix : "", nKeyword);
 	for(i=j=0; i<nKeyword; i++){
 		if( j==0 ) printf("    ");
-		printf(" %3d,", aKeywordTable[i].offset);
+		printf(" %3d,", aKeywordTable[aSlot[i]].offset);
 		j++;
 		if( j>12 ){
 			printf("\n");
@@ -463,22 +502,14 @@ main (int argc, char **argv)
 	printf("%s  };\n", j==0 ? "" : "\n");
 
 
-	printf("  int h, i;\n");
+	printf("  unsigned int i;\n");
 	printf("  if( n<2 ) return 0;\n");
-	printf("  h = ((charMap(z[0])*4) ^\n"
-	       "      (charMap(z[n-1])*3) ^\n"
-	       "      n) %% %d;\n", bestSize);
-	printf("  for(i=((int)%saHash[h])-1; i>=0; i=((int)%saNext[i])-1){\n",
-	       prefix ? prefix : "", prefix ? prefix : "");
-	printf("    if( %saLen[i]==n &&"
-	       " casecmp(&%szText[%saOffset[i]],z,n)==0 ){\n",
+	printf("  i = %skeywordHash(%saSeed[%skeywordHash(0, z, n) %% %d], z, n) %% %d;\n",
+	       prefix ? prefix : "", prefix ? prefix : "", prefix ? prefix : "", nBucket, nKeyword);
+	printf("  return %saLen[i]==n && casecmp(&%szText[%saOffset[i]],z,n)==0;\n",
 	       prefix ? prefix : "",
 	       prefix ? prefix : "",
 	       prefix ? prefix : "");
-	printf("      return 1;\n");
-	printf("    }\n");
-	printf("  }\n");
-	printf("  return 0;\n");
 	printf("}\n");
 	printf("\nstatic gboolean\n%sis_keyword (const char *z)\n{\n", prefix ? prefix : "");
 	printf("\treturn %skeywordCode(z, strlen (z));\n", prefix ? prefix : "");
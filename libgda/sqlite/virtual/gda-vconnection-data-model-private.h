@@ -37,6 +37,7 @@ typedef struct GdaVConnectionTableData GdaVConnectionTableData;
 typedef struct VContext VContext;
 typedef struct ExecContext ExecContext;
 typedef struct VirtualFilteredData VirtualFilteredData;
+typedef struct VirtualIndex VirtualIndex;
 
 struct VContext{
 	GWeakRef                 context_object;
@@ -71,6 +72,7 @@ struct VirtualFilteredData {
 	/* data */
 	GdaDataModel *model;
 	GdaDataModelIter *iter; /* not NULL while nrows == -1 */
+	GArray          *rows; /* model's row numbers selected using an automatic index, or %NULL */
 	GPtrArray       *values_array;
 	gint          ncols;
 	gint          nrows; /* -1 until known */
@@ -90,12 +92,19 @@ struct GdaVConnectionTableData {
 	GdaSet                      *modif_params[PARAMS_NB];
 
 	ExecContext                  context; /* not a pointer! */
+
+	/* automatic indexes, for data models which don't handle filtering themselves */
+	GHashTable                  *indexes; /* key = column number + 1, value = a VirtualIndex */
+	GdaDataModel                *indexed_model; /* no ref held */
+	gulong                       indexed_model_changed_sigid;
+	gulong                       indexed_model_reset_sigid;
 };
 
 
 void                     _gda_vconnection_virtual_filtered_data_unref (VirtualFilteredData *data);
 
 void                     _gda_vconnection_data_model_table_data_free (GdaVConnectionTableData *td);
+void                     _gda_vconnection_data_model_table_data_clear_indexes (GdaVConnectionTableData *td);
 
 GdaVConnectionTableData *_gda_vconnection_get_table_data_by_name (GdaVconnectionDataModel *cnc, const gchar *table_name);
 GdaVConnectionTableData *_gda_vconnection_get_table_data_by_model (GdaVconnectionDataModel *cnc, GdaDataModel *model);
@@ -553,6 +553,7 @@ _gda_vconnection_data_model_table_data_free (GdaVConnectionTableData *td)
 {
 	ParamType i;
 
+	_gda_vconnection_data_model_table_data_clear_indexes (td);
 	if (td->real_model)
 		g_object_unref (td->real_model);
 	if (td->columns) {
@@ -575,6 +576,26 @@ _gda_vconnection_data_model_table_data_free (GdaVConnectionTableData *td)
 	g_free (td);
 }
 
+/*
+ * Removes all the automatic indexes computed for @td, and stops monitoring the
+ * associated data model's changes
+ */
+void
+_gda_vconnection_data_model_table_data_clear_indexes (GdaVConnectionTableData *td)
+{
+	if (td->indexed_model) {
+		g_signal_handler_disconnect (td->indexed_model, td->indexed_model_changed_sigid);
+		g_signal_handler_disconnect (td->indexed_model, td->indexed_model_reset_sigid);
+		td->indexed_model = NULL;
+		td->indexed_model_changed_sigid = 0;
+		td->indexed_model_reset_sigid = 0;
+	}
+	if (td->indexes) {
+		g_hash_table_destroy (td->indexes);
+		td->indexes = NULL;
+	}
+}
+
 static void
 vcontext_free (VContext *context)
 {
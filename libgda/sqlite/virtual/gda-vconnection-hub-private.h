@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2007 - 2011 Vivien Malerba <malerba@gnome-db.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __GDA_VCONNECTION_HUB_PRIVATE_H__
+#define __GDA_VCONNECTION_HUB_PRIVATE_H__
+
+#include "gda-vconnection-hub.h"
+
+G_BEGIN_DECLS
+
+void _gda_vconnection_hub_statement_started (GdaVconnectionHub *hub, GdaStatement *stmt);
+
+G_END_DECLS
+
+#endif
@@ -24,6 +24,7 @@
 #include <glib/gi18n-lib.h>
 #include <string.h>
 #include "gda-vconnection-hub.h"
+#include "gda-vconnection-hub-private.h"
 #include "gda-virtual-provider.h"
 #include <libgda/sql-parser/gda-sql-parser.h>
 #include <libgda/gda-util.h>
@@ -46,6 +47,11 @@ static void detach_hub_connection (GdaVconnectionHub *hub, HubConnection *hc);
 typedef struct {
 	GSList        *hub_connections; /* list of HubConnection structures */
 	GdaSqlParser *internal_parser;
+
+	/* batched key lookups */
+	guint         batch_size; /* 0 if disabled */
+	guint         stmt_serial; /* incremented each time a statement is executed */
+	gboolean      batch_allowed; /* TRUE while the last executed statement is a SELECT */
 } GdaVconnectionHubPrivate;
 
 static void gda_vconnection_hub_dispose   (GObject *object);
@@ -73,6 +79,9 @@ gda_vconnection_hub_init (GdaVconnectionHub *cnc)
 	GdaVconnectionHubPrivate *priv = gda_vconnection_hub_get_instance_private (cnc);
 	priv->hub_connections = NULL;
 	priv->internal_parser = gda_sql_parser_new ();;
+	priv->batch_size = 0;
+	priv->stmt_serial = 0;
+	priv->batch_allowed = FALSE;
 }
 
 static void
@@ -270,6 +279,71 @@ gda_vconnection_hub_foreach (GdaVconnectionHub *hub,
 	}
 }
 
+/**
+ * gda_vconnection_hub_set_batch_size:
+ * @hub: a #GdaVconnectionHub connection
+ * @batch_size: the maximum number of rows fetched at once for a key lookup, or 0 to disable batching
+ *
+ * When a virtual table representing a table of a connection bound in @hub is accessed using a single
+ * equality constraint on an integer column (which is what happens for the inner table of a nested loop
+ * join on that column), SQLite looks up the matching rows once for each row of the outer table, which
+ * by default results in one query executed by the bound connection for each outer row.
+ *
+ * If @batch_size is greater than 0, then the rows fetched for each looked up key are kept in memory for the
+ * duration of the SELECT statement being executed, so looking up the same key again does not require any query.
+ * Moreover, when the looked up keys are ascending (which is what happens when the outer table is scanned
+ * in the order of the key), the matching rows are fetched in batches of up to
+ * @batch_size rows, ordered by key (as "SELECT ... WHERE key &gt;= ##value ORDER BY key LIMIT @batch_size"),
+ * so subsequent lookups for keys in the same range don't require any query; this stops as soon as a fetched
+ * range has not been used by any lookup. Other keys are looked up one at a time, as SQLite only provides the
+ * outer table's keys one after the other.
+ *
+ * Batching is only used when executing SELECT statements.
+ *
+ * Since: 6.0
+ */
+void
+gda_vconnection_hub_set_batch_size (GdaVconnectionHub *hub, guint batch_size)
+{
+	g_return_if_fail (GDA_IS_VCONNECTION_HUB (hub));
+	GdaVconnectionHubPrivate *priv = gda_vconnection_hub_get_instance_private (hub);
+	priv->batch_size = batch_size;
+	priv->stmt_serial ++;
+}
+
+/**
+ * gda_vconnection_hub_get_batch_size:
+ * @hub: a #GdaVconnectionHub connection
+ *
+ * Get the batch size used for key lookups, see gda_vconnection_hub_set_batch_size().
+ *
+ * Returns: the batch size, or 0 if batching is disabled
+ *
+ * Since: 6.0
+ */
+guint
+gda_vconnection_hub_get_batch_size (GdaVconnectionHub *hub)
+{
+	g_return_val_if_fail (GDA_IS_VCONNECTION_HUB (hub), 0);
+	GdaVconnectionHubPrivate *priv = gda_vconnection_hub_get_instance_private (hub);
+	return priv->batch_size;
+}
+
+/*
+ * Called by the #GdaVproviderHub each time a statement is about to be executed by @hub:
+ * data fetched for batched key lookups is not kept from one statement to the other
+ */
+void
+_gda_vconnection_hub_statement_started (GdaVconnectionHub *hub, GdaStatement *stmt)
+{
+	GdaSqlStatementType type;
+	GdaVconnectionHubPrivate *priv = gda_vconnection_hub_get_instance_private (hub);
+
+	type = gda_statement_get_statement_type (stmt);
+	priv->stmt_serial ++;
+	priv->batch_allowed = (type == GDA_SQL_STATEMENT_SELECT) || (type == GDA_SQL_STATEMENT_COMPOUND);
+}
+
 static void meta_changed_cb (GdaMetaStore *store, GSList *changes, HubConnection *hc);
 
 typedef struct {
@@ -284,8 +358,27 @@ typedef struct {
 	gchar        **col_dtypes;/* free using g_strfreev */
 
 	GHashTable    *filters_hash; /* key = string; value = a ComputedFilter pointer */
+
+	/* batched key lookups, see gda_vconnection_hub_set_batch_size() */
+	guint          keys_serial; /* hub's statement serial when the rows below have been fetched */
+	GHashTable    *keys_hash; /* key = a gint64 pointer, value = a GPtrArray of #GdaRow */
+	GArray        *keys_ranges; /* array of KeyRange, sorted and not overlapping */
+	GType         *keys_col_types; /* types of the fetched values */
+	guint          keys_nrows;
+	gboolean       keys_has_last;
+	gint64         keys_last; /* last looked up key */
+	guint          keys_ascending; /* number of consecutive lookups of ascending keys */
+	gint           keys_range_hits; /* lookups answered since the last range fetch, or -1 */
 } LocalSpec;
 
+typedef struct {
+	gint64   low;
+	gint64   high; /* excluded */
+	gboolean unbounded; /* if %TRUE, then @high is ignored */
+} KeyRange;
+
+static void key_buffer_clear (LocalSpec *lspec);
+
 static void local_spec_free (LocalSpec *spec)
 {
 	gda_value_free (spec->table_name);
@@ -298,6 +391,7 @@ static void local_spec_free (LocalSpec *spec)
 	g_clear_error (&(spec->cols_error));
 	if (spec->filters_hash)
 		g_hash_table_destroy (spec->filters_hash);
+	key_buffer_clear (spec);
 	g_free (spec);
 }
 
@@ -408,16 +502,28 @@ typedef struct {
 	GdaStatement *stmt;
 	int orderByConsumed;
 	struct GdaVirtualConstraintUsage *out_const;
+
+	gint key_column; /* column of the single EQ constraint on an integer column, or -1 */
+	GdaStatement *batch_stmt; /* statement used for batched key lookups, or %NULL */
+	guint batch_stmt_size; /* LIMIT value used in @batch_stmt */
 } ComputedFilter;
 
 static void
 computed_filter_free (ComputedFilter *filter)
 {
 	g_object_unref (filter->stmt);
+	if (filter->batch_stmt)
+		g_object_unref (filter->batch_stmt);
 	g_free (filter->out_const);
 	g_free (filter);
 }
 
+static gboolean
+type_is_batchable_key (GType type)
+{
+	return (type == G_TYPE_INT) || (type == G_TYPE_INT64) || (type == G_TYPE_UINT);
+}
+
 static void
 dict_table_create_filter (GdaVconnectionDataModelSpec *spec, GdaVconnectionDataModelFilter *info)
 {
@@ -455,7 +561,7 @@ dict_table_create_filter (GdaVconnectionDataModelSpec *spec, GdaVconnectionDataM
 					      NULL);
 
 	/* WHERE part */
-	gint argpos;
+	gint argpos, key_column = -1;
 	GdaSqlBuilderId *op_ids;
 	op_ids = g_new (GdaSqlBuilderId, info->nConstraint);
 	for (i = 0, argpos = 0; i < info->nConstraint; i++) {
@@ -484,8 +590,13 @@ dict_table_create_filter (GdaVconnectionDataModelSpec *spec, GdaVconnectionDataM
 		/* update info->aConstraintUsage */
 		info->aConstraintUsage [i].argvIndex = argpos+1;
 		info->aConstraintUsage [i].omit = 1;
+		if ((argpos == 0) && (cons->op == GDA_SQL_OPERATOR_TYPE_EQ) &&
+		    type_is_batchable_key (lspec->col_gtypes[cons->iColumn]))
+			key_column = cons->iColumn;
 		argpos++;
 	}
+	if ((argpos != 1) || (info->nOrderBy > 0))
+		key_column = -1;
 	if (argpos > 0) {
 		GdaSqlBuilderId whid;
 		whid = gda_sql_builder_add_cond_v (b, GDA_SQL_OPERATOR_TYPE_AND, op_ids, argpos);
@@ -520,6 +631,7 @@ dict_table_create_filter (GdaVconnectionDataModelSpec *spec, GdaVconnectionDataM
 		filter = g_new0 (ComputedFilter, 1);
 		filter->stmt = stmt;
 		filter->orderByConsumed = info->orderByConsumed;
+		filter->key_column = key_column;
 		filter->out_const = g_new (struct GdaVirtualConstraintUsage,  info->nConstraint);
 		memcpy (filter->out_const,
 			info->aConstraintUsage,
@@ -705,6 +817,398 @@ create_value_from_sqlite3_gvalue (GType type, GValue *svalue, GError **error)
 		return value;
 }
 
+/*
+ * Batched key lookups
+ *
+ * Rows fetched for a key lookup are kept (as #GdaRow objects) in @lspec->keys_hash, grouped by key, and
+ * @lspec->keys_ranges lists the key ranges for which all the rows have been fetched (a key in one
+ * of these ranges and not in @lspec->keys_hash has no matching row).
+ */
+#define KEY_BUFFER_MAX_ROWS_FACTOR 100
+
+/* keys are fetched by ranges after KEY_ASCENDING_MIN_RUN consecutive lookups of ascending keys */
+#define KEY_ASCENDING_MIN_RUN 2
+
+static void
+key_buffer_rows_free (GPtrArray *rows)
+{
+	g_ptr_array_free (rows, TRUE);
+}
+
+static void
+key_buffer_clear (LocalSpec *lspec)
+{
+	if (lspec->keys_hash) {
+		g_hash_table_destroy (lspec->keys_hash);
+		lspec->keys_hash = NULL;
+	}
+	if (lspec->keys_ranges) {
+		g_array_free (lspec->keys_ranges, TRUE);
+		lspec->keys_ranges = NULL;
+	}
+	g_free (lspec->keys_col_types);
+	lspec->keys_col_types = NULL;
+	lspec->keys_nrows = 0;
+	lspec->keys_has_last = FALSE;
+	lspec->keys_ascending = 0;
+	lspec->keys_range_hits = -1;
+}
+
+static gboolean
+value_to_key (const GValue *value, gint64 *key)
+{
+	if (!value)
+		return FALSE;
+	if (G_VALUE_TYPE (value) == G_TYPE_INT)
+		*key = g_value_get_int (value);
+	else if (G_VALUE_TYPE (value) == G_TYPE_INT64)
+		*key = g_value_get_int64 (value);
+	else if (G_VALUE_TYPE (value) == G_TYPE_UINT)
+		*key = g_value_get_uint (value);
+	else
+		return FALSE;
+	return TRUE;
+}
+
+/*
+ * Returns: %TRUE if all the rows for @key have already been fetched, in which case @out_rows
+ * is set (to %NULL if there is no row for @key)
+ */
+static gboolean
+key_buffer_lookup (LocalSpec *lspec, gint64 key, GPtrArray **out_rows)
+{
+	*out_rows = NULL;
+	if (!lspec->keys_hash)
+		return FALSE;
+	*out_rows = g_hash_table_lookup (lspec->keys_hash, &key);
+	if (*out_rows)
+		return TRUE;
+
+	/* binary search in the ranges */
+	gint low = 0, high = (gint) lspec->keys_ranges->len - 1;
+	while (low <= high) {
+		gint mid;
+		KeyRange *range;
+		mid = low + (high - low) / 2;
+		range = &g_array_index (lspec->keys_ranges, KeyRange, mid);
+		if (key < range->low)
+			high = mid - 1;
+		else if (range->unbounded || (key < range->high))
+			return TRUE;
+		else
+			low = mid + 1;
+	}
+	return FALSE;
+}
+
+static gint
+key_range_compare_func (gconstpointer a, gconstpointer b)
+{
+	const KeyRange *r1 = a;
+	const KeyRange *r2 = b;
+	return r1->low < r2->low ? -1 : (r1->low == r2->low ? 0 : 1);
+}
+
+/*
+ * Adds a range and merges overlapping ranges
+ */
+static void
+key_buffer_add_range (LocalSpec *lspec, KeyRange *range)
+{
+	GArray *merged;
+	guint i;
+
+	g_array_append_val (lspec->keys_ranges, *range);
+	g_array_sort (lspec->keys_ranges, key_range_compare_func);
+
+	merged = g_array_sized_new (FALSE, FALSE, sizeof (KeyRange), lspec->keys_ranges->len);
+	for (i = 0; i < lspec->keys_ranges->len; i++) {
+		KeyRange *r = &g_array_index (lspec->keys_ranges, KeyRange, i);
+		if (merged->len > 0) {
+			KeyRange *last = &g_array_index (merged, KeyRange, merged->len - 1);
+			if (last->unbounded)
+				continue;
+			if (r->low <= last->high) {
+				if (r->unbounded)
+					last->unbounded = TRUE;
+				else if (r->high > last->high)
+					last->high = r->high;
+				continue;
+			}
+		}
+		g_array_append_val (merged, *r);
+	}
+	g_array_free (lspec->keys_ranges, TRUE);
+	lspec->keys_ranges = merged;
+}
+
+static GdaStatement *
+key_buffer_get_batch_statement (LocalSpec *lspec, ComputedFilter *filter, guint batch_size)
+{
+	GdaSqlBuilder *b;
+	GdaSqlBuilderId fid, pid;
+	gint i;
+
+	if (filter->batch_stmt && (filter->batch_stmt_size == batch_size))
+		return filter->batch_stmt;
+	if (filter->batch_stmt) {
+		g_object_unref (filter->batch_stmt);
+		filter->batch_stmt = NULL;
+	}
+
+	b = gda_sql_builder_new (GDA_SQL_STATEMENT_SELECT);
+	for (i = 0; i < lspec->ncols; i++)
+		gda_sql_builder_select_add_field (b, lspec->col_names[i], NULL, NULL);
+	gda_sql_builder_select_add_target_id (b,
+					      gda_sql_builder_add_id (b, g_value_get_string (lspec->table_name)),
+					      NULL);
+	fid = gda_sql_builder_add_id (b, lspec->col_names[filter->key_column]);
+	pid = gda_sql_builder_add_param (b, "param0", lspec->col_gtypes[filter->key_column], FALSE);
+	gda_sql_builder_set_where (b, gda_sql_builder_add_cond (b, GDA_SQL_OPERATOR_TYPE_GEQ, fid, pid, 0));
+	gda_sql_builder_select_order_by (b, gda_sql_builder_add_id (b, lspec->col_names[filter->key_column]),
+					 TRUE, NULL);
+	gda_sql_builder_select_set_limit (b, gda_sql_builder_add_expr (b, NULL, G_TYPE_UINT, batch_size), 0);
+	filter->batch_stmt = gda_sql_builder_get_statement (b, NULL);
+	filter->batch_stmt_size = batch_size;
+	g_object_unref (b);
+
+	return filter->batch_stmt;
+}
+
+/*
+ * Fetches the rows for keys starting at @key, or only for @key if @batch_size is 0
+ *
+ * Returns: %TRUE if all the rows for @key have been fetched
+ */
+static gboolean
+key_buffer_fetch (LocalSpec *lspec, ComputedFilter *filter, gint64 key, GValue *svalue, guint batch_size)
+{
+	GdaStatement *stmt;
+	GdaSet *params = NULL;
+	GdaHolder *holder;
+	GValue *value;
+	GdaDataModel *model;
+	GdaDataModelIter *iter;
+	GError *lerror = NULL;
+
+	/* @filter's own statement is "SELECT ... WHERE key = ##param0" */
+	stmt = batch_size > 0 ? key_buffer_get_batch_statement (lspec, filter, batch_size) : filter->stmt;
+	if (!stmt || ! gda_statement_get_parameters (stmt, &params, NULL) || !params)
+		return FALSE;
+	holder = gda_set_get_holder (params, "param0");
+	value = holder ? create_value_from_sqlite3_gvalue (gda_holder_get_g_type (holder), svalue, NULL) : NULL;
+	if (!value || ! gda_holder_take_value (holder, value, NULL)) {
+		g_object_unref (params);
+		return FALSE;
+	}
+
+	model = gda_connection_statement_execute_select_full (lspec->hc->cnc, stmt, params,
+							      GDA_STATEMENT_MODEL_CURSOR_FORWARD, NULL,
+							      &lerror);
+	g_object_unref (params);
+	if (!model) {
+		gda_log_message ("Virtual table: batched key lookup error: %s",
+				 lerror && lerror->message ? lerror->message : "no detail");
+		g_clear_error (&lerror);
+		return FALSE;
+	}
+
+	/* read all the rows */
+	GPtrArray *rows;
+	GArray *keys;
+	guint nrows;
+	gboolean allok = TRUE;
+	rows = g_ptr_array_new_with_free_func (g_object_unref);
+	keys = g_array_new (FALSE, FALSE, sizeof (gint64));
+	iter = gda_data_model_create_iter (model);
+	while (gda_data_model_iter_move_next (iter)) {
+		GdaRow *row;
+		gint64 rkey;
+		gint i;
+		if (! value_to_key (gda_data_model_iter_get_value_at (iter, filter->key_column), &rkey)) {
+			allok = FALSE;
+			break;
+		}
+		row = gda_row_new (lspec->ncols);
+		for (i = 0; i < lspec->ncols; i++) {
+			const GValue *cvalue;
+			cvalue = gda_data_model_iter_get_value_at (iter, i);
+			if (cvalue && (G_VALUE_TYPE (cvalue) != 0)) {
+				GValue *dest;
+				dest = gda_row_get_value (row, i);
+				g_value_init (dest, G_VALUE_TYPE (cvalue));
+				g_value_copy (cvalue, dest);
+			}
+		}
+		g_ptr_array_add (rows, row);
+		g_array_append_val (keys, rkey);
+	}
+	g_object_unref (iter);
+	nrows = rows->len;
+
+	if (gda_data_model_get_exceptions (model))
+		allok = FALSE;
+	if (allok && !lspec->keys_col_types) {
+		gint i;
+		lspec->keys_col_types = g_new (GType, lspec->ncols);
+		for (i = 0; i < lspec->ncols; i++) {
+			GdaColumn *column;
+			column = gda_data_model_describe_column (model, i);
+			lspec->keys_col_types[i] = column ? gda_column_get_g_type (column) : GDA_TYPE_NULL;
+			if ((lspec->keys_col_types[i] == GDA_TYPE_NULL) || (lspec->keys_col_types[i] == G_TYPE_INVALID))
+				lspec->keys_col_types[i] = lspec->col_gtypes[i];
+		}
+	}
+	g_object_unref (model);
+
+	/* compute the range of keys for which all the rows have been fetched */
+	KeyRange range;
+	range.low = key;
+	range.high = key;
+	range.unbounded = FALSE;
+	if (allok && (batch_size == 0)) {
+		guint i;
+		range.high = key + 1;
+		for (i = 0; i < nrows; i++) {
+			if (g_array_index (keys, gint64, i) != key)
+				allok = FALSE;
+		}
+	}
+	else if (allok) {
+		if (nrows < batch_size)
+			range.unbounded = TRUE;
+		else {
+			/* the rows for the last key may not all have been fetched */
+			range.high = g_array_index (keys, gint64, nrows - 1);
+			if (range.high <= key)
+				allok = FALSE; /* all the rows have the same key */
+		}
+	}
+
+	if (allok) {
+		guint i;
+		GPtrArray *krows = NULL; /* rows for the current key, or %NULL if they must be ignored */
+		if (!lspec->keys_hash) {
+			lspec->keys_hash = g_hash_table_new_full (g_int64_hash, g_int64_equal,
+								  g_free, (GDestroyNotify) key_buffer_rows_free);
+			lspec->keys_ranges = g_array_new (FALSE, FALSE, sizeof (KeyRange));
+		}
+		for (i = 0; i < nrows; i++) {
+			gint64 rkey;
+			rkey = g_array_index (keys, gint64, i);
+			if ((i == 0) || (g_array_index (keys, gint64, i - 1) != rkey)) {
+				/* first row for @rkey: ignore rows for keys which are either already known
+				 * or for which not all the rows have been fetched */
+				krows = NULL;
+				if ((range.unbounded || (rkey < range.high)) &&
+				    ! g_hash_table_lookup (lspec->keys_hash, &rkey)) {
+					gint64 *pkey;
+					pkey = g_new (gint64, 1);
+					*pkey = rkey;
+					krows = g_ptr_array_new_with_free_func (g_object_unref);
+					g_hash_table_insert (lspec->keys_hash, pkey, krows);
+				}
+			}
+			if (krows) {
+				g_ptr_array_add (krows, g_object_ref (g_ptr_array_index (rows, i)));
+				lspec->keys_nrows ++;
+			}
+		}
+		key_buffer_add_range (lspec, &range);
+	}
+	g_ptr_array_free (rows, TRUE);
+	g_array_free (keys, TRUE);
+
+	return allok;
+}
+
+/*
+ * Creates a new data model containing @rows
+ */
+static GdaDataModel *
+key_buffer_make_model (LocalSpec *lspec, GPtrArray *rows)
+{
+	GdaDataModel *model;
+	guint i;
+
+	model = gda_data_model_array_new_with_g_types_v (lspec->ncols,
+							 lspec->keys_col_types ? lspec->keys_col_types : lspec->col_gtypes);
+	for (i = 0; rows && (i < rows->len); i++) {
+		GdaRow *row;
+		GList *values = NULL;
+		gint j;
+		row = g_ptr_array_index (rows, i);
+		for (j = lspec->ncols - 1; j >= 0; j--) {
+			GValue *value;
+			value = gda_row_get_value (row, j);
+			values = g_list_prepend (values, G_VALUE_TYPE (value) != 0 ? value : NULL);
+		}
+		gda_data_model_append_values (model, values, NULL);
+		g_list_free (values);
+	}
+	g_object_set (model, "read-only", TRUE, NULL);
+	return model;
+}
+
+static gboolean
+find_filter_for_stmt_func (G_GNUC_UNUSED gpointer key, ComputedFilter *filter, GdaStatement *stmt)
+{
+	return filter->stmt == stmt;
+}
+
+/*
+ * Returns: a new data model, or %NULL if batched key lookups can't be used
+ */
+static GdaDataModel *
+batched_key_lookup (LocalSpec *lspec, GdaStatement *stmt, GValue *svalue)
+{
+	GdaVconnectionHubPrivate *priv = gda_vconnection_hub_get_instance_private (lspec->hc->hub);
+	ComputedFilter *filter;
+	GPtrArray *rows;
+	gint64 key;
+
+	if (!priv->batch_allowed || (priv->batch_size == 0) || !lspec->filters_hash)
+		return NULL;
+	filter = g_hash_table_find (lspec->filters_hash, (GHRFunc) find_filter_for_stmt_func, stmt);
+	if (!filter || (filter->key_column < 0))
+		return NULL;
+	if (!svalue || (G_VALUE_TYPE (svalue) != G_TYPE_INT64))
+		return NULL;
+	key = g_value_get_int64 (svalue);
+
+	if ((lspec->keys_serial != priv->stmt_serial) ||
+	    (lspec->keys_nrows > priv->batch_size * KEY_BUFFER_MAX_ROWS_FACTOR)) {
+		key_buffer_clear (lspec);
+		lspec->keys_serial = priv->stmt_serial;
+	}
+
+	/* detect keys looked up in ascending order */
+	if (lspec->keys_has_last && (key >= lspec->keys_last))
+		lspec->keys_ascending ++;
+	else
+		lspec->keys_ascending = 0;
+	lspec->keys_has_last = TRUE;
+	lspec->keys_last = key;
+
+	if (! key_buffer_lookup (lspec, key, &rows)) {
+		guint batch_size;
+
+		/* fetching a range of keys is only useful if the next keys looked up are in that range:
+		 * if the previous range was of no use, look up this key alone and retry with a range next time */
+		if ((lspec->keys_ascending >= KEY_ASCENDING_MIN_RUN) && (lspec->keys_range_hits != 0))
+			batch_size = priv->batch_size;
+		else
+			batch_size = 0;
+		if (! key_buffer_fetch (lspec, filter, key, svalue, batch_size) ||
+		    ! key_buffer_lookup (lspec, key, &rows))
+			return NULL;
+		lspec->keys_range_hits = (batch_size > 0) ? 0 : -1;
+	}
+	else if (lspec->keys_range_hits >= 0)
+		lspec->keys_range_hits ++;
+	return key_buffer_make_model (lspec, rows);
+}
+
 static GdaDataModel *
 dict_table_create_model_func (GdaVconnectionDataModelSpec *spec, G_GNUC_UNUSED int idxNum, const char *idxStr,
 			      int argc, GValue **argv)
@@ -714,6 +1218,12 @@ dict_table_create_model_func (GdaVconnectionDataModelSpec *spec, G_GNUC_UNUSED i
 	GdaSet *params = NULL;
 	LocalSpec *lspec = (LocalSpec *) spec;
 
+	if (idxStr && (argc == 1)) {
+		model = batched_key_lookup (lspec, (GdaStatement*) idxStr, argv [0]);
+		if (model)
+			return model;
+	}
+
 	if (idxStr) {
 		gint i;
 		GSList *list;
@@ -921,6 +1431,7 @@ table_add (HubConnection *hc, const GValue *table_name, GError **error)
 	GDA_VCONNECTION_DATA_MODEL_SPEC (lspec)->create_filtered_model_func = dict_table_create_model_func;
 	lspec->table_name = gda_value_copy (table_name);
 	lspec->hc = hc;
+	lspec->keys_range_hits = -1;
 	tmp = get_complete_table_name (hc, lspec->table_name);
 	/*g_print ("%s (HC=%p, table_name=%s) name=%s\n", __FUNCTION__, hc, g_value_get_string (table_name), tmp);*/
 	if (!gda_vconnection_data_model_add (GDA_VCONNECTION_DATA_MODEL (hc->hub), (GdaVconnectionDataModelSpec*) lspec,
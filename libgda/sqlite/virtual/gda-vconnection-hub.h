@@ -65,6 +65,8 @@ gboolean            gda_vconnection_hub_remove         (GdaVconnectionHub *hub,
 GdaConnection      *gda_vconnection_hub_get_connection (GdaVconnectionHub *hub, const gchar *ns);
 void                gda_vconnection_hub_foreach        (GdaVconnectionHub *hub, 
 							GdaVConnectionHubFunc func, gpointer data);
+void                gda_vconnection_hub_set_batch_size (GdaVconnectionHub *hub, guint batch_size);
+guint               gda_vconnection_hub_get_batch_size (GdaVconnectionHub *hub);
 
 G_END_DECLS
 
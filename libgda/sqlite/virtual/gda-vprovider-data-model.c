@@ -22,6 +22,9 @@
 
 #include <glib/gi18n-lib.h>
 #include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <math.h>
 #include "gda-vprovider-data-model.h"
 #include "gda-vconnection-data-model.h"
 #include "gda-vconnection-data-model-private.h"
@@ -194,9 +197,13 @@ struct VirtualCursor {
 
 
 
+/*
+ * @rows: (transfer full) (nullable): the model's row numbers to iterate on, or %NULL to iterate on all the rows
+ */
 static VirtualFilteredData *
 virtual_filtered_data_new (VirtualTable *vtable, GdaDataModel *model,
-			   int idxNum, const char *idxStr, int argc, sqlite3_value **argv)
+			   int idxNum, const char *idxStr, int argc, sqlite3_value **argv,
+			   GArray *rows)
 {
 	VirtualFilteredData *data;
 	GdaSqliteProvider *prov = GDA_SQLITE_PROVIDER (gda_connection_get_provider (GDA_CONNECTION (vtable->cnc)));
@@ -210,19 +217,23 @@ virtual_filtered_data_new (VirtualTable *vtable, GdaDataModel *model,
 	data->argc = argc;
 	data->argv = create_gvalues_array_from_sqlite3_array (prov, argc, argv);
 	data->model = g_object_ref (model);
-	if (GDA_IS_DATA_PROXY (model))
-		data->iter = g_object_new (GDA_TYPE_DATA_MODEL_ITER,
-					   "data-model", model, NULL);
-	else
-		data->iter = gda_data_model_create_iter (model);
-	g_object_set (data->iter, "validate-changes", FALSE, NULL);
+	if (rows)
+		data->rows = rows;
+	else {
+		if (GDA_IS_DATA_PROXY (model))
+			data->iter = g_object_new (GDA_TYPE_DATA_MODEL_ITER,
+						   "data-model", model, NULL);
+		else
+			data->iter = gda_data_model_create_iter (model);
+		g_object_set (data->iter, "validate-changes", FALSE, NULL);
+	}
 
 	gint n;
 	n = gda_data_model_get_n_columns (model);
 	n = (n >= 0) ? n : 1;
 	data->values_array = g_ptr_array_new_full (1, (GDestroyNotify) gda_value_free);
 	data->ncols = gda_data_model_get_n_columns (model);
-	data->nrows = -1;
+	data->nrows = rows ? (gint) rows->len : -1;
 	data->rowid_offset = vtable->rows_offset;
 	vtable->rows_offset ++;
 	
@@ -249,6 +260,8 @@ virtual_filtered_data_free (VirtualFilteredData *data)
 	g_object_unref (data->model);
 	if (data->iter)
 		g_object_unref (data->iter);
+	if (data->rows)
+		g_array_free (data->rows, TRUE);
 
 	if (data->values_array) {
 		g_ptr_array_free (data->values_array, TRUE);
@@ -908,6 +921,27 @@ virtualNext (sqlite3_vtab_cursor *cur)
 			}
 		}
 	}
+	else if (data->rows && (cursor->row < data->nrows) &&
+		 (data->values_array->len < (guint) ((cursor->row + 1) * data->ncols))) {
+		/* load data for the row selected by an automatic index */
+		gint mrow, col;
+		mrow = g_array_index (data->rows, gint, cursor->row);
+		for (col = 0; col < data->ncols; col++) {
+			const GValue *cvalue;
+			GError *lerror = NULL;
+			cvalue = gda_data_model_get_value_at (data->model, col, mrow, &lerror);
+			if (cvalue && (G_VALUE_TYPE (cvalue) != 0)) {
+				GValue *copy = gda_value_new (G_VALUE_TYPE (cvalue));
+				g_value_copy (cvalue, copy);
+				g_ptr_array_insert (data->values_array, -1, copy);
+			}
+			else {
+				GValue *value = gda_value_new (G_TYPE_ERROR);
+				g_value_take_boxed (value, lerror);
+				g_ptr_array_insert (data->values_array, -1, value);
+			}
+		}
+	}
 	return SQLITE_OK;
 
  onerror:
@@ -977,8 +1011,12 @@ virtualColumn (sqlite3_vtab_cursor *cur, sqlite3_context *ctx, int i)
 	TRACE (cur->pVtab, cur);
 	
 	if (i == ((VirtualTable*) cur->pVtab)->td->n_columns) {
-		/* private hidden column, which returns the row number */
-		SQLITE3_CALL (prov, sqlite3_result_int) (ctx, cursor->row);
+		/* private hidden column, which returns the row number in the data model */
+		if (cursor->data->rows)
+			SQLITE3_CALL (prov, sqlite3_result_int) (ctx, g_array_index (cursor->data->rows,
+										     gint, cursor->row));
+		else
+			SQLITE3_CALL (prov, sqlite3_result_int) (ctx, cursor->row);
 		return SQLITE_OK;
 	}
 
@@ -1168,6 +1206,576 @@ virtual_table_manage_real_data_model (VirtualTable *vtable, int idxNum, const ch
 #endif
 }
 
+/*
+ * Automatic indexes
+ *
+ * When a virtual table is backed by a data model which does not handle any filtering itself (i.e. when the
+ * table has been created using gda_vconnection_data_model_add_model()), SQLite has to scan the whole data
+ * model each time the table is accessed, which makes joins between data models really slow (each
+ * join is a nested loop over all the rows of the inner data model).
+ *
+ * For such tables, and if the data model can be accessed randomly, indexes are computed on demand:
+ *  - a hash index, to handle EQ constraints
+ *  - an ordered index, to handle range constraints (on numerical columns only) and ORDER BY on a single column
+ *
+ * All the indexes of a table are discarded whenever the data model changes.
+ *
+ * The indexes only need to return a superset of the rows matching the constraints because SQLite
+ * always double checks the constraints (the "omit" attribute is never set).
+ *
+ * The plan chosen in virtualBestIndex() is encoded in @idxNum (AUTO_INDEX_IDXNUM + column number) and
+ * in @idxStr, which contains one character per constraint value passed to virtualFilter():
+ *  - 'e': EQ constraint
+ *  - 'g', 'G': GT and GE constraints
+ *  - 'l', 'L': LT and LE constraints
+ * optionally followed by 'o' or 'O' if the rows must be returned sorted by ascending (resp. descending) order.
+ */
+#define AUTO_INDEX_IDXNUM 0x40000000
+#define AUTO_INDEX_UNKNOWN_NROWS 1000000
+
+typedef enum {
+	INDEX_CLASS_NULL,
+	INDEX_CLASS_NUMBER,
+	INDEX_CLASS_TEXT,
+	INDEX_CLASS_BINARY
+} IndexValueClass;
+
+typedef struct {
+	IndexValueClass  cls;
+	gboolean         is_int;
+	gint64           inum;
+	gdouble          num;
+	gchar           *key; /* for INDEX_CLASS_TEXT */
+	gint             row;
+} IndexEntry;
+
+struct VirtualIndex {
+	gint        column;
+	gint        nrows; /* number of rows of the data model when the index was computed */
+	gboolean    locale_collation;
+	GHashTable *hash; /* key = a normalized value as a string, value = a GArray of row numbers */
+	guint       hash_size; /* number of distinct keys */
+	IndexEntry *sorted; /* @nrows entries, or %NULL if not yet computed */
+};
+
+static void
+virtual_index_free (VirtualIndex *index)
+{
+	if (index->hash)
+		g_hash_table_destroy (index->hash);
+	if (index->sorted) {
+		gint i;
+		for (i = 0; i < index->nrows; i++)
+			g_free (index->sorted[i].key);
+		g_free (index->sorted);
+	}
+	g_free (index);
+}
+
+/*
+ * Tells if @text can be read as a number by SQLite
+ */
+static gboolean
+index_text_to_number (const gchar *text, gboolean *is_int, gint64 *inum, gdouble *num)
+{
+	gchar *endptr;
+	const gchar *ptr;
+
+	for (ptr = text; *ptr && g_ascii_isspace (*ptr); ptr++);
+	if (!*ptr)
+		return FALSE;
+
+	errno = 0;
+	*inum = g_ascii_strtoll (ptr, &endptr, 10);
+	for (; *endptr && g_ascii_isspace (*endptr); endptr++);
+	if (!*endptr && (errno != ERANGE)) {
+		*is_int = TRUE;
+		*num = (gdouble) *inum;
+		return TRUE;
+	}
+
+	errno = 0;
+	*num = g_ascii_strtod (ptr, &endptr);
+	for (; *endptr && g_ascii_isspace (*endptr); endptr++);
+	if (*endptr || (errno == ERANGE) || isnan (*num) || isinf (*num))
+		return FALSE;
+	*is_int = FALSE;
+	return TRUE;
+}
+
+/*
+ * Fills @entry with @value, as it is returned to SQLite by virtualColumn(), except that
+ * if @numeric_text is %TRUE, then texts which can be converted to numbers are returned as numbers.
+ */
+static void
+index_entry_set_value (IndexEntry *entry, const GValue *value, gboolean locale_collation, gboolean numeric_text)
+{
+	GType type;
+
+	entry->key = NULL;
+	entry->is_int = FALSE;
+	if (!value || gda_value_is_null (value) || (G_VALUE_TYPE (value) == G_TYPE_ERROR)) {
+		entry->cls = INDEX_CLASS_NULL;
+		return;
+	}
+
+	type = G_VALUE_TYPE (value);
+	entry->cls = INDEX_CLASS_NUMBER;
+	if (type == G_TYPE_INT) {
+		entry->is_int = TRUE;
+		entry->inum = g_value_get_int (value);
+		entry->num = (gdouble) entry->inum;
+	}
+	else if (type == G_TYPE_INT64) {
+		entry->is_int = TRUE;
+		entry->inum = g_value_get_int64 (value);
+		entry->num = (gdouble) entry->inum;
+	}
+	else if (type == G_TYPE_DOUBLE)
+		entry->num = g_value_get_double (value);
+	else if ((type == GDA_TYPE_BLOB) || (type == GDA_TYPE_BINARY))
+		entry->cls = INDEX_CLASS_BINARY;
+	else {
+		gchar *str;
+		str = gda_value_stringify (value);
+		if (numeric_text && index_text_to_number (str, &(entry->is_int), &(entry->inum), &(entry->num)))
+			g_free (str);
+		else {
+			entry->cls = INDEX_CLASS_TEXT;
+			if (locale_collation) {
+				entry->key = g_utf8_collate_key (str, -1);
+				g_free (str);
+			}
+			else
+				entry->key = str;
+		}
+	}
+}
+
+/*
+ * Compares two entries using SQLite's ordering rules
+ */
+static gint
+index_entry_compare (const IndexEntry *e1, const IndexEntry *e2)
+{
+	if (e1->cls != e2->cls)
+		return e1->cls < e2->cls ? -1 : 1;
+	switch (e1->cls) {
+	case INDEX_CLASS_NUMBER:
+		if (e1->is_int && e2->is_int)
+			return e1->inum < e2->inum ? -1 : (e1->inum == e2->inum ? 0 : 1);
+		return e1->num < e2->num ? -1 : (e1->num == e2->num ? 0 : 1);
+	case INDEX_CLASS_TEXT:
+		return strcmp (e1->key, e2->key);
+	default:
+		return 0;
+	}
+}
+
+static gint
+index_entry_sort_func (gconstpointer a, gconstpointer b)
+{
+	gint res;
+	res = index_entry_compare ((const IndexEntry*) a, (const IndexEntry*) b);
+	if (res == 0)
+		res = ((const IndexEntry*) a)->row - ((const IndexEntry*) b)->row;
+	return res;
+}
+
+/*
+ * Computes a string such that if SQLite considers two values as equal, then they have
+ * the same key.
+ *
+ * Returns: (transfer full) (nullable): a new string, or %NULL if @value can't be equal to anything
+ */
+static gchar *
+index_hash_key_from_value (const GValue *value)
+{
+	IndexEntry entry;
+	gchar *key = NULL;
+
+	/* use the "LOCALE" collation, as 2 strings equal for the "BINARY" collation are also equal
+	 * for the "LOCALE" collation */
+	index_entry_set_value (&entry, value, TRUE, TRUE);
+	if (entry.cls == INDEX_CLASS_NUMBER) {
+		gchar buf [G_ASCII_DTOSTR_BUF_SIZE];
+		if (entry.num == 0.)
+			entry.num = 0.; /* -0 */
+		key = g_strconcat ("n", g_ascii_dtostr (buf, sizeof (buf), entry.num), NULL);
+	}
+	else if (entry.cls == INDEX_CLASS_TEXT)
+		key = g_strconcat ("s", entry.key, NULL);
+	g_free (entry.key);
+	return key;
+}
+
+static gboolean
+column_is_indexable (GdaColumn *column)
+{
+	GType type;
+	if (!column)
+		return FALSE;
+	type = gda_column_get_g_type (column);
+	return (type != GDA_TYPE_BLOB) && (type != GDA_TYPE_BINARY) && (type != GDA_TYPE_NULL);
+}
+
+/*
+ * Range constraints are only handled for columns whose values are passed to SQLite as numbers, for which
+ * there is no collation involved
+ */
+static gboolean
+column_is_numeric (GdaColumn *column)
+{
+	GType type;
+	if (!column)
+		return FALSE;
+	type = gda_column_get_g_type (column);
+	return (type == G_TYPE_INT) || (type == G_TYPE_INT64) || (type == G_TYPE_DOUBLE);
+}
+
+/*
+ * Returns: %TRUE if automatic indexes can be used for @vtable
+ */
+static gboolean
+virtual_table_can_use_indexes (VirtualTable *vtable)
+{
+	GdaDataModel *model;
+	model = vtable->td->spec->data_model;
+	if (!model || vtable->td->spec->create_filter_func)
+		return FALSE;
+	if (! (gda_data_model_get_access_flags (model) & GDA_DATA_MODEL_ACCESS_RANDOM))
+		return FALSE;
+	return gda_data_model_get_n_rows (model) >= 0;
+}
+
+static void
+indexed_model_changed_cb (G_GNUC_UNUSED GdaDataModel *model, GdaVConnectionTableData *td)
+{
+	if (td->indexes)
+		g_hash_table_remove_all (td->indexes);
+}
+
+/*
+ * Get the index for @column, computing it if necessary.
+ *
+ * Returns: (transfer none): the index
+ */
+static VirtualIndex *
+virtual_table_get_index (VirtualTable *vtable, gint column, gboolean sorted)
+{
+	GdaVConnectionTableData *td = vtable->td;
+	GdaDataModel *model = td->spec->data_model;
+	VirtualIndex *index = NULL;
+	gint nrows, i;
+
+	if (!td->indexes) {
+		td->indexes = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+						     NULL, (GDestroyNotify) virtual_index_free);
+		td->indexed_model = model;
+		td->indexed_model_changed_sigid = g_signal_connect (model, "changed",
+								    G_CALLBACK (indexed_model_changed_cb), td);
+		td->indexed_model_reset_sigid = g_signal_connect (model, "reset",
+								  G_CALLBACK (indexed_model_changed_cb), td);
+	}
+
+	nrows = gda_data_model_get_n_rows (model);
+	index = g_hash_table_lookup (td->indexes, GINT_TO_POINTER (column + 1));
+	if (index && (index->nrows != nrows)) {
+		/* "changed" signals may not have been emitted */
+		g_hash_table_remove (td->indexes, GINT_TO_POINTER (column + 1));
+		index = NULL;
+	}
+	if (!index) {
+		GdaColumn *gcol;
+		index = g_new0 (VirtualIndex, 1);
+		index->column = column;
+		index->nrows = nrows;
+		gcol = gda_data_model_describe_column (model, column);
+		index->locale_collation = gcol && (gda_column_get_g_type (gcol) == G_TYPE_STRING);
+		g_hash_table_insert (td->indexes, GINT_TO_POINTER (column + 1), index);
+	}
+
+	if (sorted) {
+		if (!index->sorted) {
+			index->sorted = g_new (IndexEntry, MAX (nrows, 1));
+			for (i = 0; i < nrows; i++) {
+				const GValue *value;
+				value = gda_data_model_get_value_at (model, column, i, NULL);
+				index_entry_set_value (&(index->sorted[i]), value, index->locale_collation, FALSE);
+				index->sorted[i].row = i;
+			}
+			qsort (index->sorted, nrows, sizeof (IndexEntry), index_entry_sort_func);
+		}
+	}
+	else if (!index->hash) {
+		index->hash = g_hash_table_new_full (g_str_hash, g_str_equal,
+						     g_free, (GDestroyNotify) g_array_unref);
+		for (i = 0; i < nrows; i++) {
+			const GValue *value;
+			gchar *key;
+			GArray *array;
+			value = gda_data_model_get_value_at (model, column, i, NULL);
+			key = index_hash_key_from_value (value);
+			if (!key)
+				continue;
+			array = g_hash_table_lookup (index->hash, key);
+			if (array)
+				g_free (key);
+			else {
+				array = g_array_new (FALSE, FALSE, sizeof (gint));
+				g_hash_table_insert (index->hash, key, array);
+			}
+			g_array_append_val (array, i);
+		}
+		index->hash_size = g_hash_table_size (index->hash);
+	}
+
+	return index;
+}
+
+/*
+ * Returns: the position of the 1st entry in @index's sorted entries which is greater than (or equal to
+ * if @inclusive is %TRUE) @probe
+ */
+static gint
+virtual_index_lower_bound (VirtualIndex *index, const IndexEntry *probe, gboolean inclusive)
+{
+	gint low = 0, high = index->nrows;
+	while (low < high) {
+		gint mid, res;
+		mid = low + (high - low) / 2;
+		res = index_entry_compare (&(index->sorted[mid]), probe);
+		if ((res < 0) || (!inclusive && (res == 0)))
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return low;
+}
+
+/*
+ * Computes the list of the data model's rows to return for the plan chosen in virtualBestIndex()
+ *
+ * Returns: (transfer full): a new array of row numbers
+ */
+static GArray *
+virtual_table_compute_rows_from_index (VirtualTable *vtable, int idxNum, const char *idxStr,
+				       int argc, GValue **argv)
+{
+	gint column, i;
+	gboolean sorted = FALSE, desc = FALSE, eq = FALSE;
+	GArray *rows;
+
+	column = idxNum - AUTO_INDEX_IDXNUM;
+	for (i = 0; idxStr && idxStr[i]; i++) {
+		if (idxStr[i] == 'e')
+			eq = TRUE;
+		else if (idxStr[i] == 'o')
+			sorted = TRUE;
+		else if (idxStr[i] == 'O')
+			sorted = desc = TRUE;
+		else
+			sorted = TRUE; /* range constraints */
+	}
+	if (eq) {
+		VirtualIndex *index;
+		gchar *key;
+		GArray *array = NULL;
+
+		index = virtual_table_get_index (vtable, column, FALSE);
+		key = (argc > 0) ? index_hash_key_from_value (argv[0]) : NULL;
+		if (key) {
+			array = g_hash_table_lookup (index->hash, key);
+			g_free (key);
+		}
+		rows = g_array_sized_new (FALSE, FALSE, sizeof (gint), array ? array->len : 0);
+		if (array)
+			g_array_append_vals (rows, array->data, array->len);
+		return rows;
+	}
+
+	g_assert (sorted);
+	VirtualIndex *index;
+	gint start, end;
+	index = virtual_table_get_index (vtable, column, TRUE);
+	start = 0;
+	end = index->nrows;
+	for (i = 0; (i < argc) && idxStr[i]; i++) {
+		IndexEntry probe;
+		gint pos;
+		gchar op = idxStr[i];
+		if ((op == 'o') || (op == 'O'))
+			break;
+
+		/* range constraints never match NULL values */
+		probe.cls = INDEX_CLASS_NULL;
+		pos = virtual_index_lower_bound (index, &probe, FALSE);
+		start = MAX (start, pos);
+
+		index_entry_set_value (&probe, argv[i], index->locale_collation, TRUE);
+		if (probe.cls == INDEX_CLASS_NULL) {
+			/* comparison with NULL is never TRUE */
+			end = start;
+		}
+		else if ((op == 'g') || (op == 'G')) {
+			pos = virtual_index_lower_bound (index, &probe, op == 'G');
+			start = MAX (start, pos);
+		}
+		else {
+			pos = virtual_index_lower_bound (index, &probe, op == 'l');
+			end = MIN (end, pos);
+		}
+		g_free (probe.key);
+	}
+
+	rows = g_array_sized_new (FALSE, FALSE, sizeof (gint), end > start ? end - start : 0);
+	if (desc) {
+		for (i = end - 1; i >= start; i--)
+			g_array_append_val (rows, index->sorted[i].row);
+	}
+	else {
+		for (i = start; i < end; i++)
+			g_array_append_val (rows, index->sorted[i].row);
+	}
+	return rows;
+}
+
+/*
+ * Maps a RowID as returned by virtualRowid() to a row number in the data model
+ */
+static gint
+virtual_table_rowid_to_model_row (VirtualTable *vtable, gint64 rowid)
+{
+	gint row;
+	row = (gint) (rowid & 0xFFFFFFFF);
+
+	if (!vtable->td->context.current_vcontext)
+		return row;
+	GPtrArray *values_array = vtable->td->context.current_vcontext->context_data;
+	if (values_array) {
+		guint i;
+		for (i = 0; i < values_array->len; i++) {
+			VirtualFilteredData *vd;
+			vd = g_ptr_array_index (values_array, i);
+			if (vd->rowid_offset == (guint32) (rowid >> 32)) {
+				if (vd->rows && (row >= 0) && ((guint) row < vd->rows->len))
+					row = g_array_index (vd->rows, gint, row);
+				break;
+			}
+		}
+	}
+	return row;
+}
+
+/*
+ * Chooses an automatic index to use, if any
+ */
+static void
+virtual_table_best_index (VirtualTable *vtable, sqlite3_index_info *pIdxInfo)
+{
+	GdaSqliteProvider *prov = GDA_SQLITE_PROVIDER (gda_connection_get_provider (GDA_CONNECTION (vtable->cnc)));
+	GdaDataModel *model = vtable->td->spec->data_model;
+	gint nrows, nc, column = -1;
+	gint lower = -1, upper = -1, eq = -1;
+	gchar order = 0;
+	gdouble nrows_d, est_rows;
+
+	nrows = gda_data_model_get_n_rows (model);
+	nrows_d = nrows >= 0 ? (gdouble) nrows : (gdouble) AUTO_INDEX_UNKNOWN_NROWS;
+	pIdxInfo->estimatedCost = nrows_d;
+	pIdxInfo->estimatedRows = (sqlite3_int64) nrows_d;
+
+	if (! virtual_table_can_use_indexes (vtable))
+		return;
+
+	/* EQ constraint */
+	for (nc = 0; nc < pIdxInfo->nConstraint; nc++) {
+		struct sqlite3_index_constraint *cons = &(pIdxInfo->aConstraint[nc]);
+		if (!cons->usable || (cons->op != SQLITE_INDEX_CONSTRAINT_EQ) ||
+		    (cons->iColumn < 0) || (cons->iColumn >= vtable->td->n_columns) ||
+		    ! column_is_indexable (gda_data_model_describe_column (model, cons->iColumn)))
+			continue;
+		eq = nc;
+		column = cons->iColumn;
+		break;
+	}
+
+	if (eq < 0) {
+		/* range constraints, on the ORDER BY column if possible */
+		gint ocol = -1;
+		if ((pIdxInfo->nOrderBy == 1) && (pIdxInfo->aOrderBy[0].iColumn >= 0) &&
+		    (pIdxInfo->aOrderBy[0].iColumn < vtable->td->n_columns) &&
+		    column_is_indexable (gda_data_model_describe_column (model, pIdxInfo->aOrderBy[0].iColumn)))
+			ocol = pIdxInfo->aOrderBy[0].iColumn;
+		for (nc = 0; nc < pIdxInfo->nConstraint; nc++) {
+			struct sqlite3_index_constraint *cons = &(pIdxInfo->aConstraint[nc]);
+			if (!cons->usable || (cons->iColumn < 0) || (cons->iColumn >= vtable->td->n_columns) ||
+			    ((column >= 0) && (cons->iColumn != column)) ||
+			    ((column < 0) && (ocol >= 0) && (cons->iColumn != ocol)) ||
+			    ! column_is_numeric (gda_data_model_describe_column (model, cons->iColumn)))
+				continue;
+			if (((cons->op == SQLITE_INDEX_CONSTRAINT_GT) || (cons->op == SQLITE_INDEX_CONSTRAINT_GE)) &&
+			    (lower < 0)) {
+				lower = nc;
+				column = cons->iColumn;
+			}
+			else if (((cons->op == SQLITE_INDEX_CONSTRAINT_LT) || (cons->op == SQLITE_INDEX_CONSTRAINT_LE)) &&
+				 (upper < 0)) {
+				upper = nc;
+				column = cons->iColumn;
+			}
+		}
+		if ((ocol >= 0) && ((column < 0) || (column == ocol))) {
+			column = ocol;
+			order = pIdxInfo->aOrderBy[0].desc ? 'O' : 'o';
+		}
+	}
+
+	if (column < 0)
+		return;
+
+	/* compute plan */
+	GString *string;
+	gint argv_index = 1;
+	string = g_string_new ("");
+	if (eq >= 0) {
+		VirtualIndex *index = NULL;
+		pIdxInfo->aConstraintUsage[eq].argvIndex = argv_index++;
+		g_string_append_c (string, 'e');
+		if (vtable->td->indexes)
+			index = g_hash_table_lookup (vtable->td->indexes, GINT_TO_POINTER (column + 1));
+		if (index && index->hash && (index->hash_size > 0))
+			est_rows = nrows_d / index->hash_size;
+		else
+			est_rows = 10.;
+		pIdxInfo->estimatedCost = (gdouble) g_bit_storage ((gulong) nrows_d) + est_rows;
+	}
+	else {
+		est_rows = nrows_d;
+		if (lower >= 0) {
+			pIdxInfo->aConstraintUsage[lower].argvIndex = argv_index++;
+			g_string_append_c (string, pIdxInfo->aConstraint[lower].op == SQLITE_INDEX_CONSTRAINT_GT ? 'g' : 'G');
+			est_rows /= 3.;
+		}
+		if (upper >= 0) {
+			pIdxInfo->aConstraintUsage[upper].argvIndex = argv_index++;
+			g_string_append_c (string, pIdxInfo->aConstraint[upper].op == SQLITE_INDEX_CONSTRAINT_LT ? 'l' : 'L');
+			est_rows /= 3.;
+		}
+		if (order) {
+			g_string_append_c (string, order);
+			pIdxInfo->orderByConsumed = 1;
+		}
+		pIdxInfo->estimatedCost = (est_rows < nrows_d) ? (gdouble) g_bit_storage ((gulong) nrows_d) + est_rows : nrows_d;
+	}
+
+	pIdxInfo->estimatedRows = (sqlite3_int64) MAX (est_rows, 1.);
+	pIdxInfo->idxNum = AUTO_INDEX_IDXNUM + column;
+	pIdxInfo->idxStr = SQLITE3_CALL (prov, sqlite3_mprintf) ("%s", string->str);
+	pIdxInfo->needToFreeIdxStr = 1;
+	g_string_free (string, TRUE);
+}
+
 static int
 virtualFilter (sqlite3_vtab_cursor *pVtabCursor, int idxNum, const char *idxStr, int argc, sqlite3_value **argv)
 {
@@ -1233,10 +1841,22 @@ virtualFilter (sqlite3_vtab_cursor *pVtabCursor, int idxNum, const char *idxStr,
 #endif
 
 	if (!data && values_array != NULL) {
+		GArray *rows = NULL;
 		virtual_table_manage_real_data_model (vtable, idxNum, idxStr, argc, argv);
 		if (! vtable->td->real_model)
 			return SQLITE_ERROR;
-		data = virtual_filtered_data_new (vtable, vtable->td->real_model, idxNum, idxStr, argc, argv);
+		if ((idxNum >= AUTO_INDEX_IDXNUM) && virtual_table_can_use_indexes (vtable)) {
+			GValue **gargv;
+			gargv = create_gvalues_array_from_sqlite3_array (prov, argc, argv);
+			rows = virtual_table_compute_rows_from_index (vtable, idxNum, idxStr, argc, gargv);
+			if (gargv) {
+				gint i;
+				for (i = 0; i < argc; i++)
+					gda_value_free (gargv[i]);
+				g_free (gargv);
+			}
+		}
+		data = virtual_filtered_data_new (vtable, vtable->td->real_model, idxNum, idxStr, argc, argv, rows);
 		g_ptr_array_insert (values_array, -1, data);
 #ifdef DEBUG_VCONTEXT
 		g_print ("VData %p prepended to array %p wt %d\n", data, values_array,
@@ -1413,6 +2033,12 @@ virtualBestIndex (sqlite3_vtab *tab, sqlite3_index_info *pIdxInfo)
 		index_info_dump (pIdxInfo, TRUE);
 #endif
 	}
+	else if (vtable->td->spec->data_model) {
+		virtual_table_best_index (vtable, pIdxInfo);
+#ifdef GDA_DEBUG_VIRTUAL
+		index_info_dump (pIdxInfo, TRUE);
+#endif
+	}
 
 	return SQLITE_OK;
 }
@@ -1668,7 +2294,7 @@ virtualUpdate (sqlite3_vtab *tab, int nData, sqlite3_value **apData, sqlite_int6
 	if (optype == 1) {
 		/* DELETE */
 		if (SQLITE3_CALL (prov, sqlite3_value_type) (apData[0]) == SQLITE_INTEGER) {
-			gint rowid = SQLITE3_CALL (prov, sqlite3_value_int) (apData [0]);
+			gint rowid = virtual_table_rowid_to_model_row (vtable, SQLITE3_CALL (prov, sqlite3_value_int64) (apData [0]));
 			return gda_data_model_remove_row (vtable->td->real_model, rowid, NULL) ?
 				SQLITE_OK : SQLITE_READONLY;
 		}
@@ -1712,7 +2338,7 @@ virtualUpdate (sqlite3_vtab *tab, int nData, sqlite3_value **apData, sqlite_int6
 		for (i = 2; i < (nData - 1); i++) {
 			GValue *value;
 			GType type;
-			gint rowid = SQLITE3_CALL (prov, sqlite3_value_int) (apData [0]);
+			gint rowid = virtual_table_rowid_to_model_row (vtable, SQLITE3_CALL (prov, sqlite3_value_int64) (apData [0]));
 			gboolean res;
 			GError *error = NULL;
 
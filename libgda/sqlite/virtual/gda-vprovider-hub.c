@@ -22,6 +22,7 @@
 #include <string.h>
 #include "gda-vprovider-hub.h"
 #include "gda-vconnection-hub.h"
+#include "gda-vconnection-hub-private.h"
 #include <libgda/gda-debug-macros.h>
 #include <libgda/gda-server-provider-impl.h>
 
@@ -43,6 +44,11 @@ G_DEFINE_TYPE_WITH_PRIVATE (GdaVproviderHub, gda_vprovider_hub, GDA_TYPE_VPROVID
 static GdaConnection *gda_vprovider_hub_create_connection (GdaServerProvider *provider);
 static gboolean       gda_vprovider_hub_close_connection (GdaServerProvider *provider, GdaConnection *cnc);
 static const gchar   *gda_vprovider_hub_get_name (GdaServerProvider *provider);
+static GObject       *gda_vprovider_hub_statement_execute (GdaServerProvider *provider, GdaConnection *cnc,
+							    GdaStatement *stmt, GdaSet *params,
+							    GdaStatementModelUsage model_usage,
+							    GType *col_types, GdaSet **last_inserted_row,
+							    GError **error);
 
 
 /*
@@ -77,7 +83,7 @@ static GdaServerProviderBase hub_base_functions = {
 	NULL,
 	NULL,
 	NULL,
-	NULL,
+	gda_vprovider_hub_statement_execute,
 
 	NULL, NULL, NULL, NULL, /* padding */
 };
@@ -141,3 +147,19 @@ gda_vprovider_hub_get_name (G_GNUC_UNUSED GdaServerProvider *provider)
 {
 	return "Virtual hub";
 }
+
+static GObject *
+gda_vprovider_hub_statement_execute (GdaServerProvider *provider, GdaConnection *cnc,
+				     GdaStatement *stmt, GdaSet *params,
+				     GdaStatementModelUsage model_usage,
+				     GType *col_types, GdaSet **last_inserted_row, GError **error)
+{
+	g_return_val_if_fail (GDA_IS_VCONNECTION_HUB (cnc), NULL);
+	_gda_vconnection_hub_statement_started (GDA_VCONNECTION_HUB (cnc), stmt);
+
+	GdaServerProviderBase *parent_functions;
+	parent_functions = gda_server_provider_get_impl_functions_for_class (gda_vprovider_hub_parent_class, GDA_SERVER_PROVIDER_FUNCTIONS_BASE);
+	return parent_functions->statement_execute (provider, cnc, stmt, params,
+						    model_usage, col_types,
+						    last_inserted_row, error);
+}
@@ -351,6 +351,7 @@ gda_ldap_provider_prepare_connection (GdaServerProvider *provider, GdaConnection
         const gchar *pwd = NULL;
         const gchar *time_limit = NULL;
         const gchar *size_limit = NULL;
+        const gchar *page_size = NULL;
         const gchar *tls_method = NULL;
         const gchar *tls_cacert = NULL;
 	int rtls_method = -1;
@@ -415,6 +416,7 @@ gda_ldap_provider_prepare_connection (GdaServerProvider *provider, GdaConnection
 	}
 	time_limit = gda_quark_list_find (params, "TIME_LIMIT");
 	size_limit = gda_quark_list_find (params, "SIZE_LIMIT");
+	page_size = gda_quark_list_find (params, "PAGE_SIZE");
 
 	/* open LDAP connection */
 	LdapConnectionData *cdata;
@@ -499,6 +501,11 @@ gda_ldap_provider_prepare_connection (GdaServerProvider *provider, GdaConnection
 	cdata->url = url;
 	cdata->time_limit = 0;
 	cdata->size_limit = 0;
+	cdata->page_size = GDA_LDAP_DEFAULT_PAGE_SIZE;
+	if (page_size && *page_size) {
+		int size = atoi (page_size);
+		cdata->page_size = size > 0 ? size : 0;
+	}
 	cdata->base_dn = g_strdup (base_dn);
 	if (use_cache)
 		cdata->attributes_cache_file = compute_data_file_name (params, TRUE, "attrs");
@@ -28,6 +28,9 @@
  */
 #define LDAP_PROVIDER_NAME "Ldap"
 
+/* default number of entries requested at once using the paged results control (RFC 2696) */
+#define GDA_LDAP_DEFAULT_PAGE_SIZE 1000
+
 #include <ldap.h>
 #include <ldap_schema.h>
 #include <glib.h>
@@ -61,6 +64,7 @@ typedef struct {
 
 	int           time_limit;
 	int           size_limit;
+	int           page_size; /* for paged results, 0 if not used */
 
 	GHashTable   *attributes_hash; /* key = attribute name, value = a #LdapAttribute */
 	gchar        *attributes_cache_file;
@@ -57,10 +57,14 @@ struct _LdapPart {
 				    * opportunity of being computed */
 
 	/* result of execution, both %NULL if data was truncated when executing */
-	LDAPMessage     *ldap_msg;
+	LDAPMessage     *ldap_msg; /* when using paged results, only the current page */
 	gint             nb_entries;
 	LDAPMessage     *ldap_row; /* no ref! */
 
+	/* paged results (RFC 2696) */
+	struct berval   *cookie; /* to request the next page, %NULL if there is no more page */
+	int              next_msgid; /* message ID of the next page's search already sent, or -1 */
+
 	/* tree-like structure */
 	GSList          *children; /* list of #LdapPart, ref held there */
 	LdapPart        *parent; /* no ref held */
@@ -100,6 +104,7 @@ struct _GdaDataModelLdapPrivate {
 	gchar              *filter;
 	GArray             *attributes;
 	GdaLdapSearchScope  scope;
+	gint                page_size; /* 0 if paged results are not used */
 	MultipleValueAction default_mv_action;
 	GList              *columns;
 	GArray             *column_mv_actions; /* array of #MultipleValueAction, notincluding column 0 */
@@ -242,6 +247,7 @@ gda_data_model_ldap_init (GdaDataModelLdap *model,
 	
 	model->priv->n_columns = g_list_length (model->priv->columns);
 	model->priv->scope = GDA_LDAP_SEARCH_BASE;
+	model->priv->page_size = -1; /* use the connection's setting */
 }
 
 static void
@@ -1007,11 +1013,162 @@ typedef struct {
 	GdaDataModelLdap *model;
 } WorkerSearchData;
 
+/*
+ * Sends the search request for @part (for its next page if paged results are used)
+ */
+static int
+ldap_part_send_search (GdaDataModelLdap *model, LdapConnectionData *cdata, LdapPart *part, int *out_msgid)
+{
+	LDAPControl *ctrls[2] = {NULL, NULL};
+	int lscope, res;
+
+	switch (part->scope) {
+	default:
+	case GDA_LDAP_SEARCH_BASE:
+		lscope = LDAP_SCOPE_BASE;
+		break;
+	case GDA_LDAP_SEARCH_ONELEVEL:
+		lscope = LDAP_SCOPE_ONELEVEL;
+		break;
+	case GDA_LDAP_SEARCH_SUBTREE:
+		lscope = LDAP_SCOPE_SUBTREE;
+		break;
+	}
+
+	if (model->priv->page_size > 0) {
+		/* not critical: servers not supporting it return all the entries at once */
+		res = ldap_create_page_control (cdata->handle, model->priv->page_size, part->cookie, 0, &ctrls[0]);
+		if (res != LDAP_SUCCESS)
+			return res;
+	}
+
+	res = ldap_search_ext (cdata->handle, part->base_dn, lscope,
+			       model->priv->filter,
+			       (char**) model->priv->attributes->data, 0,
+			       ctrls[0] ? ctrls : NULL, NULL, NULL, -1,
+			       out_msgid);
+	if (ctrls[0])
+		ldap_control_free (ctrls[0]);
+	return res;
+}
+
+/*
+ * Waits for the result of the search identified by @msgid, and updates @part's cookie
+ * for the next page, if any.
+ *
+ * Returns: the search's result code
+ */
+static int
+ldap_part_receive_page (LdapConnectionData *cdata, LdapPart *part, int msgid, LDAPMessage **out_msg)
+{
+	LDAPMessage *msg = NULL;
+	LDAPControl **sctrls = NULL;
+	int rc, res;
+
+	*out_msg = NULL;
+	if (part->cookie) {
+		ber_bvfree (part->cookie);
+		part->cookie = NULL;
+	}
+
+	rc = ldap_result (cdata->handle, msgid, LDAP_MSG_ALL, NULL, &msg);
+	if (rc <= 0) {
+		if (msg)
+			ldap_msgfree (msg);
+		ldap_get_option (cdata->handle, LDAP_OPT_RESULT_CODE, &res);
+		return (res == LDAP_SUCCESS) ? LDAP_OTHER : res;
+	}
+
+	rc = ldap_parse_result (cdata->handle, msg, &res, NULL, NULL, NULL, &sctrls, 0);
+	if (rc != LDAP_SUCCESS) {
+		ldap_msgfree (msg);
+		return rc;
+	}
+
+	if (sctrls) {
+		LDAPControl *pctrl;
+		pctrl = ldap_control_find (LDAP_CONTROL_PAGEDRESULTS, sctrls, NULL);
+		if (pctrl) {
+			struct berval cookie = {0, NULL};
+			ber_int_t count;
+			if ((ldap_parse_pageresponse_control (cdata->handle, pctrl, &count, &cookie) == LDAP_SUCCESS) &&
+			    (cookie.bv_len > 0))
+				part->cookie = ber_bvdup (&cookie);
+			if (cookie.bv_val)
+				ber_memfree (cookie.bv_val);
+		}
+		ldap_controls_free (sctrls);
+	}
+
+	*out_msg = msg;
+	return res;
+}
+
+/*
+ * Requests the next page of @part, if any, without waiting for the result, so the server
+ * prepares it while the current page is being read
+ */
+static void
+ldap_part_prefetch_next_page (GdaDataModelLdap *model, LdapConnectionData *cdata, LdapPart *part)
+{
+	if (part->cookie && (part->next_msgid < 0)) {
+		if (ldap_part_send_search (model, cdata, part, &part->next_msgid) != LDAP_SUCCESS)
+			part->next_msgid = -1; /* sent again when the page is actually needed */
+	}
+}
+
+/*
+ * Replaces @part's current page with the next one
+ *
+ * Returns: %TRUE if @part->ldap_msg now contains the next page
+ */
+static gboolean
+ldap_part_fetch_next_page (GdaDataModelLdap *model, LdapConnectionData *cdata, LdapPart *part)
+{
+	LDAPMessage *msg;
+	int msgid, res;
+
+	if (part->next_msgid < 0) {
+		res = ldap_part_send_search (model, cdata, part, &msgid);
+		if (res != LDAP_SUCCESS)
+			goto onerror;
+	}
+	else {
+		msgid = part->next_msgid;
+		part->next_msgid = -1;
+	}
+
+	res = ldap_part_receive_page (cdata, part, msgid, &msg);
+	if ((res != LDAP_SUCCESS) && (res != LDAP_NO_SUCH_OBJECT)) {
+		if (msg)
+			ldap_msgfree (msg);
+		goto onerror;
+	}
+
+	ldap_msgfree (part->ldap_msg);
+	part->ldap_msg = msg;
+	part->ldap_row = NULL;
+	part->nb_entries = ldap_count_entries (cdata->handle, msg);
+	ldap_part_prefetch_next_page (model, cdata, part);
+	return TRUE;
+
+ onerror:
+	if (part->cookie) {
+		ber_bvfree (part->cookie);
+		part->cookie = NULL;
+	}
+	GError *e = NULL;
+	g_set_error (&e, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_OTHER_ERROR,
+		     "%s", ldap_err2string (res));
+	add_exception (model, e);
+	return FALSE;
+}
+
 static gpointer
 worker_execute_ldap_search (WorkerSearchData *data, GError **error)
 {
 	LDAPMessage *msg = NULL;
-	int lscope, res = 0;
+	int msgid, res = 0;
 
 	GError *e = NULL;
 	if (! gda_ldap_ensure_bound (data->cnc, &e)) {
@@ -1022,19 +1179,6 @@ worker_execute_ldap_search (WorkerSearchData *data, GError **error)
 	g_assert (data->model->priv->current_exec);
 	g_assert (! data->model->priv->current_exec->executed);
 
-	switch (data->model->priv->current_exec->scope) {
-	default:
-	case GDA_LDAP_SEARCH_BASE:
-		lscope = LDAP_SCOPE_BASE;
-		break;
-	case GDA_LDAP_SEARCH_ONELEVEL:
-		lscope = LDAP_SCOPE_ONELEVEL;
-		break;
-	case GDA_LDAP_SEARCH_SUBTREE:
-		lscope = LDAP_SCOPE_SUBTREE;
-		break;
-	}
-	
 #ifdef GDA_DEBUG_SUBSEARCHES
 	if (data->model->priv->scope == GDA_LDAP_SEARCH_SUBTREE) {
 		g_print ("Model %p model->priv->top_exec:\n", data->model);
@@ -1058,11 +1202,9 @@ worker_execute_ldap_search (WorkerSearchData *data, GError **error)
 	retry:
 #endif
 	gda_ldap_execution_slowdown (data->cnc);
-	res = ldap_search_ext_s (data->cdata->handle, data->model->priv->current_exec->base_dn, lscope,
-				 data->model->priv->filter,
-				 (char**) data->model->priv->attributes->data, 0,
-				 NULL, NULL, NULL, -1,
-				 &msg);
+	res = ldap_part_send_search (data->model, data->cdata, data->model->priv->current_exec, &msgid);
+	if (res == LDAP_SUCCESS)
+		res = ldap_part_receive_page (data->cdata, data->model->priv->current_exec, msgid, &msg);
 	data->model->priv->current_exec->executed = TRUE;
 
 #define GDA_DEBUG_FORCE_ERROR
@@ -1088,6 +1230,8 @@ worker_execute_ldap_search (WorkerSearchData *data, GError **error)
 		/* keep the connection opened for this LdapPart */
 		data->cdata->keep_bound_count ++;
 
+		ldap_part_prefetch_next_page (data->model, data->cdata, data->model->priv->current_exec);
+
 #ifdef GDA_DEBUG_SUBSEARCHES
 		g_print ("model->priv->current_exec->nb_entries = %d\n",
 			 data->model->priv->current_exec->nb_entries);
@@ -1103,6 +1247,10 @@ worker_execute_ldap_search (WorkerSearchData *data, GError **error)
 		if ((data->cdata->time_limit == 0) && (data->cdata->size_limit == 0) &&
 		    (data->model->priv->scope == GDA_LDAP_SEARCH_SUBTREE)) {
 			gboolean split_error;
+			if (data->model->priv->current_exec->cookie) {
+				ber_bvfree (data->model->priv->current_exec->cookie);
+				data->model->priv->current_exec->cookie = NULL;
+			}
 			if (ldap_part_split (data->model->priv->current_exec, data->model, &split_error)) {
 				/* create some children to re-run the search */
 				if (msg)
@@ -1146,11 +1294,11 @@ worker_execute_ldap_search (WorkerSearchData *data, GError **error)
 			}
 		}
 		/* error */
+		if (msg)
+			ldap_msgfree (msg);
 		GError *e = NULL;
-		int ldap_errno;
-		ldap_get_option (data->cdata->handle, LDAP_OPT_ERROR_NUMBER, &ldap_errno);
 		g_set_error (&e, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_OTHER_ERROR,
-			     "%s", ldap_err2string (ldap_errno));
+			     "%s", ldap_err2string (res));
 		add_exception (data->model, e);
 		gda_ldap_may_unbind (data->cnc);
 		return NULL;
@@ -1250,6 +1398,8 @@ worker_gda_data_model_ldap_iter_next (WorkerIterData *data, GError **error)
 		data->imodel->priv->base_dn = g_strdup (data->cdata->base_dn);
 	if (! data->imodel->priv->attributes)
 		data->imodel->priv->attributes = g_array_new (TRUE, FALSE, sizeof (gchar*));
+	if (data->imodel->priv->page_size < 0)
+		data->imodel->priv->page_size = data->cdata->page_size;
 	if (! data->imodel->priv->top_exec) {
 		data->imodel->priv->top_exec = ldap_part_new (NULL, data->imodel->priv->base_dn, data->imodel->priv->scope);
 		data->imodel->priv->current_exec = data->imodel->priv->top_exec;
@@ -1288,6 +1438,11 @@ worker_gda_data_model_ldap_iter_next (WorkerIterData *data, GError **error)
 			update_iter_from_ldap_row (data->imodel, data->iter);
 			break;
 		}
+		else if ((cpart->cookie || (cpart->next_msgid >= 0)) &&
+			 ldap_part_fetch_next_page (data->imodel, data->cdata, cpart)) {
+			/* the next page replaces the current one, and its 1st row is read by the next loop */
+			continue;
+		}
 		else {
 			/* nothing more for this part, switch to the next one */
 			ldap_msgfree (data->imodel->priv->current_exec->ldap_msg);
@@ -1443,6 +1598,8 @@ ldap_part_new (LdapPart *parent, const gchar *base_dn, GdaLdapSearchScope scope)
 	part->scope = scope;
 	part->ldap_msg = NULL;
 	part->ldap_row = NULL;
+	part->cookie = NULL;
+	part->next_msgid = -1;
 	part->children = NULL;
 	part->parent = parent;
 	return part;
@@ -1462,6 +1619,10 @@ worker_ldap_part_free (WorkerLdapPartData *data, GError **error)
 		g_slist_foreach (data->part->children, (GFunc) ldap_part_free, data->cnc);
 		g_slist_free (data->part->children);
 	}
+	if ((data->part->next_msgid >= 0) && data->cdata->handle)
+		ldap_abandon_ext (data->cdata->handle, data->part->next_msgid, NULL, NULL);
+	if (data->part->cookie)
+		ber_bvfree (data->part->cookie);
 	if (data->part->ldap_msg) {
 		ldap_msgfree (data->part->ldap_msg);
 
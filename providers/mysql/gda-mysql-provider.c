@@ -44,6 +44,7 @@
 #include <libgda/libgda.h>
 #include <libgda/gda-data-model-private.h>
 #include <libgda/gda-server-provider-extra.h>
+#include <libgda/gda-connection-internal.h>
 #include <libgda/binreloc/gda-binreloc.h>
 #include <libgda/gda-statement-extra.h>
 #include <sql-parser/gda-sql-parser.h>
@@ -196,6 +197,7 @@ static GObject             *gda_mysql_provider_statement_execute (GdaServerProvi
 								  GType                           *col_types,
 								  GdaSet                         **last_inserted_row,
 								  GError                         **error);
+static gint                 gda_mysql_provider_get_max_params (GdaServerProvider *provider, GdaConnection *cnc);
 static GdaSqlStatement     *gda_mysql_provider_statement_rewrite (GdaServerProvider *provider, GdaConnection *cnc,
 								  GdaStatement *stmt, GdaSet *params, GError **error);
 
@@ -288,8 +290,9 @@ GdaServerProviderBase mysql_base_functions = {
 	gda_mysql_provider_delete_savepoint,
 	gda_mysql_provider_statement_prepare,
 	gda_mysql_provider_statement_execute,
+	gda_mysql_provider_get_max_params,
 
-	NULL, NULL, NULL, NULL, /* padding */
+	NULL, NULL, NULL, /* padding */
 };
 
 GdaServerProviderXa mysql_xa_functions = {
@@ -739,6 +742,17 @@ gda_mysql_provider_get_server_version (GdaServerProvider  *provider,
 	return ((GdaProviderReuseable*)cdata->reuseable)->server_version;
 }
 
+/*
+ * Maximum number of parameters request
+ *
+ * The client/server protocol stores the number of parameters of a prepared statement in 16 bits
+ */
+static gint
+gda_mysql_provider_get_max_params (G_GNUC_UNUSED GdaServerProvider *provider, G_GNUC_UNUSED GdaConnection *cnc)
+{
+	return G_MAXUINT16;
+}
+
 /*
  * Support operation request
  *
@@ -1482,6 +1496,31 @@ mysql_render_insert (GdaSqlStatementInsert *stmt, GdaSqlRenderingContext *contex
 			g_string_append (string, " () VALUES ()");
 	}
 
+	/* upsert: MySQL checks all the unique constraints, so the conflict target is not used, except
+	 * to express "do nothing" as a no-op update */
+	if (stmt->conflict_fields || stmt->update_fields) {
+		if (pretty)
+			g_string_append (string, "\nON DUPLICATE KEY UPDATE ");
+		else
+			g_string_append (string, " ON DUPLICATE KEY UPDATE ");
+		if (stmt->update_fields) {
+			for (list = stmt->update_fields; list; list = list->next) {
+				if (list != stmt->update_fields)
+					g_string_append (string, ", ");
+				str = context->render_field (GDA_SQL_ANY_PART (list->data), context, error);
+				if (!str) goto err;
+				g_string_append_printf (string, "%s = VALUES(%s)", str, str);
+				g_free (str);
+			}
+		}
+		else {
+			str = context->render_field (GDA_SQL_ANY_PART (stmt->conflict_fields->data), context, error);
+			if (!str) goto err;
+			g_string_append_printf (string, "%s = %s", str, str);
+			g_free (str);
+		}
+	}
+
 	str = g_string_free (string, FALSE);
 	return str;
 
@@ -2038,6 +2077,23 @@ make_last_inserted_set (GdaConnection *cnc, GdaStatement *stmt, my_ulonglong las
 	}
 }
 
+typedef struct {
+	MYSQL_STMT *mysql_stmt;
+	gint        param;
+} LongDataChunk;
+
+static gboolean
+send_long_data_chunk (const guchar *data, glong size, G_GNUC_UNUSED glong offset, LongDataChunk *chunk,
+		      GError **error)
+{
+	if (mysql_stmt_send_long_data (chunk->mysql_stmt, chunk->param, (const char*) data, size)) {
+		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR,
+			     "%s", mysql_stmt_error (chunk->mysql_stmt));
+		return FALSE;
+	}
+	return TRUE;
+}
+
 static void
 free_bind_param_data (GSList *mem_to_free)
 {
@@ -2046,6 +2102,45 @@ free_bind_param_data (GSList *mem_to_free)
 	}
 }
 
+/*
+ * Makes sure the session's maximum execution time corresponds to the timeout applying to @stmt,
+ * using MAX_EXECUTION_TIME for MySQL (which only applies to SELECT statements), and
+ * max_statement_time for MariaDB. Older servers don't support it and the timeout is ignored.
+ */
+static gboolean
+set_statement_timeout (GdaConnection *cnc, MysqlConnectionData *cdata, GdaStatement *stmt, GError **error)
+{
+	const char *server_info;
+	gchar *sql;
+	guint timeout;
+
+	timeout = _gda_connection_get_statement_timeout (cnc, stmt);
+	if (timeout == cdata->statement_timeout)
+		return TRUE;
+
+	server_info = mysql_get_server_info (cdata->mysql);
+	if (server_info && strstr (server_info, "MariaDB")) {
+		gchar buf [G_ASCII_DTOSTR_BUF_SIZE];
+		sql = g_strdup_printf ("SET SESSION max_statement_time = %s",
+				       g_ascii_dtostr (buf, sizeof (buf), timeout / 1000.));
+	}
+	else if (cdata->reuseable->version_long >= 50708)
+		sql = g_strdup_printf ("SET SESSION MAX_EXECUTION_TIME = %u", timeout);
+	else {
+		cdata->statement_timeout = timeout;
+		return TRUE;
+	}
+
+	if (gda_mysql_real_query_wrap (cnc, cdata->mysql, sql, strlen (sql))) {
+		_gda_mysql_make_error (cnc, cdata->mysql, NULL, error);
+		g_free (sql);
+		return FALSE;
+	}
+	g_free (sql);
+	cdata->statement_timeout = timeout;
+	return TRUE;
+}
+
 /*
  * Execute statement request
  *
@@ -2089,6 +2184,9 @@ gda_mysql_provider_statement_execute (GdaServerProvider               *provider,
 	if (!cdata) 
 		return FALSE;
 
+	if (! set_statement_timeout (cnc, cdata, stmt, error))
+		return NULL;
+
 	/* get/create new prepared statement */
 	ps = (GdaMysqlPStmt *) gda_connection_get_prepared_statement (cnc, stmt);
 	if (!ps) {
@@ -2186,6 +2284,7 @@ gda_mysql_provider_statement_execute (GdaServerProvider               *provider,
 
 	MYSQL_BIND *mysql_bind_param = NULL;
 	GSList *mem_to_free = NULL;
+	GdaBlob **long_data = NULL; /* for each parameter, the BLOB to send using mysql_stmt_send_long_data() */
 
 	if (nb_params > 0) {
 		mysql_bind_param = g_new0 (MYSQL_BIND, nb_params);
@@ -2507,20 +2606,12 @@ gda_mysql_provider_statement_execute (GdaServerProvider               *provider,
 				glong blob_len;
 				GdaBlobOp *op;
 				op = gda_blob_get_op (blob);
-				if (op) {
+				if (op)
 					blob_len = gda_blob_op_get_length (op);
-					if ((blob_len != gda_binary_get_size (bin)) &&
-					    ! gda_blob_op_read_all (op, blob)) {
-						/* force reading the complete BLOB into memory */
-						str = _("Can't read whole BLOB into memory");
-					}
-				}
 				else
 					blob_len = gda_binary_get_size (bin);
 				if (blob_len < 0)
 					str = _("Can't get BLOB's length");
-				else if (blob_len >= G_MAXINT)
-					str = _("BLOB is too big");
 				
 				if (str) {
 					event = gda_connection_point_available_event (cnc, GDA_CONNECTION_EVENT_ERROR);
@@ -2529,7 +2620,19 @@ gda_mysql_provider_statement_execute (GdaServerProvider               *provider,
 						     GDA_SERVER_PROVIDER_DATA_ERROR, "%s", str);
 					break;
 				}
-				
+				else if (op && (blob_len != gda_binary_get_size (bin))) {
+					/* the BLOB's contents is not in memory: it will be sent in chunks
+					 * using mysql_stmt_send_long_data() once the parameters are bound */
+					if (!long_data) {
+						long_data = g_new0 (GdaBlob*, nb_params);
+						mem_to_free = g_slist_prepend (mem_to_free, long_data);
+					}
+					long_data [i] = blob;
+					mysql_bind_param[i].buffer_type = MYSQL_TYPE_BLOB;
+					mysql_bind_param[i].buffer = NULL;
+					mysql_bind_param[i].buffer_length = 0;
+					mysql_bind_param[i].length = NULL;
+				}
 				else {
 					mysql_bind_param[i].buffer_type = MYSQL_TYPE_BLOB;
 					mysql_bind_param[i].buffer = (char *) gda_binary_get_data (bin);
@@ -2651,6 +2754,29 @@ gda_mysql_provider_statement_execute (GdaServerProvider               *provider,
 	}
 
 	
+	if (long_data && !empty_rs) {
+		for (i = 0; i < nb_params; i++) {
+			LongDataChunk chunk;
+			GError *lerror = NULL;
+			if (!long_data [i])
+				continue;
+			chunk.mysql_stmt = gda_mysql_pstmt_get_mysql_stmt (ps);
+			chunk.param = i;
+			if (! gda_server_provider_blob_stream (cnc, long_data [i],
+							       (GdaServerProviderBlobChunkFunc) send_long_data_chunk,
+							       &chunk, &lerror)) {
+				event = gda_connection_point_available_event (cnc, GDA_CONNECTION_EVENT_ERROR);
+				gda_connection_event_set_description (event,
+				   lerror && lerror->message ? lerror->message : _("No detail"));
+				gda_connection_add_event (cnc, event);
+				g_propagate_error (error, lerror);
+				g_object_unref (ps);
+				free_bind_param_data (mem_to_free);
+				return NULL;
+			}
+		}
+	}
+
 	GObject *return_value = NULL;
 	if (mysql_stmt_execute (gda_mysql_pstmt_get_mysql_stmt (ps))) {
 		event = _gda_mysql_make_error (cnc, NULL, gda_mysql_pstmt_get_mysql_stmt (ps), error);
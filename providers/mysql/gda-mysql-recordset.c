@@ -512,8 +512,11 @@ gda_mysql_recordset_new_direct (GdaConnection *cnc, GdaDataModelAccessFlags flag
 	for (mysql_row = mysql_fetch_row (mysql_res), rownum = 0;
 	     mysql_row;
 	     mysql_row = mysql_fetch_row (mysql_res), rownum++) {
-		GdaRow *row = gda_row_new (priv->ncols);
+		GdaRow *row;
 		gint col;
+		if (! gda_data_select_check_limits ((GdaDataSelect*) model, NULL))
+			break; /* the error is in the model's exceptions */
+		row = gda_row_new (priv->ncols);
 		for (col = 0; col < priv->ncols; col++) {
 			gint i = col;
 		
@@ -526,7 +529,7 @@ gda_mysql_recordset_new_direct (GdaConnection *cnc, GdaDataModelAccessFlags flag
 
 			gda_value_reset_with_type (value, type);
 			if (type == G_TYPE_STRING)
-				g_value_set_string (value, data);
+				gda_data_select_row_set_string ((GdaDataSelect*) model, row, value, data, -1);
 			else {
 				GdaDataHandler *dh;
 				gboolean valueset = FALSE;
@@ -965,20 +968,20 @@ new_row_from_mysql_stmt (GdaMysqlRecordset *imodel, G_GNUC_UNUSED gint rownum, G
 		case MYSQL_TYPE_BIT: {
 			char *bvalue = NULL;
 			memmove (&length, mysql_bind_result[i].length, sizeof (unsigned long));
+			if (type == G_TYPE_STRING) {
+				/* copied directly from the bind buffer */
+				gda_data_select_row_set_string ((GdaDataSelect*) imodel, row, value,
+								length > 0 ? (const gchar*) mysql_bind_result[i].buffer : "",
+								length);
+				break;
+			}
 			if (length > 0) {
 				bvalue = g_malloc (length + 1);
 				memcpy (bvalue, mysql_bind_result[i].buffer, length);
 				bvalue [length] = 0;
 			}
 			
-			if (type == G_TYPE_STRING) {
-				if (length == 0) {
-					bvalue = "\0";
-				}
-				g_value_set_string (value, bvalue);
-				bvalue = NULL;
-			}
-			else if (type == GDA_TYPE_TEXT) {
+			if (type == GDA_TYPE_TEXT) {
 				if (length == 0) {
 					bvalue = "\0";
 				}
@@ -1105,6 +1108,10 @@ gda_mysql_recordset_fetch_random (GdaDataSelect  *model,
 
 	imodel = GDA_MYSQL_RECORDSET (model);
 
+	if (! gda_data_select_check_limits (model, error)) {
+		*row = NULL;
+		return FALSE;
+	}
 	*row = new_row_from_mysql_stmt (imodel, rownum, error);
 	if (!*row)
 		return TRUE;
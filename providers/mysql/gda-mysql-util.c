@@ -21,6 +21,19 @@
 #include <glib/gi18n-lib.h>
 #include "gda-mysql-util.h"
 
+/* maps the errors raised when a statement's maximum execution time is exceeded */
+static GdaServerProviderError
+errno_to_provider_error (unsigned int err)
+{
+	switch (err) {
+	case 3024: /* ER_QUERY_TIMEOUT, MySQL */
+	case 1969: /* ER_STATEMENT_TIMEOUT, MariaDB */
+		return GDA_SERVER_PROVIDER_TIMEOUT_ERROR;
+	default:
+		return GDA_SERVER_PROVIDER_STATEMENT_EXEC_ERROR;
+	}
+}
+
 /*
  * Create a new #GdaConnectionEvent object and "adds" it to @cnc
  *
@@ -41,7 +54,7 @@ _gda_mysql_make_error (GdaConnection  *cnc,
 			(event_error, mysql_error (mysql));
 		gda_connection_event_set_code
 			(event_error, (glong) mysql_errno (mysql));
-		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_STATEMENT_EXEC_ERROR,
+		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, errno_to_provider_error (mysql_errno (mysql)),
 			     "%s", mysql_error (mysql));
 		
 		//g_print ("%s: %s\n", __func__, mysql_error (mysql));
@@ -53,7 +66,7 @@ _gda_mysql_make_error (GdaConnection  *cnc,
 			(event_error, mysql_stmt_error (mysql_stmt));
 		gda_connection_event_set_code
 			(event_error, (glong) mysql_stmt_errno (mysql_stmt));
-		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_STATEMENT_EXEC_ERROR,
+		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, errno_to_provider_error (mysql_stmt_errno (mysql_stmt)),
 			     "%s", mysql_stmt_error (mysql_stmt));
 		
 		//g_print ("%s : %s\n", __func__, mysql_stmt_error (mysql_stmt));
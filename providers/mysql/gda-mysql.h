@@ -48,6 +48,7 @@ typedef struct {
 	GdaMysqlReuseable *reuseable;
 	GdaConnection     *cnc;
 	MYSQL             *mysql;	
+	guint              statement_timeout; /* maximum execution time set for the session, in ms */
 } MysqlConnectionData;
 
 // Makes back my_bool
@@ -26,6 +26,7 @@
 #include "gda-postgres.h"
 #include "gda-postgres-blob-op.h"
 #include <libgda/gda-blob-op-impl.h>
+#include <libgda/gda-server-provider-extra.h>
 #include "gda-postgres-util.h"
 
 
@@ -337,6 +338,25 @@ gda_postgres_blob_op_read (GdaBlobOp *op, GdaBlob *blob, glong offset, glong siz
 	return -1;
 }
 
+typedef struct {
+	PGconn *pconn;
+	gint    fd;
+	glong   nbwritten;
+} ChunkWriteData;
+
+static gboolean
+chunk_write (const guchar *data, glong size, G_GNUC_UNUSED glong offset, ChunkWriteData *cdata,
+	     GError **error)
+{
+	if (lo_write (cdata->pconn, cdata->fd, (char*) data, size) < size) {
+		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR,
+			     "%s", _("Can't write BLOB's contents"));
+		return FALSE;
+	}
+	cdata->nbwritten += size;
+	return TRUE;
+}
+
 static glong
 gda_postgres_blob_op_write (GdaBlobOp *op, GdaBlob *blob, glong offset)
 {
@@ -366,32 +386,17 @@ gda_postgres_blob_op_write (GdaBlobOp *op, GdaBlob *blob, glong offset)
 	}
 
 	if (gda_blob_get_op (blob) && (gda_blob_get_op (blob) != op)) {
-		/* use data through blob->op */
-		#define buf_size 16384
-		gint nread = 0;
-		GdaBlob *tmpblob = gda_blob_new ();
-		gda_blob_set_op (tmpblob, gda_blob_get_op (blob));
-
-		nbwritten = 0;
-
-		for (nread = gda_blob_op_read (gda_blob_get_op (tmpblob), tmpblob, 0, buf_size);
-		     nread > 0;
-		     nread = gda_blob_op_read (gda_blob_get_op (tmpblob), tmpblob, nbwritten, buf_size)) {
-			GdaBinary *bin = gda_blob_get_binary (tmpblob);
-			glong tmp_written;
-			tmp_written = lo_write (pconn, priv->fd, (char*) gda_binary_get_data (bin),
-						gda_binary_get_size (bin));
-			if (tmp_written < gda_binary_get_size (bin)) {
-				_gda_postgres_make_error (priv->cnc, pconn, NULL, NULL);
-				gda_blob_free (tmpblob);
-				goto out_error;
-			}
-			nbwritten += tmp_written;
-			if (nread < buf_size)
-				/* nothing more to read */
-				break;
+		/* use data through blob->op, one chunk at a time */
+		ChunkWriteData cdata;
+		cdata.pconn = pconn;
+		cdata.fd = priv->fd;
+		cdata.nbwritten = 0;
+		if (! gda_server_provider_blob_stream (priv->cnc, blob, (GdaServerProviderBlobChunkFunc) chunk_write,
+						       &cdata, NULL)) {
+			_gda_postgres_make_error (priv->cnc, pconn, NULL, NULL);
+			goto out_error;
 		}
-		gda_blob_free (tmpblob);
+		nbwritten = cdata.nbwritten;
 	}
 	else {
 		/* use data in (GdaBinary *) blob */
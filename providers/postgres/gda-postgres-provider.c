@@ -41,6 +41,7 @@
 #include <libgda/libgda.h>
 #include <libgda/gda-data-model-private.h>
 #include <libgda/gda-server-provider-extra.h>
+#include <libgda/gda-connection-internal.h>
 #include <libgda/binreloc/gda-binreloc.h>
 #include <libgda/gda-statement-extra.h>
 #include <sql-parser/gda-sql-parser.h>
@@ -137,6 +138,7 @@ static GObject             *gda_postgres_provider_statement_execute (GdaServerPr
 								     GdaStatement *stmt, GdaSet *params,
 								     GdaStatementModelUsage model_usage,
 								     GType *col_types, GdaSet **last_inserted_row, GError **error);
+static gint                 gda_postgres_provider_get_max_params (GdaServerProvider *provider, GdaConnection *cnc);
 
 /* Quoting */
 static gchar               *gda_postgres_provider_identifier_quote    (GdaServerProvider *provider, GdaConnection *cnc,
@@ -227,8 +229,9 @@ GdaServerProviderBase postgres_base_functions = {
 	gda_postgres_provider_delete_savepoint,
 	gda_postgres_provider_statement_prepare,
 	gda_postgres_provider_statement_execute,
+	gda_postgres_provider_get_max_params,
 
-	NULL, NULL, NULL, NULL, /* padding */
+	NULL, NULL, NULL, /* padding */
 };
 
 GdaServerProviderXa postgres_xa_functions = {
@@ -606,6 +609,7 @@ gda_postgres_provider_open_connection (GdaServerProvider *provider, GdaConnectio
 	cdata = g_new0 (PostgresConnectionData, 1);
 	cdata->cnc = cnc;
         cdata->pconn = pconn;
+	cdata->local_timeout = G_MAXUINT;
 
 	/* attach connection data */
 	gda_connection_internal_set_provider_data (cnc, (GdaServerProviderConnectionData*) cdata,
@@ -749,6 +753,17 @@ gda_postgres_provider_get_server_version (GdaServerProvider *provider, GdaConnec
 	return ((GdaProviderReuseable*)cdata->reuseable)->server_version;
 }
 
+/*
+ * Maximum number of parameters request
+ *
+ * The client/server protocol stores the number of parameters of a prepared statement in 16 bits
+ */
+static gint
+gda_postgres_provider_get_max_params (G_GNUC_UNUSED GdaServerProvider *provider, G_GNUC_UNUSED GdaConnection *cnc)
+{
+	return G_MAXUINT16;
+}
+
 /*
  * Support operation request
  *
@@ -1874,6 +1889,64 @@ params_freev (gchar **param_values, gboolean *param_mem, gint size)
 	g_free (param_mem);
 }
 
+/*
+ * Makes sure the statement_timeout setting corresponds to the timeout applying to @stmt.
+ *
+ * Outside of any transaction, the session's setting is modified. Inside a transaction, the setting is
+ * modified using SET LOCAL, so it is reverted at the end of the transaction whatever its outcome, and
+ * the session's setting remains known. Nothing is sent when the transaction has failed, so the
+ * statement (usually a ROLLBACK) reaches the server.
+ */
+static gboolean
+set_statement_timeout (GdaConnection *cnc, PostgresConnectionData *cdata, GdaStatement *stmt, GError **error)
+{
+	PGresult *pg_res;
+	gchar *sql;
+	guint timeout, current;
+	gboolean local;
+
+	timeout = _gda_connection_get_statement_timeout (cnc, stmt);
+	switch (PQtransactionStatus (cdata->pconn)) {
+	case PQTRANS_IDLE:
+		/* any SET LOCAL has been reverted by the end of the transaction */
+		cdata->local_timeout = G_MAXUINT;
+		local = FALSE;
+		break;
+	case PQTRANS_INTRANS:
+		local = TRUE;
+		break;
+	default:
+		/* failed transaction, or unknown state: the current setting applies */
+		current = (cdata->local_timeout != G_MAXUINT) ? cdata->local_timeout : cdata->statement_timeout;
+		cdata->timeout_armed = (current != 0);
+		return TRUE;
+	}
+
+	current = (cdata->local_timeout != G_MAXUINT) ? cdata->local_timeout : cdata->statement_timeout;
+	if (timeout == current) {
+		cdata->timeout_armed = (timeout != 0);
+		return TRUE;
+	}
+
+	sql = g_strdup_printf ("SET %sstatement_timeout TO %u", local ? "LOCAL " : "", timeout);
+	pg_res = _gda_postgres_PQexec_wrap (cnc, cdata->pconn, sql);
+	g_free (sql);
+	if (!pg_res || (PQresultStatus (pg_res) != PGRES_COMMAND_OK)) {
+		cdata->timeout_armed = FALSE;
+		_gda_postgres_make_error (cnc, cdata->pconn, pg_res, error);
+		if (pg_res)
+			PQclear (pg_res);
+		return FALSE;
+	}
+	PQclear (pg_res);
+	if (local)
+		cdata->local_timeout = timeout;
+	else
+		cdata->statement_timeout = timeout;
+	cdata->timeout_armed = (timeout != 0);
+	return TRUE;
+}
+
 /*
  * Execute statement request
  *
@@ -1916,6 +1989,9 @@ gda_postgres_provider_statement_execute (GdaServerProvider *provider, GdaConnect
 	if (!cdata)
 		return NULL;
 
+	if (! set_statement_timeout (cnc, cdata, stmt, error))
+		return NULL;
+
 	/*
 	 * execute prepared statement using C API: CURSOR based
 	 */
@@ -2177,7 +2253,7 @@ gda_postgres_provider_statement_execute (GdaServerProvider *provider, GdaConnect
 
 			/* always create a new blob as there is no way to truncate an existing blob */
 			if (gda_postgres_blob_op_declare_blob (op) &&
-			    gda_blob_op_write ((GdaBlobOp*) op, blob, 0))
+			    (gda_blob_op_write ((GdaBlobOp*) op, blob, 0) >= 0))
 				param_values [i] = gda_postgres_blob_op_get_id (op);
 			else
 				param_values [i] = NULL;
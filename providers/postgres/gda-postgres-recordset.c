@@ -71,7 +71,7 @@ static gboolean gda_postgres_recordset_fetch_at (GdaDataSelect *model, GdaRow **
 
 /* static helper functions */
 static void make_point (GdaGeometricPoint *point, const gchar *value);
-static void set_value (GdaConnection *cnc, GdaRow *row, GValue *value, GType type, const gchar *thevalue, gint length, GError **error);
+static void set_value (GdaDataSelect *model, GdaRow *row, GValue *value, GType type, const gchar *thevalue, gint length, GError **error);
 
 static void     set_prow_with_pg_res (GdaPostgresRecordset *imodel, GdaRow *prow, gint pg_res_rownum, GError **error);
 static GdaRow *new_row_from_pg_res (GdaPostgresRecordset *imodel, gint pg_res_rownum, GError **error);
@@ -425,6 +425,10 @@ gda_postgres_recordset_fetch_random (GdaDataSelect *model, GdaRow **prow, gint r
 		return TRUE;
 	}
 
+	if (! gda_data_select_check_limits (model, error)) {
+		*prow = NULL;
+		return FALSE;
+	}
 	*prow = new_row_from_pg_res (imodel, rownum, error);
 	gda_data_select_take_row (model, *prow, rownum);
 
@@ -456,6 +460,8 @@ gda_postgres_recordset_store_all (GdaDataSelect *model, GError **error)
 
 	for (i = 0; i < gda_data_select_get_advertized_nrows (model); i++) {
 		GdaRow *prow;
+		if (gda_data_select_get_stored_row (model, i))
+			continue;
 		if (! gda_postgres_recordset_fetch_random (model, &prow, i, error))
 			return FALSE;
 	}
@@ -578,9 +584,11 @@ make_point (GdaGeometricPoint *point, const gchar *value)
 }
 
 static void
-set_value (GdaConnection *cnc, GdaRow *row, GValue *value, GType type, const gchar *thevalue,
-	   G_GNUC_UNUSED gint length, GError **error)
+set_value (GdaDataSelect *model, GdaRow *row, GValue *value, GType type, const gchar *thevalue,
+	   gint length, GError **error)
 {
+	GdaConnection *cnc;
+	cnc = gda_data_select_get_connection (model);
 	gda_value_reset_with_type (value, type);
 
 	if (type == G_TYPE_BOOLEAN)
@@ -591,7 +599,7 @@ set_value (GdaConnection *cnc, GdaRow *row, GValue *value, GType type, const gch
     g_value_take_boxed (value, txt);
   }
 	else if (type == G_TYPE_STRING) 
-		g_value_set_string (value, thevalue);
+		gda_data_select_row_set_string (model, row, value, thevalue, length);
 	else if (type == G_TYPE_INT)
 		g_value_set_int (value, atol (thevalue));
 	else if (type == G_TYPE_UINT)
@@ -765,8 +773,7 @@ set_value (GdaConnection *cnc, GdaRow *row, GValue *value, GType type, const gch
 		g_value_set_gtype (value, gda_g_type_from_string (thevalue));
 	else {
 		/*g_warning ("Type %s not translated for value '%s' => set as string", g_type_name (type), thevalue);*/
-		gda_value_reset_with_type (value, G_TYPE_STRING);
-		g_value_set_string (value, thevalue);
+		gda_data_select_row_set_string (model, row, value, thevalue, length);
 	}
 }
 
@@ -788,12 +795,14 @@ set_prow_with_pg_res (GdaPostgresRecordset *imodel, GdaRow *prow, gint pg_res_ro
 	gint col;
   GdaPostgresRecordsetPrivate *priv = gda_postgres_recordset_get_instance_private (imodel);
 
+	/* @prow may be priv->tmp_row, filled again for each row */
+	gda_data_select_row_reset ((GdaDataSelect*) imodel, prow);
 	for (col = 0; col < gda_pstmt_get_ncols (gda_data_select_get_prep_stmt ((GdaDataSelect*) imodel)); col++) {
 		thevalue = PQgetvalue (priv->pg_res, pg_res_rownum, col);
 		if (thevalue && (*thevalue != '\0' ? FALSE : PQgetisnull (priv->pg_res, pg_res_rownum, col)))
 			gda_value_set_null (gda_row_get_value (prow, col));
 		else
-			set_value (gda_data_select_get_connection ((GdaDataSelect*) imodel),
+			set_value ((GdaDataSelect*) imodel,
 				   prow, gda_row_get_value (prow, col), 
 				   gda_pstmt_get_types (gda_data_select_get_prep_stmt ((GdaDataSelect*) imodel)) [col],
 				   thevalue, 
@@ -18,6 +18,7 @@
  * Boston, MA  02110-1301, USA.
  */
 
+#include <string.h>
 #include <glib/gi18n-lib.h>
 #include "gda-postgres-util.h"
 
@@ -73,6 +74,7 @@ _gda_postgres_make_error (GdaConnection *cnc, PGconn *pconn, PGresult *pg_res, G
 	GdaConnectionEvent *error_ev;
         GdaConnectionEventCode gda_code = GDA_CONNECTION_EVENT_CODE_UNKNOWN;
         GdaTransactionStatus *trans;
+	GdaServerProviderError code = GDA_SERVER_PROVIDER_STATEMENT_EXEC_ERROR;
 
         error_ev = gda_connection_point_available_event (cnc, GDA_CONNECTION_EVENT_ERROR);
         if (pconn != NULL) {
@@ -85,6 +87,15 @@ _gda_postgres_make_error (GdaConnection *cnc, PGconn *pconn, PGresult *pg_res, G
                         sqlstate = PQresultErrorField (pg_res, PG_DIAG_SQLSTATE);
                         gda_connection_event_set_sqlstate (error_ev, sqlstate);
                         gda_code = gda_postgres_sqlsate_to_gda_code (sqlstate);
+			/* query_canceled: raised by the statement_timeout setting, but also by
+			 * pg_cancel_backend(), PQcancel() and other cancellations, so only reported
+			 * as a timeout if one applies to the statement */
+			if (sqlstate && !strcmp (sqlstate, "57014")) {
+				PostgresConnectionData *cdata;
+				cdata = (PostgresConnectionData*) gda_connection_internal_get_provider_data_error (cnc, NULL);
+				if (cdata && cdata->timeout_armed)
+					code = GDA_SERVER_PROVIDER_TIMEOUT_ERROR;
+			}
                 }
                 else {
                         message = g_strdup (PQerrorMessage (pconn));
@@ -99,7 +110,7 @@ _gda_postgres_make_error (GdaConnection *cnc, PGconn *pconn, PGresult *pg_res, G
 
                 gda_connection_event_set_description (error_ev, ptr);
                 gda_connection_event_set_gda_code (error_ev, gda_code);
-		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_STATEMENT_EXEC_ERROR, "%s", ptr);
+		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, code, "%s", ptr);
 		g_free (message);
         }
         else {
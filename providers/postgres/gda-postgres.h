@@ -60,6 +60,11 @@ typedef struct {
 	GDateDMY              date_second;
 	GDateDMY              date_third;
 	gchar                 date_sep;
+
+	guint                 statement_timeout; /* value of the session's statement_timeout setting, in ms */
+	guint                 local_timeout; /* value set using SET LOCAL in the current transaction,
+					      * or G_MAXUINT if none */
+	gboolean              timeout_armed; /* TRUE if a timeout applies to the last executed statement */
 } PostgresConnectionData;
 
 #endif
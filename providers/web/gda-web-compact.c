@@ -0,0 +1,299 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <string.h>
+#include <glib/gi18n-lib.h>
+#include "gda-web-compact.h"
+
+/*
+ * Decoded contents of a <gda_array_compact> node: the whole node is base64 decoded and all the
+ * values are checked when the object is created; the values are only converted to GValue when
+ * a row is requested.
+ */
+struct _WebCompactData {
+	guchar *data;
+	gsize   size;
+	gint    ncols;
+	gint    nrows;
+	gsize  *offsets; /* offset of each row in @data */
+};
+
+static guint32
+read_uint32 (const guchar *ptr)
+{
+	guint32 v;
+	memcpy (&v, ptr, sizeof (v));
+	return GUINT32_FROM_LE (v);
+}
+
+static guint64
+read_uint64 (const guchar *ptr)
+{
+	guint64 v;
+	memcpy (&v, ptr, sizeof (v));
+	return GUINT64_FROM_LE (v);
+}
+
+static gdouble
+read_double (const guchar *ptr)
+{
+	guint64 v;
+	gdouble d;
+	v = read_uint64 (ptr);
+	memcpy (&d, &v, sizeof (d));
+	return d;
+}
+
+/*
+ * _gda_web_compact_data_new
+ * @encoded: the base64 encoded contents of the <gda_array_compact> node
+ * @ncols: the number of columns
+ * @nrows: the number of rows announced by the "rows" attribute
+ *
+ * Returns: a new #WebCompactData, or %NULL if @encoded is not valid
+ */
+WebCompactData *
+_gda_web_compact_data_new (const gchar *encoded, gint ncols, gint nrows, GError **error)
+{
+	WebCompactData *compact;
+	gsize pos;
+	gint i, j;
+
+	g_return_val_if_fail (encoded, NULL);
+
+	if ((ncols <= 0) || (nrows < 0)) {
+		g_set_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR,
+			     "%s", _("Invalid compact data size"));
+		return NULL;
+	}
+
+	compact = g_new0 (WebCompactData, 1);
+	compact->ncols = ncols;
+	compact->nrows = nrows;
+	compact->data = g_base64_decode (encoded, &(compact->size));
+	if ((guint64) nrows * ncols > compact->size) /* each value uses at least one byte */
+		goto onerror;
+	compact->offsets = g_new (gsize, nrows > 0 ? nrows : 1);
+
+	/* check all the values and compute the offset of each row */
+	for (pos = 0, i = 0; i < nrows; i++) {
+		compact->offsets [i] = pos;
+		for (j = 0; j < ncols; j++) {
+			if (pos >= compact->size)
+				goto onerror;
+			switch (compact->data [pos++]) {
+			case WEB_COMPACT_NULL:
+				break;
+			case WEB_COMPACT_INT:
+			case WEB_COMPACT_DOUBLE:
+				if (compact->size - pos < 8)
+					goto onerror;
+				pos += 8;
+				break;
+			case WEB_COMPACT_TEXT: {
+				guint32 len;
+				if (compact->size - pos < 4)
+					goto onerror;
+				len = read_uint32 (compact->data + pos);
+				pos += 4;
+				if (compact->size - pos < len)
+					goto onerror;
+				pos += len;
+				break;
+			}
+			default:
+				goto onerror;
+			}
+		}
+	}
+	if (pos != compact->size)
+		goto onerror;
+
+	return compact;
+
+ onerror:
+	g_set_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR,
+		     "%s", _("Invalid compact data received from the web server"));
+	_gda_web_compact_data_free (compact);
+	return NULL;
+}
+
+gint
+_gda_web_compact_data_get_n_rows (WebCompactData *compact)
+{
+	g_return_val_if_fail (compact, -1);
+	return compact->nrows;
+}
+
+static void
+set_value_from_string (GdaRow *row, GValue *value, GType type, const gchar *str)
+{
+	if ((type == G_TYPE_STRING) || (type == GDA_TYPE_NULL)) {
+		if (! g_utf8_validate (str, -1, NULL)) {
+			GError *lerror = NULL;
+			g_set_error (&lerror, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR,
+				     "%s", _("Invalid UTF-8 string"));
+			gda_row_invalidate_value_e (row, value, lerror);
+		}
+		else {
+			gda_value_reset_with_type (value, G_TYPE_STRING);
+			g_value_set_string (value, str);
+		}
+	}
+	else {
+		GValue *tmp;
+		tmp = gda_value_new_from_string (str, type);
+		if (tmp) {
+			gda_value_reset_with_type (value, type);
+			g_value_copy (tmp, value);
+			gda_value_free (tmp);
+		}
+		else {
+			GError *lerror = NULL;
+			g_set_error (&lerror, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR,
+				     _("Can't convert '%s' to a value of type '%s'"), str, g_type_name (type));
+			gda_row_invalidate_value_e (row, value, lerror);
+		}
+	}
+}
+
+static void
+set_value_from_int (GdaRow *row, GValue *value, GType type, gint64 i)
+{
+	if (type == G_TYPE_INT64) {
+		gda_value_reset_with_type (value, type);
+		g_value_set_int64 (value, i);
+	}
+	else if ((type == G_TYPE_INT) && (i >= G_MININT) && (i <= G_MAXINT)) {
+		gda_value_reset_with_type (value, type);
+		g_value_set_int (value, (gint) i);
+	}
+	else if ((type == G_TYPE_UINT) && (i >= 0) && (i <= G_MAXUINT)) {
+		gda_value_reset_with_type (value, type);
+		g_value_set_uint (value, (guint) i);
+	}
+	else if ((type == G_TYPE_UINT64) && (i >= 0)) {
+		gda_value_reset_with_type (value, type);
+		g_value_set_uint64 (value, (guint64) i);
+	}
+	else if (type == G_TYPE_DOUBLE) {
+		gda_value_reset_with_type (value, type);
+		g_value_set_double (value, (gdouble) i);
+	}
+	else if (type == G_TYPE_BOOLEAN) {
+		gda_value_reset_with_type (value, type);
+		g_value_set_boolean (value, i ? TRUE : FALSE);
+	}
+	else {
+		gchar *str;
+		str = g_strdup_printf ("%" G_GINT64_FORMAT, i);
+		set_value_from_string (row, value, type, str);
+		g_free (str);
+	}
+}
+
+static void
+set_value_from_double (GdaRow *row, GValue *value, GType type, gdouble d)
+{
+	if (type == G_TYPE_DOUBLE) {
+		gda_value_reset_with_type (value, type);
+		g_value_set_double (value, d);
+	}
+	else if (type == G_TYPE_FLOAT) {
+		gda_value_reset_with_type (value, type);
+		g_value_set_float (value, (gfloat) d);
+	}
+	else {
+		gchar buf [G_ASCII_DTOSTR_BUF_SIZE];
+		g_ascii_dtostr (buf, sizeof (buf), d);
+		set_value_from_string (row, value, type, buf);
+	}
+}
+
+/*
+ * _gda_web_compact_data_fill_row
+ * @types: the type of each column
+ *
+ * Sets the values of @row to the ones of the @rownum row. Values which can't be converted
+ * to the column's type are invalidated (see gda_row_invalidate_value_e()).
+ *
+ * Returns: %FALSE if @rownum is out of range
+ */
+gboolean
+_gda_web_compact_data_fill_row (WebCompactData *compact, gint rownum, GdaRow *row,
+				const GType *types, GError **error)
+{
+	const guchar *ptr;
+	gint j;
+
+	g_return_val_if_fail (compact, FALSE);
+	g_return_val_if_fail (row, FALSE);
+	g_return_val_if_fail (types, FALSE);
+
+	if ((rownum < 0) || (rownum >= compact->nrows)) {
+		g_set_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ROW_OUT_OF_RANGE_ERROR,
+			     _("Row %d out of range (0-%d)"), rownum, compact->nrows - 1);
+		return FALSE;
+	}
+
+	/* all the values have been checked by _gda_web_compact_data_new() */
+	ptr = compact->data + compact->offsets [rownum];
+	for (j = 0; j < compact->ncols; j++) {
+		GValue *value;
+		value = gda_row_get_value (row, j);
+		switch (*ptr++) {
+		case WEB_COMPACT_NULL:
+			gda_value_set_null (value);
+			break;
+		case WEB_COMPACT_INT:
+			set_value_from_int (row, value, types [j], (gint64) read_uint64 (ptr));
+			ptr += 8;
+			break;
+		case WEB_COMPACT_DOUBLE:
+			set_value_from_double (row, value, types [j], read_double (ptr));
+			ptr += 8;
+			break;
+		case WEB_COMPACT_TEXT: {
+			guint32 len;
+			gchar *str;
+			len = read_uint32 (ptr);
+			ptr += 4;
+			str = g_strndup ((const gchar *) ptr, len);
+			ptr += len;
+			set_value_from_string (row, value, types [j], str);
+			g_free (str);
+			break;
+		}
+		default:
+			g_assert_not_reached ();
+		}
+	}
+
+	return TRUE;
+}
+
+void
+_gda_web_compact_data_free (WebCompactData *compact)
+{
+	if (!compact)
+		return;
+	g_free (compact->data);
+	g_free (compact->offsets);
+	g_free (compact);
+}
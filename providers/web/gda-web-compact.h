@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __GDA_WEB_COMPACT_H__
+#define __GDA_WEB_COMPACT_H__
+
+#include <libgda/libgda.h>
+#include <libgda/gda-row.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Tags preceding each value of the compact result encoding, see the README file
+ */
+typedef enum {
+	WEB_COMPACT_NULL   = 0,
+	WEB_COMPACT_TEXT   = 1, /* 32 bits length and bytes */
+	WEB_COMPACT_INT    = 2, /* 64 bits integer */
+	WEB_COMPACT_DOUBLE = 3  /* IEEE 754 double */
+} WebCompactTag;
+
+typedef struct _WebCompactData WebCompactData;
+
+WebCompactData *_gda_web_compact_data_new        (const gchar *encoded, gint ncols, gint nrows, GError **error);
+gint            _gda_web_compact_data_get_n_rows (WebCompactData *compact);
+gboolean        _gda_web_compact_data_fill_row   (WebCompactData *compact, gint rownum, GdaRow *row,
+						  const GType *types, GError **error);
+void            _gda_web_compact_data_free       (WebCompactData *compact);
+
+G_END_DECLS
+
+#endif
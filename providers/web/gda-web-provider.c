@@ -357,6 +357,9 @@ gda_web_provider_open_connection (GdaServerProvider *provider, GdaConnection *cn
 	cdata->forced_closing = FALSE;
 	cdata->worker_session = soup_session_new_with_options ("ssl-use-system-ca-file", TRUE, NULL);
 	cdata->front_session = soup_session_new_with_options ("max-conns-per-host", 1, "ssl-use-system-ca-file", TRUE, NULL);
+	/* accept gzip or deflate compressed replies */
+	if (! soup_session_has_feature (cdata->front_session, SOUP_TYPE_CONTENT_DECODER))
+		soup_session_add_feature_by_type (cdata->front_session, SOUP_TYPE_CONTENT_DECODER);
 	if (use_ssl) {
 		server_url = g_string_new ("https://");
 		g_print ("USING SSL\n");
@@ -1405,6 +1408,9 @@ gda_web_provider_statement_execute (GdaServerProvider *provider, GdaConnection *
 			xmlSetProp (node, BAD_CAST "type", BAD_CAST "SELECT");
 	}
 	xmlNewChild (cmdnode, NULL, BAD_CAST "preparehash", BAD_CAST (gda_web_pstmt_get_pstmt_hash (ps)));
+	/* ask for the compact encoding of the results, ignored by older servers which still
+	 * send the results as <gda_array_data> nodes */
+	xmlNewChild (cmdnode, NULL, BAD_CAST "encoding", BAD_CAST "compact");
 
 	/* bind statement's parameters */
 	GSList *list;
@@ -20,6 +20,7 @@
  */
 
 #include <stdarg.h>
+#include <stdlib.h>
 #include <string.h>
 #include <glib/gi18n-lib.h>
 #include <libgda/gda-util.h>
@@ -27,9 +28,11 @@
 #include <libgda/gda-connection-private.h>
 #include <gda-data-model.h>
 #include <gda-data-select-private.h>
+#include <libgda/providers-support/gda-data-select-priv.h>
 #include "gda-web.h"
 #include "gda-web-recordset.h"
 #include "gda-web-provider.h"
+#include "gda-web-compact.h"
 
 #define _GDA_PSTMT(x) ((GdaPStmt*)(x))
 
@@ -47,6 +50,8 @@ typedef struct {
 	
 	GdaDataModel *real_model;
 	GdaRow       *prow;
+
+	WebCompactData *compact; /* when the server uses the compact encoding */
 } GdaWebRecordsetPrivate;
 
 G_DEFINE_TYPE_WITH_PRIVATE(GdaWebRecordset, gda_web_recordset, GDA_TYPE_DATA_SELECT)
@@ -91,6 +96,10 @@ gda_web_recordset_dispose (GObject *object)
 		g_object_unref (priv->real_model);
 	if (priv->prow)
 		g_object_unref (priv->prow);
+	if (priv->compact) {
+		_gda_web_compact_data_free (priv->compact);
+		priv->compact = NULL;
+	}
 
 	G_OBJECT_CLASS (gda_web_recordset_parent_class)->dispose (object);
 }
@@ -258,6 +267,31 @@ gda_web_recordset_store (GdaWebRecordset *rs, xmlNodePtr data_node, GError **err
 	g_return_val_if_fail (!strcmp ((gchar*) data_node->name, "gda_array"), FALSE);
   GdaWebRecordsetPrivate *priv = gda_web_recordset_get_instance_private (rs);
 
+	/* compact encoding: the node's contents are decoded here, and the values are converted
+	 * to GValue only when a row is requested */
+	for (node = data_node->children; node; node = node->next) {
+		if (!strcmp ((gchar*) node->name, "gda_array_compact")) {
+			xmlChar *prop, *contents;
+			gint nrows = -1;
+
+			prop = xmlGetProp (node, BAD_CAST "rows");
+			if (prop) {
+				nrows = atoi ((gchar*) prop);
+				xmlFree (prop);
+			}
+			contents = xmlNodeGetContent (node);
+			priv->compact = _gda_web_compact_data_new ((gchar*) contents,
+								   gda_data_model_get_n_columns ((GdaDataModel*) rs),
+								   nrows, error);
+			xmlFree (contents);
+			if (!priv->compact)
+				return FALSE;
+			gda_data_select_set_advertized_nrows ((GdaDataSelect*) rs,
+							      _gda_web_compact_data_get_n_rows (priv->compact));
+			return TRUE;
+		}
+	}
+
 	/* modify the @data_node tree to set the correct data types */
 	ncols = gda_data_model_get_n_columns ((GdaDataModel*) rs);
 	for (node = data_node->children, i = 0;
@@ -334,6 +368,20 @@ gda_web_recordset_fetch_random (GdaDataSelect *model, GdaRow **prow, gint rownum
     return TRUE;
   }
 
+	if (priv->compact) {
+		GdaPStmt *ps;
+		ps = gda_data_select_get_prep_stmt (model);
+		*prow = gda_row_new (gda_pstmt_get_ncols (ps));
+		if (! _gda_web_compact_data_fill_row (priv->compact, rownum, *prow,
+						      gda_pstmt_get_types (ps), error)) {
+			g_object_unref (*prow);
+			*prow = NULL;
+			return FALSE;
+		}
+		gda_data_select_take_row (model, *prow, rownum);
+		return TRUE;
+	}
+
 	if (priv->real_model) {
 		gint i, ncols;
 		ncols = gda_data_model_get_n_columns ((GdaDataModel*) model);
@@ -0,0 +1,421 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/*
+ * Checks the compact result encoding, using a local web server which sends a reply the way
+ * the gda-front.php script does: gzip compressed and in several chunks
+ */
+#include <libgda/libgda.h>
+#include <libsoup/soup.h>
+#include <gio/gio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gda-web-compact.h"
+
+#define NB_ROWS 1000
+#define NB_COLS 5
+#define CHUNK_SIZE 1024
+
+/*
+ * Local web server, run in its own thread
+ */
+typedef struct {
+	GThread      *thread;
+	GMainContext *context;
+	GMainLoop    *loop;
+	SoupServer   *server;
+	guint         port;
+
+	GMutex        mutex;
+	GCond         cond;
+	gboolean      ready;
+
+	gchar        *reply;
+	gboolean      compressed; /* set if the client accepted a compressed reply */
+} TestServer;
+
+static GBytes *
+gzip_data (const gchar *data, gsize length)
+{
+	GOutputStream *mem, *out;
+	GZlibCompressor *compressor;
+	GBytes *bytes;
+	GError *error = NULL;
+
+	mem = g_memory_output_stream_new_resizable ();
+	compressor = g_zlib_compressor_new (G_ZLIB_COMPRESSOR_FORMAT_GZIP, -1);
+	out = g_converter_output_stream_new (mem, G_CONVERTER (compressor));
+	g_assert (g_output_stream_write_all (out, data, length, NULL, NULL, &error));
+	g_assert_no_error (error);
+	g_assert (g_output_stream_close (out, NULL, &error));
+	g_assert_no_error (error);
+	bytes = g_memory_output_stream_steal_as_bytes (G_MEMORY_OUTPUT_STREAM (mem));
+	g_object_unref (out);
+	g_object_unref (compressor);
+	g_object_unref (mem);
+	return bytes;
+}
+
+static void
+server_callback (G_GNUC_UNUSED SoupServer *server, SoupMessage *msg, G_GNUC_UNUSED const char *path,
+		 G_GNUC_UNUSED GHashTable *query, G_GNUC_UNUSED SoupClientContext *client, TestServer *ts)
+{
+	const gchar *accept;
+	GBytes *bytes = NULL;
+	const gchar *data;
+	gsize length, offset;
+
+	accept = soup_message_headers_get_list (msg->request_headers, "Accept-Encoding");
+	if (accept && soup_header_contains (accept, "gzip")) {
+		ts->compressed = TRUE;
+		bytes = gzip_data (ts->reply, strlen (ts->reply));
+		data = g_bytes_get_data (bytes, &length);
+		soup_message_headers_replace (msg->response_headers, "Content-Encoding", "gzip");
+	}
+	else {
+		data = ts->reply;
+		length = strlen (ts->reply);
+	}
+
+	soup_message_set_status (msg, SOUP_STATUS_OK);
+	soup_message_headers_set_content_type (msg->response_headers, "text/plain", NULL);
+	soup_message_headers_set_encoding (msg->response_headers, SOUP_ENCODING_CHUNKED);
+	for (offset = 0; offset < length; offset += CHUNK_SIZE)
+		soup_message_body_append (msg->response_body, SOUP_MEMORY_COPY, data + offset,
+					  MIN (CHUNK_SIZE, length - offset));
+	soup_message_body_complete (msg->response_body);
+	if (bytes)
+		g_bytes_unref (bytes);
+}
+
+static gpointer
+server_thread (TestServer *ts)
+{
+	GSList *uris;
+	GError *error = NULL;
+
+	g_main_context_push_thread_default (ts->context);
+	ts->server = soup_server_new (NULL, NULL);
+	soup_server_add_handler (ts->server, NULL, (SoupServerCallback) server_callback, ts, NULL);
+	g_assert (soup_server_listen_local (ts->server, 0, SOUP_SERVER_LISTEN_IPV4_ONLY, &error));
+	g_assert_no_error (error);
+	uris = soup_server_get_uris (ts->server);
+	g_assert (uris);
+	ts->port = soup_uri_get_port ((SoupURI*) uris->data);
+	g_slist_free_full (uris, (GDestroyNotify) soup_uri_free);
+
+	g_mutex_lock (&ts->mutex);
+	ts->ready = TRUE;
+	g_cond_signal (&ts->cond);
+	g_mutex_unlock (&ts->mutex);
+
+	g_main_loop_run (ts->loop);
+
+	g_object_unref (ts->server);
+	g_main_context_pop_thread_default (ts->context);
+	return NULL;
+}
+
+static TestServer *
+test_server_start (gchar *reply)
+{
+	TestServer *ts;
+
+	ts = g_new0 (TestServer, 1);
+	ts->reply = reply;
+	ts->context = g_main_context_new ();
+	ts->loop = g_main_loop_new (ts->context, FALSE);
+	g_mutex_init (&ts->mutex);
+	g_cond_init (&ts->cond);
+
+	ts->thread = g_thread_new ("web-test-server", (GThreadFunc) server_thread, ts);
+	g_mutex_lock (&ts->mutex);
+	while (!ts->ready)
+		g_cond_wait (&ts->cond, &ts->mutex);
+	g_mutex_unlock (&ts->mutex);
+	return ts;
+}
+
+static gboolean
+quit_loop (GMainLoop *loop)
+{
+	g_main_loop_quit (loop);
+	return G_SOURCE_REMOVE;
+}
+
+static void
+test_server_stop (TestServer *ts)
+{
+	g_main_context_invoke (ts->context, (GSourceFunc) quit_loop, ts->loop);
+	g_thread_join (ts->thread);
+	g_main_loop_unref (ts->loop);
+	g_main_context_unref (ts->context);
+	g_mutex_clear (&ts->mutex);
+	g_cond_clear (&ts->cond);
+	g_free (ts->reply);
+	g_free (ts);
+}
+
+/*
+ * Compact encoding, as done by the gda_compact_encode_value() PHP function
+ */
+static void
+encode_null (GByteArray *array)
+{
+	guint8 tag = WEB_COMPACT_NULL;
+	g_byte_array_append (array, &tag, 1);
+}
+
+static void
+encode_text (GByteArray *array, const gchar *text)
+{
+	guint8 tag = WEB_COMPACT_TEXT;
+	guint32 len;
+	len = GUINT32_TO_LE (strlen (text));
+	g_byte_array_append (array, &tag, 1);
+	g_byte_array_append (array, (guint8*) &len, 4);
+	g_byte_array_append (array, (guint8*) text, strlen (text));
+}
+
+static void
+encode_int (GByteArray *array, gint64 value)
+{
+	guint8 tag = WEB_COMPACT_INT;
+	guint64 v;
+	v = GUINT64_TO_LE ((guint64) value);
+	g_byte_array_append (array, &tag, 1);
+	g_byte_array_append (array, (guint8*) &v, 8);
+}
+
+static void
+encode_double (GByteArray *array, gdouble value)
+{
+	guint8 tag = WEB_COMPACT_DOUBLE;
+	guint64 v;
+	memcpy (&v, &value, 8);
+	v = GUINT64_TO_LE (v);
+	g_byte_array_append (array, &tag, 1);
+	g_byte_array_append (array, (guint8*) &v, 8);
+}
+
+/* columns: id (gint), name (string, NULL every 10 rows), ratio (gdouble), day (GDate, sent as text)
+ * and big (gint, too big for odd rows) */
+static gchar *
+create_encoded_rows (gint nrows)
+{
+	GByteArray *array;
+	gchar *encoded;
+	gint i;
+
+	array = g_byte_array_new ();
+	for (i = 0; i < nrows; i++) {
+		gchar *tmp;
+		encode_int (array, i);
+		if (i % 10 == 0)
+			encode_null (array);
+		else {
+			tmp = g_strdup_printf ("name%d", i);
+			encode_text (array, tmp);
+			g_free (tmp);
+		}
+		encode_double (array, i / 4.);
+		tmp = g_strdup_printf ("2026-01-%02d", i % 28 + 1);
+		encode_text (array, tmp);
+		g_free (tmp);
+		encode_int (array, (i % 2) ? G_MAXINT64 - i : -i);
+	}
+	encoded = g_base64_encode (array->data, array->len);
+	g_byte_array_unref (array);
+	return encoded;
+}
+
+static void
+check_rows (WebCompactData *compact)
+{
+	GType column_types [NB_COLS] = {G_TYPE_INT, G_TYPE_STRING, G_TYPE_DOUBLE, G_TYPE_DATE, G_TYPE_INT};
+	GError *error = NULL;
+	GdaRow *row;
+	gint i;
+
+	g_assert_cmpint (_gda_web_compact_data_get_n_rows (compact), ==, NB_ROWS);
+
+	/* read backwards, as a random access data model may do */
+	for (i = NB_ROWS - 1; i >= 0; i--) {
+		GValue *value;
+
+		row = gda_row_new (NB_COLS);
+		g_assert (_gda_web_compact_data_fill_row (compact, i, row, column_types, &error));
+		g_assert_no_error (error);
+
+		value = gda_row_get_value (row, 0);
+		g_assert_cmpint (g_value_get_int (value), ==, i);
+
+		value = gda_row_get_value (row, 1);
+		if (i % 10 == 0)
+			g_assert (gda_value_is_null (value));
+		else {
+			gchar *tmp;
+			tmp = g_strdup_printf ("name%d", i);
+			g_assert_cmpstr (g_value_get_string (value), ==, tmp);
+			g_free (tmp);
+		}
+
+		value = gda_row_get_value (row, 2);
+		g_assert_cmpfloat (g_value_get_double (value), ==, i / 4.);
+
+		value = gda_row_get_value (row, 3);
+		g_assert (G_VALUE_TYPE (value) == G_TYPE_DATE);
+		g_assert_cmpint (g_date_get_day ((GDate*) g_value_get_boxed (value)), ==, i % 28 + 1);
+
+		value = gda_row_get_value (row, 4);
+		if (i % 2)
+			g_assert (! gda_row_value_is_valid (row, value));
+		else
+			g_assert_cmpint (g_value_get_int (value), ==, -i);
+		g_object_unref (row);
+	}
+
+	row = gda_row_new (NB_COLS);
+	g_assert (! _gda_web_compact_data_fill_row (compact, NB_ROWS, row, column_types, &error));
+	g_assert_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ROW_OUT_OF_RANGE_ERROR);
+	g_clear_error (&error);
+	g_object_unref (row);
+}
+
+static void
+test_compact_server (void)
+{
+	TestServer *ts;
+	SoupSession *session;
+	SoupMessage *msg;
+	gchar *encoded, *url;
+	const gchar *body, *ptr;
+	guint status;
+	xmlDocPtr doc;
+	xmlNodePtr node;
+	WebCompactData *compact = NULL;
+
+	encoded = create_encoded_rows (NB_ROWS);
+	ts = test_server_start (g_strdup_printf ("NOHASH\n<?xml version=\"1.0\"?>\n"
+						 "<reply><status>OK</status><gda_array>"
+						 "<gda_array_field id=\"FI0\" name=\"id\" gdatype=\"gint\"/>"
+						 "<gda_array_field id=\"FI1\" name=\"name\" gdatype=\"gchararray\"/>"
+						 "<gda_array_field id=\"FI2\" name=\"ratio\" gdatype=\"gdouble\"/>"
+						 "<gda_array_field id=\"FI3\" name=\"day\" gdatype=\"GDate\"/>"
+						 "<gda_array_field id=\"FI4\" name=\"big\" gdatype=\"gint\"/>"
+						 "<gda_array_compact rows=\"%d\">%s</gda_array_compact>"
+						 "</gda_array></reply>", NB_ROWS, encoded));
+	g_free (encoded);
+
+	/* same setup as the provider's front session */
+	session = soup_session_new_with_options ("max-conns-per-host", 1, NULL);
+	if (! soup_session_has_feature (session, SOUP_TYPE_CONTENT_DECODER))
+		soup_session_add_feature_by_type (session, SOUP_TYPE_CONTENT_DECODER);
+
+	url = g_strdup_printf ("http://127.0.0.1:%u/gda-front.php", ts->port);
+	msg = soup_message_new ("POST", url);
+	g_free (url);
+	soup_message_set_request (msg, "text/plain", SOUP_MEMORY_STATIC, "NOHASH\n<request/>",
+				  strlen ("NOHASH\n<request/>"));
+	status = soup_session_send_message (session, msg);
+	g_assert_cmpuint (status, ==, SOUP_STATUS_OK);
+	g_assert (ts->compressed);
+
+	body = msg->response_body->data;
+	g_assert (g_str_has_prefix (body, "NOHASH\n"));
+	ptr = body + strlen ("NOHASH\n");
+	doc = xmlParseMemory (ptr, msg->response_body->length - (ptr - body));
+	g_assert (doc);
+
+	for (node = xmlDocGetRootElement (doc)->children; node; node = node->next) {
+		if (!strcmp ((gchar*) node->name, "gda_array")) {
+			xmlNodePtr child;
+			for (child = node->children; child; child = child->next) {
+				if (!strcmp ((gchar*) child->name, "gda_array_compact")) {
+					xmlChar *prop, *contents;
+					GError *error = NULL;
+
+					prop = xmlGetProp (child, BAD_CAST "rows");
+					contents = xmlNodeGetContent (child);
+					compact = _gda_web_compact_data_new ((gchar*) contents, NB_COLS,
+									     atoi ((gchar*) prop), &error);
+					g_assert_no_error (error);
+					xmlFree (prop);
+					xmlFree (contents);
+				}
+			}
+		}
+	}
+	g_assert (compact);
+	check_rows (compact);
+	_gda_web_compact_data_free (compact);
+
+	xmlFreeDoc (doc);
+	g_object_unref (msg);
+	g_object_unref (session);
+	test_server_stop (ts);
+}
+
+static void
+test_compact_invalid (void)
+{
+	WebCompactData *compact;
+	GError *error = NULL;
+	gchar *encoded, *truncated;
+
+	encoded = create_encoded_rows (10);
+
+	/* wrong number of rows */
+	compact = _gda_web_compact_data_new (encoded, NB_COLS, 11, &error);
+	g_assert (!compact);
+	g_assert_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR);
+	g_clear_error (&error);
+
+	compact = _gda_web_compact_data_new (encoded, NB_COLS, 9, &error);
+	g_assert (!compact);
+	g_assert_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR);
+	g_clear_error (&error);
+
+	/* truncated data */
+	truncated = g_strndup (encoded, (strlen (encoded) / 8) * 4);
+	compact = _gda_web_compact_data_new (truncated, NB_COLS, 10, &error);
+	g_assert (!compact);
+	g_assert_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_DATA_ERROR);
+	g_clear_error (&error);
+	g_free (truncated);
+
+	/* no row at all */
+	compact = _gda_web_compact_data_new ("", NB_COLS, 0, &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (_gda_web_compact_data_get_n_rows (compact), ==, 0);
+	_gda_web_compact_data_free (compact);
+
+	g_free (encoded);
+}
+
+int
+main (int argc, char *argv[])
+{
+	gda_init ();
+	g_test_init (&argc, &argv, NULL);
+
+	g_test_add_func ("/web/compact/server", test_compact_server);
+	g_test_add_func ("/web/compact/invalid", test_compact_invalid);
+
+	return g_test_run ();
+}
@@ -10,6 +10,13 @@ include_once "gda-config.php";
 
 header ('Content-type: text/plain; charset=UTF-8');
 
+/*
+ * Compress the reply if the client accepts it (ob_gzhandler() checks the Accept-Encoding header),
+ * the reply is then sent in chunks as it is read from the worker's reply file
+ */
+if (! extension_loaded ("zlib") || ! ob_start ("ob_gzhandler"))
+	ob_start ();
+
 $datafile = null;
 
 try {
@@ -50,7 +57,12 @@ try {
 		throw new Exception ("No reply");
 
 	$file = fopen ($datafile, 'rb');
-	fpassthru ($file);
+	while (! feof ($file)) {
+		echo fread ($file, 65536);
+		ob_flush ();
+		flush ();
+	}
+	fclose ($file);
 	if (isset ($log)) {
 		$tmp = file_get_contents ($datafile);
 		$log->lwrite ("RESPONSE: [$tmp]");
@@ -104,6 +104,39 @@ function mdb2_type_to_gtype ($mdb2type)
 	}
 }
 
+/*
+ * Compact result encoding of a single value (see the provider's README): a tag byte
+ * followed by the value. Integers and doubles are sent in binary form when
+ * it can be done without any loss, and all the other values are sent as text.
+ */
+function gda_compact_encode_value ($value, $gtype)
+{
+	if (is_null ($value))
+		return chr (0);
+
+	$value = (string) $value;
+	if (($gtype == "gint") && preg_match ('/^-?[0-9]+$/', $value)) {
+		$int = intval ($value);
+		if ((string) $int === $value) {
+			if (PHP_INT_SIZE >= 8)
+				return chr (2).pack ("V", $int & 0xffffffff).pack ("V", ($int >> 32) & 0xffffffff);
+			else
+				return chr (2).pack ("V", $int).pack ("V", ($int < 0) ? -1 : 0);
+		}
+	}
+	else if (($gtype == "gdouble") &&
+		 preg_match ('/^[-+]?([0-9]+\.?[0-9]*|\.[0-9]+)([eE][-+]?[0-9]+)?$/', $value)) {
+		$double = floatval ($value);
+		if (is_finite ($double)) {
+			$bin = pack ("d", $double);
+			if (pack ("S", 1) != pack ("v", 1))
+				$bin = strrev ($bin);
+			return chr (3).$bin;
+		}
+	}
+	return chr (1).pack ("V", strlen ($value)).$value;
+}
+
 /**
  * Logging class:
  * - contains lfile, lopen and lwrite methods
@@ -399,6 +399,7 @@ function gda_handle_xml ($xml, &$doquit)
 				$argsnode = null;
 				$pstmt_hash = null;
 				$type_is_result = false;
+				$compact = false;
 
 				foreach ($child->children() as $sqlnode) {
 					if ($sqlnode->getName() == "sql") {
@@ -414,6 +415,8 @@ function gda_handle_xml ($xml, &$doquit)
 						$argsnode = $sqlnode;
 					else if ($sqlnode->getName() == "preparehash")
 						$pstmt_hash = $sqlnode[0];
+					else if ($sqlnode->getName() == "encoding")
+						$compact = ((string) $sqlnode[0] == "compact");
 				}
 				if (! isset ($sql))
 					throw new GdaException('Bad XML input', true);
@@ -422,7 +425,7 @@ function gda_handle_xml ($xml, &$doquit)
 				if (!isset ($mdb2))
 					$mdb2 = real_connect ($_SESSION['dsn'], $reply);
 
-				do_exec ($reply, $mdb2, $pstmt_hash, $sql, $type_is_result, $argsnode);
+				do_exec ($reply, $mdb2, $pstmt_hash, $sql, $type_is_result, $argsnode, $compact);
 				$status = "OK";
 				break;
 			case "BEGIN":
@@ -591,7 +594,7 @@ function do_unprepare ($reply, &$mdb2, $pstmt_hash)
 	}
 }
 
-function do_exec ($reply, &$mdb2, $pstmt_hash, $sql, $type_is_result, $argsnode)
+function do_exec ($reply, &$mdb2, $pstmt_hash, $sql, $type_is_result, $argsnode, $compact = false)
 {
 	/* get prepared statement */
 	global $prepared_statements;
@@ -656,13 +659,31 @@ function do_exec ($reply, &$mdb2, $pstmt_hash, $sql, $type_is_result, $argsnode)
 			$field->addAttribute ("nullok", "TRUE");
 		}
 		
-		$data = $node->addChild ("gda_array_data", null);
-		while (($row = $res->fetchRow())) {
-			// MDB2's default fetchmode is MDB2_FETCHMODE_ORDERED
-			$xmlrow = $data->addChild ("gda_array_row", null);
-			for ($i = 0; $i < $ncols; $i++) {
-				$val = $xmlrow->addChild ("gda_value");
-				$val[0] = str_replace ("&", "&amp;", $row[$i]);
+		if ($compact) {
+			/* see the "Compact result encoding" section of the provider's README */
+			$nrows = 0;
+			$encoded = "";
+			while (($row = $res->fetchRow())) {
+				for ($i = 0; $i < $ncols; $i++) {
+					if (isset ($gtypes))
+						$encoded .= gda_compact_encode_value ($row[$i], $gtypes[$i]);
+					else
+						$encoded .= gda_compact_encode_value ($row[$i], "gchararray");
+				}
+				$nrows++;
+			}
+			$data = $node->addChild ("gda_array_compact", base64_encode ($encoded));
+			$data->addAttribute ("rows", $nrows);
+		}
+		else {
+			$data = $node->addChild ("gda_array_data", null);
+			while (($row = $res->fetchRow())) {
+				// MDB2's default fetchmode is MDB2_FETCHMODE_ORDERED
+				$xmlrow = $data->addChild ("gda_array_row", null);
+				for ($i = 0; $i < $ncols; $i++) {
+					$val = $xmlrow->addChild ("gda_value");
+					$val[0] = str_replace ("&", "&amp;", $row[$i]);
+				}
 			}
 		}
 	}
@@ -0,0 +1,336 @@
+/* check-data-model-cursor.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+#include <glib.h>
+#include <glib/gi18n.h>
+#include <locale.h>
+#include <string.h>
+#include <libgda/libgda.h>
+#include <libgda/providers-support/gda-data-select-priv.h>
+#include <libgda/gda-row-private.h>
+
+#define NB_ROWS 50
+
+typedef struct {
+  GdaConnection *cnn;
+} CheckCursor;
+
+static void
+init_data (CheckCursor *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GError *error = NULL;
+  gchar *cstr;
+  gint i;
+
+  cstr = g_strdup_printf ("DB_DIR=%s;DB_NAME=cursor", BUILD_DIR);
+  data->cnn = gda_connection_open_from_string ("SQLite", cstr, NULL,
+                                               GDA_CONNECTION_OPTIONS_NONE, &error);
+  g_free (cstr);
+  g_assert_no_error (error);
+
+  gda_connection_execute_non_select_command (data->cnn, "DROP TABLE IF EXISTS users", NULL);
+  gda_connection_execute_non_select_command (data->cnn,
+                                             "CREATE TABLE users (id INTEGER PRIMARY KEY, name TEXT)",
+                                             &error);
+  g_assert_no_error (error);
+  for (i = 0; i < NB_ROWS; i++) {
+    gchar *sql;
+    if (i % 10 == 0)
+      sql = g_strdup_printf ("INSERT INTO users (id, name) VALUES (%d, NULL)", i);
+    else
+      sql = g_strdup_printf ("INSERT INTO users (id, name) VALUES (%d, 'user%d')", i, i);
+    g_assert_cmpint (gda_connection_execute_non_select_command (data->cnn, sql, &error), ==, 1);
+    g_assert_no_error (error);
+    g_free (sql);
+  }
+}
+
+static void
+finish_data (CheckCursor *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  g_object_unref (data->cnn);
+}
+
+static GdaDataModel *
+run_select (CheckCursor *data, GdaStatementModelUsage usage)
+{
+  GdaSqlParser *parser;
+  GdaStatement *stmt;
+  GdaDataModel *model;
+  GError *error = NULL;
+
+  parser = gda_connection_create_parser (data->cnn);
+  stmt = gda_sql_parser_parse_string (parser, "SELECT id, name FROM users ORDER BY id", NULL, &error);
+  g_assert_no_error (error);
+  model = gda_connection_statement_execute_select_full (data->cnn, stmt, NULL, usage, NULL, &error);
+  g_assert_no_error (error);
+  g_assert (model);
+  g_object_unref (stmt);
+  g_object_unref (parser);
+  return model;
+}
+
+/* reads all the rows of @model using a GdaDataModelCursor and checks the values */
+static void
+check_model (GdaDataModel *model)
+{
+  GdaDataModelCursor *cursor;
+  GError *error = NULL;
+  gint nrows = 0;
+
+  cursor = gda_data_model_cursor_new (model);
+  g_assert_cmpint (gda_data_model_cursor_get_n_columns (cursor), ==, 2);
+  g_assert_cmpint (gda_data_model_cursor_get_row (cursor), ==, -1);
+  g_assert (gda_data_model_cursor_get_value (cursor, 0) == NULL);
+
+  while (gda_data_model_cursor_move_next (cursor, &error)) {
+    const GValue *value;
+    g_assert_cmpint (gda_data_model_cursor_get_row (cursor), ==, nrows);
+
+    value = gda_data_model_cursor_get_value (cursor, 0);
+    g_assert (value);
+    g_assert_cmpint (g_value_get_int (value), ==, nrows);
+
+    value = gda_data_model_cursor_get_value (cursor, 1);
+    g_assert (value);
+    if (nrows % 10 == 0)
+      g_assert (gda_value_is_null (value));
+    else {
+      gchar *tmp;
+      tmp = g_strdup_printf ("user%d", nrows);
+      g_assert_cmpstr (g_value_get_string (value), ==, tmp);
+      g_free (tmp);
+    }
+    g_assert (gda_data_model_cursor_get_value (cursor, 2) == NULL);
+    nrows++;
+  }
+  g_assert_no_error (error);
+  g_assert_cmpint (nrows, ==, NB_ROWS);
+  g_assert_cmpint (gda_data_model_cursor_get_row (cursor), ==, -1);
+  g_assert (! gda_data_model_cursor_move_next (cursor, NULL));
+  gda_data_model_cursor_unref (cursor);
+}
+
+static void
+test_random (CheckCursor *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  model = run_select (data, GDA_STATEMENT_MODEL_RANDOM_ACCESS);
+  check_model (model);
+  g_object_unref (model);
+}
+
+static void
+test_forward (CheckCursor *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  model = run_select (data, GDA_STATEMENT_MODEL_CURSOR_FORWARD);
+  check_model (model);
+  g_object_unref (model);
+}
+
+static void
+test_array (CheckCursor *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model, *copy;
+  model = run_select (data, GDA_STATEMENT_MODEL_RANDOM_ACCESS);
+  copy = (GdaDataModel*) gda_data_model_array_copy_model (model, NULL);
+  g_assert (copy);
+  check_model (copy);
+  g_object_unref (copy);
+  g_object_unref (model);
+}
+
+static void
+test_export (CheckCursor *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  gchar *random_csv, *forward_csv;
+
+  model = run_select (data, GDA_STATEMENT_MODEL_RANDOM_ACCESS);
+  random_csv = gda_data_model_export_to_string (model, GDA_DATA_MODEL_IO_TEXT_SEPARATED,
+                                                NULL, 0, NULL, 0, NULL);
+  g_object_unref (model);
+
+  model = run_select (data, GDA_STATEMENT_MODEL_CURSOR_FORWARD);
+  forward_csv = gda_data_model_export_to_string (model, GDA_DATA_MODEL_IO_TEXT_SEPARATED,
+                                                 NULL, 0, NULL, 0, NULL);
+  g_object_unref (model);
+
+  gchar **lines;
+  lines = g_strsplit (random_csv, "\n", -1);
+  g_assert_cmpint (g_strv_length (lines), ==, NB_ROWS);
+  g_assert (strstr (lines[1], "user1"));
+  g_strfreev (lines);
+  g_assert_cmpstr (random_csv, ==, forward_csv);
+  g_free (random_csv);
+  g_free (forward_csv);
+}
+
+/* exporting a cursor based data model whose iterator is already positioned starts at the
+ * iterator's row, and leaves the iterator after the last row */
+static void
+test_export_positioned (CheckCursor *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  GdaDataModelIter *iter;
+  GdaDataModelCursor *cursor;
+  gchar *csv, **lines;
+  gint i;
+
+  model = run_select (data, GDA_STATEMENT_MODEL_CURSOR_FORWARD);
+  iter = gda_data_model_create_iter (model);
+  for (i = 0; i < 3; i++)
+    g_assert (gda_data_model_iter_move_next (iter));
+  g_assert_cmpint (gda_data_model_iter_get_row (iter), ==, 2);
+
+  csv = gda_data_model_export_to_string (model, GDA_DATA_MODEL_IO_TEXT_SEPARATED,
+                                         NULL, 0, NULL, 0, NULL);
+  lines = g_strsplit (csv, "\n", -1);
+  g_assert_cmpint (g_strv_length (lines), ==, NB_ROWS - 2);
+  g_assert (g_str_has_prefix (lines[0], "2,"));
+  g_assert (g_str_has_prefix (lines[NB_ROWS - 3], "49,"));
+  g_strfreev (lines);
+  g_free (csv);
+
+  g_assert (! gda_data_model_iter_is_valid (iter));
+  g_assert_cmpint (gda_data_model_iter_get_row (iter), ==, -1);
+  g_object_unref (iter);
+  g_object_unref (model);
+
+  /* a cursor freed before the end leaves the iterator on the cursor's row */
+  model = run_select (data, GDA_STATEMENT_MODEL_CURSOR_FORWARD);
+  iter = gda_data_model_create_iter (model);
+  g_assert (gda_data_model_iter_move_next (iter));
+  g_assert (gda_data_model_iter_move_next (iter));
+  cursor = gda_data_model_cursor_new (model);
+  g_assert (gda_data_model_cursor_move_next (cursor, NULL));
+  g_assert_cmpint (gda_data_model_cursor_get_row (cursor), ==, 1);
+  g_assert_cmpint (g_value_get_int (gda_data_model_cursor_get_value (cursor, 0)), ==, 1);
+  g_assert (gda_data_model_cursor_move_next (cursor, NULL));
+  g_assert (gda_data_model_cursor_move_next (cursor, NULL));
+  g_assert_cmpint (gda_data_model_cursor_get_row (cursor), ==, 3);
+  gda_data_model_cursor_unref (cursor);
+
+  g_assert (gda_data_model_iter_is_valid (iter));
+  g_assert_cmpint (gda_data_model_iter_get_row (iter), ==, 3);
+  g_assert_cmpint (g_value_get_int (gda_data_model_iter_get_value_at (iter, 0)), ==, 3);
+  g_assert (gda_data_model_iter_move_next (iter));
+  g_assert_cmpint (g_value_get_int (gda_data_model_iter_get_value_at (iter, 0)), ==, 4);
+  g_object_unref (iter);
+  g_object_unref (model);
+}
+
+/* the strings of the rows are stored in memory pages shared by several rows: check that
+ * copied values remain valid once the rows and the data model are destroyed */
+static void
+test_strings (CheckCursor *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  GdaDataModelCursor *cursor;
+  GPtrArray *copies;
+  GError *error = NULL;
+  gchar *long_name, *sql;
+  guint i;
+
+  long_name = g_strnfill (10000, 'x');
+  sql = g_strdup_printf ("INSERT INTO users (id, name) VALUES (%d, '%s')", NB_ROWS, long_name);
+  g_assert_cmpint (gda_connection_execute_non_select_command (data->cnn, sql, &error), ==, 1);
+  g_assert_no_error (error);
+  g_free (sql);
+
+  copies = g_ptr_array_new_with_free_func ((GDestroyNotify) gda_value_free);
+  model = run_select (data, GDA_STATEMENT_MODEL_CURSOR_FORWARD);
+  cursor = gda_data_model_cursor_new (model);
+  while (gda_data_model_cursor_move_next (cursor, &error))
+    g_ptr_array_add (copies, gda_value_copy (gda_data_model_cursor_get_value (cursor, 1)));
+  g_assert_no_error (error);
+  gda_data_model_cursor_unref (cursor);
+  g_object_unref (model);
+
+  g_assert_cmpint (copies->len, ==, NB_ROWS + 1);
+  for (i = 0; i < NB_ROWS; i++) {
+    GValue *value = g_ptr_array_index (copies, i);
+    if (i % 10 == 0)
+      g_assert (gda_value_is_null (value));
+    else {
+      gchar *tmp;
+      tmp = g_strdup_printf ("user%d", i);
+      g_assert_cmpstr (g_value_get_string (value), ==, tmp);
+      g_free (tmp);
+    }
+  }
+  g_assert_cmpstr (g_value_get_string (g_ptr_array_index (copies, NB_ROWS)), ==, long_name);
+  g_ptr_array_unref (copies);
+  g_free (long_name);
+}
+
+/* a row filled again for each fetched row, as providers do in cursor mode, must not keep
+ * the memory pages of its previous values */
+static void
+test_reused_row (CheckCursor *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  GdaRow *row;
+  gchar *str;
+  guint i;
+
+  model = run_select (data, GDA_STATEMENT_MODEL_CURSOR_FORWARD);
+  row = gda_row_new (1);
+  str = g_strnfill (1000, 'x');
+  for (i = 0; i < 1000; i++) {
+    GValue *value;
+    value = gda_row_get_value (row, 0);
+    gda_data_select_row_reset (GDA_DATA_SELECT (model), row);
+    g_assert_cmpuint (_gda_row_get_n_held_data (row), ==, 0);
+    g_assert_true (gda_value_is_null (value));
+
+    str [0] = 'a' + (i % 26);
+    gda_data_select_row_set_string (GDA_DATA_SELECT (model), row, value, str, -1);
+    g_assert_cmpuint (_gda_row_get_n_held_data (row), ==, 1);
+    g_assert_cmpstr (g_value_get_string (value), ==, str);
+  }
+  g_free (str);
+
+  /* the row's strings remain valid after the data model has been destroyed */
+  g_object_unref (model);
+  g_assert_cmpint (strlen (g_value_get_string (gda_row_get_value (row, 0))), ==, 1000);
+  g_object_unref (row);
+}
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  setlocale (LC_ALL,"");
+
+  gda_init ();
+
+  g_test_init (&argc,&argv,NULL);
+
+  g_test_add ("/gda/cursor/random", CheckCursor, NULL, init_data, test_random, finish_data);
+  g_test_add ("/gda/cursor/forward", CheckCursor, NULL, init_data, test_forward, finish_data);
+  g_test_add ("/gda/cursor/array", CheckCursor, NULL, init_data, test_array, finish_data);
+  g_test_add ("/gda/cursor/export", CheckCursor, NULL, init_data, test_export, finish_data);
+  g_test_add ("/gda/cursor/export-positioned", CheckCursor, NULL, init_data, test_export_positioned, finish_data);
+  g_test_add ("/gda/cursor/strings", CheckCursor, NULL, init_data, test_strings, finish_data);
+  g_test_add ("/gda/cursor/reused-row", CheckCursor, NULL, init_data, test_reused_row, finish_data);
+
+  return g_test_run();
+}
@@ -0,0 +1,280 @@
+/* check-data-model-snapshot.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+#include <glib.h>
+#include <glib/gi18n.h>
+#include <glib/gstdio.h>
+#include <locale.h>
+#include <string.h>
+#include <libgda/libgda.h>
+
+#define NB_ROWS 100
+
+typedef struct {
+  gchar *filename;
+} CheckSnapshot;
+
+static void
+init_data (CheckSnapshot *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  data->filename = g_build_filename (BUILD_DIR, "snapshot.gdasnap", NULL);
+  g_unlink (data->filename);
+}
+
+static void
+finish_data (CheckSnapshot *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  g_unlink (data->filename);
+  g_free (data->filename);
+}
+
+/* columns: id (int), name (string, repeated, NULL every 10 rows), ratio (double), day (date),
+ * data (binary) and nothing (always NULL) */
+static GdaDataModel *
+create_model (void)
+{
+  GdaDataModel *model;
+  const gchar *names[] = {"id", "name", "ratio", "day", "data", "nothing"};
+  GError *error = NULL;
+  gint i, j;
+
+  model = gda_data_model_array_new_with_g_types (6, G_TYPE_INT, G_TYPE_STRING, G_TYPE_DOUBLE,
+                                                 G_TYPE_DATE, GDA_TYPE_BINARY, GDA_TYPE_NULL);
+  for (j = 0; j < 6; j++)
+    gda_column_set_name (gda_data_model_describe_column (model, j), names[j]);
+
+  for (i = 0; i < NB_ROWS; i++) {
+    GValue *value;
+    gchar *tmp;
+
+    g_assert_cmpint (gda_data_model_append_row (model, &error), ==, i);
+    g_assert_no_error (error);
+
+    value = gda_value_new (G_TYPE_INT);
+    g_value_set_int (value, i);
+    g_assert (gda_data_model_set_value_at (model, 0, i, value, &error));
+    gda_value_free (value);
+
+    if (i % 10 == 0)
+      value = gda_value_new_null ();
+    else {
+      tmp = g_strdup_printf ("name%d", i % 7);
+      value = gda_value_new_from_string (tmp, G_TYPE_STRING);
+      g_free (tmp);
+    }
+    g_assert (gda_data_model_set_value_at (model, 1, i, value, &error));
+    gda_value_free (value);
+
+    value = gda_value_new (G_TYPE_DOUBLE);
+    g_value_set_double (value, i / 4.);
+    g_assert (gda_data_model_set_value_at (model, 2, i, value, &error));
+    gda_value_free (value);
+
+    tmp = g_strdup_printf ("2026-01-%02d", i % 28 + 1);
+    value = gda_value_new_from_string (tmp, G_TYPE_DATE);
+    g_free (tmp);
+    g_assert (gda_data_model_set_value_at (model, 3, i, value, &error));
+    gda_value_free (value);
+
+    tmp = g_strnfill (i, 'b');
+    value = gda_value_new_binary ((const guchar*) tmp, i);
+    g_free (tmp);
+    g_assert (gda_data_model_set_value_at (model, 4, i, value, &error));
+    gda_value_free (value);
+    g_assert_no_error (error);
+  }
+  return model;
+}
+
+static void
+test_roundtrip (CheckSnapshot *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model, *snap;
+  const GValue *value, *value2;
+  GError *error = NULL;
+  gint i, j;
+
+  model = create_model ();
+  g_assert (gda_data_model_snapshot_save (model, data->filename, &error));
+  g_assert_no_error (error);
+
+  snap = gda_data_model_snapshot_new (data->filename, &error);
+  g_assert_no_error (error);
+  g_assert (GDA_IS_DATA_MODEL_SNAPSHOT (snap));
+  g_assert_cmpint (gda_data_model_get_n_rows (snap), ==, NB_ROWS);
+  g_assert_cmpint (gda_data_model_get_n_columns (snap), ==, 6);
+  g_assert (gda_data_model_get_access_flags (snap) & GDA_DATA_MODEL_ACCESS_RANDOM);
+
+  for (j = 0; j < 6; j++) {
+    GdaColumn *c1, *c2;
+    c1 = gda_data_model_describe_column (model, j);
+    c2 = gda_data_model_describe_column (snap, j);
+    g_assert_cmpstr (gda_column_get_name (c1), ==, gda_column_get_name (c2));
+    g_assert (gda_column_get_g_type (c1) == gda_column_get_g_type (c2));
+  }
+
+  /* read backwards, to check random access */
+  for (i = NB_ROWS - 1; i >= 0; i--) {
+    for (j = 0; j < 5; j++) {
+      value = gda_data_model_get_value_at (model, j, i, &error);
+      g_assert_no_error (error);
+      value2 = gda_data_model_get_value_at (snap, j, i, &error);
+      g_assert_no_error (error);
+      g_assert (value2);
+      g_assert (gda_value_differ (value, value2) == 0);
+    }
+    value2 = gda_data_model_get_value_at (snap, 5, i, &error);
+    g_assert_no_error (error);
+    g_assert (gda_value_is_null (value2));
+  }
+
+  /* strings are shared by the rows using them */
+  value = gda_data_model_get_value_at (snap, 1, 1, NULL);
+  value2 = gda_data_model_get_value_at (snap, 1, 8, NULL);
+  g_assert (value == value2);
+  g_assert_cmpstr (g_value_get_string (value), ==, "name1");
+
+  /* binary values point into the file, using a single value per column */
+  value = gda_data_model_get_value_at (snap, 4, 3, NULL);
+  g_assert_cmpint (gda_binary_get_size (gda_value_get_binary (value)), ==, 3);
+  value2 = gda_data_model_get_value_at (snap, 4, 7, NULL);
+  g_assert (value == value2);
+  g_assert_cmpint (gda_binary_get_size (gda_value_get_binary (value)), ==, 7);
+  g_assert (memcmp (gda_binary_get_data (gda_value_get_binary (value)), "bbbbbbb", 7) == 0);
+
+  g_assert (gda_data_model_get_attributes_at (snap, 1, 10) & GDA_VALUE_ATTR_IS_NULL);
+  g_assert (! (gda_data_model_get_attributes_at (snap, 0, 10) & GDA_VALUE_ATTR_CAN_BE_NULL));
+
+  g_assert (! gda_data_model_get_value_at (snap, 0, NB_ROWS, &error));
+  g_assert_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ROW_OUT_OF_RANGE_ERROR);
+  g_clear_error (&error);
+
+  /* the snapshot can be replaced while opened */
+  g_assert (gda_data_model_snapshot_save (snap, data->filename, &error));
+  g_assert_no_error (error);
+  g_object_unref (snap);
+
+  snap = gda_data_model_snapshot_new (data->filename, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (gda_data_model_get_n_rows (snap), ==, NB_ROWS);
+  value = gda_data_model_get_value_at (snap, 3, 5, &error);
+  g_assert_no_error (error);
+  g_assert (G_VALUE_TYPE (value) == G_TYPE_DATE);
+  g_assert_cmpint (g_date_get_day ((GDate*) g_value_get_boxed (value)), ==, 6);
+  g_object_unref (snap);
+  g_object_unref (model);
+}
+
+/* snapshot of a data model which can only be read once, with a column of unknown type */
+static void
+test_cursor (CheckSnapshot *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaConnection *cnc;
+  GdaSqlParser *parser;
+  GdaStatement *stmt;
+  GdaDataModel *model, *snap;
+  const GValue *value;
+  GError *error = NULL;
+  gchar *cstr;
+  gint i;
+
+  cstr = g_strdup_printf ("DB_DIR=%s;DB_NAME=snapshot", BUILD_DIR);
+  cnc = gda_connection_open_from_string ("SQLite", cstr, NULL, GDA_CONNECTION_OPTIONS_NONE, &error);
+  g_free (cstr);
+  g_assert_no_error (error);
+
+  parser = gda_connection_create_parser (cnc);
+  stmt = gda_sql_parser_parse_string (parser,
+                                      "WITH RECURSIVE c(x) AS (SELECT 0 UNION ALL SELECT x + 1 FROM c WHERE x < 99) "
+                                      "SELECT x, 'v' || (x % 3) FROM c", NULL, &error);
+  g_assert_no_error (error);
+  model = gda_connection_statement_execute_select_full (cnc, stmt, NULL, GDA_STATEMENT_MODEL_CURSOR_FORWARD,
+                                                        NULL, &error);
+  g_assert_no_error (error);
+  g_assert (gda_data_model_snapshot_save (model, data->filename, &error));
+  g_assert_no_error (error);
+  g_object_unref (model);
+  g_object_unref (stmt);
+  g_object_unref (parser);
+  g_object_unref (cnc);
+
+  snap = gda_data_model_snapshot_new (data->filename, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (gda_data_model_get_n_rows (snap), ==, NB_ROWS);
+  for (i = 0; i < NB_ROWS; i++) {
+    gchar *tmp;
+    value = gda_data_model_get_value_at (snap, 1, i, &error);
+    g_assert_no_error (error);
+    tmp = g_strdup_printf ("v%d", i % 3);
+    g_assert_cmpstr (g_value_get_string (value), ==, tmp);
+    g_free (tmp);
+  }
+  g_object_unref (snap);
+}
+
+static void
+test_invalid (CheckSnapshot *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model, *snap;
+  GError *error = NULL;
+  gchar *contents;
+  gsize length;
+
+  g_assert (g_file_set_contents (data->filename, "id,name\n1,foo\n", -1, NULL));
+  snap = gda_data_model_snapshot_new (data->filename, &error);
+  g_assert (! snap);
+  g_assert_error (error, GDA_DATA_MODEL_SNAPSHOT_ERROR, GDA_DATA_MODEL_SNAPSHOT_FORMAT_ERROR);
+  g_clear_error (&error);
+
+  /* truncated file */
+  model = create_model ();
+  g_assert (gda_data_model_snapshot_save (model, data->filename, &error));
+  g_assert_no_error (error);
+  g_object_unref (model);
+  g_assert (g_file_get_contents (data->filename, &contents, &length, NULL));
+  g_assert (g_file_set_contents (data->filename, contents, length / 2, NULL));
+  g_free (contents);
+  snap = gda_data_model_snapshot_new (data->filename, &error);
+  g_assert (! snap);
+  g_assert_error (error, GDA_DATA_MODEL_SNAPSHOT_ERROR, GDA_DATA_MODEL_SNAPSHOT_FORMAT_ERROR);
+  g_clear_error (&error);
+
+  g_unlink (data->filename);
+  snap = gda_data_model_snapshot_new (data->filename, &error);
+  g_assert (! snap);
+  g_assert_error (error, G_FILE_ERROR, G_FILE_ERROR_NOENT);
+  g_clear_error (&error);
+}
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  setlocale (LC_ALL,"");
+
+  gda_init ();
+
+  g_test_init (&argc,&argv,NULL);
+
+  g_test_add ("/gda/snapshot/roundtrip", CheckSnapshot, NULL, init_data, test_roundtrip, finish_data);
+  g_test_add ("/gda/snapshot/cursor", CheckSnapshot, NULL, init_data, test_cursor, finish_data);
+  g_test_add ("/gda/snapshot/invalid", CheckSnapshot, NULL, init_data, test_invalid, finish_data);
+
+  return g_test_run();
+}
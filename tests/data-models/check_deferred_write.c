@@ -0,0 +1,302 @@
+/* check-deferred-write.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+#include <glib.h>
+#include <glib/gi18n.h>
+#include <locale.h>
+#include <string.h>
+#include <libgda/libgda.h>
+
+#define NB_ROWS 10
+
+typedef struct {
+  GdaConnection *cnn;
+  GdaDataModel  *model;
+} CheckDeferred;
+
+static void
+init_data (CheckDeferred *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaSqlParser *parser;
+  GdaStatement *stmt;
+  GError *error = NULL;
+  gchar *cstr;
+  gint i;
+
+  cstr = g_strdup_printf ("DB_DIR=%s;DB_NAME=deferred", BUILD_DIR);
+  data->cnn = gda_connection_open_from_string ("SQLite", cstr, NULL,
+                                               GDA_CONNECTION_OPTIONS_NONE, &error);
+  g_free (cstr);
+  g_assert_no_error (error);
+
+  gda_connection_execute_non_select_command (data->cnn, "DROP TABLE IF EXISTS items", NULL);
+  gda_connection_execute_non_select_command (data->cnn,
+                                             "CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT, "
+                                             "qty INTEGER DEFAULT 5)",
+                                             &error);
+  g_assert_no_error (error);
+  for (i = 0; i < NB_ROWS; i++) {
+    gchar *sql;
+    sql = g_strdup_printf ("INSERT INTO items (id, name, qty) VALUES (%d, 'item%d', %d)", i, i, i);
+    g_assert_cmpint (gda_connection_execute_non_select_command (data->cnn, sql, &error), ==, 1);
+    g_assert_no_error (error);
+    g_free (sql);
+  }
+
+  parser = gda_connection_create_parser (data->cnn);
+  stmt = gda_sql_parser_parse_string (parser, "SELECT id, name, qty FROM items ORDER BY id", NULL, &error);
+  g_assert_no_error (error);
+  data->model = gda_connection_statement_execute_select_full (data->cnn, stmt, NULL,
+                                                              GDA_STATEMENT_MODEL_RANDOM_ACCESS,
+                                                              NULL, &error);
+  g_assert_no_error (error);
+  g_object_unref (stmt);
+  g_object_unref (parser);
+
+  g_assert_true (gda_data_select_compute_modification_statements (GDA_DATA_SELECT (data->model), &error));
+  g_assert_no_error (error);
+  g_object_set (data->model, "deferred-write", TRUE, NULL);
+}
+
+static void
+finish_data (CheckDeferred *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  g_object_unref (data->model);
+  g_object_unref (data->cnn);
+}
+
+/* returns the number of rows in the items table, as seen by the database */
+static gint
+count_db_rows (CheckDeferred *data, const gchar *where)
+{
+  GdaDataModel *model;
+  GError *error = NULL;
+  const GValue *cvalue;
+  gchar *sql;
+  gint count;
+
+  sql = g_strdup_printf ("SELECT count(*) FROM items WHERE %s", where);
+  model = gda_connection_execute_select_command (data->cnn, sql, &error);
+  g_free (sql);
+  g_assert_no_error (error);
+  cvalue = gda_data_model_get_value_at (model, 0, 0, &error);
+  g_assert_no_error (error);
+  if (G_VALUE_TYPE (cvalue) == G_TYPE_INT64)
+    count = (gint) g_value_get_int64 (cvalue);
+  else
+    count = g_value_get_int (cvalue);
+  g_object_unref (model);
+  return count;
+}
+
+static GList *
+make_row (gint id, const gchar *name)
+{
+  GList *values = NULL;
+  GValue *value;
+
+  value = gda_value_new (G_TYPE_INT);
+  g_value_set_int (value, id);
+  values = g_list_append (values, value);
+  value = gda_value_new (G_TYPE_STRING);
+  g_value_set_string (value, name);
+  values = g_list_append (values, value);
+  return values;
+}
+
+static void
+free_row (GList *values)
+{
+  g_list_free_full (values, (GDestroyNotify) gda_value_free);
+}
+
+static void
+test_mixed (CheckDeferred *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GError *error = NULL;
+  const GValue *cvalue;
+  GValue *value;
+  GList *values;
+  gint row;
+
+  /* UPDATE */
+  value = gda_value_new_from_string ("changed", G_TYPE_STRING);
+  g_assert_true (gda_data_model_set_value_at (data->model, 1, 0, value, &error));
+  g_assert_no_error (error);
+  gda_value_free (value);
+
+  /* DELETE */
+  g_assert_true (gda_data_model_remove_row (data->model, 1, &error));
+  g_assert_no_error (error);
+
+  /* INSERT, "qty" being computed by the database */
+  values = make_row (100, "new");
+  row = gda_data_model_append_values (data->model, values, &error);
+  g_assert_no_error (error);
+  free_row (values);
+  g_assert_cmpint (row, ==, NB_ROWS - 1);
+
+  /* nothing sent yet, but the data model shows the modifications */
+  g_assert_cmpint (count_db_rows (data, "name = 'changed'"), ==, 0);
+  g_assert_cmpint (count_db_rows (data, "1"), ==, NB_ROWS);
+  g_assert_cmpint (gda_data_model_get_n_rows (data->model), ==, NB_ROWS);
+  cvalue = gda_data_model_get_value_at (data->model, 1, 0, &error);
+  g_assert_no_error (error);
+  g_assert_cmpstr (g_value_get_string (cvalue), ==, "changed");
+  cvalue = gda_data_model_get_value_at (data->model, 0, 1, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (g_value_get_int (cvalue), ==, 2);
+  cvalue = gda_data_model_get_value_at (data->model, 2, row, &error);
+  g_assert_no_error (error);
+  g_assert_true (gda_value_is_null (cvalue));
+
+  g_assert_true (gda_data_select_flush (GDA_DATA_SELECT (data->model), &error));
+  g_assert_no_error (error);
+
+  g_assert_cmpint (count_db_rows (data, "name = 'changed'"), ==, 1);
+  g_assert_cmpint (count_db_rows (data, "id = 1"), ==, 0);
+  g_assert_cmpint (count_db_rows (data, "id = 100"), ==, 1);
+
+  /* the inserted row has been re-read */
+  cvalue = gda_data_model_get_value_at (data->model, 2, row, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (g_value_get_int (cvalue), ==, 5);
+
+  /* nothing left to flush */
+  g_assert_true (gda_data_select_flush (GDA_DATA_SELECT (data->model), &error));
+  g_assert_no_error (error);
+}
+
+static void
+test_batches (CheckDeferred *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GError *error = NULL;
+  gint i;
+
+  for (i = 0; i < 5; i++) {
+    g_assert_true (gda_data_model_remove_row (data->model, 0, &error));
+    g_assert_no_error (error);
+  }
+  for (i = 0; i < 50; i++) {
+    GList *values;
+    gchar *name;
+    name = g_strdup_printf ("batch%d", i);
+    values = make_row (1000 + i, name);
+    g_free (name);
+    g_assert_cmpint (gda_data_model_append_values (data->model, values, &error), >=, 0);
+    g_assert_no_error (error);
+    free_row (values);
+  }
+  g_assert_cmpint (gda_data_model_get_n_rows (data->model), ==, NB_ROWS - 5 + 50);
+
+  g_assert_true (gda_data_select_flush (GDA_DATA_SELECT (data->model), &error));
+  g_assert_no_error (error);
+  g_assert_cmpint (count_db_rows (data, "id < 5"), ==, 0);
+  g_assert_cmpint (count_db_rows (data, "id >= 1000 AND qty = 5"), ==, 50);
+  g_assert_cmpint (gda_data_model_get_n_rows (data->model), ==, NB_ROWS - 5 + 50);
+}
+
+static void
+test_generated_key (CheckDeferred *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GError *error = NULL;
+  const GValue *cvalue;
+  GValue *value;
+  GList *values;
+  gint row;
+
+  /* INSERT, "id" being computed by the database */
+  values = g_list_append (NULL, NULL);
+  value = gda_value_new (G_TYPE_STRING);
+  g_value_set_string (value, "auto");
+  values = g_list_append (values, value);
+  row = gda_data_model_append_values (data->model, values, &error);
+  g_assert_no_error (error);
+  free_row (values);
+  g_assert_cmpint (row, ==, NB_ROWS);
+
+  /* UPDATE of the inserted row, which can only be identified once it has been inserted */
+  value = gda_value_new_from_string ("auto-changed", G_TYPE_STRING);
+  g_assert_true (gda_data_model_set_value_at (data->model, 1, row, value, &error));
+  g_assert_no_error (error);
+  gda_value_free (value);
+
+  /* DELETE of another row */
+  g_assert_true (gda_data_model_remove_row (data->model, 0, &error));
+  g_assert_no_error (error);
+
+  g_assert_true (gda_data_select_flush (GDA_DATA_SELECT (data->model), &error));
+  g_assert_no_error (error);
+
+  g_assert_cmpint (count_db_rows (data, "1"), ==, NB_ROWS);
+  g_assert_cmpint (count_db_rows (data, "id = 0"), ==, 0);
+  g_assert_cmpint (count_db_rows (data, "name = 'auto'"), ==, 0);
+  g_assert_cmpint (count_db_rows (data, "name = 'auto-changed' AND id = 10"), ==, 1);
+
+  /* the inserted row has been re-read */
+  row = NB_ROWS - 1;
+  cvalue = gda_data_model_get_value_at (data->model, 0, row, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (g_value_get_int (cvalue), ==, 10);
+  cvalue = gda_data_model_get_value_at (data->model, 1, row, &error);
+  g_assert_no_error (error);
+  g_assert_cmpstr (g_value_get_string (cvalue), ==, "auto-changed");
+}
+
+static void
+test_rollback (CheckDeferred *data, G_GNUC_UNUSED gconstpointer user_data)
+{
+  GError *error = NULL;
+  GList *values;
+
+  g_assert_true (gda_data_model_remove_row (data->model, 0, &error));
+  g_assert_no_error (error);
+
+  /* conflicts with an existing row */
+  values = make_row (3, "duplicate");
+  g_assert_cmpint (gda_data_model_append_values (data->model, values, &error), >=, 0);
+  g_assert_no_error (error);
+  free_row (values);
+
+  g_assert_false (gda_data_select_flush (GDA_DATA_SELECT (data->model), &error));
+  g_assert_nonnull (error);
+  g_clear_error (&error);
+
+  /* the DELETE has been rolled back */
+  g_assert_cmpint (count_db_rows (data, "1"), ==, NB_ROWS);
+  g_assert_cmpint (count_db_rows (data, "id = 0"), ==, 1);
+}
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  setlocale (LC_ALL,"");
+
+  gda_init ();
+
+  g_test_init (&argc,&argv,NULL);
+
+  g_test_add ("/gda/deferred-write/mixed", CheckDeferred, NULL, init_data, test_mixed, finish_data);
+  g_test_add ("/gda/deferred-write/batches", CheckDeferred, NULL, init_data, test_batches, finish_data);
+  g_test_add ("/gda/deferred-write/generated-key", CheckDeferred, NULL, init_data, test_generated_key, finish_data);
+  g_test_add ("/gda/deferred-write/rollback", CheckDeferred, NULL, init_data, test_rollback, finish_data);
+
+  return g_test_run();
+}
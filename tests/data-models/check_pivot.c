@@ -29,6 +29,8 @@ static GdaDataModel *get_source_model (GdaConnection *cnc);
 static gint test_field_formats (GdaDataPivot *pivot);
 static gint test_column_formats (GdaDataPivot *pivot);
 static gint test_on_data (GdaConnection *cnc);
+static gint test_aggregates (GdaConnection *cnc);
+static gint test_aggregates_modified_source (GdaConnection *cnc);
 
 int
 main (G_GNUC_UNUSED int argc, G_GNUC_UNUSED char **argv)
@@ -63,6 +65,8 @@ main (G_GNUC_UNUSED int argc, G_GNUC_UNUSED char **argv)
 	g_object_unref (pivot);
 
 	number_failed += test_on_data (cnc);
+	number_failed += test_aggregates (cnc);
+	number_failed += test_aggregates_modified_source (cnc);
 
 	/* end of tests */
 	g_object_unref (cnc);
@@ -210,3 +214,160 @@ test_on_data (GdaConnection *cnc)
 	g_object_unref (pivot);
 	return number_failed;
 }
+
+/*
+ * Checks the AVG, MAX and COUNT aggregates computed for @person, the data fields being
+ * AVG (qty), MAX (qty) and COUNT (food)
+ */
+static gint
+check_aggregates (GdaDataPivot *pivot, const gchar *person, gdouble avg, gint max, guint count)
+{
+	GdaDataModel *model = GDA_DATA_MODEL (pivot);
+	gint row, nrows;
+	nrows = gda_data_model_get_n_rows (model);
+	for (row = 0; row < nrows; row++) {
+		const GValue *value;
+		value = gda_data_model_get_value_at (model, 0, row, NULL);
+		if (value && G_VALUE_HOLDS_STRING (value) && !strcmp (g_value_get_string (value), person))
+			break;
+	}
+	if (row == nrows) {
+		g_print ("Error: no row for [%s]\n", person);
+		return 1;
+	}
+
+	const GValue *value;
+	gchar *str;
+	gint nfailed = 0;
+	value = gda_data_model_get_value_at (model, 1, row, NULL);
+	if (!value || !G_VALUE_HOLDS_DOUBLE (value) || (g_value_get_double (value) != avg)) {
+		g_print ("Error: wrong AVG value for [%s]\n", person);
+		nfailed ++;
+	}
+
+	value = gda_data_model_get_value_at (model, 2, row, NULL);
+	str = value ? gda_value_stringify (value) : NULL;
+	if (!str || (atoi (str) != max)) {
+		g_print ("Error: wrong MAX value for [%s]: got [%s]\n", person, str);
+		nfailed ++;
+	}
+	g_free (str);
+
+	value = gda_data_model_get_value_at (model, 3, row, NULL);
+	if (!value || !G_VALUE_HOLDS_UINT (value) || (g_value_get_uint (value) != count)) {
+		g_print ("Error: wrong COUNT value for [%s]\n", person);
+		nfailed ++;
+	}
+	return nfailed;
+}
+
+static gint
+test_aggregates (GdaConnection *cnc)
+{
+	GdaDataModel *sources [2];
+	GType max_types [2] = {G_TYPE_INVALID, G_TYPE_INVALID};
+	GdaStatement *stmt;
+	GError *error = NULL;
+	gint number_failed = 0;
+	guint i;
+
+	/* the aggregates are computed by @cnc for the 1st source, which has not been read yet,
+	 * and by the pivot's virtual connection for the 2nd one */
+	stmt = gda_connection_parse_sql_string (cnc, "select * from food", NULL, &error);
+	g_assert (stmt);
+	sources [0] = gda_connection_statement_execute_select_full (cnc, stmt, NULL,
+								    GDA_STATEMENT_MODEL_CURSOR_FORWARD,
+								    NULL, &error);
+	g_object_unref (stmt);
+	g_assert (sources [0]);
+	sources [1] = get_source_model (cnc);
+
+	for (i = 0; i < 2; i++) {
+		GdaDataPivot *pivot;
+		pivot = GDA_DATA_PIVOT (gda_data_pivot_new (sources [i]));
+		g_object_unref (sources [i]);
+
+		if (! gda_data_pivot_add_field (pivot, GDA_DATA_PIVOT_FIELD_ROW, "person", NULL, &error) ||
+		    ! gda_data_pivot_add_data (pivot, GDA_DATA_PIVOT_AVG, "qty", NULL, &error) ||
+		    ! gda_data_pivot_add_data (pivot, GDA_DATA_PIVOT_MAX, "qty", "maxqty", &error) ||
+		    ! gda_data_pivot_add_data (pivot, GDA_DATA_PIVOT_COUNT, "food", NULL, &error) ||
+		    ! gda_data_pivot_populate (pivot, &error)) {
+			g_print ("Failed to populate pivot: %s\n",
+				 error && error->message ? error->message : "no detail");
+			g_clear_error (&error);
+			number_failed ++;
+		}
+		else {
+			gda_data_model_dump (GDA_DATA_MODEL (pivot), NULL);
+			number_failed += check_aggregates (pivot, "Janet", 16.125, 19, 8);
+			number_failed += check_aggregates (pivot, "Beth", 16., 20, 5);
+			max_types [i] = G_VALUE_TYPE (gda_data_model_get_value_at (GDA_DATA_MODEL (pivot), 2, 0, NULL));
+		}
+		g_object_unref (pivot);
+	}
+
+	/* the aggregates have the same types whichever connection computed them */
+	if (max_types [0] != max_types [1]) {
+		g_print ("Error: MAX value computed as a %s and as a %s\n",
+			 g_type_name (max_types [0]), g_type_name (max_types [1]));
+		number_failed ++;
+	}
+
+	return number_failed;
+}
+
+/*
+ * The aggregates must take into account the modifications made to the source data model and
+ * not yet written to the database: the source's SELECT statement can't be re-executed then.
+ */
+static gint
+test_aggregates_modified_source (GdaConnection *cnc)
+{
+	GdaDataModel *source;
+	GdaDataPivot *pivot;
+	GError *error = NULL;
+	gint number_failed = 0;
+
+	source = get_source_model (cnc);
+	g_assert (GDA_IS_DATA_SELECT (source));
+	if (! gda_data_select_compute_modification_statements_ext (GDA_DATA_SELECT (source),
+								   GDA_DATA_SELECT_COND_ALL_COLUMNS,
+								   &error)) {
+		g_print ("Failed to compute modification statements: %s\n",
+			 error && error->message ? error->message : "no detail");
+		g_clear_error (&error);
+		g_object_unref (source);
+		return 1;
+	}
+
+	/* remove the (Janet, 4, Car, 17) row, without writing to the database */
+	g_object_set (source, "deferred-write", TRUE, NULL);
+	if (! gda_data_model_remove_row (source, 22, &error)) {
+		g_print ("Failed to remove row: %s\n",
+			 error && error->message ? error->message : "no detail");
+		g_clear_error (&error);
+		g_object_unref (source);
+		return 1;
+	}
+
+	pivot = GDA_DATA_PIVOT (gda_data_pivot_new (source));
+	if (! gda_data_pivot_add_field (pivot, GDA_DATA_PIVOT_FIELD_ROW, "person", NULL, &error) ||
+	    ! gda_data_pivot_add_data (pivot, GDA_DATA_PIVOT_AVG, "qty", NULL, &error) ||
+	    ! gda_data_pivot_add_data (pivot, GDA_DATA_PIVOT_MAX, "qty", "maxqty", &error) ||
+	    ! gda_data_pivot_add_data (pivot, GDA_DATA_PIVOT_COUNT, "food", NULL, &error) ||
+	    ! gda_data_pivot_populate (pivot, &error)) {
+		g_print ("Failed to populate pivot: %s\n",
+			 error && error->message ? error->message : "no detail");
+		g_clear_error (&error);
+		number_failed ++;
+	}
+	else {
+		gda_data_model_dump (GDA_DATA_MODEL (pivot), NULL);
+		number_failed += check_aggregates (pivot, "Janet", 16., 19, 7);
+		number_failed += check_aggregates (pivot, "Beth", 16., 20, 5);
+	}
+	g_object_unref (pivot);
+	g_object_unref (source);
+
+	return number_failed;
+}
@@ -51,6 +51,7 @@ static gboolean check_simultanous_select_random (GdaConnection *virtual, GError
 static gboolean check_simultanous_select_forward (GdaConnection *virtual, GError **error);
 static void check_threads_select_random (GdaConnection *virtual);
 static gboolean check_date (GdaConnection *virtual, GError **error);
+static gboolean check_batched_lookup (GdaConnection *virtual, GdaConnection *out_cnc, GError **error);
 
 
 static gboolean test1 (Data *data);
@@ -218,6 +219,15 @@ test1 (Data *data) {
 		return G_SOURCE_REMOVE;
 	}
 
+	g_message ("Check batched key lookups");
+	if (!check_batched_lookup (virtual, out_cnc, &error)) {
+		g_message ("Error: Check batched key lookups: %s", error && error->message ? error->message : "No detail");
+    data->fails += 1;
+		g_clear_error (&error);
+		g_main_loop_quit (data->loop);
+		return G_SOURCE_REMOVE;
+	}
+
 	g_message ("Check Threads select ramdom");
 	check_threads_select_random (virtual);
 
@@ -840,3 +850,136 @@ check_date (GdaConnection *virtual, GError **error)
 	g_date_time_unref (ts);
 	return TRUE;
 }
+
+/*
+ * Returns: the number of statements executed by @cnc since its metrics were last reset
+ */
+static guint64
+count_executed_statements (GdaConnection *cnc)
+{
+	GdaDataModel *metrics;
+	guint64 total = 0;
+	gint i, nrows;
+
+	metrics = gda_connection_get_metrics (cnc);
+	g_assert (metrics);
+	nrows = gda_data_model_get_n_rows (metrics);
+	for (i = 0; i < nrows; i++) {
+		const GValue *cvalue;
+		cvalue = gda_data_model_get_value_at (metrics, 1, i, NULL);
+		g_assert (cvalue && (G_VALUE_TYPE (cvalue) == G_TYPE_UINT64));
+		total += g_value_get_uint64 (cvalue);
+	}
+	g_object_unref (metrics);
+	return total;
+}
+
+static gboolean
+check_batched_lookup (GdaConnection *virtual, GdaConnection *out_cnc, GError **error)
+{
+	GdaDataModel *ref, *model;
+	gboolean retval;
+	guint64 nb_unbatched, nb_batched;
+	gint nb_outer;
+	/* CROSS JOIN makes SQLite scan "city" in the outer loop, so "out.cities" is looked up
+	 * once per city row */
+	const gchar *sql = "SELECT c.name, o.name FROM city c CROSS JOIN out.cities o "
+		"WHERE o.population = c.population ORDER BY c.name, o.name";
+
+	ref = run_sql_select (virtual, "SELECT * FROM city", FALSE, error);
+	if (!ref)
+		return FALSE;
+	nb_outer = gda_data_model_get_n_rows (ref);
+	g_object_unref (ref);
+	g_assert_cmpint (nb_outer, >, 0);
+
+	g_object_set (out_cnc, "statement-metrics", TRUE, NULL);
+
+	/* without batching: one statement per outer row */
+	g_assert_cmpuint (gda_vconnection_hub_get_batch_size (GDA_VCONNECTION_HUB (virtual)), ==, 0);
+	gda_connection_reset_metrics (out_cnc);
+	ref = run_sql_select (virtual, sql, FALSE, error);
+	if (!ref)
+		goto onerror;
+	gda_data_model_get_n_rows (ref); /* make sure all the rows have been fetched */
+	nb_unbatched = count_executed_statements (out_cnc);
+	g_print ("Key lookups without batching: %" G_GUINT64_FORMAT " statement(s)\n", nb_unbatched);
+	g_assert_cmpuint (nb_unbatched, >=, (guint64) nb_outer);
+
+	/* populations are in random order in city.csv: keys are mostly looked up one at a time,
+	 * and never more than without batching */
+	gda_vconnection_hub_set_batch_size (GDA_VCONNECTION_HUB (virtual), 3);
+	g_assert_cmpuint (gda_vconnection_hub_get_batch_size (GDA_VCONNECTION_HUB (virtual)), ==, 3);
+	gda_connection_reset_metrics (out_cnc);
+	model = run_sql_select (virtual, sql, FALSE, error);
+	if (!model) {
+		g_object_unref (ref);
+		goto onerror;
+	}
+	gda_data_model_get_n_rows (model);
+	nb_batched = count_executed_statements (out_cnc);
+	g_print ("Key lookups with a batch size of 3: %" G_GUINT64_FORMAT " statement(s)\n", nb_batched);
+	g_assert_cmpuint (nb_batched, <=, nb_unbatched);
+	retval = assert_data_model_equal (model, ref, error);
+	g_object_unref (model);
+	if (!retval) {
+		g_object_unref (ref);
+		goto onerror;
+	}
+
+	/* ascending keys: a small batch size makes sure several key ranges get fetched */
+	const gchar *sorted_sql = "SELECT count (*) FROM (SELECT DISTINCT population FROM city "
+		"ORDER BY population) c CROSS JOIN out.cities o WHERE o.population = c.population";
+	g_object_unref (ref);
+	gda_vconnection_hub_set_batch_size (GDA_VCONNECTION_HUB (virtual), 0);
+	gda_connection_reset_metrics (out_cnc);
+	ref = run_sql_select (virtual, sorted_sql, FALSE, error);
+	if (!ref)
+		goto onerror;
+	nb_unbatched = count_executed_statements (out_cnc);
+
+	gda_vconnection_hub_set_batch_size (GDA_VCONNECTION_HUB (virtual), 3);
+	gda_connection_reset_metrics (out_cnc);
+	model = run_sql_select (virtual, sorted_sql, FALSE, error);
+	if (!model) {
+		g_object_unref (ref);
+		goto onerror;
+	}
+	nb_batched = count_executed_statements (out_cnc);
+	g_print ("Ascending key lookups with a batch size of 3: %" G_GUINT64_FORMAT " statement(s), "
+		 "%" G_GUINT64_FORMAT " without batching\n", nb_batched, nb_unbatched);
+	g_assert_cmpuint (nb_batched, <, nb_unbatched);
+	retval = assert_data_model_equal (model, ref, error);
+	g_object_unref (model);
+	if (!retval) {
+		g_object_unref (ref);
+		goto onerror;
+	}
+
+	/* a batch size larger than "out.cities" fetches all the keys above the looked up one at once:
+	 * the first 2 keys are looked up alone, and the 3rd one detects the ascending order */
+	gda_vconnection_hub_set_batch_size (GDA_VCONNECTION_HUB (virtual), 1000);
+	gda_connection_reset_metrics (out_cnc);
+	model = run_sql_select (virtual, sorted_sql, FALSE, error);
+	if (!model) {
+		g_object_unref (ref);
+		goto onerror;
+	}
+	nb_batched = count_executed_statements (out_cnc);
+	g_print ("Ascending key lookups with a batch size of 1000: %" G_GUINT64_FORMAT " statement(s)\n", nb_batched);
+	g_assert_cmpuint (nb_batched, ==, 3);
+	retval = assert_data_model_equal (model, ref, error);
+	g_object_unref (model);
+	g_object_unref (ref);
+	if (!retval)
+		goto onerror;
+
+	gda_vconnection_hub_set_batch_size (GDA_VCONNECTION_HUB (virtual), 0);
+	g_object_set (out_cnc, "statement-metrics", FALSE, NULL);
+	return retval;
+
+ onerror:
+	gda_vconnection_hub_set_batch_size (GDA_VCONNECTION_HUB (virtual), 0);
+	g_object_set (out_cnc, "statement-metrics", FALSE, NULL);
+	return FALSE;
+}
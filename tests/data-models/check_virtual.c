@@ -26,6 +26,8 @@ static GdaDataModel *run_sql_select (GdaConnection *cnc, const gchar *sql);
 static gboolean run_sql_non_select (GdaConnection *cnc, const gchar *sql);
 static gboolean test1 (void);
 static gboolean test2 (void);
+static gboolean test3 (void);
+static gboolean test4 (void);
 
 int 
 main (G_GNUC_UNUSED int argc, G_GNUC_UNUSED char **argv)
@@ -37,6 +39,10 @@ main (G_GNUC_UNUSED int argc, G_GNUC_UNUSED char **argv)
 		nfailed++;
 	if (! test2 ())
 		nfailed++;
+	if (! test3 ())
+		nfailed++;
+	if (! test4 ())
+		nfailed++;
 
 	if (nfailed == 0) {
 		g_print ("Ok, all tests passed\n");
@@ -178,6 +184,203 @@ test2 (void)
 	return retval;
 }
 
+static gint
+value_get_int (const GValue *value)
+{
+	if (G_VALUE_TYPE (value) == G_TYPE_INT64)
+		return (gint) g_value_get_int64 (value);
+	else if (G_VALUE_TYPE (value) == G_TYPE_INT)
+		return g_value_get_int (value);
+	else
+		return -1;
+}
+
+/*
+ * Automatic indexes for data models added using gda_vconnection_data_model_add_model()
+ */
+static gboolean
+test3 (void)
+{
+	GError *error = NULL;
+	GdaConnection *cnc;
+	GdaVirtualProvider *provider;
+	GdaDataModel *orders, *customers, *model;
+	gboolean retval = FALSE;
+	gint i;
+
+	g_print ("===== %s () =====\n", __FUNCTION__);
+	provider = gda_vprovider_data_model_new ();
+	cnc = gda_virtual_connection_open (provider, GDA_CONNECTION_OPTIONS_NONE, NULL);
+	g_object_unref (provider);
+	g_assert (cnc);
+
+	customers = gda_data_model_array_new_with_g_types (2, G_TYPE_INT, G_TYPE_STRING);
+	gda_data_model_set_column_name (customers, 0, "id");
+	gda_data_model_set_column_name (customers, 1, "name");
+	orders = gda_data_model_array_new_with_g_types (2, G_TYPE_INT, G_TYPE_INT);
+	gda_data_model_set_column_name (orders, 0, "customer");
+	gda_data_model_set_column_name (orders, 1, "amount");
+	for (i = 0; i < 1000; i++) {
+		GList *values;
+		gchar *name;
+		name = g_strdup_printf ("customer%d", i);
+		values = g_list_append (NULL, gda_value_new (G_TYPE_INT));
+		g_value_set_int ((GValue*) values->data, 999 - i);
+		values = g_list_append (values, gda_value_new_from_string (name, G_TYPE_STRING));
+		g_free (name);
+		g_assert (gda_data_model_append_values (customers, values, NULL) >= 0);
+		g_list_free_full (values, (GDestroyNotify) gda_value_free);
+
+		values = g_list_append (NULL, gda_value_new (G_TYPE_INT));
+		g_value_set_int ((GValue*) values->data, i % 100);
+		values = g_list_append (values, gda_value_new (G_TYPE_INT));
+		g_value_set_int ((GValue*) values->next->data, i);
+		g_assert (gda_data_model_append_values (orders, values, NULL) >= 0);
+		g_list_free_full (values, (GDestroyNotify) gda_value_free);
+	}
+
+	if (!gda_vconnection_data_model_add_model (GDA_VCONNECTION_DATA_MODEL (cnc), customers, "customers", &error))
+		g_error ("Add customers model error: %s\n", error && error->message ? error->message : "no detail");
+	if (!gda_vconnection_data_model_add_model (GDA_VCONNECTION_DATA_MODEL (cnc), orders, "orders", &error))
+		g_error ("Add orders model error: %s\n", error && error->message ? error->message : "no detail");
+
+	/* join using the EQ constraints */
+	model = run_sql_select (cnc, "SELECT c.name, o.amount FROM orders o INNER JOIN customers c ON (c.id = o.customer) WHERE o.amount < 200 ORDER BY o.amount");
+	if (!model || (gda_data_model_get_n_rows (model) != 200)) {
+		g_print ("Wrong number of rows in join\n");
+		goto out;
+	}
+	for (i = 0; i < 200; i++) {
+		const GValue *cvalue;
+		gchar *name;
+		cvalue = gda_data_model_get_value_at (model, 1, i, NULL);
+		if (!cvalue || (value_get_int (cvalue) != i)) {
+			g_print ("Wrong order at row %d\n", i);
+			g_object_unref (model);
+			goto out;
+		}
+		cvalue = gda_data_model_get_value_at (model, 0, i, NULL);
+		name = g_strdup_printf ("customer%d", 999 - (i % 100));
+		if (!cvalue || strcmp (g_value_get_string (cvalue), name)) {
+			g_print ("Wrong join result at row %d\n", i);
+			g_free (name);
+			g_object_unref (model);
+			goto out;
+		}
+		g_free (name);
+	}
+	g_object_unref (model);
+
+	/* ORDER BY only, descending */
+	model = run_sql_select (cnc, "SELECT id FROM customers ORDER BY id DESC");
+	if (!model || (gda_data_model_get_n_rows (model) != 1000)) {
+		g_print ("Wrong number of rows\n");
+		goto out;
+	}
+	for (i = 0; i < 1000; i++) {
+		const GValue *cvalue;
+		cvalue = gda_data_model_get_value_at (model, 0, i, NULL);
+		if (!cvalue || (value_get_int (cvalue) != 999 - i)) {
+			g_print ("Wrong descending order at row %d\n", i);
+			g_object_unref (model);
+			goto out;
+		}
+	}
+	g_object_unref (model);
+
+	/* the hidden row number column is the row in the data model, not in the index */
+	model = run_sql_select (cnc, "SELECT __gda_row_nb FROM customers WHERE id = 990");
+	if (!model || (gda_data_model_get_n_rows (model) != 1) ||
+	    (value_get_int (gda_data_model_get_value_at (model, 0, 0, NULL)) != 9)) {
+		g_print ("Wrong data model row number\n");
+		if (model)
+			g_object_unref (model);
+		goto out;
+	}
+	g_object_unref (model);
+
+	/* indexes must be discarded when the data model changes */
+	model = run_sql_select (cnc, "SELECT name FROM customers WHERE id = 1000");
+	if (!model || (gda_data_model_get_n_rows (model) != 0)) {
+		g_print ("Unexpected row for id = 1000\n");
+		goto out;
+	}
+	g_object_unref (model);
+	if (! run_sql_non_select (cnc, "INSERT INTO customers VALUES (1000, 'new customer')"))
+		goto out;
+	model = run_sql_select (cnc, "SELECT name FROM customers WHERE id = 1000");
+	if (!model || (gda_data_model_get_n_rows (model) != 1)) {
+		g_print ("Index was not updated after the data model changed\n");
+		goto out;
+	}
+	g_object_unref (model);
+
+	retval = TRUE;
+ out:
+	g_object_unref (customers);
+	g_object_unref (orders);
+	g_object_unref (cnc);
+
+	g_print ("%s() is %s\n", __FUNCTION__, retval ? "Ok" : "NOT Ok");
+	return retval;
+}
+
+/*
+ * Filtering a GdaDataProxy, which maps the rows using the hidden row number column of
+ * a virtual table, when an automatic index is used
+ */
+static gboolean
+test4 (void)
+{
+	GdaDataModel *model, *proxy;
+	GError *error = NULL;
+	gboolean retval = FALSE;
+	gint i;
+
+	g_print ("===== %s () =====\n", __FUNCTION__);
+	model = gda_data_model_array_new_with_g_types (2, G_TYPE_INT, G_TYPE_STRING);
+	gda_data_model_set_column_name (model, 0, "id");
+	gda_data_model_set_column_name (model, 1, "name");
+	for (i = 0; i < 100; i++) {
+		GList *values;
+		gchar *name;
+		name = g_strdup_printf ("name%d", i);
+		values = g_list_append (NULL, gda_value_new (G_TYPE_INT));
+		g_value_set_int ((GValue*) values->data, i);
+		values = g_list_append (values, gda_value_new_from_string (name, G_TYPE_STRING));
+		g_free (name);
+		g_assert (gda_data_model_append_values (model, values, NULL) >= 0);
+		g_list_free_full (values, (GDestroyNotify) gda_value_free);
+	}
+
+	proxy = (GdaDataModel*) gda_data_proxy_new (model);
+	if (!gda_data_proxy_set_filter_expr (GDA_DATA_PROXY (proxy), "id >= 90", &error)) {
+		g_print ("Could not set filter: %s\n", error && error->message ? error->message : "no detail");
+		g_clear_error (&error);
+		goto out;
+	}
+	if (gda_data_model_get_n_rows (proxy) != 10) {
+		g_print ("Wrong number of filtered rows: %d\n", gda_data_model_get_n_rows (proxy));
+		goto out;
+	}
+	for (i = 0; i < 10; i++) {
+		const GValue *cvalue;
+		cvalue = gda_data_model_get_value_at (proxy, 0, i, NULL);
+		if (!cvalue || (value_get_int (cvalue) != 90 + i)) {
+			g_print ("Wrong filtered row %d\n", i);
+			goto out;
+		}
+	}
+
+	retval = TRUE;
+ out:
+	g_object_unref (proxy);
+	g_object_unref (model);
+
+	g_print ("%s() is %s\n", __FUNCTION__, retval ? "Ok" : "NOT Ok");
+	return retval;
+}
+
 static GdaDataModel *
 run_sql_select (GdaConnection *cnc, const gchar *sql)
 {
@@ -597,6 +597,204 @@ test_db_catalog_get_objects (DbCatalogCnc *self,
   g_assert_cmpstr (name1, ==, name2);
 }
 
+static GdaDbTable *
+create_fkey_table (const gchar *name, const gchar *reftable, const gchar *constraint)
+{
+  GdaDbTable *table;
+  GdaDbColumn *column;
+
+  table = gda_db_table_new ();
+  gda_db_base_set_name (GDA_DB_BASE (table), name);
+
+  column = gda_db_column_new ();
+  gda_db_column_set_name (column, "id");
+  gda_db_column_set_type (column, G_TYPE_INT);
+  gda_db_column_set_pkey (column, TRUE);
+  gda_db_table_append_column (table, column);
+  g_object_unref (column);
+
+  if (reftable)
+    {
+      GdaDbFkey *fkey;
+
+      column = gda_db_column_new ();
+      gda_db_column_set_name (column, "ref_id");
+      gda_db_column_set_type (column, G_TYPE_INT);
+      gda_db_table_append_column (table, column);
+      g_object_unref (column);
+
+      fkey = gda_db_fkey_new ();
+      gda_db_fkey_set_ref_table (fkey, reftable);
+      gda_db_fkey_set_field (fkey, "ref_id", "id");
+      gda_db_table_append_fkey (table, fkey);
+      g_object_unref (fkey);
+    }
+
+  if (constraint)
+    gda_db_table_append_constraint (table, constraint);
+
+  return table;
+}
+
+static gboolean
+table_exists (GdaConnection *cnc, const gchar *name)
+{
+  GdaDataModel *model;
+  gchar *sql;
+  gint nrows;
+
+  sql = g_strdup_printf ("SELECT name FROM sqlite_master WHERE type = 'table' AND name = '%s'", name);
+  model = gda_connection_execute_select_command (cnc, sql, NULL);
+  g_free (sql);
+  g_assert_nonnull (model);
+  nrows = gda_data_model_get_n_rows (model);
+  g_object_unref (model);
+
+  return nrows == 1;
+}
+
+/* Returns: (transfer full): the names of the tables starting with @prefix, in the order they were created */
+static gchar *
+get_created_tables (GdaConnection *cnc, const gchar *prefix)
+{
+  GdaDataModel *model;
+  GString *string;
+  gchar *sql;
+  gint i, nrows;
+
+  sql = g_strdup_printf ("SELECT name FROM sqlite_master WHERE type = 'table' AND name LIKE '%s%%' "
+                         "ORDER BY rowid", prefix);
+  model = gda_connection_execute_select_command (cnc, sql, NULL);
+  g_free (sql);
+  g_assert_nonnull (model);
+
+  string = g_string_new ("");
+  nrows = gda_data_model_get_n_rows (model);
+  for (i = 0; i < nrows; i++)
+    {
+      const GValue *value = gda_data_model_get_value_at (model, 0, i, NULL);
+
+      g_assert_nonnull (value);
+      if (i > 0)
+        g_string_append_c (string, ',');
+      g_string_append (string, g_value_get_string (value));
+    }
+  g_object_unref (model);
+
+  return g_string_free (string, FALSE);
+}
+
+static void
+test_db_catalog_fkey_order (CheckDbObject *self,
+                            G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDbTable *table;
+  GError *error = NULL;
+  gboolean res;
+
+  /* tables are appended before the tables they reference */
+  table = create_fkey_table ("order_c", "order_b", NULL);
+  gda_db_catalog_append_table (self->catalog, table);
+  g_object_unref (table);
+
+  table = create_fkey_table ("order_b", "order_a", NULL);
+  gda_db_catalog_append_table (self->catalog, table);
+  g_object_unref (table);
+
+  table = create_fkey_table ("order_a", NULL, NULL);
+  gda_db_catalog_append_table (self->catalog, table);
+  g_object_unref (table);
+
+  /* a table referencing itself */
+  table = create_fkey_table ("order_self", "order_self", NULL);
+  gda_db_catalog_append_table (self->catalog, table);
+  g_object_unref (table);
+
+  /* tables referencing each other: the first one appended comes last */
+  table = create_fkey_table ("order_x", "order_y", NULL);
+  gda_db_catalog_append_table (self->catalog, table);
+  g_object_unref (table);
+
+  table = create_fkey_table ("order_y", "order_x", NULL);
+  gda_db_catalog_append_table (self->catalog, table);
+  g_object_unref (table);
+
+  res = gda_db_catalog_perform_operation (self->catalog, &error);
+  g_assert_no_error (error);
+  g_assert_true (res);
+
+  gchar *names = get_created_tables (self->cnc, "order_");
+  g_assert_cmpstr (names, ==, "order_a,order_b,order_c,order_self,order_y,order_x");
+  g_free (names);
+  g_assert_null (gda_connection_get_transaction_status (self->cnc));
+}
+
+static void
+test_db_catalog_update_order (CheckDbObject *self,
+                              G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  GdaDbTable *table;
+  GError *error = NULL;
+  gboolean res;
+
+  g_assert_cmpint (gda_connection_execute_non_select_command (self->cnc,
+                                                              "CREATE TABLE update_a (id INTEGER PRIMARY KEY)",
+                                                              NULL), !=, -1);
+
+  /* the existing table gets a new column referencing a new table, which can't be created */
+  table = create_fkey_table ("update_a", "update_b", NULL);
+  gda_db_catalog_append_table (self->catalog, table);
+  g_object_unref (table);
+
+  table = create_fkey_table ("update_b", NULL, "CHECK (");
+  gda_db_catalog_append_table (self->catalog, table);
+  g_object_unref (table);
+
+  /* in a transaction started by the caller, which the catalog leaves untouched on error */
+  g_assert_true (gda_connection_begin_transaction (self->cnc, NULL,
+                                                   GDA_TRANSACTION_ISOLATION_SERVER_DEFAULT, NULL));
+  res = gda_db_catalog_perform_operation (self->catalog, &error);
+  g_assert_false (res);
+  g_assert_nonnull (error);
+  g_clear_error (&error);
+
+  /* the existing table is only updated after the creation of the table it references */
+  model = gda_connection_execute_select_command (self->cnc, "SELECT ref_id FROM update_a", NULL);
+  g_assert_null (model);
+
+  g_assert_true (gda_connection_rollback_transaction (self->cnc, NULL, NULL));
+  g_assert_true (table_exists (self->cnc, "update_a"));
+  g_assert_false (table_exists (self->cnc, "update_b"));
+}
+
+static void
+test_db_catalog_rollback (CheckDbObject *self,
+                          G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDbTable *table;
+  GError *error = NULL;
+  gboolean res;
+
+  table = create_fkey_table ("rollback_a", NULL, NULL);
+  gda_db_catalog_append_table (self->catalog, table);
+  g_object_unref (table);
+
+  /* invalid table, created after the valid one: no table is created at all */
+  table = create_fkey_table ("rollback_b", "rollback_a", "CHECK (");
+  gda_db_catalog_append_table (self->catalog, table);
+  g_object_unref (table);
+
+  res = gda_db_catalog_perform_operation (self->catalog, &error);
+  g_assert_false (res);
+  g_assert_nonnull (error);
+  g_clear_error (&error);
+
+  g_assert_false (table_exists (self->cnc, "rollback_a"));
+  g_assert_false (table_exists (self->cnc, "rollback_b"));
+  g_assert_null (gda_connection_get_transaction_status (self->cnc));
+}
+
 gint
 main (gint   argc,
       gchar *argv[])
@@ -653,5 +851,26 @@ main (gint   argc,
               test_db_catalog_get_objects,
               test_db_catalog_finish_db);
 
+  g_test_add ("/test-db/catalog-fkey-order",
+              CheckDbObject,
+              NULL,
+              test_db_catalog_start,
+              test_db_catalog_fkey_order,
+              test_db_catalog_finish);
+
+  g_test_add ("/test-db/catalog-update-order",
+              CheckDbObject,
+              NULL,
+              test_db_catalog_start,
+              test_db_catalog_update_order,
+              test_db_catalog_finish);
+
+  g_test_add ("/test-db/catalog-rollback",
+              CheckDbObject,
+              NULL,
+              test_db_catalog_start,
+              test_db_catalog_rollback,
+              test_db_catalog_finish);
+
   return g_test_run();
 }
@@ -0,0 +1,355 @@
+/* test-blob-stream.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <glib/gi18n.h>
+#include <locale.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "libgda/libgda.h"
+#include "libgda/gda-server-provider-extra.h"
+
+#define PROVIDER_NAME "SQLite"
+#define DB_TEST_BASE "sqlite_blob_stream"
+#define CHUNK_SIZE 1024
+#define BLOB_SIZE (CHUNK_SIZE * 9 + 123)
+
+typedef struct
+{
+  GdaConnection *cnc;
+  gchar *dbfile;
+  guchar *data;
+} TestObjectFixture;
+
+static void
+test_blob_stream_start (TestObjectFixture *fixture,
+                        G_GNUC_UNUSED gconstpointer user_data)
+{
+  gint id = g_random_int_range (0, G_MAXINT);
+  gchar *cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s_%d", DB_TEST_BASE, id);
+  gint i;
+
+  fixture->dbfile = g_strdup_printf ("%s_%d.db", DB_TEST_BASE, id);
+  fixture->cnc = gda_connection_open_from_string (PROVIDER_NAME, cncstring, NULL,
+                                                  GDA_CONNECTION_OPTIONS_NONE, NULL);
+  g_free (cncstring);
+  g_assert_nonnull (fixture->cnc);
+  g_object_set (fixture->cnc, "blob-chunk-size", CHUNK_SIZE, NULL);
+
+  fixture->data = g_new (guchar, BLOB_SIZE);
+  for (i = 0; i < BLOB_SIZE; i++)
+    fixture->data [i] = (guchar) (i * 7);
+
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc,
+                                                              "CREATE TABLE blobs (id INTEGER PRIMARY KEY, data BLOB)",
+                                                              NULL), !=, -1);
+}
+
+static void
+test_blob_stream_finish (TestObjectFixture *fixture,
+                         G_GNUC_UNUSED gconstpointer user_data)
+{
+  gda_connection_close (fixture->cnc, NULL);
+  g_object_unref (fixture->cnc);
+  g_unlink (fixture->dbfile);
+  g_free (fixture->dbfile);
+  g_free (fixture->data);
+}
+
+typedef struct {
+  GByteArray *contents;
+  gint        nchunks;
+} StreamData;
+
+static gboolean
+collect_chunk (const guchar *data, glong size, glong offset, StreamData *sdata,
+               G_GNUC_UNUSED GError **error)
+{
+  g_assert_cmpint (offset, ==, sdata->contents->len);
+  g_assert_cmpint (size, <=, CHUNK_SIZE);
+  g_byte_array_append (sdata->contents, data, size);
+  sdata->nchunks ++;
+  return TRUE;
+}
+
+/* Streams @blob and checks that its contents is the first @size bytes of @fixture->data */
+static void
+check_stream_size (TestObjectFixture *fixture, GdaBlob *blob, glong size)
+{
+  StreamData sdata;
+  GError *error = NULL;
+
+  sdata.contents = g_byte_array_new ();
+  sdata.nchunks = 0;
+  g_assert_true (gda_server_provider_blob_stream (fixture->cnc, blob,
+                                                  (GdaServerProviderBlobChunkFunc) collect_chunk,
+                                                  &sdata, &error));
+  g_assert_no_error (error);
+  g_assert_cmpint (sdata.nchunks, ==, (size + CHUNK_SIZE - 1) / CHUNK_SIZE);
+  g_assert_cmpint (sdata.contents->len, ==, size);
+  g_assert_true (memcmp (sdata.contents->data, fixture->data, size) == 0);
+  g_byte_array_unref (sdata.contents);
+}
+
+/* Streams @blob and checks that its contents is @fixture->data */
+static void
+check_stream (TestObjectFixture *fixture, GdaBlob *blob)
+{
+  check_stream_size (fixture, blob, BLOB_SIZE);
+}
+
+static void
+insert_blob (TestObjectFixture *fixture, gint id, const GValue *value)
+{
+  GdaSqlParser *parser;
+  GdaStatement *stmt;
+  GdaSet *params;
+  GError *error = NULL;
+
+  parser = gda_connection_create_parser (fixture->cnc);
+  stmt = gda_sql_parser_parse_string (parser, "INSERT INTO blobs (id, data) VALUES (##id::int, ##data::GdaBlob)",
+                                      NULL, &error);
+  g_assert_no_error (error);
+  g_assert_true (gda_statement_get_parameters (stmt, &params, &error));
+  g_assert_true (gda_set_set_holder_value (params, &error, "id", id));
+  g_assert_true (gda_holder_set_value (gda_set_get_holder (params, "data"), value, &error));
+  g_assert_cmpint (gda_connection_statement_execute_non_select (fixture->cnc, stmt, params, NULL, &error), ==, 1);
+  g_assert_no_error (error);
+  g_object_unref (params);
+  g_object_unref (stmt);
+  g_object_unref (parser);
+}
+
+static GdaDataModel *
+select_blob (TestObjectFixture *fixture, gint id)
+{
+  GdaDataModel *model;
+  GError *error = NULL;
+  gchar *sql;
+
+  sql = g_strdup_printf ("SELECT data FROM blobs WHERE id = %d", id);
+  model = gda_connection_execute_select_command (fixture->cnc, sql, &error);
+  g_free (sql);
+  g_assert_no_error (error);
+  g_assert_cmpint (gda_data_model_get_n_rows (model), ==, 1);
+  return model;
+}
+
+static void
+test_blob_stream_memory (TestObjectFixture *fixture,
+                         G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaBlob *blob;
+  guint size;
+
+  g_object_get (fixture->cnc, "blob-chunk-size", &size, NULL);
+  g_assert_cmpuint (size, ==, CHUNK_SIZE);
+
+  blob = gda_blob_new ();
+  gda_binary_set_data (gda_blob_get_binary (blob), fixture->data, BLOB_SIZE);
+  check_stream (fixture, blob);
+  gda_blob_free (blob);
+}
+
+static void
+test_blob_stream_copy (TestObjectFixture *fixture,
+                       G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  const GValue *cvalue;
+  GValue *value;
+  GdaBlob *blob;
+
+  /* insert a BLOB from memory */
+  blob = gda_blob_new ();
+  gda_binary_set_data (gda_blob_get_binary (blob), fixture->data, BLOB_SIZE);
+  value = gda_value_new (GDA_TYPE_BLOB);
+  gda_value_take_blob (value, blob);
+  insert_blob (fixture, 1, value);
+  gda_value_free (value);
+
+  /* copy it to another row: the contents is transferred by chunks from the 1st row */
+  model = select_blob (fixture, 1);
+  cvalue = gda_data_model_get_value_at (model, 0, 0, NULL);
+  g_assert_nonnull (cvalue);
+  g_assert_true (G_VALUE_TYPE (cvalue) == GDA_TYPE_BLOB);
+  check_stream (fixture, (GdaBlob*) gda_value_get_blob (cvalue));
+  insert_blob (fixture, 2, cvalue);
+  g_object_unref (model);
+
+  model = select_blob (fixture, 2);
+  cvalue = gda_data_model_get_value_at (model, 0, 0, NULL);
+  g_assert_nonnull (cvalue);
+  check_stream (fixture, (GdaBlob*) gda_value_get_blob (cvalue));
+  g_object_unref (model);
+}
+
+/* a BLOB whose size is a multiple of the chunk size must not be read past its end */
+static void
+test_blob_stream_exact_chunks (TestObjectFixture *fixture,
+                               G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  const GValue *cvalue;
+  GValue *value;
+  GdaBlob *blob;
+  glong size = CHUNK_SIZE * 4;
+
+  blob = gda_blob_new ();
+  gda_binary_set_data (gda_blob_get_binary (blob), fixture->data, size);
+  check_stream_size (fixture, blob, size);
+
+  value = gda_value_new (GDA_TYPE_BLOB);
+  gda_value_take_blob (value, blob);
+  insert_blob (fixture, 1, value);
+  gda_value_free (value);
+
+  /* streamed through the SQLite BLOB handler */
+  model = select_blob (fixture, 1);
+  cvalue = gda_data_model_get_value_at (model, 0, 0, NULL);
+  g_assert_nonnull (cvalue);
+  g_assert_true (G_VALUE_TYPE (cvalue) == GDA_TYPE_BLOB);
+  g_assert_nonnull (gda_blob_get_op ((GdaBlob*) gda_value_get_blob (cvalue)));
+  check_stream_size (fixture, (GdaBlob*) gda_value_get_blob (cvalue), size);
+
+  /* copied by chunks to another row */
+  insert_blob (fixture, 2, cvalue);
+  g_object_unref (model);
+  model = select_blob (fixture, 2);
+  cvalue = gda_data_model_get_value_at (model, 0, 0, NULL);
+  g_assert_nonnull (cvalue);
+  check_stream_size (fixture, (GdaBlob*) gda_value_get_blob (cvalue), size);
+  g_object_unref (model);
+}
+
+/* Reads the whole BLOB manipulated by @op using a GInputStream */
+static GBytes *
+read_stream (GdaBlobOp *op)
+{
+  GInputStream *istream;
+  GOutputStream *ostream;
+  GError *error = NULL;
+  gssize size;
+
+  istream = gda_blob_op_get_input_stream (op, 0);
+  g_assert_nonnull (istream);
+  ostream = g_memory_output_stream_new_resizable ();
+  size = g_output_stream_splice (ostream, istream,
+                                 G_OUTPUT_STREAM_SPLICE_CLOSE_SOURCE | G_OUTPUT_STREAM_SPLICE_CLOSE_TARGET,
+                                 NULL, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (size, ==, BLOB_SIZE);
+  g_object_unref (istream);
+
+  GBytes *bytes;
+  bytes = g_memory_output_stream_steal_as_bytes (G_MEMORY_OUTPUT_STREAM (ostream));
+  g_object_unref (ostream);
+  return bytes;
+}
+
+static void
+test_blob_stream_gio (TestObjectFixture *fixture,
+                      G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  const GValue *cvalue;
+  GValue *value;
+  GdaBlob *blob;
+  GdaBlobOp *op;
+  GBytes *bytes;
+  GOutputStream *ostream;
+  GError *error = NULL;
+  gsize written;
+  gint i;
+
+  blob = gda_blob_new ();
+  gda_binary_set_data (gda_blob_get_binary (blob), fixture->data, BLOB_SIZE);
+  value = gda_value_new (GDA_TYPE_BLOB);
+  gda_value_take_blob (value, blob);
+  insert_blob (fixture, 1, value);
+  gda_value_free (value);
+
+  model = select_blob (fixture, 1);
+  cvalue = gda_data_model_get_value_at (model, 0, 0, NULL);
+  g_assert_nonnull (cvalue);
+  op = gda_blob_get_op ((GdaBlob*) gda_value_get_blob (cvalue));
+  g_assert_nonnull (op);
+
+  /* read using a GInputStream */
+  bytes = read_stream (op);
+  g_assert_true (memcmp (g_bytes_get_data (bytes, NULL), fixture->data, BLOB_SIZE) == 0);
+  g_bytes_unref (bytes);
+
+  /* overwrite using a GOutputStream, with writes smaller than the buffer */
+  for (i = 0; i < BLOB_SIZE; i++)
+    fixture->data [i] = (guchar) (i * 3);
+  ostream = gda_blob_op_get_output_stream (op, 0);
+  g_assert_nonnull (ostream);
+  for (i = 0; i < BLOB_SIZE; i += 100) {
+    g_assert_true (g_output_stream_write_all (ostream, fixture->data + i, MIN (100, BLOB_SIZE - i),
+                                              &written, NULL, &error));
+    g_assert_no_error (error);
+  }
+  g_assert_true (g_output_stream_close (ostream, NULL, &error));
+  g_assert_no_error (error);
+  g_object_unref (ostream);
+
+  bytes = read_stream (op);
+  g_assert_true (memcmp (g_bytes_get_data (bytes, NULL), fixture->data, BLOB_SIZE) == 0);
+  g_bytes_unref (bytes);
+  g_object_unref (model);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  setlocale (LC_ALL,"");
+  g_test_init (&argc, &argv, NULL);
+  gda_init ();
+
+  g_test_add ("/test-blob-stream/memory",
+              TestObjectFixture,
+              NULL,
+              test_blob_stream_start,
+              test_blob_stream_memory,
+              test_blob_stream_finish);
+
+  g_test_add ("/test-blob-stream/copy",
+              TestObjectFixture,
+              NULL,
+              test_blob_stream_start,
+              test_blob_stream_copy,
+              test_blob_stream_finish);
+
+  g_test_add ("/test-blob-stream/exact-chunks",
+              TestObjectFixture,
+              NULL,
+              test_blob_stream_start,
+              test_blob_stream_exact_chunks,
+              test_blob_stream_finish);
+
+  g_test_add ("/test-blob-stream/gio",
+              TestObjectFixture,
+              NULL,
+              test_blob_stream_start,
+              test_blob_stream_gio,
+              test_blob_stream_finish);
+
+  return g_test_run ();
+}
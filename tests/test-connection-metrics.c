@@ -0,0 +1,175 @@
+/* test-connection-metrics.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <glib/gi18n.h>
+#include <locale.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "libgda/libgda.h"
+
+#define PROVIDER_NAME "SQLite"
+#define DB_TEST_BASE "sqlite_metrics"
+
+typedef struct
+{
+  GdaConnection *cnc;
+  gchar *dbfile;
+} TestObjectFixture;
+
+static void
+test_metrics_start (TestObjectFixture *fixture,
+                    G_GNUC_UNUSED gconstpointer user_data)
+{
+  gint id = g_random_int_range (0, G_MAXINT);
+  gchar *cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s_%d", DB_TEST_BASE, id);
+  fixture->dbfile = g_strdup_printf ("%s_%d.db", DB_TEST_BASE, id);
+
+  fixture->cnc = gda_connection_open_from_string (PROVIDER_NAME, cncstring, NULL,
+                                                  GDA_CONNECTION_OPTIONS_NONE, NULL);
+  g_free (cncstring);
+  g_assert_nonnull (fixture->cnc);
+
+  g_object_set (fixture->cnc, "statement-metrics", TRUE, NULL);
+}
+
+static void
+test_metrics_finish (TestObjectFixture *fixture,
+                     G_GNUC_UNUSED gconstpointer user_data)
+{
+  gda_connection_close (fixture->cnc, NULL);
+  g_object_unref (fixture->cnc);
+  g_unlink (fixture->dbfile);
+  g_free (fixture->dbfile);
+}
+
+static void
+execute_non_select (GdaConnection *cnc, const gchar *sql)
+{
+  GError *error = NULL;
+  gint res;
+
+  res = gda_connection_execute_non_select_command (cnc, sql, &error);
+  if (res == -1)
+    g_print ("Error executing '%s': %s\n", sql,
+             error && error->message ? error->message : "No detail");
+  g_assert_cmpint (res, !=, -1);
+}
+
+static gint
+find_statement (GdaDataModel *model, const gchar *sql)
+{
+  gint i, nrows;
+
+  nrows = gda_data_model_get_n_rows (model);
+  for (i = 0; i < nrows; i++)
+    {
+      const GValue *cvalue;
+      cvalue = gda_data_model_get_value_at (model, 0, i, NULL);
+      g_assert_nonnull (cvalue);
+      if (g_str_has_prefix (g_value_get_string (cvalue), sql))
+        return i;
+    }
+  return -1;
+}
+
+static void
+test_metrics_grouping (TestObjectFixture *fixture,
+                       G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model, *metrics;
+  const GValue *cvalue;
+  GError *error = NULL;
+  gint row;
+
+  execute_non_select (fixture->cnc, "CREATE TABLE person (id int, name string)");
+  execute_non_select (fixture->cnc, "INSERT INTO person VALUES (1, 'Joe')");
+  execute_non_select (fixture->cnc, "INSERT INTO person VALUES (2, 'Jane')");
+  execute_non_select (fixture->cnc, "INSERT INTO person VALUES (3, 'Jim')");
+
+  model = gda_connection_execute_select_command (fixture->cnc, "SELECT * FROM person", &error);
+  g_assert_nonnull (model);
+  g_assert_cmpint (gda_data_model_get_n_rows (model), ==, 3);
+  g_object_unref (model);
+
+  metrics = gda_connection_get_metrics (fixture->cnc);
+  g_assert_nonnull (metrics);
+
+  /* the 3 INSERT differ only by their literals and must be grouped */
+  row = find_statement (metrics, "INSERT INTO person");
+  g_assert_cmpint (row, >=, 0);
+  cvalue = gda_data_model_get_value_at (metrics, 1, row, NULL);
+  g_assert_cmpint (g_value_get_uint64 (cvalue), ==, 3);
+  cvalue = gda_data_model_get_value_at (metrics, 3, row, NULL);
+  g_assert_cmpint (g_value_get_uint64 (cvalue), ==, 3);
+
+  row = find_statement (metrics, "SELECT");
+  g_assert_cmpint (row, >=, 0);
+  cvalue = gda_data_model_get_value_at (metrics, 1, row, NULL);
+  g_assert_cmpint (g_value_get_uint64 (cvalue), ==, 1);
+  cvalue = gda_data_model_get_value_at (metrics, 2, row, NULL);
+  g_assert_cmpint (g_value_get_uint64 (cvalue), ==, 0);
+  g_object_unref (metrics);
+
+  gda_connection_reset_metrics (fixture->cnc);
+  metrics = gda_connection_get_metrics (fixture->cnc);
+  g_assert_cmpint (gda_data_model_get_n_rows (metrics), ==, 0);
+  g_object_unref (metrics);
+}
+
+static void
+test_metrics_dump (TestObjectFixture *fixture,
+                   G_GNUC_UNUSED gconstpointer user_data)
+{
+  gchar *dump;
+
+  execute_non_select (fixture->cnc, "CREATE TABLE data (value int)");
+  execute_non_select (fixture->cnc, "INSERT INTO data VALUES (10)");
+
+  dump = gda_connection_dump_metrics (fixture->cnc);
+  g_assert_nonnull (dump);
+  g_assert_nonnull (strstr (dump, "gda_statement_executions_total"));
+  g_assert_nonnull (strstr (dump, "gda_statement_phase_seconds"));
+  g_assert_nonnull (strstr (dump, "INSERT INTO data"));
+  g_free (dump);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  setlocale (LC_ALL,"");
+
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add ("/test-connection-metrics/grouping",
+              TestObjectFixture,
+              NULL,
+              test_metrics_start,
+              test_metrics_grouping,
+              test_metrics_finish);
+
+  g_test_add ("/test-connection-metrics/dump",
+              TestObjectFixture,
+              NULL,
+              test_metrics_start,
+              test_metrics_dump,
+              test_metrics_finish);
+
+  return g_test_run ();
+}
@@ -0,0 +1,235 @@
+/* test-execution-limits.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <glib/gi18n.h>
+#include <locale.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "libgda/libgda.h"
+
+#define PROVIDER_NAME "SQLite"
+#define DB_TEST_BASE "sqlite_execution_limits"
+#define NB_ROWS 100
+#define NAME_SIZE 1000
+
+typedef struct
+{
+  GdaConnection *cnc;
+  gchar *dbfile;
+} TestObjectFixture;
+
+static void
+test_limits_start (TestObjectFixture *fixture,
+                   G_GNUC_UNUSED gconstpointer user_data)
+{
+  gint id = g_random_int_range (0, G_MAXINT);
+  gchar *cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s_%d", DB_TEST_BASE, id);
+  gchar *name, *sql;
+  gint i;
+
+  fixture->dbfile = g_strdup_printf ("%s_%d.db", DB_TEST_BASE, id);
+  fixture->cnc = gda_connection_open_from_string (PROVIDER_NAME, cncstring, NULL,
+                                                  GDA_CONNECTION_OPTIONS_NONE, NULL);
+  g_free (cncstring);
+  g_assert_nonnull (fixture->cnc);
+
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc,
+                                                              "CREATE TABLE data (id INTEGER PRIMARY KEY, name TEXT)",
+                                                              NULL), !=, -1);
+  name = g_strnfill (NAME_SIZE, 'x');
+  sql = g_strdup_printf ("WITH RECURSIVE c(x) AS (SELECT 0 UNION ALL SELECT x + 1 FROM c WHERE x < %d) "
+                         "INSERT INTO data SELECT x, '%s' FROM c", NB_ROWS - 1, name);
+  g_assert_cmpint (gda_connection_execute_non_select_command (fixture->cnc, sql, NULL), ==, NB_ROWS);
+  g_free (sql);
+  g_free (name);
+}
+
+static void
+test_limits_finish (TestObjectFixture *fixture,
+                    G_GNUC_UNUSED gconstpointer user_data)
+{
+  gda_connection_close (fixture->cnc, NULL);
+  g_object_unref (fixture->cnc);
+  g_unlink (fixture->dbfile);
+  g_free (fixture->dbfile);
+}
+
+static GdaStatement *
+parse_select (TestObjectFixture *fixture)
+{
+  GdaSqlParser *parser;
+  GdaStatement *stmt;
+
+  parser = gda_connection_create_parser (fixture->cnc);
+  stmt = gda_sql_parser_parse_string (parser, "SELECT id, name FROM data ORDER BY id", NULL, NULL);
+  g_assert_nonnull (stmt);
+  g_object_unref (parser);
+  return stmt;
+}
+
+/* checks that the rows of @model can be read up to @nrows, and not beyond */
+static void
+check_limit (GdaDataModel *model, gint nrows)
+{
+  const GValue *value;
+  GError *error = NULL;
+  GError **exceptions;
+
+  value = gda_data_model_get_value_at (model, 0, nrows - 1, &error);
+  g_assert_no_error (error);
+  g_assert_nonnull (value);
+  g_assert_cmpint (g_value_get_int (value), ==, nrows - 1);
+
+  value = gda_data_model_get_value_at (model, 0, nrows, &error);
+  g_assert_null (value);
+  g_assert_error (error, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_LIMIT_ERROR);
+  g_clear_error (&error);
+
+  /* the rows already fetched remain accessible */
+  value = gda_data_model_get_value_at (model, 0, nrows / 2, &error);
+  g_assert_no_error (error);
+  g_assert_nonnull (value);
+  g_assert_cmpint (g_value_get_int (value), ==, nrows / 2);
+
+  exceptions = gda_data_model_get_exceptions (model);
+  g_assert_nonnull (exceptions);
+  g_assert_error (exceptions [0], GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_LIMIT_ERROR);
+}
+
+static void
+test_limits_rows (TestObjectFixture *fixture,
+                  G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  GdaStatement *stmt;
+  GError *error = NULL;
+  gint nrows;
+
+  g_object_set (fixture->cnc, "max-rows", 10, NULL);
+  stmt = parse_select (fixture);
+  model = gda_connection_statement_execute_select (fixture->cnc, stmt, NULL, &error);
+  g_assert_no_error (error);
+  check_limit (model, 10);
+  g_object_unref (model);
+
+  /* the statement's setting overrides the connection's one */
+  g_object_set (stmt, "max-rows", 20, NULL);
+  model = gda_connection_statement_execute_select (fixture->cnc, stmt, NULL, &error);
+  g_assert_no_error (error);
+  check_limit (model, 20);
+  g_object_unref (model);
+
+  /* cursor based data models don't hold the rows */
+  model = gda_connection_statement_execute_select_full (fixture->cnc, stmt, NULL,
+                                                        GDA_STATEMENT_MODEL_CURSOR_FORWARD, NULL, &error);
+  g_assert_no_error (error);
+  GdaDataModelIter *iter;
+  iter = gda_data_model_create_iter (model);
+  for (nrows = 0; gda_data_model_iter_move_next (iter); nrows++);
+  g_assert_cmpint (nrows, ==, NB_ROWS);
+  g_object_unref (iter);
+  g_object_unref (model);
+  g_object_unref (stmt);
+}
+
+static void
+test_limits_bytes (TestObjectFixture *fixture,
+                   G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  GdaStatement *stmt;
+  GError *error = NULL;
+  gint i;
+
+  /* each row holds more than NAME_SIZE bytes */
+  g_object_set (fixture->cnc, "max-bytes", (guint64) NAME_SIZE * 30, NULL);
+  stmt = parse_select (fixture);
+  model = gda_connection_statement_execute_select (fixture->cnc, stmt, NULL, &error);
+  g_assert_no_error (error);
+  for (i = 0; i < NB_ROWS; i++) {
+    if (! gda_data_model_get_value_at (model, 0, i, &error))
+      break;
+  }
+  g_assert_error (error, GDA_DATA_SELECT_ERROR, GDA_DATA_SELECT_LIMIT_ERROR);
+  g_clear_error (&error);
+  g_assert_cmpint (i, >, 0);
+  g_assert_cmpint (i, <=, 30);
+  g_object_unref (model);
+  g_object_unref (stmt);
+}
+
+static void
+test_limits_timeout (TestObjectFixture *fixture,
+                     G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *model;
+  GError *error = NULL;
+  guint timeout;
+
+  g_object_set (fixture->cnc, "statement-timeout", 200, NULL);
+  g_object_get (fixture->cnc, "statement-timeout", &timeout, NULL);
+  g_assert_cmpuint (timeout, ==, 200);
+
+  /* never ends without the timeout */
+  model = gda_connection_execute_select_command (fixture->cnc,
+                                                 "WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c) "
+                                                 "SELECT count(*) FROM c", &error);
+  g_assert_null (model);
+  g_assert_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_TIMEOUT_ERROR);
+  g_clear_error (&error);
+
+  /* the connection remains usable */
+  model = gda_connection_execute_select_command (fixture->cnc, "SELECT count(*) FROM data", &error);
+  g_assert_no_error (error);
+  g_assert_nonnull (model);
+  g_assert_cmpint (gda_data_model_get_n_rows (model), ==, 1);
+  g_object_unref (model);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  setlocale (LC_ALL,"");
+  g_test_init (&argc, &argv, NULL);
+  gda_init ();
+
+  g_test_add ("/test-execution-limits/rows",
+              TestObjectFixture,
+              NULL,
+              test_limits_start,
+              test_limits_rows,
+              test_limits_finish);
+
+  g_test_add ("/test-execution-limits/bytes",
+              TestObjectFixture,
+              NULL,
+              test_limits_start,
+              test_limits_bytes,
+              test_limits_finish);
+
+  g_test_add ("/test-execution-limits/timeout",
+              TestObjectFixture,
+              NULL,
+              test_limits_start,
+              test_limits_timeout,
+              test_limits_finish);
+
+  return g_test_run ();
+}
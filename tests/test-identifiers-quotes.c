@@ -154,6 +154,52 @@ check_result (ATest *test, const gchar *result, const gchar *expected, gboolean
 	return TRUE;
 }
 
+/*
+ * The quoted identifiers are cached for each provider: the cache must be invalidated when
+ * the "identifiers-case-sensitive" property changes
+ */
+static guint
+test_cache_invalidation (void)
+{
+	ATest *itest = NULL, *stest = NULL;
+	GdaServerProvider *prov;
+	guint i, nfailed = 0;
+
+	for (i = 0; i < G_N_ELEMENTS (tests); i++) {
+		if (!tests [i].provider || strcmp (tests [i].sql_identifier, "CapitalTest"))
+			continue;
+		if (!strcmp (tests [i].provider, "iMySQL"))
+			itest = &(tests [i]);
+		else if (!strcmp (tests [i].provider, "sMySQL"))
+			stest = &(tests [i]);
+	}
+	g_assert (itest && stest);
+
+	prov = gda_config_get_provider ("MySQL", NULL);
+	if (!prov) {
+		g_print ("Can't find provider for MySQL, ignoring cache invalidation test\n");
+		return 0;
+	}
+
+	/* each quoting is done twice, the 2nd one using the cache */
+	for (i = 0; i < 4; i++) {
+		ATest *test;
+		gchar *result;
+		test = (i % 2) ? stest : itest;
+		g_object_set (G_OBJECT (prov), "identifiers-case-sensitive", (i % 2) ? TRUE : FALSE, NULL);
+
+		result = gda_sql_identifier_quote (test->sql_identifier, NULL, prov, FALSE, FALSE);
+		if (!check_result (test, result, test->result1, FALSE, FALSE))
+			nfailed++;
+		g_free (result);
+
+		result = gda_sql_identifier_quote (test->sql_identifier, NULL, prov, FALSE, FALSE);
+		if (!check_result (test, result, test->result1, FALSE, FALSE))
+			nfailed++;
+		g_free (result);
+	}
+	return nfailed;
+}
 
 int
 main (G_GNUC_UNUSED int argc, G_GNUC_UNUSED char** argv)
@@ -202,6 +248,8 @@ main (G_GNUC_UNUSED int argc, G_GNUC_UNUSED char** argv)
 		g_free (result);
 	}
 
+	nfailed += test_cache_invalidation ();
+
 	g_print ("%d tests executed, ", i * 4);
 	if (nfailed > 0)
 		g_print ("%d failed\n", nfailed);
@@ -0,0 +1,296 @@
+/* test-insert-rows.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <glib/gi18n.h>
+#include <locale.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "libgda/libgda.h"
+
+#define PROVIDER_NAME "SQLite"
+#define DB_TEST_BASE "sqlite_insert_rows"
+
+/* 3 parameters per row, more than the default SQLite limit for a single statement */
+#define NB_ROWS 40000
+
+typedef struct
+{
+  GdaConnection *cnc;
+  gchar *dbfile;
+} TestObjectFixture;
+
+static void
+test_insert_rows_start (TestObjectFixture *fixture,
+                        G_GNUC_UNUSED gconstpointer user_data)
+{
+  gint id = g_random_int_range (0, G_MAXINT);
+  gchar *cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s_%d", DB_TEST_BASE, id);
+  GError *error = NULL;
+  gint res;
+
+  fixture->dbfile = g_strdup_printf ("%s_%d.db", DB_TEST_BASE, id);
+  fixture->cnc = gda_connection_open_from_string (PROVIDER_NAME, cncstring, NULL,
+                                                  GDA_CONNECTION_OPTIONS_NONE, NULL);
+  g_free (cncstring);
+  g_assert_nonnull (fixture->cnc);
+
+  res = gda_connection_execute_non_select_command (fixture->cnc,
+                                                   "CREATE TABLE items (id INTEGER PRIMARY KEY, "
+                                                   "name TEXT, qty INTEGER)", &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (res, !=, -1);
+}
+
+static void
+test_insert_rows_finish (TestObjectFixture *fixture,
+                         G_GNUC_UNUSED gconstpointer user_data)
+{
+  gda_connection_close (fixture->cnc, NULL);
+  g_object_unref (fixture->cnc);
+  g_unlink (fixture->dbfile);
+  g_free (fixture->dbfile);
+}
+
+/* creates a data model with the (id, name, qty) rows for ids from @first to @last */
+static GdaDataModel *
+create_rows (gint first, gint last, const gchar *prefix)
+{
+  GdaDataModel *model;
+  gint i;
+
+  model = gda_data_model_array_new_with_g_types (3, G_TYPE_INT, G_TYPE_STRING, G_TYPE_INT);
+  gda_column_set_name (gda_data_model_describe_column (model, 0), "id");
+  gda_column_set_name (gda_data_model_describe_column (model, 1), "name");
+  gda_column_set_name (gda_data_model_describe_column (model, 2), "qty");
+  for (i = first; i <= last; i++) {
+    GList *values = NULL;
+    GValue *value;
+    GError *error = NULL;
+
+    g_value_set_int ((value = gda_value_new (G_TYPE_INT)), i);
+    values = g_list_append (values, value);
+    if (i % 10) {
+      value = gda_value_new (G_TYPE_STRING);
+      g_value_take_string (value, g_strdup_printf ("%s%d", prefix, i));
+    }
+    else
+      value = gda_value_new_null ();
+    values = g_list_append (values, value);
+    g_value_set_int ((value = gda_value_new (G_TYPE_INT)), i % 7);
+    values = g_list_append (values, value);
+
+    g_assert_cmpint (gda_data_model_append_values (model, values, &error), ==, i - first);
+    g_assert_no_error (error);
+    g_list_free_full (values, (GDestroyNotify) gda_value_free);
+  }
+  return model;
+}
+
+static gint
+get_int (GdaConnection *cnc, const gchar *sql)
+{
+  GdaDataModel *model;
+  const GValue *value;
+  GError *error = NULL;
+  gint retval;
+
+  model = gda_connection_execute_select_command (cnc, sql, &error);
+  g_assert_no_error (error);
+  g_assert_nonnull (model);
+  value = gda_data_model_get_value_at (model, 0, 0, &error);
+  g_assert_no_error (error);
+  retval = g_value_get_int (value);
+  g_object_unref (model);
+  return retval;
+}
+
+static gchar *
+get_name (GdaConnection *cnc, gint id)
+{
+  GdaDataModel *model;
+  const GValue *value;
+  GError *error = NULL;
+  gchar *sql, *retval = NULL;
+
+  sql = g_strdup_printf ("SELECT name FROM items WHERE id = %d", id);
+  model = gda_connection_execute_select_command (cnc, sql, &error);
+  g_free (sql);
+  g_assert_no_error (error);
+  g_assert_nonnull (model);
+  g_assert_cmpint (gda_data_model_get_n_rows (model), ==, 1);
+  value = gda_data_model_get_value_at (model, 0, 0, &error);
+  g_assert_no_error (error);
+  if (G_VALUE_TYPE (value) != GDA_TYPE_NULL)
+    retval = g_value_dup_string (value);
+  g_object_unref (model);
+  return retval;
+}
+
+static void
+test_insert_rows_chunks (TestObjectFixture *fixture,
+                         G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *rows;
+  GError *error = NULL;
+  GValue *value;
+  gchar *name;
+  gint max_params;
+
+  max_params = gda_server_provider_get_max_params (gda_connection_get_provider (fixture->cnc),
+                                                   fixture->cnc);
+  g_assert_cmpint (max_params, >, 0);
+
+  rows = create_rows (1, NB_ROWS, "item");
+  g_assert_true (gda_connection_insert_rows_into_table (fixture->cnc, "items", NULL, rows,
+                                                        NULL, NULL, &error));
+  g_assert_no_error (error);
+  g_object_unref (rows);
+
+  g_assert_cmpint (get_int (fixture->cnc, "SELECT count (*) FROM items"), ==, NB_ROWS);
+  g_assert_cmpint (get_int (fixture->cnc, "SELECT count (*) FROM items WHERE name IS NULL"), ==, NB_ROWS / 10);
+  g_assert_cmpint (get_int (fixture->cnc, "SELECT sum (qty) FROM items WHERE id <= 7"), ==, 21);
+  name = get_name (fixture->cnc, NB_ROWS - 1);
+  g_assert_cmpstr (name, ==, "item39999");
+  g_free (name);
+
+  /* a duplicate key in the last chunk: nothing is inserted */
+  rows = create_rows (NB_ROWS + 1, 2 * NB_ROWS, "item");
+  g_assert_true (gda_connection_insert_rows_into_table (fixture->cnc, "items", NULL, rows,
+                                                        NULL, NULL, &error));
+  g_assert_no_error (error);
+  g_object_unref (rows);
+  rows = create_rows (3 * NB_ROWS, 4 * NB_ROWS, "item");
+  g_value_set_int ((value = gda_value_new (G_TYPE_INT)), NB_ROWS);
+  g_assert_true (gda_data_model_set_value_at (rows, 0, NB_ROWS, value, &error));
+  g_assert_no_error (error);
+  gda_value_free (value);
+  g_assert_false (gda_connection_insert_rows_into_table (fixture->cnc, "items", NULL, rows,
+                                                         NULL, NULL, &error));
+  g_assert_nonnull (error);
+  g_clear_error (&error);
+  g_object_unref (rows);
+  g_assert_cmpint (get_int (fixture->cnc, "SELECT count (*) FROM items"), ==, 2 * NB_ROWS);
+}
+
+static void
+test_insert_rows_upsert (TestObjectFixture *fixture,
+                         G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaDataModel *rows;
+  GError *error = NULL;
+  GSList *col_names = NULL;
+  const gchar *conflict_columns[] = {"id", NULL};
+  const gchar *update_columns[] = {"name", NULL};
+  gchar *name;
+  GdaSqlBuilder *builder;
+  GdaStatement *stmt;
+  GValue *value;
+
+  col_names = g_slist_append (col_names, "id");
+  col_names = g_slist_append (col_names, "name");
+  col_names = g_slist_append (col_names, "qty");
+
+  rows = create_rows (1, 100, "item");
+  g_assert_true (gda_connection_insert_rows_into_table (fixture->cnc, "items", col_names, rows,
+                                                        NULL, NULL, &error));
+  g_assert_no_error (error);
+  g_object_unref (rows);
+
+  /* conflicting rows are ignored */
+  rows = create_rows (51, 150, "ignored");
+  g_assert_true (gda_connection_insert_rows_into_table (fixture->cnc, "items", col_names, rows,
+                                                        conflict_columns, NULL, &error));
+  g_assert_no_error (error);
+  g_object_unref (rows);
+  g_assert_cmpint (get_int (fixture->cnc, "SELECT count (*) FROM items"), ==, 150);
+  name = get_name (fixture->cnc, 51);
+  g_assert_cmpstr (name, ==, "item51");
+  g_free (name);
+  name = get_name (fixture->cnc, 101);
+  g_assert_cmpstr (name, ==, "ignored101");
+  g_free (name);
+
+  /* conflicting rows are updated, in several chunks */
+  rows = create_rows (1, NB_ROWS, "updated");
+  g_assert_true (gda_connection_insert_rows_into_table (fixture->cnc, "items", col_names, rows,
+                                                        conflict_columns, update_columns, &error));
+  g_assert_no_error (error);
+  g_object_unref (rows);
+  g_assert_cmpint (get_int (fixture->cnc, "SELECT count (*) FROM items"), ==, NB_ROWS);
+  g_assert_cmpint (get_int (fixture->cnc, "SELECT count (*) FROM items WHERE name LIKE 'updated%'"),
+                   ==, NB_ROWS - NB_ROWS / 10);
+  name = get_name (fixture->cnc, 51);
+  g_assert_cmpstr (name, ==, "updated51");
+  g_free (name);
+  name = get_name (fixture->cnc, 60);
+  g_assert_null (name);
+
+  /* the columns to update can't be specified without the conflict target */
+  builder = gda_sql_builder_new (GDA_SQL_STATEMENT_INSERT);
+  gda_sql_builder_set_table (builder, "items");
+  value = gda_value_new (G_TYPE_INT);
+  g_value_set_int (value, 1);
+  gda_sql_builder_add_field_value_as_gvalue (builder, "id", value);
+  gda_value_free (value);
+  gda_sql_builder_insert_set_upsert (builder, NULL, update_columns);
+  stmt = gda_sql_builder_get_statement (builder, &error);
+  g_assert_no_error (error);
+  g_object_unref (builder);
+  g_assert_null (gda_statement_to_sql_extended (stmt, fixture->cnc, NULL, 0, NULL, &error));
+  g_assert_error (error, GDA_SQL_ERROR, GDA_SQL_STRUCTURE_CONTENTS_ERROR);
+  g_clear_error (&error);
+  g_object_unref (stmt);
+
+  rows = create_rows (1, 10, "rejected");
+  g_assert_false (gda_connection_insert_rows_into_table (fixture->cnc, "items", col_names, rows,
+                                                         NULL, update_columns, &error));
+  g_assert_nonnull (error);
+  g_clear_error (&error);
+  g_object_unref (rows);
+  name = get_name (fixture->cnc, 1);
+  g_assert_cmpstr (name, ==, "updated1");
+  g_free (name);
+
+  g_slist_free (col_names);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  setlocale (LC_ALL, "");
+  g_test_init (&argc, &argv, NULL);
+  gda_init ();
+
+  g_test_add ("/test-insert-rows/chunks",
+              TestObjectFixture,
+              NULL,
+              test_insert_rows_start,
+              test_insert_rows_chunks,
+              test_insert_rows_finish);
+
+  g_test_add ("/test-insert-rows/upsert",
+              TestObjectFixture,
+              NULL,
+              test_insert_rows_start,
+              test_insert_rows_upsert,
+              test_insert_rows_finish);
+
+  return g_test_run ();
+}
@@ -0,0 +1,259 @@
+/* test-meta-struct-bulk.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <glib/gi18n.h>
+#include <locale.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "libgda/libgda.h"
+
+#define PROVIDER_NAME "SQLite"
+#define DB_TEST_BASE "sqlite_meta_struct_bulk"
+
+static const gchar *objects[] = {"customers", "orders", "order_lines", "big_orders"};
+
+typedef struct
+{
+  GdaConnection *cnc;
+  GdaMetaStore *store;
+  gchar *dbfile;
+} TestObjectFixture;
+
+static void
+execute_non_select (GdaConnection *cnc, const gchar *sql)
+{
+  GError *error = NULL;
+  gint res;
+
+  res = gda_connection_execute_non_select_command (cnc, sql, &error);
+  if (res == -1)
+    g_print ("Error executing '%s': %s\n", sql,
+             error && error->message ? error->message : "No detail");
+  g_assert_cmpint (res, !=, -1);
+}
+
+static void
+test_meta_struct_start (TestObjectFixture *fixture,
+                        G_GNUC_UNUSED gconstpointer user_data)
+{
+  gint id = g_random_int_range (0, G_MAXINT);
+  gchar *cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s_%d", DB_TEST_BASE, id);
+  GError *error = NULL;
+
+  fixture->dbfile = g_strdup_printf ("%s_%d.db", DB_TEST_BASE, id);
+  fixture->cnc = gda_connection_open_from_string (PROVIDER_NAME, cncstring, NULL,
+                                                  GDA_CONNECTION_OPTIONS_NONE, NULL);
+  g_free (cncstring);
+  g_assert_nonnull (fixture->cnc);
+
+  execute_non_select (fixture->cnc, "CREATE TABLE customers (id INTEGER PRIMARY KEY, name TEXT NOT NULL)");
+  execute_non_select (fixture->cnc, "CREATE TABLE orders (id INTEGER PRIMARY KEY, "
+                      "customer_id INTEGER REFERENCES customers (id) ON DELETE CASCADE, ref VARCHAR(20))");
+  execute_non_select (fixture->cnc, "CREATE TABLE order_lines (order_id INTEGER, line INTEGER, qty INTEGER DEFAULT 1, "
+                      "PRIMARY KEY (order_id, line), FOREIGN KEY (order_id) REFERENCES orders (id))");
+  execute_non_select (fixture->cnc, "CREATE VIEW big_orders AS SELECT o.id, o.ref FROM orders o "
+                      "JOIN order_lines l ON (l.order_id = o.id) WHERE l.qty > 10");
+
+  g_assert_true (gda_connection_update_meta_store (fixture->cnc, NULL, &error));
+  g_assert_no_error (error);
+  fixture->store = gda_connection_get_meta_store (fixture->cnc);
+}
+
+static void
+test_meta_struct_finish (TestObjectFixture *fixture,
+                         G_GNUC_UNUSED gconstpointer user_data)
+{
+  gda_connection_close (fixture->cnc, NULL);
+  g_object_unref (fixture->cnc);
+  g_unlink (fixture->dbfile);
+  g_free (fixture->dbfile);
+}
+
+static GdaMetaDbObject *
+get_object (GdaMetaStruct *mstruct, const gchar *name)
+{
+  GdaMetaDbObject *dbo;
+  GValue *vname;
+
+  g_value_set_string ((vname = gda_value_new (G_TYPE_STRING)), name);
+  dbo = gda_meta_struct_get_db_object (mstruct, NULL, NULL, vname);
+  gda_value_free (vname);
+  g_assert_nonnull (dbo);
+  return dbo;
+}
+
+static void
+compare_tables (GdaMetaTable *t1, GdaMetaTable *t2)
+{
+  GSList *l1, *l2;
+  gint i;
+
+  g_assert_cmpuint (g_slist_length (t1->columns), ==, g_slist_length (t2->columns));
+  for (l1 = t1->columns, l2 = t2->columns; l1; l1 = l1->next, l2 = l2->next) {
+    GdaMetaTableColumn *c1 = GDA_META_TABLE_COLUMN (l1->data);
+    GdaMetaTableColumn *c2 = GDA_META_TABLE_COLUMN (l2->data);
+    g_assert_cmpstr (c1->column_name, ==, c2->column_name);
+    g_assert_cmpstr (c1->column_type, ==, c2->column_type);
+    g_assert_cmpstr (c1->default_value, ==, c2->default_value);
+    g_assert_true (c1->gtype == c2->gtype);
+    g_assert_cmpint (c1->pkey, ==, c2->pkey);
+    g_assert_cmpint (c1->nullok, ==, c2->nullok);
+  }
+
+  g_assert_cmpint (t1->pk_cols_nb, ==, t2->pk_cols_nb);
+  for (i = 0; i < t1->pk_cols_nb; i++)
+    g_assert_cmpint (t1->pk_cols_array[i], ==, t2->pk_cols_array[i]);
+
+  g_assert_cmpuint (g_slist_length (t1->fk_list), ==, g_slist_length (t2->fk_list));
+  for (l1 = t1->fk_list, l2 = t2->fk_list; l1; l1 = l1->next, l2 = l2->next) {
+    GdaMetaTableForeignKey *fk1 = GDA_META_TABLE_FOREIGN_KEY (l1->data);
+    GdaMetaTableForeignKey *fk2 = GDA_META_TABLE_FOREIGN_KEY (l2->data);
+    g_assert_cmpstr (fk1->depend_on->obj_name, ==, fk2->depend_on->obj_name);
+    g_assert_cmpint (fk1->depend_on->obj_type, ==, fk2->depend_on->obj_type);
+    g_assert_cmpint (fk1->on_delete_policy, ==, fk2->on_delete_policy);
+    g_assert_cmpint (fk1->cols_nb, ==, fk2->cols_nb);
+    for (i = 0; i < fk1->cols_nb; i++) {
+      g_assert_cmpstr (fk1->fk_names_array[i], ==, fk2->fk_names_array[i]);
+      g_assert_cmpstr (fk1->ref_pk_names_array[i], ==, fk2->ref_pk_names_array[i]);
+      g_assert_cmpint (fk1->ref_pk_cols_array[i], ==, fk2->ref_pk_cols_array[i]);
+    }
+  }
+
+  g_assert_cmpuint (g_slist_length (t1->reverse_fk_list), ==, g_slist_length (t2->reverse_fk_list));
+  for (l1 = t1->reverse_fk_list; l1; l1 = l1->next)
+    g_assert_true (GDA_META_TABLE_FOREIGN_KEY (l1->data)->depend_on == GDA_META_DB_OBJECT (t1));
+}
+
+/* compares @mstruct with a GdaMetaStruct complemented object by object */
+static void
+compare_with_per_object (TestObjectFixture *fixture, GdaMetaStruct *mstruct)
+{
+  GdaMetaStruct *ref;
+  GSList *list;
+  guint i;
+
+  ref = gda_meta_struct_new (fixture->store, GDA_META_STRUCT_FEATURE_ALL);
+  for (i = 0; i < G_N_ELEMENTS (objects); i++) {
+    GValue *vname;
+    GError *error = NULL;
+
+    g_value_set_string ((vname = gda_value_new (G_TYPE_STRING)), objects[i]);
+    g_assert_nonnull (gda_meta_struct_complement (ref, GDA_META_DB_UNKNOWN, NULL, NULL, vname, &error));
+    g_assert_no_error (error);
+    gda_value_free (vname);
+  }
+
+  list = gda_meta_struct_get_all_db_objects (mstruct);
+  g_assert_cmpuint (g_slist_length (list), ==, G_N_ELEMENTS (objects));
+  g_slist_free (list);
+
+  for (i = 0; i < G_N_ELEMENTS (objects); i++) {
+    GdaMetaDbObject *dbo1, *dbo2;
+
+    dbo1 = get_object (mstruct, objects[i]);
+    dbo2 = get_object (ref, objects[i]);
+    g_assert_cmpint (dbo1->obj_type, ==, dbo2->obj_type);
+    g_assert_cmpstr (dbo1->obj_full_name, ==, dbo2->obj_full_name);
+    g_assert_cmpstr (dbo1->obj_short_name, ==, dbo2->obj_short_name);
+    if (dbo1->obj_type == GDA_META_DB_TABLE)
+      compare_tables (GDA_META_TABLE (dbo1), GDA_META_TABLE (dbo2));
+    else {
+      g_assert_cmpint (dbo1->obj_type, ==, GDA_META_DB_VIEW);
+      g_assert_cmpstr (GDA_META_VIEW (dbo1)->view_def, ==, GDA_META_VIEW (dbo2)->view_def);
+      g_assert_cmpuint (g_slist_length (dbo1->depend_list), ==, g_slist_length (dbo2->depend_list));
+    }
+  }
+
+  g_assert_cmpuint (g_slist_length (GDA_META_TABLE (get_object (mstruct, "orders"))->fk_list), ==, 1);
+  g_assert_cmpuint (g_slist_length (GDA_META_TABLE (get_object (mstruct, "orders"))->reverse_fk_list), ==, 1);
+  g_assert_cmpint (GDA_META_TABLE (get_object (mstruct, "order_lines"))->pk_cols_nb, ==, 2);
+
+  g_object_unref (ref);
+}
+
+static void
+test_meta_struct_all (TestObjectFixture *fixture,
+                      G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaMetaStruct *mstruct;
+  GError *error = NULL;
+
+  mstruct = gda_meta_struct_new (fixture->store, GDA_META_STRUCT_FEATURE_ALL);
+  g_assert_true (gda_meta_struct_complement_all (mstruct, &error));
+  g_assert_no_error (error);
+  compare_with_per_object (fixture, mstruct);
+
+  /* already complemented objects are kept as they are */
+  g_assert_true (gda_meta_struct_complement_all (mstruct, &error));
+  g_assert_no_error (error);
+  compare_with_per_object (fixture, mstruct);
+  g_object_unref (mstruct);
+}
+
+static void
+test_meta_struct_schema (TestObjectFixture *fixture,
+                         G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaMetaStruct *mstruct;
+  GValue *catalog, *schema;
+  GError *error = NULL;
+
+  g_value_set_string ((catalog = gda_value_new (G_TYPE_STRING)), "main");
+  g_value_set_string ((schema = gda_value_new (G_TYPE_STRING)), "main");
+
+  mstruct = gda_meta_struct_new (fixture->store, GDA_META_STRUCT_FEATURE_ALL);
+  g_assert_true (gda_meta_struct_complement_schema (mstruct, catalog, schema, &error));
+  g_assert_no_error (error);
+  compare_with_per_object (fixture, mstruct);
+  g_object_unref (mstruct);
+
+  mstruct = gda_meta_struct_new (fixture->store, GDA_META_STRUCT_FEATURE_ALL);
+  g_assert_true (gda_meta_struct_complement_schema (mstruct, NULL, schema, &error));
+  g_assert_no_error (error);
+  compare_with_per_object (fixture, mstruct);
+  g_object_unref (mstruct);
+
+  gda_value_free (catalog);
+  gda_value_free (schema);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  setlocale (LC_ALL, "");
+  g_test_init (&argc, &argv, NULL);
+  gda_init ();
+
+  g_test_add ("/test-meta-struct-bulk/all",
+              TestObjectFixture,
+              NULL,
+              test_meta_struct_start,
+              test_meta_struct_all,
+              test_meta_struct_finish);
+
+  g_test_add ("/test-meta-struct-bulk/schema",
+              TestObjectFixture,
+              NULL,
+              test_meta_struct_start,
+              test_meta_struct_schema,
+              test_meta_struct_finish);
+
+  return g_test_run ();
+}
@@ -0,0 +1,271 @@
+/* test-numeric.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <locale.h>
+#include <string.h>
+#include "libgda/libgda.h"
+
+static GdaNumeric *
+numeric_from_string (const gchar *str)
+{
+  GdaNumeric *numeric;
+  numeric = gda_numeric_new ();
+  gda_numeric_set_from_string (numeric, str);
+  return numeric;
+}
+
+static void
+check_string (const gchar *str, const gchar *expected)
+{
+  GdaNumeric *numeric;
+  gchar *res;
+
+  numeric = numeric_from_string (str);
+  res = gda_numeric_get_string (numeric);
+  g_assert_cmpstr (res, ==, expected);
+  g_free (res);
+  gda_numeric_free (numeric);
+}
+
+static void
+test_numeric_strings (void)
+{
+  check_string ("0", "0");
+  check_string ("1.50", "1.50");
+  check_string ("-0.00", "0.00");
+  check_string ("-12.345", "-12.345");
+  check_string ("0.001", "0.001");
+  check_string ("1e3", "1000");
+  check_string ("1.5e-3", "0.0015");
+  check_string ("NaN", "NaN");
+  check_string ("-inf", "-Infinity");
+
+  /* more than 128 bits */
+  check_string ("340282366920938463463374607431768211456", "340282366920938463463374607431768211456");
+  check_string ("-123456789012345678901234567890123456789012.5",
+                "-123456789012345678901234567890123456789012.5");
+  check_string ("99999999999999999999.99999999999999999999", "99999999999999999999.99999999999999999999");
+}
+
+static void
+check_compare (const gchar *str1, const gchar *str2, gint expected)
+{
+  GdaNumeric *n1, *n2;
+
+  n1 = numeric_from_string (str1);
+  n2 = numeric_from_string (str2);
+  g_assert_cmpint (gda_numeric_compare (n1, n2), ==, expected);
+  g_assert_cmpint (gda_numeric_compare (n2, n1), ==, - expected);
+  if (expected == 0)
+    {
+      g_assert_true (gda_numeric_equal (n1, n2));
+      g_assert_cmpuint (gda_numeric_hash (n1), ==, gda_numeric_hash (n2));
+    }
+  gda_numeric_free (n1);
+  gda_numeric_free (n2);
+}
+
+static void
+test_numeric_compare (void)
+{
+  check_compare ("1.5", "1.50", 0);
+  check_compare ("2", "10", -1);
+  check_compare ("-2", "-10", 1);
+  check_compare ("-1", "1", -1);
+  check_compare ("0", "-0.0", 0);
+  check_compare ("NaN", "Infinity", 1);
+  check_compare ("-Infinity", "-1e100", -1);
+  check_compare ("340282366920938463463374607431768211456", "340282366920938463463374607431768211455", 1);
+  check_compare ("340282366920938463463374607431768211456.000", "340282366920938463463374607431768211456", 0);
+  check_compare ("1e30", "0.000001", 1);
+
+  /* gda_value_compare() must not compare the strings */
+  GValue *v1, *v2;
+  v1 = gda_value_new_from_string ("9.5", GDA_TYPE_NUMERIC);
+  v2 = gda_value_new_from_string ("10", GDA_TYPE_NUMERIC);
+  g_assert_cmpint (gda_value_compare (v1, v2), <, 0);
+  gda_value_free (v1);
+  gda_value_free (v2);
+}
+
+static void
+check_op (GdaNumeric *(*func) (const GdaNumeric *, const GdaNumeric *),
+          const gchar *str1, const gchar *str2, const gchar *expected)
+{
+  GdaNumeric *n1, *n2, *res;
+  gchar *str;
+
+  n1 = numeric_from_string (str1);
+  n2 = numeric_from_string (str2);
+  res = func (n1, n2);
+  str = gda_numeric_get_string (res);
+  g_assert_cmpstr (str, ==, expected);
+  g_free (str);
+  gda_numeric_free (res);
+  gda_numeric_free (n1);
+  gda_numeric_free (n2);
+}
+
+static void
+test_numeric_arithmetic (void)
+{
+  GdaNumeric *numeric;
+  gint64 unscaled;
+  guint scale;
+
+  check_op (gda_numeric_add, "1.5", "2.25", "3.75");
+  check_op (gda_numeric_sub, "1.5", "2.25", "-0.75");
+  check_op (gda_numeric_mul, "1.5", "-2.25", "-3.375");
+  check_op (gda_numeric_add, "-1", "1", "0");
+  check_op (gda_numeric_add, "340282366920938463463374607431768211455", "1",
+            "340282366920938463463374607431768211456");
+  check_op (gda_numeric_sub, "340282366920938463463374607431768211456", "1",
+            "340282366920938463463374607431768211455");
+  check_op (gda_numeric_mul, "123456789012345678901234567890", "987654321098765432109876543210",
+            "121932631137021795226185032733622923332237463801111263526900");
+  check_op (gda_numeric_add, "Infinity", "1", "Infinity");
+
+  numeric = gda_numeric_new ();
+  gda_numeric_set_decimal (numeric, -12345, 2);
+  g_assert_true (gda_numeric_get_decimal (numeric, &unscaled, &scale));
+  g_assert_cmpint (unscaled, ==, -12345);
+  g_assert_cmpuint (scale, ==, 2);
+  g_assert_cmpfloat (gda_numeric_get_double (numeric), ==, -123.45);
+  gda_numeric_free (numeric);
+}
+
+/*
+ * Benchmark, run with -m perf. The "string" figures reproduce what GdaNumeric used to do when it only
+ * stored numbers as strings: parsing through g_ascii_strtod() and comparing through doubles.
+ */
+#define BENCH_VALUES 10000
+#define BENCH_ROUNDS 100
+
+static gchar **
+bench_strings (void)
+{
+  gchar **strings;
+  gint i;
+  strings = g_new (gchar *, BENCH_VALUES + 1);
+  for (i = 0; i < BENCH_VALUES; i++)
+    strings[i] = g_strdup_printf ("%d.%02d", g_random_int_range (-1000000, 1000000),
+                                  g_random_int_range (0, 100));
+  strings[BENCH_VALUES] = NULL;
+  return strings;
+}
+
+static void
+test_numeric_bench (void)
+{
+  gchar **strings;
+  GdaNumeric **numerics;
+  gdouble elapsed;
+  gint i, r, sum = 0;
+
+  if (!g_test_perf ())
+    return;
+
+  strings = bench_strings ();
+  numerics = g_new (GdaNumeric *, BENCH_VALUES);
+  for (i = 0; i < BENCH_VALUES; i++)
+    numerics[i] = numeric_from_string (strings[i]);
+
+  /* decoding */
+  g_test_timer_start ();
+  for (r = 0; r < BENCH_ROUNDS; r++)
+    for (i = 0; i < BENCH_VALUES; i++)
+      {
+        gchar *end, *copy;
+        g_ascii_strtod (strings[i], &end);
+        copy = g_strdup (strings[i]);
+        sum += *copy;
+        g_free (copy);
+      }
+  elapsed = g_test_timer_elapsed ();
+  g_test_minimized_result (elapsed, "decode, string: %g s", elapsed);
+
+  g_test_timer_start ();
+  for (r = 0; r < BENCH_ROUNDS; r++)
+    for (i = 0; i < BENCH_VALUES; i++)
+      gda_numeric_set_from_string (numerics[i], strings[i]);
+  elapsed = g_test_timer_elapsed ();
+  g_test_minimized_result (elapsed, "decode, native: %g s", elapsed);
+
+  /* comparing */
+  g_test_timer_start ();
+  for (r = 0; r < BENCH_ROUNDS; r++)
+    for (i = 1; i < BENCH_VALUES; i++)
+      {
+        gdouble d1, d2;
+        d1 = g_ascii_strtod (strings[i - 1], NULL);
+        d2 = g_ascii_strtod (strings[i], NULL);
+        sum += (d1 < d2) ? -1 : ((d1 > d2) ? 1 : 0);
+      }
+  elapsed = g_test_timer_elapsed ();
+  g_test_minimized_result (elapsed, "compare, string: %g s", elapsed);
+
+  g_test_timer_start ();
+  for (r = 0; r < BENCH_ROUNDS; r++)
+    for (i = 1; i < BENCH_VALUES; i++)
+      sum += gda_numeric_compare (numerics[i - 1], numerics[i]);
+  elapsed = g_test_timer_elapsed ();
+  g_test_minimized_result (elapsed, "compare, native: %g s", elapsed);
+
+  /* hashing */
+  g_test_timer_start ();
+  for (r = 0; r < BENCH_ROUNDS; r++)
+    for (i = 0; i < BENCH_VALUES; i++)
+      {
+        gdouble d;
+        d = g_ascii_strtod (strings[i], NULL);
+        sum += g_double_hash (&d);
+      }
+  elapsed = g_test_timer_elapsed ();
+  g_test_minimized_result (elapsed, "hash, string: %g s", elapsed);
+
+  g_test_timer_start ();
+  for (r = 0; r < BENCH_ROUNDS; r++)
+    for (i = 0; i < BENCH_VALUES; i++)
+      sum += gda_numeric_hash (numerics[i]);
+  elapsed = g_test_timer_elapsed ();
+  g_test_minimized_result (elapsed, "hash, native: %g s", elapsed);
+
+  g_test_message ("checksum: %d", sum);
+  for (i = 0; i < BENCH_VALUES; i++)
+    gda_numeric_free (numerics[i]);
+  g_free (numerics);
+  g_strfreev (strings);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  setlocale (LC_ALL,"");
+
+  g_test_init (&argc, &argv, NULL);
+  gda_init ();
+
+  g_test_add_func ("/test-numeric/strings", test_numeric_strings);
+  g_test_add_func ("/test-numeric/compare", test_numeric_compare);
+  g_test_add_func ("/test-numeric/arithmetic", test_numeric_arithmetic);
+  g_test_add_func ("/test-numeric/bench", test_numeric_bench);
+
+  return g_test_run ();
+}
@@ -0,0 +1,219 @@
+/* test-providers-cache.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <glib/gi18n.h>
+#include <locale.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "libgda/libgda.h"
+
+/*
+ * The providers are only listed once per process, so each listing is done in a sub process,
+ * all of them sharing the same cache directory (XDG_CACHE_HOME).
+ */
+#define CACHE_DIR_ENV "GDA_TEST_PROVIDERS_CACHE_DIR"
+#define CACHED_DESCR "Description from the cache"
+#define REMOVED_MODULE "/nonexistent/libgda-removed." G_MODULE_SUFFIX
+
+/* Returns: (transfer full): the path of the providers' cache file, or %NULL if it does not exist */
+static gchar *
+get_cache_file (void)
+{
+  gchar *dirname, *path = NULL;
+  const gchar *name;
+  GDir *dir;
+
+  dirname = g_build_filename (g_getenv (CACHE_DIR_ENV), "libgda", NULL);
+  dir = g_dir_open (dirname, 0, NULL);
+  if (dir) {
+    while ((name = g_dir_read_name (dir))) {
+      if (g_str_has_prefix (name, "providers-") && g_str_has_suffix (name, ".cache")) {
+        path = g_build_filename (dirname, name, NULL);
+        break;
+      }
+    }
+    g_dir_close (dir);
+  }
+  g_free (dirname);
+  return path;
+}
+
+static GKeyFile *
+load_cache (gchar **out_path)
+{
+  GKeyFile *keyfile;
+  GError *error = NULL;
+  gchar *path;
+
+  path = get_cache_file ();
+  g_assert_nonnull (path);
+  keyfile = g_key_file_new ();
+  g_assert_true (g_key_file_load_from_file (keyfile, path, G_KEY_FILE_KEEP_COMMENTS, &error));
+  g_assert_no_error (error);
+  if (out_path)
+    *out_path = path;
+  else
+    g_free (path);
+  return keyfile;
+}
+
+static void
+save_cache (GKeyFile *keyfile, const gchar *path)
+{
+  GError *error = NULL;
+  g_assert_true (g_key_file_save_to_file (keyfile, path, &error));
+  g_assert_no_error (error);
+}
+
+/* run in a sub process: prints the "<provider>: <description>" list */
+static void
+list_providers (void)
+{
+  GdaDataModel *model;
+  gint i, nrows;
+
+  gda_init ();
+  model = gda_config_list_providers ();
+  g_assert_nonnull (model);
+  nrows = gda_data_model_get_n_rows (model);
+  for (i = 0; i < nrows; i++) {
+    const GValue *name, *descr;
+    name = gda_data_model_get_value_at (model, 0, i, NULL);
+    descr = gda_data_model_get_value_at (model, 1, i, NULL);
+    g_assert_nonnull (name);
+    g_print ("%s: %s\n", g_value_get_string (name),
+             descr && G_VALUE_HOLDS_STRING (descr) ? g_value_get_string (descr) : "");
+  }
+  g_object_unref (model);
+}
+
+static void
+run_list_providers (void)
+{
+  g_test_trap_subprocess (NULL, 0, G_TEST_SUBPROCESS_INHERIT_STDERR);
+  g_test_trap_assert_passed ();
+}
+
+static void
+test_providers_cache (void)
+{
+  GKeyFile *keyfile;
+  gchar *path, *group, *descr;
+  gchar **groups;
+
+  if (g_test_subprocess ()) {
+    list_providers ();
+    return;
+  }
+
+  /* 1st listing: the cache is created */
+  run_list_providers ();
+  path = get_cache_file ();
+  g_assert_nonnull (path);
+  g_free (path);
+
+  keyfile = load_cache (&path);
+  groups = g_key_file_get_groups (keyfile, NULL);
+  if (!groups || !groups[0]) {
+    g_strfreev (groups);
+    g_key_file_free (keyfile);
+    g_free (path);
+    g_test_skip ("No provider module has been built");
+    return;
+  }
+  group = g_strdup (groups[0]);
+  g_strfreev (groups);
+  g_assert_cmpint (g_key_file_get_integer (keyfile, group, "NbProviders", NULL), >, 0);
+  g_assert_true (g_key_file_has_key (keyfile, group, "Name0", NULL));
+
+  /* 2nd listing: an up to date module's information is read from the cache, and
+   * the information of modules which don't exist anymore is removed */
+  g_key_file_set_string (keyfile, group, "Description0", CACHED_DESCR);
+  g_key_file_set_int64 (keyfile, REMOVED_MODULE, "MTime", 1);
+  save_cache (keyfile, path);
+  g_key_file_free (keyfile);
+
+  run_list_providers ();
+  g_test_trap_assert_stdout ("*" CACHED_DESCR "*");
+  keyfile = load_cache (NULL);
+  g_assert_false (g_key_file_has_group (keyfile, REMOVED_MODULE));
+  g_assert_true (g_key_file_has_group (keyfile, group));
+
+  /* 3rd listing: a module whose modification time has changed is loaded again */
+  g_key_file_set_int64 (keyfile, group, "MTime",
+                        g_key_file_get_int64 (keyfile, group, "MTime", NULL) - 1);
+  save_cache (keyfile, path);
+  g_key_file_free (keyfile);
+
+  run_list_providers ();
+  g_test_trap_assert_stdout_unmatched ("*" CACHED_DESCR "*");
+  keyfile = load_cache (NULL);
+  descr = g_key_file_get_string (keyfile, group, "Description0", NULL);
+  g_assert_cmpstr (descr, !=, CACHED_DESCR);
+  g_free (descr);
+
+  /* 4th listing: the same when the size has changed */
+  g_key_file_set_string (keyfile, group, "Description0", CACHED_DESCR);
+  g_key_file_set_int64 (keyfile, group, "Size",
+                        g_key_file_get_int64 (keyfile, group, "Size", NULL) + 1);
+  save_cache (keyfile, path);
+  g_key_file_free (keyfile);
+
+  run_list_providers ();
+  g_test_trap_assert_stdout_unmatched ("*" CACHED_DESCR "*");
+
+  g_free (group);
+  g_unlink (path);
+  g_free (path);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  gchar *dirname = NULL;
+
+  setlocale (LC_ALL,"");
+
+  /* must be done before anything calls g_get_user_cache_dir() */
+  if (!g_getenv (CACHE_DIR_ENV)) {
+    dirname = g_dir_make_tmp ("gda-providers-cache-XXXXXX", NULL);
+    g_assert_nonnull (dirname);
+    g_setenv (CACHE_DIR_ENV, dirname, TRUE);
+  }
+  g_setenv ("XDG_CACHE_HOME", g_getenv (CACHE_DIR_ENV), TRUE);
+  g_unsetenv ("GDA_NO_PROVIDERS_CACHE");
+
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/providers-cache/invalidation", test_providers_cache);
+
+  gint retval;
+  retval = g_test_run ();
+
+  if (dirname) {
+    gchar *libgda_dir;
+    libgda_dir = g_build_filename (dirname, "libgda", NULL);
+    g_rmdir (libgda_dir);
+    g_free (libgda_dir);
+    g_rmdir (dirname);
+    g_free (dirname);
+  }
+  return retval;
+}
@@ -996,6 +996,66 @@ test_server_operation_operations_db (TestObjectFixture *fixture,
   g_assert_true (res);
 }
 
+#define NB_FKEYS 50
+
+static void
+test_server_operation_shared_specs (TestObjectFixture *fixture,
+                                    G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaServerOperation *op1, *op2;
+  const GValue *value;
+  gboolean res;
+  gint i;
+
+  /* both operations are created from the same specifications */
+  op1 = gda_server_provider_create_operation (fixture->provider, fixture->cnc,
+                                              GDA_SERVER_OPERATION_CREATE_TABLE, NULL, NULL);
+  g_assert_nonnull (op1);
+  op2 = gda_server_provider_create_operation (fixture->provider, fixture->cnc,
+                                              GDA_SERVER_OPERATION_CREATE_TABLE, NULL, NULL);
+  g_assert_nonnull (op2);
+
+  res = gda_server_operation_set_value_at (op1, "Shared", NULL, "/TABLE_DEF_P/TABLE_NAME");
+  g_assert_true (res);
+
+  for (i = 0; i < NB_FKEYS; i++)
+    {
+      gchar *str = g_strdup_printf ("ref%d", i);
+      res = gda_server_operation_set_value_at (op1, str, NULL, "/FKEY_S/%d/FKEY_REF_TABLE", i);
+      g_assert_true (res);
+      g_free (str);
+    }
+  g_assert_cmpuint (gda_server_operation_get_sequence_size (op1, "/FKEY_S"), ==, NB_FKEYS);
+
+  value = gda_server_operation_get_value_at (op1, "/FKEY_S/%d/FKEY_REF_TABLE", NB_FKEYS - 1);
+  g_assert_nonnull (value);
+  g_assert_cmpstr (g_value_get_string (value), ==, "ref49");
+
+  /* items after a removed one are found at their new position */
+  gda_server_operation_del_item_from_sequence (op1, "/FKEY_S/10");
+  g_assert_cmpuint (gda_server_operation_get_sequence_size (op1, "/FKEY_S"), ==, NB_FKEYS - 1);
+  value = gda_server_operation_get_value_at (op1, "/FKEY_S/10/FKEY_REF_TABLE");
+  g_assert_nonnull (value);
+  g_assert_cmpstr (g_value_get_string (value), ==, "ref11");
+  g_assert_null (gda_server_operation_get_node_info (op1, "/FKEY_S/%d", NB_FKEYS - 1));
+
+  /* the other operation is not affected */
+  g_assert_cmpuint (gda_server_operation_get_sequence_size (op2, "/FKEY_S"), ==, 0);
+  value = gda_server_operation_get_value_at (op2, "/TABLE_DEF_P/TABLE_NAME");
+  g_assert_true (!value || G_VALUE_HOLDS (value, GDA_TYPE_NULL));
+  g_object_unref (op1);
+
+  res = gda_server_operation_set_value_at (op2, "Shared2", NULL, "/TABLE_DEF_P/TABLE_NAME");
+  g_assert_true (res);
+  res = gda_server_operation_set_value_at (op2, "id", NULL, "/FIELDS_A/@COLUMN_NAME/0");
+  g_assert_true (res);
+  res = gda_server_operation_set_value_at (op2, "integer", NULL, "/FIELDS_A/@COLUMN_TYPE/0");
+  g_assert_true (res);
+  res = gda_server_provider_perform_operation (fixture->provider, fixture->cnc, op2, NULL);
+  g_assert_true (res);
+  g_object_unref (op2);
+}
+
 gint
 main(gint argc, gchar *argv[])
 {
@@ -1017,6 +1077,13 @@ main(gint argc, gchar *argv[])
               test_server_operation_operations_db,
               test_server_operation_finish);
 
+  g_test_add ("/test-server-operation-sqlite/shared-specs",
+              TestObjectFixture,
+              NULL,
+              test_server_operation_start,
+              test_server_operation_shared_specs,
+              test_server_operation_finish);
+
   return g_test_run();
 }
 
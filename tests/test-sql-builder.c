@@ -42,6 +42,8 @@ static GdaSqlStatement *build10 (void);
 static GdaSqlStatement *build11 (void);
 static GdaSqlStatement *build12 (void);
 static GdaSqlStatement *build13 (void);
+static GdaSqlStatement *build14 (void);
+static GdaSqlStatement *build15 (void);
 
 static gboolean builder_test_target_id (void);
 
@@ -59,7 +61,9 @@ ATest tests[] = {
 	{"build10", build10, "{\"sql\":null,\"stmt_type\":\"SELECT\",\"contents\":{\"distinct\":\"true\",\"fields\":[{\"expr\":{\"value\":\"fav_id\",\"sqlident\":\"TRUE\"}},{\"expr\":{\"value\":\"rank\",\"sqlident\":\"TRUE\"}}],\"from\":{\"targets\":[{\"expr\":{\"value\":\"mytable\",\"sqlident\":\"TRUE\"},\"table_name\":\"mytable\"}]},\"limit\":{\"value\":\"5\"}}}"},
 	{"build11", build11, "{\"sql\":null,\"stmt_type\":\"SELECT\",\"contents\":{\"distinct\":\"true\",\"distinct_on\":{\"value\":\"rank\",\"sqlident\":\"TRUE\"},\"fields\":[{\"expr\":{\"value\":\"fav_id\",\"sqlident\":\"TRUE\"}},{\"expr\":{\"value\":\"rank\",\"sqlident\":\"TRUE\"}}],\"from\":{\"targets\":[{\"expr\":{\"value\":\"mytable\",\"sqlident\":\"TRUE\"},\"table_name\":\"mytable\"}]},\"limit\":{\"value\":\"5\"},\"offset\":{\"value\":\"2\"}}}"},
 	{"build12", build12, "{\"sql\":null,\"stmt_type\":\"SELECT\",\"contents\":{\"distinct\":\"false\",\"fields\":[{\"expr\":{\"value\":\"store_name\",\"sqlident\":\"TRUE\"}},{\"expr\":{\"func\":{\"function_name\":\"sum\",\"function_args\":[{\"value\":\"sales\",\"sqlident\":\"TRUE\"}]}}}],\"from\":{\"targets\":[{\"expr\":{\"value\":\"stores\",\"sqlident\":\"TRUE\"},\"table_name\":\"stores\"}]},\"group_by\":[{\"value\":\"store_name\",\"sqlident\":\"TRUE\"}],\"having\":{\"operation\":{\"operator\":\">\",\"operand0\":{\"func\":{\"function_name\":\"sum\",\"function_args\":[{\"value\":\"sales\",\"sqlident\":\"TRUE\"}]}},\"operand1\":{\"value\":\"10\"}}}}}"},
-	{"build13", build13, "{\"sql\":null,\"stmt_type\":\"SELECT\",\"contents\":{\"distinct\":\"false\",\"fields\":[{\"expr\":{\"value\":\"'A''string'\"}},{\"expr\":{\"value\":\"234\"}},{\"expr\":{\"value\":\"TRUE\"}},{\"expr\":{\"value\":\"123.456789\"}},{\"expr\":{\"value\":\"1972-05-27\"}},{\"expr\":{\"value\":\"abc'de\\\\\\\\fgh\"}}]}}"}
+	{"build13", build13, "{\"sql\":null,\"stmt_type\":\"SELECT\",\"contents\":{\"distinct\":\"false\",\"fields\":[{\"expr\":{\"value\":\"'A''string'\"}},{\"expr\":{\"value\":\"234\"}},{\"expr\":{\"value\":\"TRUE\"}},{\"expr\":{\"value\":\"123.456789\"}},{\"expr\":{\"value\":\"1972-05-27\"}},{\"expr\":{\"value\":\"abc'de\\\\\\\\fgh\"}}]}}"},
+	{"build14", build14, "{\"sql\":null,\"stmt_type\":\"INSERT\",\"contents\":{\"table\":\"mytable\",\"fields\":[\"id\",\"name\"],\"values\":[[{\"value\":\"1\"},{\"value\":\"'a'\"}],[{\"value\":\"2\"},{\"value\":\"'b'\"}],[{\"value\":\"3\"},{\"value\":\"NULL\"}]]}}"},
+	{"build15", build15, "{\"sql\":null,\"stmt_type\":\"INSERT\",\"contents\":{\"table\":\"mytable\",\"fields\":[\"id\",\"name\"],\"values\":[[{\"value\":null,\"param_spec\":{\"name\":\"id1\",\"descr\":null,\"type\":\"int\",\"is_param\":true,\"nullok\":false}},{\"value\":null,\"param_spec\":{\"name\":\"name1\",\"descr\":null,\"type\":\"string\",\"is_param\":true,\"nullok\":true}}],[{\"value\":null,\"param_spec\":{\"name\":\"id2\",\"descr\":null,\"type\":\"int\",\"is_param\":true,\"nullok\":false}},{\"value\":null,\"param_spec\":{\"name\":\"name2\",\"descr\":null,\"type\":\"string\",\"is_param\":true,\"nullok\":true}}]],\"conflict_fields\":[\"id\"],\"update_fields\":[\"name\"]}}"}
 };
 
 int
@@ -650,3 +654,64 @@ build13 (void)
 	g_object_unref (b);
 	return stmt;
 }
+
+/*
+ * INSERT INTO mytable (id, name) VALUES (1, 'a'), (2, 'b'), (3, NULL)
+ */
+static GdaSqlStatement *
+build14 (void)
+{
+	GdaSqlBuilder *b;
+	GdaSqlStatement *stmt;
+	GdaSqlBuilderId ids [2];
+
+	b = gda_sql_builder_new (GDA_SQL_STATEMENT_INSERT);
+	gda_sql_builder_set_table (b, "mytable");
+	gda_sql_builder_add_field_value_id (b, gda_sql_builder_add_id (b, "id"), 0);
+	gda_sql_builder_add_field_value_id (b, gda_sql_builder_add_id (b, "name"), 0);
+
+	ids [0] = gda_sql_builder_add_expr (b, NULL, G_TYPE_INT, 1);
+	ids [1] = gda_sql_builder_add_expr (b, NULL, G_TYPE_STRING, "a");
+	gda_sql_builder_insert_add_values_v (b, ids, 2);
+	ids [0] = gda_sql_builder_add_expr (b, NULL, G_TYPE_INT, 2);
+	ids [1] = gda_sql_builder_add_expr (b, NULL, G_TYPE_STRING, "b");
+	gda_sql_builder_insert_add_values_v (b, ids, 2);
+	ids [0] = gda_sql_builder_add_expr (b, NULL, G_TYPE_INT, 3);
+	ids [1] = gda_sql_builder_add_expr_value (b, NULL);
+	gda_sql_builder_insert_add_values_v (b, ids, 2);
+
+	stmt = gda_sql_statement_copy (gda_sql_builder_get_sql_statement (b));
+	g_object_unref (b);
+	return stmt;
+}
+
+/*
+ * INSERT INTO mytable (id, name) VALUES (##id1::int, ##name1::string::null), (##id2::int, ##name2::string::null)
+ *        ON CONFLICT (id) DO UPDATE SET name = EXCLUDED.name
+ */
+static GdaSqlStatement *
+build15 (void)
+{
+	GdaSqlBuilder *b;
+	GdaSqlStatement *stmt;
+	GdaSqlBuilderId ids [2];
+	const gchar *conflict_fields[] = {"id", NULL};
+	const gchar *update_fields[] = {"name", NULL};
+
+	b = gda_sql_builder_new (GDA_SQL_STATEMENT_INSERT);
+	gda_sql_builder_set_table (b, "mytable");
+	gda_sql_builder_add_field_value_id (b, gda_sql_builder_add_id (b, "id"),
+					    gda_sql_builder_add_param (b, "id1", G_TYPE_INT, FALSE));
+	gda_sql_builder_add_field_value_id (b, gda_sql_builder_add_id (b, "name"),
+					    gda_sql_builder_add_param (b, "name1", G_TYPE_STRING, TRUE));
+
+	ids [0] = gda_sql_builder_add_param (b, "id2", G_TYPE_INT, FALSE);
+	ids [1] = gda_sql_builder_add_param (b, "name2", G_TYPE_STRING, TRUE);
+	gda_sql_builder_insert_add_values_v (b, ids, 2);
+
+	gda_sql_builder_insert_set_upsert (b, conflict_fields, update_fields);
+
+	stmt = gda_sql_statement_copy (gda_sql_builder_get_sql_statement (b));
+	g_object_unref (b);
+	return stmt;
+}
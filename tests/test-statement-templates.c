@@ -0,0 +1,369 @@
+/* test-statement-templates.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <glib/gi18n.h>
+#include <locale.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "libgda/libgda.h"
+#include <libgda/gda-statement-priv.h>
+
+#define PROVIDER_NAME "SQLite"
+#define DB_TEST_BASE "sqlite_statement_templates"
+
+#define SELECT_SQL "SELECT id, name FROM items WHERE id = ##id::int::null AND name LIKE ##pat::string " \
+	"AND qty > ##qty::int ORDER BY name"
+
+typedef struct
+{
+  GdaConnection *cnc;
+  gchar *dbfile;
+  GdaSqlParser *parser;
+} TestObjectFixture;
+
+static void
+test_templates_start (TestObjectFixture *fixture,
+                      G_GNUC_UNUSED gconstpointer user_data)
+{
+  gint id = g_random_int_range (0, G_MAXINT);
+  gchar *cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s_%d", DB_TEST_BASE, id);
+
+  fixture->dbfile = g_strdup_printf ("%s_%d.db", DB_TEST_BASE, id);
+  fixture->cnc = gda_connection_open_from_string (PROVIDER_NAME, cncstring, NULL,
+                                                  GDA_CONNECTION_OPTIONS_NONE, NULL);
+  g_free (cncstring);
+  g_assert_nonnull (fixture->cnc);
+  fixture->parser = gda_connection_create_parser (fixture->cnc);
+  g_assert_nonnull (fixture->parser);
+}
+
+static void
+test_templates_finish (TestObjectFixture *fixture,
+                       G_GNUC_UNUSED gconstpointer user_data)
+{
+  g_object_unref (fixture->parser);
+  gda_connection_close (fixture->cnc, NULL);
+  g_object_unref (fixture->cnc);
+  g_unlink (fixture->dbfile);
+  g_free (fixture->dbfile);
+}
+
+static GdaStatement *
+parse_statement (GdaSqlParser *parser, const gchar *sql, GdaSet **params)
+{
+  GdaStatement *stmt;
+  GError *error = NULL;
+
+  stmt = gda_sql_parser_parse_string (parser, sql, NULL, &error);
+  g_assert_no_error (error);
+  g_assert_nonnull (stmt);
+  g_assert_true (gda_statement_get_parameters (stmt, params, &error));
+  g_assert_no_error (error);
+  return stmt;
+}
+
+/*
+ * Renders @stmt, which may have been rendered before, and a copy of @stmt, which has never been
+ * rendered, and checks that both renderings and lists of used parameters are identical
+ */
+static void
+check_rendering (GdaStatement *stmt, GdaConnection *cnc, GdaSet *params, GdaStatementSqlFlag flags)
+{
+  GdaStatement *copy;
+  GSList *used1, *used2, *list1, *list2;
+  gchar *sql1, *sql2;
+  GError *error = NULL;
+
+  sql1 = gda_statement_to_sql_extended (stmt, cnc, params, flags, &used1, &error);
+  g_assert_no_error (error);
+  g_assert_nonnull (sql1);
+
+  copy = gda_statement_copy (stmt);
+  sql2 = gda_statement_to_sql_extended (copy, cnc, params, flags, &used2, &error);
+  g_assert_no_error (error);
+  g_object_unref (copy);
+
+  g_assert_cmpstr (sql1, ==, sql2);
+  g_assert_cmpint (g_slist_length (used1), ==, g_slist_length (used2));
+  for (list1 = used1, list2 = used2; list1; list1 = list1->next, list2 = list2->next)
+    g_assert_true (list1->data == list2->data);
+
+  g_slist_free (used1);
+  g_slist_free (used2);
+  g_free (sql1);
+  g_free (sql2);
+}
+
+static void
+set_values (GdaSet *params, gint id, const gchar *pat, gint qty)
+{
+  GError *error = NULL;
+
+  if (id >= 0)
+    g_assert_true (gda_set_set_holder_value (params, &error, "id", id));
+  else
+    g_assert_true (gda_holder_set_value (gda_set_get_holder (params, "id"), NULL, &error));
+  g_assert_no_error (error);
+  g_assert_true (gda_set_set_holder_value (params, &error, "pat", pat));
+  g_assert_no_error (error);
+  g_assert_true (gda_set_set_holder_value (params, &error, "qty", qty));
+  g_assert_no_error (error);
+}
+
+static void
+test_templates_values (TestObjectFixture *fixture,
+                       G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaStatement *stmt;
+  GdaSet *params;
+  gchar *sql;
+  gint i;
+
+  stmt = parse_statement (fixture->parser, SELECT_SQL, &params);
+
+  /* without any connection, then using the connection's dialect */
+  for (i = 0; i < 100; i++) {
+    gchar *pat;
+
+    pat = g_strdup_printf ("it'em %d%%", i);
+    set_values (params, i, pat, i * 3);
+    g_free (pat);
+    check_rendering (stmt, NULL, params, 0);
+    check_rendering (stmt, fixture->cnc, params, 0);
+  }
+
+  /* a NULL value changes the structure of the SQL around the parameter */
+  set_values (params, -1, "null id", 1);
+  check_rendering (stmt, fixture->cnc, params, 0);
+  sql = gda_statement_to_sql_extended (stmt, fixture->cnc, params, 0, NULL, NULL);
+  g_assert_nonnull (strstr (sql, "IS NULL"));
+  g_free (sql);
+
+  set_values (params, 5, "not null id", 1);
+  check_rendering (stmt, fixture->cnc, params, 0);
+  sql = gda_statement_to_sql_extended (stmt, fixture->cnc, params, 0, NULL, NULL);
+  g_assert_null (strstr (sql, "IS NULL"));
+  g_free (sql);
+
+  /* parameters rendered as place holders */
+  check_rendering (stmt, fixture->cnc, params, GDA_STATEMENT_SQL_PARAMS_AS_QMARK);
+  check_rendering (stmt, fixture->cnc, params, GDA_STATEMENT_SQL_PARAMS_AS_QMARK);
+  check_rendering (stmt, fixture->cnc, NULL, GDA_STATEMENT_SQL_PARAMS_SHORT);
+  check_rendering (stmt, fixture->cnc, NULL, GDA_STATEMENT_SQL_PARAMS_SHORT);
+
+  g_object_unref (params);
+  g_object_unref (stmt);
+}
+
+static void
+test_templates_errors (TestObjectFixture *fixture,
+                       G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaStatement *stmt;
+  GdaSet *params, *other;
+  GSList *used = NULL;
+  gchar *sql;
+  GError *error = NULL;
+
+  stmt = parse_statement (fixture->parser, SELECT_SQL, &params);
+  set_values (params, 1, "abc", 2);
+  check_rendering (stmt, fixture->cnc, params, 0);
+
+  /* invalid and missing parameters are still reported once the statement has been compiled */
+  gda_holder_force_invalid (gda_set_get_holder (params, "pat"));
+  sql = gda_statement_to_sql_extended (stmt, fixture->cnc, params, 0, &used, &error);
+  g_assert_null (sql);
+  g_assert_null (used);
+  g_assert_error (error, GDA_STATEMENT_ERROR, GDA_STATEMENT_PARAM_ERROR);
+  g_clear_error (&error);
+
+  other = gda_set_new_inline (1, "id", G_TYPE_INT, 1);
+  sql = gda_statement_to_sql_extended (stmt, fixture->cnc, other, 0, &used, &error);
+  g_assert_null (sql);
+  g_assert_null (used);
+  g_assert_error (error, GDA_STATEMENT_ERROR, GDA_STATEMENT_PARAM_ERROR);
+  g_clear_error (&error);
+  g_object_unref (other);
+
+  g_object_unref (params);
+  g_object_unref (stmt);
+}
+
+static void
+test_templates_structure (TestObjectFixture *fixture,
+                          G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaStatement *stmt, *other;
+  GdaSqlStatement *sqlst;
+  GdaSet *params, *other_params;
+  gchar *sql;
+
+  stmt = parse_statement (fixture->parser, SELECT_SQL, &params);
+  set_values (params, 1, "abc", 2);
+  check_rendering (stmt, fixture->cnc, params, 0);
+
+  /* changing the statement's structure discards what has been compiled */
+  other = parse_statement (fixture->parser, "DELETE FROM items WHERE id = ##id::int", &other_params);
+  g_object_get (G_OBJECT (other), "structure", &sqlst, NULL);
+  g_object_set (G_OBJECT (stmt), "structure", sqlst, NULL);
+  gda_sql_statement_free (sqlst);
+
+  sql = gda_statement_to_sql_extended (stmt, NULL, params, 0, NULL, NULL);
+  g_assert_cmpstr (sql, ==, "DELETE FROM items WHERE id = 1");
+  g_free (sql);
+  check_rendering (stmt, fixture->cnc, params, 0);
+
+  g_object_unref (other_params);
+  g_object_unref (other);
+  g_object_unref (params);
+  g_object_unref (stmt);
+}
+
+/* renders @stmt and checks if the id parameter has been rendered as NULL */
+static void
+check_null_id (GdaStatement *stmt, GdaConnection *cnc, GdaSet *params, gboolean is_null)
+{
+  GError *error = NULL;
+  gchar *sql;
+
+  sql = gda_statement_to_sql_extended (stmt, cnc, params, 0, NULL, &error);
+  g_assert_no_error (error);
+  g_assert_nonnull (sql);
+  if (is_null)
+    g_assert_nonnull (strstr (sql, "id IS NULL"));
+  else
+    g_assert_null (strstr (sql, "id IS NULL"));
+  g_free (sql);
+}
+
+static void
+test_templates_compilation (TestObjectFixture *fixture,
+                            G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaStatement *stmt;
+  GdaSet *params;
+
+  stmt = parse_statement (fixture->parser, SELECT_SQL, &params);
+  set_values (params, 1, "abc", 2);
+
+  /* a statement rendered only once is not compiled */
+  check_null_id (stmt, fixture->cnc, params, FALSE);
+  g_assert_cmpuint (_gda_statement_get_nb_compiled_templates (stmt), ==, 0);
+  check_null_id (stmt, fixture->cnc, params, FALSE);
+  g_assert_cmpuint (_gda_statement_get_nb_compiled_templates (stmt), ==, 1);
+  check_null_id (stmt, fixture->cnc, params, FALSE);
+  g_assert_cmpuint (_gda_statement_get_nb_compiled_templates (stmt), ==, 1);
+
+  /* the template is compiled again when a parameter becomes NULL, and then used */
+  set_values (params, -1, "abc", 2);
+  check_null_id (stmt, fixture->cnc, params, TRUE);
+  g_assert_cmpuint (_gda_statement_get_nb_compiled_templates (stmt), ==, 2);
+  check_null_id (stmt, fixture->cnc, params, TRUE);
+  g_assert_cmpuint (_gda_statement_get_nb_compiled_templates (stmt), ==, 2);
+
+  /* and again when it is not NULL anymore */
+  set_values (params, 3, "abc", 2);
+  check_null_id (stmt, fixture->cnc, params, FALSE);
+  g_assert_cmpuint (_gda_statement_get_nb_compiled_templates (stmt), ==, 3);
+  check_rendering (stmt, fixture->cnc, params, 0);
+  g_assert_cmpuint (_gda_statement_get_nb_compiled_templates (stmt), ==, 3);
+
+  g_object_unref (params);
+  g_object_unref (stmt);
+}
+
+static void
+test_templates_connections (TestObjectFixture *fixture,
+                            G_GNUC_UNUSED gconstpointer user_data)
+{
+  GdaStatement *stmt;
+  GdaSet *params;
+  gchar *cncstring;
+  guint i;
+
+  stmt = parse_statement (fixture->parser, SELECT_SQL, &params);
+  set_values (params, 1, "abc", 2);
+  cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s", fixture->dbfile);
+  *(strrchr (cncstring, '.')) = 0;
+
+  /* templates compiled for a connection are never used with another one, even if it
+   * has been allocated in place of a finalized one */
+  for (i = 0; i < 3; i++) {
+    GdaConnection *cnc;
+
+    cnc = gda_connection_open_from_string (PROVIDER_NAME, cncstring, NULL,
+                                           GDA_CONNECTION_OPTIONS_NONE, NULL);
+    g_assert_nonnull (cnc);
+    check_null_id (stmt, cnc, params, FALSE);
+    check_null_id (stmt, cnc, params, FALSE);
+    g_assert_cmpuint (_gda_statement_get_nb_compiled_templates (stmt), ==, i + 1);
+    gda_connection_close (cnc, NULL);
+    g_object_unref (cnc);
+  }
+
+  g_free (cncstring);
+  g_object_unref (params);
+  g_object_unref (stmt);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  setlocale (LC_ALL, "");
+  g_test_init (&argc, &argv, NULL);
+  gda_init ();
+
+  g_test_add ("/test-statement-templates/values",
+              TestObjectFixture,
+              NULL,
+              test_templates_start,
+              test_templates_values,
+              test_templates_finish);
+
+  g_test_add ("/test-statement-templates/errors",
+              TestObjectFixture,
+              NULL,
+              test_templates_start,
+              test_templates_errors,
+              test_templates_finish);
+
+  g_test_add ("/test-statement-templates/structure",
+              TestObjectFixture,
+              NULL,
+              test_templates_start,
+              test_templates_structure,
+              test_templates_finish);
+
+  g_test_add ("/test-statement-templates/compilation",
+              TestObjectFixture,
+              NULL,
+              test_templates_start,
+              test_templates_compilation,
+              test_templates_finish);
+
+  g_test_add ("/test-statement-templates/connections",
+              TestObjectFixture,
+              NULL,
+              test_templates_start,
+              test_templates_connections,
+              test_templates_finish);
+
+  return g_test_run ();
+}
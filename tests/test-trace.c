@@ -0,0 +1,208 @@
+/* test-trace.c
+ *
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+#include <glib/gi18n.h>
+#include <locale.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "libgda/libgda.h"
+
+#define PROVIDER_NAME "SQLite"
+#define DB_TEST_BASE "sqlite_trace"
+#define NB_POINTS (GDA_TRACE_POINT_BLOB_WRITE + 1)
+
+typedef struct
+{
+  GMutex mutex;
+  gint begin[NB_POINTS];
+  gint end[NB_POINTS];
+  gboolean freed;
+} TraceCounts;
+
+static void
+trace_func (GdaTracePoint point, GdaTraceEvent event, gpointer object, gint64 value, gpointer data)
+{
+  TraceCounts *counts = (TraceCounts *) data;
+
+  g_assert_cmpint (point, <, NB_POINTS);
+  g_mutex_lock (&counts->mutex);
+  if (event == GDA_TRACE_EVENT_BEGIN)
+    counts->begin[point]++;
+  else
+    counts->end[point]++;
+  g_mutex_unlock (&counts->mutex);
+}
+
+static void
+trace_counts_notify (TraceCounts *counts)
+{
+  counts->freed = TRUE;
+}
+
+static void
+test_trace_pipeline (void)
+{
+  GdaConnection *cnc;
+  GdaDataModel *model;
+  GdaStatement *stmt;
+  GdaSet *params;
+  TraceCounts counts;
+  GError *error = NULL;
+  gchar *cncstring, *dbfile;
+  gint id, i;
+
+  id = g_random_int_range (0, G_MAXINT);
+  cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s_%d", DB_TEST_BASE, id);
+  dbfile = g_strdup_printf ("%s_%d.db", DB_TEST_BASE, id);
+  cnc = gda_connection_open_from_string (PROVIDER_NAME, cncstring, NULL,
+                                         GDA_CONNECTION_OPTIONS_NONE, &error);
+  g_free (cncstring);
+  g_assert_nonnull (cnc);
+
+  g_assert_cmpint (gda_connection_execute_non_select_command (cnc, "CREATE TABLE data (id int, name string)",
+                                                               NULL), !=, -1);
+  g_assert_cmpint (gda_connection_execute_non_select_command (cnc, "INSERT INTO data VALUES (1, 'one')",
+                                                               NULL), !=, -1);
+  g_assert_cmpint (gda_connection_execute_non_select_command (cnc, "INSERT INTO data VALUES (2, 'two')",
+                                                               NULL), !=, -1);
+
+  memset (&counts, 0, sizeof (counts));
+  g_mutex_init (&counts.mutex);
+  gda_trace_set_func (trace_func, &counts, (GDestroyNotify) trace_counts_notify);
+
+  stmt = gda_connection_parse_sql_string (cnc, "SELECT * FROM data WHERE id >= ##id::int",
+                                          &params, &error);
+  g_assert_nonnull (stmt);
+  g_assert_true (gda_set_set_holder_value (params, &error, "id", 1));
+  model = gda_connection_statement_execute_select (cnc, stmt, params, &error);
+  g_assert_nonnull (model);
+  g_assert_cmpint (gda_data_model_get_n_rows (model), ==, 2);
+
+  gda_trace_set_func (NULL, NULL, NULL);
+  g_assert_true (counts.freed);
+
+  g_object_unref (model);
+  g_object_unref (stmt);
+  g_object_unref (params);
+
+  /* every started stage must have ended */
+  for (i = 0; i < NB_POINTS; i++)
+    {
+      g_assert_nonnull (gda_trace_point_to_string (i));
+      g_assert_cmpint (counts.begin[i], ==, counts.end[i]);
+    }
+
+  g_assert_cmpint (counts.begin[GDA_TRACE_POINT_PARSE], >, 0);
+  g_assert_cmpint (counts.begin[GDA_TRACE_POINT_BIND], >, 0);
+  g_assert_cmpint (counts.begin[GDA_TRACE_POINT_EXECUTE], ==, 1);
+  g_assert_cmpint (counts.begin[GDA_TRACE_POINT_ROW_BUILD], >=, 2);
+
+  /* no more events once the function is unset */
+  i = counts.begin[GDA_TRACE_POINT_EXECUTE];
+  g_assert_cmpint (gda_connection_execute_non_select_command (cnc, "DELETE FROM data", NULL), !=, -1);
+  g_assert_cmpint (counts.begin[GDA_TRACE_POINT_EXECUTE], ==, i);
+
+  g_mutex_clear (&counts.mutex);
+  gda_connection_close (cnc, NULL);
+  g_object_unref (cnc);
+  g_unlink (dbfile);
+  g_free (dbfile);
+}
+
+/*
+ * Binding a NULL parameter makes the provider execute a rewritten statement, and binding fails
+ * when parameters are missing: the bind stage must be ended in both cases
+ */
+static void
+test_trace_bind_errors (void)
+{
+  GdaConnection *cnc;
+  GdaDataModel *model;
+  GdaStatement *stmt;
+  GdaSet *params;
+  TraceCounts counts;
+  GError *error = NULL;
+  gchar *cncstring, *dbfile;
+  gint id, i;
+
+  id = g_random_int_range (0, G_MAXINT);
+  cncstring = g_strdup_printf ("DB_DIR=.;DB_NAME=%s_%d", DB_TEST_BASE, id);
+  dbfile = g_strdup_printf ("%s_%d.db", DB_TEST_BASE, id);
+  cnc = gda_connection_open_from_string (PROVIDER_NAME, cncstring, NULL,
+                                         GDA_CONNECTION_OPTIONS_NONE, &error);
+  g_free (cncstring);
+  g_assert_nonnull (cnc);
+
+  g_assert_cmpint (gda_connection_execute_non_select_command (cnc, "CREATE TABLE data (id int, name string)",
+                                                               NULL), !=, -1);
+  g_assert_cmpint (gda_connection_execute_non_select_command (cnc, "INSERT INTO data VALUES (1, 'one')",
+                                                               NULL), !=, -1);
+  g_assert_cmpint (gda_connection_execute_non_select_command (cnc, "INSERT INTO data VALUES (NULL, 'none')",
+                                                               NULL), !=, -1);
+
+  memset (&counts, 0, sizeof (counts));
+  g_mutex_init (&counts.mutex);
+  gda_trace_set_func (trace_func, &counts, (GDestroyNotify) trace_counts_notify);
+
+  /* NULL parameter: "id = NULL" is rewritten as "id IS NULL" */
+  stmt = gda_connection_parse_sql_string (cnc, "SELECT * FROM data WHERE id = ##id::int::null",
+                                          &params, &error);
+  g_assert_nonnull (stmt);
+  g_assert_true (gda_holder_set_value (gda_set_get_holder (params, "id"), NULL, &error));
+  model = gda_connection_statement_execute_select (cnc, stmt, params, &error);
+  g_assert_no_error (error);
+  g_assert_nonnull (model);
+  g_assert_cmpint (gda_data_model_get_n_rows (model), ==, 1);
+  g_object_unref (model);
+  g_object_unref (params);
+
+  /* missing parameters */
+  model = gda_connection_statement_execute_select (cnc, stmt, NULL, &error);
+  g_assert_null (model);
+  g_assert_error (error, GDA_SERVER_PROVIDER_ERROR, GDA_SERVER_PROVIDER_MISSING_PARAM_ERROR);
+  g_clear_error (&error);
+  g_object_unref (stmt);
+
+  gda_trace_set_func (NULL, NULL, NULL);
+  g_assert_true (counts.freed);
+
+  g_assert_cmpint (counts.begin[GDA_TRACE_POINT_BIND], >=, 2);
+  for (i = 0; i < NB_POINTS; i++)
+    g_assert_cmpint (counts.begin[i], ==, counts.end[i]);
+
+  g_mutex_clear (&counts.mutex);
+  gda_connection_close (cnc, NULL);
+  g_object_unref (cnc);
+  g_unlink (dbfile);
+  g_free (dbfile);
+}
+
+gint
+main (gint argc, gchar *argv[])
+{
+  setlocale (LC_ALL,"");
+
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/test-trace/pipeline", test_trace_pipeline);
+  g_test_add_func ("/test-trace/bind-errors", test_trace_bind_errors);
+
+  return g_test_run ();
+}
@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2026 The GNOME Foundation
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#include <stdio.h>
+#include <glib/gstdio.h>
+#include <libgda/libgda.h>
+#include <libgda-ui/libgda-ui.h>
+#include <libgda-ui/internal/gdaui-prefetch-model.h>
+
+/*
+ * Data model with a huge number of rows, which computes its values and counts the
+ * number of rows read
+ */
+#define FAKE_NB_ROWS 100000000
+#define CACHE_SIZE 100
+#define READ_AHEAD (CACHE_SIZE / 4)
+
+#define FAKE_TYPE_MODEL (fake_model_get_type())
+G_DECLARE_FINAL_TYPE (FakeModel, fake_model, FAKE, MODEL, GObject)
+
+struct _FakeModel {
+	GObject    object;
+	GdaColumn *columns[2];
+	GValue    *value;
+	gint       fetches; /* number of rows read, atomic */
+};
+
+static void fake_model_data_model_init (GdaDataModelInterface *iface);
+
+G_DEFINE_TYPE_WITH_CODE (FakeModel, fake_model, G_TYPE_OBJECT,
+			 G_IMPLEMENT_INTERFACE (GDA_TYPE_DATA_MODEL, fake_model_data_model_init))
+
+static void
+fake_model_init (FakeModel *model)
+{
+	gint i;
+	for (i = 0; i < 2; i++) {
+		gchar *name;
+		model->columns[i] = gda_column_new ();
+		gda_column_set_g_type (model->columns[i], G_TYPE_INT);
+		name = g_strdup_printf ("col%d", i);
+		gda_column_set_name (model->columns[i], name);
+		g_free (name);
+	}
+	model->value = gda_value_new (G_TYPE_INT);
+}
+
+static void
+fake_model_finalize (GObject *object)
+{
+	FakeModel *model = FAKE_MODEL (object);
+	g_object_unref (model->columns[0]);
+	g_object_unref (model->columns[1]);
+	gda_value_free (model->value);
+	G_OBJECT_CLASS (fake_model_parent_class)->finalize (object);
+}
+
+static void
+fake_model_class_init (FakeModelClass *klass)
+{
+	G_OBJECT_CLASS (klass)->finalize = fake_model_finalize;
+}
+
+static gint
+fake_model_get_n_rows (G_GNUC_UNUSED GdaDataModel *model)
+{
+	return FAKE_NB_ROWS;
+}
+
+static gint
+fake_model_get_n_columns (G_GNUC_UNUSED GdaDataModel *model)
+{
+	return 2;
+}
+
+static GdaColumn *
+fake_model_describe_column (GdaDataModel *model, gint col)
+{
+	return FAKE_MODEL (model)->columns[col];
+}
+
+static GdaDataModelAccessFlags
+fake_model_get_access_flags (G_GNUC_UNUSED GdaDataModel *model)
+{
+	return GDA_DATA_MODEL_ACCESS_RANDOM;
+}
+
+static const GValue *
+fake_model_get_value_at (GdaDataModel *model, gint col, gint row, G_GNUC_UNUSED GError **error)
+{
+	FakeModel *fmodel = FAKE_MODEL (model);
+	if (col == 0)
+		g_atomic_int_inc (&(fmodel->fetches));
+	g_value_set_int (fmodel->value, col == 0 ? row : -row);
+	return fmodel->value;
+}
+
+static void
+fake_model_data_model_init (GdaDataModelInterface *iface)
+{
+	iface->get_n_rows = fake_model_get_n_rows;
+	iface->get_n_columns = fake_model_get_n_columns;
+	iface->describe_column = fake_model_describe_column;
+	iface->get_access_flags = fake_model_get_access_flags;
+	iface->get_value_at = fake_model_get_value_at;
+}
+
+static gint
+get_int (GdaDataModel *model, gint col, gint row)
+{
+	const GValue *value;
+	GError *error = NULL;
+
+	value = gda_data_model_get_value_at (model, col, row, &error);
+	g_assert_no_error (error);
+	g_assert_nonnull (value);
+	g_assert_true (G_VALUE_HOLDS_INT (value));
+	return g_value_get_int (value);
+}
+
+static void
+test_cache (void)
+{
+	FakeModel *fmodel;
+	GdaDataModel *model;
+	GError *error = NULL;
+	gint i, fetches;
+
+	fmodel = g_object_new (FAKE_TYPE_MODEL, NULL);
+	model = _gdaui_prefetch_model_new (GDA_DATA_MODEL (fmodel), CACHE_SIZE);
+	g_assert_cmpint (gda_data_model_get_n_rows (model), ==, FAKE_NB_ROWS);
+	g_assert_cmpint (gda_data_model_get_n_columns (model), ==, 2);
+
+	/* on demand fetch, followed by reading ahead */
+	g_assert_cmpint (get_int (model, 0, 0), ==, 0);
+	g_assert_cmpint (get_int (model, 1, 0), ==, 0);
+	_gdaui_prefetch_model_wait (GDAUI_PREFETCH_MODEL (model));
+	g_assert_cmpint (g_atomic_int_get (&(fmodel->fetches)), ==, 1 + READ_AHEAD);
+
+	/* rows read ahead are not fetched again, and reading goes on when they are accessed */
+	for (i = 1; i <= READ_AHEAD; i++) {
+		g_assert_cmpint (get_int (model, 0, i), ==, i);
+		g_assert_cmpint (get_int (model, 1, i), ==, -i);
+	}
+	_gdaui_prefetch_model_wait (GDAUI_PREFETCH_MODEL (model));
+	g_assert_cmpint (g_atomic_int_get (&(fmodel->fetches)), ==, 1 + 2 * READ_AHEAD);
+
+	/* last row, nothing to read ahead */
+	g_assert_cmpint (get_int (model, 0, FAKE_NB_ROWS - 1), ==, FAKE_NB_ROWS - 1);
+	_gdaui_prefetch_model_wait (GDAUI_PREFETCH_MODEL (model));
+	g_assert_cmpint (g_atomic_int_get (&(fmodel->fetches)), ==, 2 + 2 * READ_AHEAD);
+
+	g_assert_null (gda_data_model_get_value_at (model, 0, FAKE_NB_ROWS, &error));
+	g_assert_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ROW_OUT_OF_RANGE_ERROR);
+	g_clear_error (&error);
+
+	/* explicit read ahead, backwards access */
+	_gdaui_prefetch_model_prefetch (GDAUI_PREFETCH_MODEL (model), 5000, 5000 + READ_AHEAD - 1);
+	_gdaui_prefetch_model_wait (GDAUI_PREFETCH_MODEL (model));
+	fetches = g_atomic_int_get (&(fmodel->fetches));
+	g_assert_cmpint (fetches, ==, 2 + 3 * READ_AHEAD);
+	for (i = 5000 + READ_AHEAD - 1; i >= 5000; i--)
+		g_assert_cmpint (get_int (model, 0, i), ==, i);
+	_gdaui_prefetch_model_wait (GDAUI_PREFETCH_MODEL (model));
+	g_assert_cmpint (g_atomic_int_get (&(fmodel->fetches)), ==, fetches + READ_AHEAD);
+
+	/* the cache is bounded: row 0 is not kept after many other rows have been accessed */
+	for (i = 10000; i < 10000 + 2 * CACHE_SIZE; i++)
+		g_assert_cmpint (get_int (model, 0, i), ==, i);
+	_gdaui_prefetch_model_wait (GDAUI_PREFETCH_MODEL (model));
+	fetches = g_atomic_int_get (&(fmodel->fetches));
+	g_assert_cmpint (get_int (model, 0, 0), ==, 0);
+	g_assert_cmpint (g_atomic_int_get (&(fmodel->fetches)), ==, fetches + 1);
+
+	g_object_unref (model);
+	g_object_unref (fmodel);
+}
+
+#define CURSOR_NB_ROWS 200
+#define CURSOR_ROW 150
+
+static void
+row_updated_cb (G_GNUC_UNUSED GdaDataModel *model, gint row, gint *updated)
+{
+	g_assert_cmpint (*updated, ==, -1);
+	*updated = row;
+}
+
+/*
+ * Rows of a cursor based data model are read by the worker thread when the reads are deferred
+ */
+static void
+test_deferred (void)
+{
+	GdaConnection *cnc;
+	GdaStatement *stmt;
+	GdaDataModel *cmodel, *model;
+	GError *error = NULL;
+	gchar *cncstring, *dbname, *dbfile;
+	gint i, updated = -1;
+
+	dbname = g_strdup_printf ("check_prefetch_model_%d", g_random_int_range (0, G_MAXINT));
+	cncstring = g_strdup_printf ("DB_DIR=%s;DB_NAME=%s", TOP_BUILD_DIR, dbname);
+	cnc = gda_connection_open_from_string ("SQLite", cncstring, NULL,
+					       GDA_CONNECTION_OPTIONS_NONE, &error);
+	g_free (cncstring);
+	g_assert_no_error (error);
+	g_assert_nonnull (cnc);
+
+	g_assert_cmpint (gda_connection_execute_non_select_command (cnc, "CREATE TABLE data (id INTEGER)",
+								    NULL), !=, -1);
+	g_assert_true (gda_connection_begin_transaction (cnc, NULL, GDA_TRANSACTION_ISOLATION_UNKNOWN, NULL));
+	for (i = 0; i < CURSOR_NB_ROWS; i++) {
+		gchar *sql;
+		sql = g_strdup_printf ("INSERT INTO data VALUES (%d)", i);
+		g_assert_cmpint (gda_connection_execute_non_select_command (cnc, sql, NULL), ==, 1);
+		g_free (sql);
+	}
+	g_assert_true (gda_connection_commit_transaction (cnc, NULL, NULL));
+
+	stmt = gda_connection_parse_sql_string (cnc, "SELECT id FROM data ORDER BY id", NULL, &error);
+	g_assert_no_error (error);
+	cmodel = gda_connection_statement_execute_select_full (cnc, stmt, NULL,
+							       GDA_STATEMENT_MODEL_CURSOR_FORWARD, NULL, &error);
+	g_object_unref (stmt);
+	g_assert_no_error (error);
+	g_assert_nonnull (cmodel);
+
+	model = _gdaui_prefetch_model_new (cmodel, CACHE_SIZE);
+	_gdaui_prefetch_model_set_deferred (GDAUI_PREFETCH_MODEL (model), TRUE);
+	g_signal_connect (model, "row-updated", G_CALLBACK (row_updated_cb), &updated);
+
+	/* the cursor is not moved by the caller... */
+	g_assert_null (gda_data_model_get_value_at (model, 0, CURSOR_ROW, &error));
+	g_assert_error (error, GDA_DATA_MODEL_ERROR, GDA_DATA_MODEL_ACCESS_ERROR);
+	g_clear_error (&error);
+
+	/* ... but by the worker thread, which then notifies the main context */
+	_gdaui_prefetch_model_wait (GDAUI_PREFETCH_MODEL (model));
+	while (g_main_context_iteration (NULL, FALSE));
+	g_assert_cmpint (updated, ==, CURSOR_ROW);
+	g_assert_cmpint (get_int (model, 0, CURSOR_ROW), ==, CURSOR_ROW);
+
+	g_object_unref (model);
+	g_object_unref (cmodel);
+	gda_connection_close (cnc, NULL);
+	g_object_unref (cnc);
+
+	dbfile = g_strdup_printf ("%s/%s.db", TOP_BUILD_DIR, dbname);
+	g_unlink (dbfile);
+	g_free (dbfile);
+	g_free (dbname);
+}
+
+/*
+ * GdauiRawGrid's virtual mode
+ */
+static void
+test_grid (void)
+{
+	FakeModel *fmodel;
+	GdauiRawGrid *grid;
+	GdaDataProxy *proxy;
+	GdaDataModel *model;
+	GtkAdjustment *adj;
+	gint start;
+
+	fmodel = g_object_new (FAKE_TYPE_MODEL, NULL);
+	grid = GDAUI_RAW_GRID (gdaui_raw_grid_new (GDA_DATA_MODEL (fmodel)));
+	g_object_ref_sink (grid);
+	proxy = gdaui_data_proxy_get_proxy (GDAUI_DATA_PROXY (grid));
+	gdaui_raw_grid_set_sample_size (grid, 50);
+
+	gdaui_raw_grid_set_virtual_mode (grid, TRUE);
+	g_assert_cmpint (gda_data_proxy_get_sample_size (proxy), ==, 500);
+
+	/* the data model exposed is the thread safe wrapper */
+	g_object_get (grid, "model", &model, NULL);
+	g_assert_true (GDAUI_IS_PREFETCH_MODEL (model));
+	g_assert_true (_gdaui_prefetch_model_get_model (GDAUI_PREFETCH_MODEL (model)) == GDA_DATA_MODEL (fmodel));
+	g_object_unref (model);
+
+	/* the position among all the rows of the data model */
+	adj = _gdaui_raw_grid_get_virtual_adjustment (grid);
+	g_assert_nonnull (adj);
+	g_assert_cmpfloat (gtk_adjustment_get_upper (adj), ==, FAKE_NB_ROWS);
+	gtk_adjustment_set_value (adj, FAKE_NB_ROWS / 2);
+	start = gda_data_proxy_get_sample_start (proxy);
+	g_assert_cmpint (start, <=, FAKE_NB_ROWS / 2);
+	g_assert_cmpint (start, >, FAKE_NB_ROWS / 2 - 500);
+
+	/* the sample size and the data model are restored */
+	gdaui_raw_grid_set_virtual_mode (grid, FALSE);
+	g_assert_cmpint (gda_data_proxy_get_sample_size (proxy), ==, 50);
+	g_assert_null (_gdaui_raw_grid_get_virtual_adjustment (grid));
+	g_object_get (grid, "model", &model, NULL);
+	g_assert_true (model == GDA_DATA_MODEL (fmodel));
+	g_object_unref (model);
+
+	g_object_unref (grid);
+	g_object_unref (fmodel);
+}
+
+int
+main (int argc, char** argv)
+{
+	gboolean has_display;
+
+	has_display = gtk_init_check (&argc, &argv);
+	gda_init ();
+	gdaui_init ();
+
+	test_cache ();
+	test_deferred ();
+	if (has_display)
+		test_grid ();
+	else
+		g_print ("No display, GdauiRawGrid's virtual mode not tested\n");
+
+	return 0;
+}